@@ -0,0 +1,1005 @@
+/* SDLP benchmark suite.
+ * Every case is calibrated to run for about --target-ms per repetition, warmed
+ * up once and then timed --reps times. Reported per operation (one CRC call,
+ * one frame, one stream chunk): min/p10/p50/p90/max ns, MB/s and TSC
+ * cycles/byte at the median. --csv and --json write the same rows for diffing
+ * across releases (scripts/bench_compare.py). */
+#if !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 199309L /* make bench-amalgamation sets it ahead of sdlp.h */
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sdlp_common.h"
+#include "sdlp_crc_parallel.h"
+#include "sdlp_filter.h"
+#include "sdlp_fixed.h"
+#include "sdlp_internal.h"
+#include "sdlp_randomizer.h"
+#include "sdlp_rs.h"
+#include "sdlp_sync.h"
+#include "sdlp_tc.h"
+#include "sdlp_tm.h"
+#include "sdlp_udp.h"
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#define BENCH_HAVE_UDP 1
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+#define BENCH_MAX_SIZE (1u << 20)
+#define BENCH_MAX_REPS 101
+#define BENCH_MAX_RESULTS 256
+#define BENCH_BURST 64
+#define BENCH_CRC_THREADS 4
+
+typedef uint16_t (*crc16_update_fn)(uint16_t crc, const uint8_t *data, size_t length);
+
+typedef struct {
+    const char *group;
+    const char *name;
+    size_t size;                /* payload bytes (the swept parameter) */
+    size_t bytes;               /* bytes processed per operation, for MB/s */
+    size_t ops_per_call;        /* operations done by one run() iteration */
+    void (*run)(void *ctx, size_t iterations);
+    void *ctx;
+} bench_case_t;
+
+typedef struct {
+    const char *group;
+    const char *name;
+    size_t size;
+    size_t bytes;
+    size_t iterations;
+    int repetitions;
+    double ns[5];               /* min, p10, p50, p90, max per operation */
+    double mb_s;
+    double cycles_per_byte;     /* < 0 without a cycle counter */
+} bench_result_t;
+
+static uint8_t bench_data[BENCH_MAX_SIZE];
+static volatile uint32_t bench_sink;
+
+static int bench_reps = 11;
+static double bench_target_ns = 20e6;
+static const char *bench_filter;
+static bench_result_t bench_results[BENCH_MAX_RESULTS];
+static size_t bench_result_count;
+
+static const size_t crc_sizes[] = {1, 16, 64, 256, 1024, 4096, 65536, BENCH_MAX_SIZE};
+static const size_t frame_sizes[] = {1, 16, 64, 256, 512, TM_MAX_DATA_SIZE};
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint64_t now_cycles(void) {
+#if defined(BENCH_HAVE_TSC)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of sorted values. */
+static double percentile(const double *sorted, int count, int p) {
+    int rank = (p * count + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+static void bench_run_case(const bench_case_t *c) {
+    char label[64];
+
+    snprintf(label, sizeof(label), "%s/%s", c->group, c->name);
+    if ((bench_filter && !strstr(label, bench_filter)) || bench_result_count == BENCH_MAX_RESULTS) {
+        return;
+    }
+
+    /* Calibrate: double the iteration count until one repetition takes long
+     * enough, then scale to the target. The last doubling doubles as warm-up. */
+    size_t iterations = 1;
+    double elapsed = 0.0;
+
+    for (;;) {
+        double t0 = now_ns();
+        c->run(c->ctx, iterations);
+        elapsed = now_ns() - t0;
+        if (elapsed >= bench_target_ns / 8 || iterations >= ((size_t)1 << 40)) {
+            break;
+        }
+        iterations *= 2;
+    }
+    if (elapsed > 0.0 && elapsed < bench_target_ns) {
+        iterations = (size_t)((double)iterations * bench_target_ns / elapsed) + 1;
+    }
+    c->run(c->ctx, iterations);
+
+    double ns[BENCH_MAX_REPS];
+    double cycles[BENCH_MAX_REPS];
+    double ops = (double)iterations * (double)c->ops_per_call;
+
+    for (int r = 0; r < bench_reps; r++) {
+        double t0 = now_ns();
+        uint64_t c0 = now_cycles();
+        c->run(c->ctx, iterations);
+        uint64_t c1 = now_cycles();
+        double t1 = now_ns();
+
+        ns[r] = (t1 - t0) / ops;
+        cycles[r] = (double)(c1 - c0) / ops;
+    }
+
+    qsort(ns, (size_t)bench_reps, sizeof(double), compare_double);
+    qsort(cycles, (size_t)bench_reps, sizeof(double), compare_double);
+
+    bench_result_t *result = &bench_results[bench_result_count++];
+
+    result->group = c->group;
+    result->name = c->name;
+    result->size = c->size;
+    result->bytes = c->bytes;
+    result->iterations = iterations;
+    result->repetitions = bench_reps;
+    result->ns[0] = ns[0];
+    result->ns[1] = percentile(ns, bench_reps, 10);
+    result->ns[2] = percentile(ns, bench_reps, 50);
+    result->ns[3] = percentile(ns, bench_reps, 90);
+    result->ns[4] = ns[bench_reps - 1];
+    result->mb_s = (double)c->bytes / result->ns[2] * 1e3;
+#if defined(BENCH_HAVE_TSC)
+    result->cycles_per_byte = percentile(cycles, bench_reps, 50) / (double)c->bytes;
+#else
+    result->cycles_per_byte = -1.0;
+#endif
+
+    printf("%-28s %8zu %8zu %12.1f %12.1f %12.1f %10.1f %8.3f\n", label, c->size, c->bytes,
+           result->ns[2], result->ns[1], result->ns[3], result->mb_s,
+           result->cycles_per_byte);
+    fflush(stdout);
+}
+
+/* CRC16 */
+
+typedef struct {
+    crc16_update_fn fn;
+    size_t size;
+} crc_ctx_t;
+
+static void run_crc16(void *ctx, size_t iterations) {
+    const crc_ctx_t *c = (const crc_ctx_t *)ctx;
+    uint16_t crc = SDLP_CRC16_INIT;
+
+    for (size_t i = 0; i < iterations; i++) {
+        crc = c->fn(crc, bench_data, c->size);
+    }
+    bench_sink += crc;
+}
+
+static const char *portable_backend_name(void) {
+#if SDLP_CRC16_BACKEND == SDLP_CRC16_BITWISE
+    return "bitwise";
+#elif SDLP_CRC16_BACKEND == SDLP_CRC16_TABLE
+    return "table";
+#elif SDLP_CRC16_BACKEND == SDLP_CRC16_SLICE4
+    return "slice4";
+#else
+    return "slice8";
+#endif
+}
+
+static void bench_crc16(const char *name, crc16_update_fn fn) {
+    for (size_t s = 0; s < sizeof(crc_sizes) / sizeof(crc_sizes[0]); s++) {
+        crc_ctx_t ctx = {fn, crc_sizes[s]};
+        bench_case_t c = {"crc16", name, crc_sizes[s], crc_sizes[s], 1, run_crc16, &ctx};
+
+        bench_run_case(&c);
+    }
+}
+
+static void run_crc16_combine(void *ctx, size_t iterations) {
+    const crc_ctx_t *c = (const crc_ctx_t *)ctx;
+    uint16_t crc = SDLP_CRC16_INIT;
+
+    for (size_t i = 0; i < iterations; i++) {
+        crc = sdlp_crc16_combine(crc, (uint16_t)i, c->size);
+    }
+    bench_sink += crc;
+}
+
+/* Thread start-up included: the split only pays off for large buffers. */
+static void run_crc16_parallel(void *ctx, size_t iterations) {
+    const crc_ctx_t *c = (const crc_ctx_t *)ctx;
+    uint16_t crc = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sdlp_crc16_parallel(bench_data, c->size, BENCH_CRC_THREADS, &crc);
+    }
+    bench_sink += crc;
+}
+
+static void bench_crc16_combine(void) {
+    static const size_t sizes[] = {1024, BENCH_MAX_SIZE};
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        crc_ctx_t ctx = {NULL, sizes[s]};
+        /* Throughput counts the bytes the second CRC covers. */
+        bench_case_t combine = {"crc16", "combine", sizes[s], sizes[s], 1, run_crc16_combine, &ctx};
+
+        bench_run_case(&combine);
+    }
+
+    crc_ctx_t ctx = {NULL, BENCH_MAX_SIZE};
+    bench_case_t parallel = {"crc16", "parallel4", BENCH_MAX_SIZE, BENCH_MAX_SIZE, 1,
+                             run_crc16_parallel, &ctx};
+
+    bench_run_case(&parallel);
+}
+
+/* Fused copy + CRC against memcpy() followed by a CRC pass over the copy. */
+
+typedef uint16_t (*crc16_copy_fn)(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length);
+
+typedef struct {
+    crc16_copy_fn fn; /* NULL: memcpy() + sdlp_crc16_update() */
+    size_t size;
+} crc_copy_ctx_t;
+
+static uint8_t bench_copy[65536];
+
+static void run_crc16_copy(void *ctx, size_t iterations) {
+    const crc_copy_ctx_t *c = (const crc_copy_ctx_t *)ctx;
+    uint16_t crc = SDLP_CRC16_INIT;
+
+    for (size_t i = 0; i < iterations; i++) {
+        if (c->fn) {
+            crc = c->fn(crc, bench_copy, bench_data, c->size);
+        } else {
+            memcpy(bench_copy, bench_data, c->size);
+            crc = sdlp_crc16_update(crc, bench_copy, c->size);
+        }
+    }
+    bench_sink += crc;
+}
+
+static void bench_crc16_copy(const char *name, crc16_copy_fn fn) {
+    for (size_t s = 0; s < sizeof(crc_sizes) / sizeof(crc_sizes[0]); s++) {
+        if (crc_sizes[s] > sizeof(bench_copy)) {
+            break;
+        }
+
+        crc_copy_ctx_t ctx = {fn, crc_sizes[s]};
+        bench_case_t c = {"crc16", name, crc_sizes[s], crc_sizes[s], 1, run_crc16_copy, &ctx};
+
+        bench_run_case(&c);
+    }
+}
+
+/* TM / TC frames */
+
+typedef struct {
+    sdlp_tm_frame_t tm;
+    sdlp_tc_frame_t tc;
+    uint8_t encoded[TM_PRIMARY_HEADER_SIZE + TC_SEGMENT_HEADER_SIZE + TM_MAX_DATA_SIZE +
+                    TM_FRAME_ERROR_CONTROL_SIZE];
+    uint8_t randomized[TM_PRIMARY_HEADER_SIZE + TM_MAX_DATA_SIZE + TM_FRAME_ERROR_CONTROL_SIZE];
+    uint8_t template_buffer[TM_PRIMARY_HEADER_SIZE + TM_MAX_DATA_SIZE + TM_FRAME_ERROR_CONTROL_SIZE];
+    sdlp_tm_template_t tmpl;
+    sdlp_tm_filter_t filter;
+    sdlp_iovec_t iov[3]; /* packet header, body, trailer of the data field */
+    uint8_t staging[TM_MAX_DATA_SIZE];
+    size_t encoded_size;
+    size_t size;
+    sdlp_frame_desc_t burst[BENCH_BURST];
+    sdlp_tm_frame_view_t tm_views[BENCH_BURST];
+    sdlp_tc_frame_view_t tc_views[BENCH_BURST];
+    int results[BENCH_BURST];
+} frame_ctx_t;
+
+static frame_ctx_t frame_ctx;
+
+static void run_tm_encode(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    size_t size = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        c->tm.data[0] = (uint8_t)i;
+        sdlp_tm_encode_frame(&c->tm, c->encoded, sizeof(c->encoded), &size);
+    }
+    bench_sink += (uint32_t)size;
+}
+
+/* Data field in three pieces, gathered by the encoder. */
+static void run_tm_encode_iov(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    size_t size = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sdlp_tm_encode_iov(0x1AB, 3, c->iov, 3, c->encoded, sizeof(c->encoded), &size);
+    }
+    bench_sink += (uint32_t)size;
+}
+
+/* The same pieces concatenated into a staging buffer first; compare with tm/encode_iov. */
+static void run_tm_encode_staged(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    size_t size = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        size_t length = 0;
+
+        for (size_t s = 0; s < 3; s++) {
+            memcpy(&c->staging[length], c->iov[s].data, c->iov[s].length);
+            length += c->iov[s].length;
+        }
+        sdlp_tm_create_frame(&c->tm, 0x1AB, 3, c->staging, (uint16_t)length);
+        sdlp_tm_encode_frame(&c->tm, c->encoded, sizeof(c->encoded), &size);
+    }
+    bench_sink += (uint32_t)size;
+}
+
+/* New frame counts into a cached frame; compare with tm/encode. */
+static void run_tm_template_counts(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sdlp_tm_template_set_counts(&c->tmpl, (uint8_t)i, (uint8_t)(i >> 8));
+    }
+    bench_sink += c->tmpl.buffer[c->tmpl.frame_length - 1u];
+}
+
+/* Counts plus an 8-byte housekeeping value at the start of the data field. */
+static void run_tm_template_patch(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    size_t length = c->size < 8u ? c->size : 8u;
+
+    for (size_t i = 0; i < iterations; i++) {
+        uint64_t value = i;
+
+        sdlp_tm_template_set_counts(&c->tmpl, (uint8_t)i, (uint8_t)(i >> 8));
+        sdlp_tm_template_patch(&c->tmpl, TM_PRIMARY_HEADER_SIZE, (const uint8_t *)&value, length);
+    }
+    bench_sink += c->tmpl.buffer[c->tmpl.frame_length - 1u];
+}
+
+/* Encode + randomize in one pass; compare with tm/encode. */
+static void run_tm_encode_randomized(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    size_t size = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        c->tm.data[0] = (uint8_t)i;
+        sdlp_tm_encode_frame_randomized(&c->tm, c->encoded, sizeof(c->encoded), &size);
+    }
+    bench_sink += (uint32_t)size;
+}
+
+static void run_tm_decode_randomized(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    int sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sink += sdlp_tm_decode_frame_randomized(c->randomized, c->encoded_size, &c->tm);
+    }
+    bench_sink += (uint32_t)sink;
+}
+
+static void run_tm_build(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    sdlp_tm_builder_t builder;
+    size_t size = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sdlp_tm_builder_begin(&builder, c->encoded, sizeof(c->encoded), 0x1AB, 3);
+        memcpy(builder.data, bench_data, c->size);
+        sdlp_tm_builder_commit(&builder, (uint16_t)c->size, &size);
+    }
+    bench_sink += (uint32_t)size;
+}
+
+static void run_tm_decode(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    int sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sink += sdlp_tm_decode_frame(c->encoded, c->encoded_size, &c->tm);
+    }
+    bench_sink += (uint32_t)sink;
+}
+
+static void run_tm_decode_view(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    int sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sink += sdlp_tm_decode_view(c->encoded, c->encoded_size, &c->tm_views[0], 1);
+    }
+    bench_sink += (uint32_t)sink;
+}
+
+/* Fixed-length encoder and decoder per frame_sizes entry (sdlp_fixed.h);
+ * compare with tm/encode and tm/decode_view. */
+#define BENCH_TM_FIXED(tag, length)                                                             \
+    SDLP_TM_FIXED_DEFINE(bench_tm_##tag, length)                                                \
+                                                                                                \
+    static void run_tm_encode_fixed_##tag(void *ctx, size_t iterations) {                       \
+        frame_ctx_t *c = (frame_ctx_t *)ctx;                                                    \
+        size_t size = 0;                                                                        \
+                                                                                                \
+        for (size_t i = 0; i < iterations; i++) {                                               \
+            c->tm.data[0] = (uint8_t)i;                                                         \
+            size = bench_tm_##tag##_encode(&c->tm.header, c->tm.data, c->encoded);              \
+        }                                                                                       \
+        bench_sink += (uint32_t)size;                                                           \
+    }                                                                                           \
+                                                                                                \
+    static void run_tm_decode_fixed_##tag(void *ctx, size_t iterations) {                       \
+        frame_ctx_t *c = (frame_ctx_t *)ctx;                                                    \
+        int sink = 0;                                                                           \
+                                                                                                \
+        for (size_t i = 0; i < iterations; i++) {                                               \
+            sink += bench_tm_##tag##_decode(c->encoded, &c->tm_views[0]);                       \
+        }                                                                                       \
+        bench_sink += (uint32_t)sink;                                                           \
+    }
+
+BENCH_TM_FIXED(1, 1)
+BENCH_TM_FIXED(16, 16)
+BENCH_TM_FIXED(64, 64)
+BENCH_TM_FIXED(256, 256)
+BENCH_TM_FIXED(512, 512)
+BENCH_TM_FIXED(max, TM_MAX_DATA_SIZE)
+
+/* In frame_sizes order. */
+static void (*const tm_encode_fixed[])(void *, size_t) = {
+    run_tm_encode_fixed_1, run_tm_encode_fixed_16, run_tm_encode_fixed_64,
+    run_tm_encode_fixed_256, run_tm_encode_fixed_512, run_tm_encode_fixed_max,
+};
+static void (*const tm_decode_fixed[])(void *, size_t) = {
+    run_tm_decode_fixed_1, run_tm_decode_fixed_16, run_tm_decode_fixed_64,
+    run_tm_decode_fixed_256, run_tm_decode_fixed_512, run_tm_decode_fixed_max,
+};
+
+static void run_tm_decode_batch(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    int sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sdlp_tm_decode_batch(c->burst, BENCH_BURST, c->tm_views, c->results);
+        sink += c->results[i % BENCH_BURST];
+    }
+    bench_sink += (uint32_t)sink;
+}
+
+static void run_tm_peek_header(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    sdlp_tm_header_t header = {0};
+    uint32_t sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        const sdlp_frame_desc_t *frame = &c->burst[i % BENCH_BURST];
+
+        sdlp_tm_peek_header(frame->buffer, frame->length, &header);
+        sink += header.virtual_channel_id;
+    }
+    bench_sink += sink;
+}
+
+/* The bench frames are for a spacecraft the filter does not accept. */
+static void run_tm_filter_reject(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    uint32_t sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        for (size_t f = 0; f < BENCH_BURST; f++) {
+            sink += (uint32_t)sdlp_tm_filter_accept(&c->filter, c->burst[f].buffer);
+        }
+    }
+    bench_sink += sink;
+}
+
+static void run_tc_encode(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    size_t size = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        c->tc.data[0] = (uint8_t)i;
+        sdlp_tc_encode_frame(&c->tc, c->encoded, sizeof(c->encoded), &size);
+    }
+    bench_sink += (uint32_t)size;
+}
+
+static void run_tc_decode(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    int sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sink += sdlp_tc_decode_frame(c->encoded, c->encoded_size, &c->tc);
+    }
+    bench_sink += (uint32_t)sink;
+}
+
+static void run_tc_decode_batch(void *ctx, size_t iterations) {
+    frame_ctx_t *c = (frame_ctx_t *)ctx;
+    int sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sdlp_tc_decode_batch(c->burst, BENCH_BURST, c->tc_views, c->results);
+        sink += c->results[i % BENCH_BURST];
+    }
+    bench_sink += (uint32_t)sink;
+}
+
+/* Encode one valid frame of the given payload size and point a burst of
+ * BENCH_BURST descriptors at copies of it spread over bench_data. */
+static void frame_setup(frame_ctx_t *c, size_t size, int tc) {
+    static uint8_t burst_frames[BENCH_BURST][sizeof(frame_ctx.encoded)];
+
+    c->size = size;
+    if (tc) {
+        sdlp_tc_create_frame(&c->tc, 0x1AB, 3, 0, bench_data, (uint16_t)size);
+        sdlp_tc_encode_frame(&c->tc, c->encoded, sizeof(c->encoded), &c->encoded_size);
+    } else {
+        sdlp_tm_create_frame(&c->tm, 0x1AB, 3, bench_data, (uint16_t)size);
+        sdlp_tm_encode_frame(&c->tm, c->encoded, sizeof(c->encoded), &c->encoded_size);
+        sdlp_randomize_copy(c->randomized, c->encoded, c->encoded_size);
+        sdlp_tm_template_init(&c->tmpl, &c->tm, c->template_buffer, sizeof(c->template_buffer));
+        sdlp_tm_filter_init(&c->filter);
+        sdlp_tm_filter_add(&c->filter, 0x1AC, SDLP_FILTER_ALL_VCS);
+
+        size_t head = size < 6u ? size : 6u;
+        size_t tail = size - head < 2u ? size - head : 2u;
+
+        c->iov[0] = (sdlp_iovec_t){bench_data, head};
+        c->iov[1] = (sdlp_iovec_t){&bench_data[BENCH_MAX_SIZE / 2], size - head - tail};
+        c->iov[2] = (sdlp_iovec_t){&bench_data[BENCH_MAX_SIZE - tail], tail};
+    }
+
+    for (size_t i = 0; i < BENCH_BURST; i++) {
+        memcpy(burst_frames[i], c->encoded, c->encoded_size);
+        c->burst[i].buffer = burst_frames[i];
+        c->burst[i].length = c->encoded_size;
+    }
+}
+
+static void bench_frames(void) {
+    for (size_t s = 0; s < sizeof(frame_sizes) / sizeof(frame_sizes[0]); s++) {
+        size_t size = frame_sizes[s];
+
+        frame_setup(&frame_ctx, size, 0);
+        size_t bytes = frame_ctx.encoded_size;
+        bench_case_t tm_cases[] = {
+            {"tm", "encode", size, bytes, 1, run_tm_encode, &frame_ctx},
+            {"tm", "encode_fixed", size, bytes, 1, tm_encode_fixed[s], &frame_ctx},
+            {"tm", "build", size, bytes, 1, run_tm_build, &frame_ctx},
+            {"tm", "encode_iov", size, bytes, 1, run_tm_encode_iov, &frame_ctx},
+            {"tm", "encode_staged", size, bytes, 1, run_tm_encode_staged, &frame_ctx},
+            {"tm", "decode", size, bytes, 1, run_tm_decode, &frame_ctx},
+            {"tm", "decode_view", size, bytes, 1, run_tm_decode_view, &frame_ctx},
+            {"tm", "decode_fixed", size, bytes, 1, tm_decode_fixed[s], &frame_ctx},
+            {"tm", "decode_batch", size, bytes, BENCH_BURST, run_tm_decode_batch, &frame_ctx},
+            {"tm", "peek_header", size, bytes, 1, run_tm_peek_header, &frame_ctx},
+            {"tm", "filter_reject", size, bytes, BENCH_BURST, run_tm_filter_reject, &frame_ctx},
+            {"tm", "template_counts", size, bytes, 1, run_tm_template_counts, &frame_ctx},
+            {"tm", "template_patch8", size, bytes, 1, run_tm_template_patch, &frame_ctx},
+            {"tm", "encode_randomized", size, bytes, 1, run_tm_encode_randomized, &frame_ctx},
+            {"tm", "decode_randomized", size, bytes, 1, run_tm_decode_randomized, &frame_ctx},
+        };
+        for (size_t i = 0; i < sizeof(tm_cases) / sizeof(tm_cases[0]); i++) {
+            bench_run_case(&tm_cases[i]);
+        }
+
+        frame_setup(&frame_ctx, size, 1);
+        bytes = frame_ctx.encoded_size;
+        bench_case_t tc_cases[] = {
+            {"tc", "encode", size, bytes, 1, run_tc_encode, &frame_ctx},
+            {"tc", "decode", size, bytes, 1, run_tc_decode, &frame_ctx},
+            {"tc", "decode_batch", size, bytes, BENCH_BURST, run_tc_decode_batch, &frame_ctx},
+        };
+        for (size_t i = 0; i < sizeof(tc_cases) / sizeof(tc_cases[0]); i++) {
+            bench_run_case(&tc_cases[i]);
+        }
+    }
+}
+
+#if defined(BENCH_HAVE_UDP)
+/* UDP frame ingest on 127.0.0.1: each call sends the burst with sendmmsg()
+ * (send() for udp/send) and receives and decodes it. A datagram lost to a
+ * full socket buffer ends the call when the receive timeout expires. */
+
+typedef struct {
+    frame_ctx_t *frames;
+    int rx_fd;
+    int tx_fd;
+    sdlp_udp_rx_t rx;
+    uint8_t datagram[sizeof(frame_ctx.encoded)];
+} udp_ctx_t;
+
+static udp_ctx_t udp_ctx;
+
+static void udp_send_burst(udp_ctx_t *c) {
+    size_t sent;
+
+    sdlp_udp_send(c->tx_fd, c->frames->burst, BENCH_BURST, &sent);
+}
+
+/* One recv() and one sdlp_tm_decode_frame() per datagram. */
+static void run_udp_recv(void *ctx, size_t iterations) {
+    udp_ctx_t *c = (udp_ctx_t *)ctx;
+    int sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        udp_send_burst(c);
+        for (size_t f = 0; f < BENCH_BURST; f++) {
+            ssize_t length = recv(c->rx_fd, c->datagram, sizeof(c->datagram), 0);
+
+            if (length < 0) {
+                break;
+            }
+            sink += sdlp_tm_decode_frame(c->datagram, (size_t)length, &c->frames->tm);
+        }
+    }
+    bench_sink += (uint32_t)sink;
+}
+
+static void udp_recv_burst(udp_ctx_t *c, int *sink) {
+    const sdlp_frame_desc_t *frames;
+    size_t count;
+
+    for (size_t f = 0; f < BENCH_BURST; f += count) {
+        if (sdlp_udp_rx_recv(&c->rx, 1, &frames, &count) != SDLP_SUCCESS || count == 0) {
+            break;
+        }
+        sdlp_tm_decode_batch(frames, count, c->frames->tm_views, c->frames->results);
+        *sink += c->frames->results[count - 1];
+        sdlp_udp_rx_release(&c->rx, count);
+    }
+}
+
+/* The ring filled by recvmmsg() and decoded in place by sdlp_tm_decode_batch(). */
+static void run_udp_recvmmsg(void *ctx, size_t iterations) {
+    udp_ctx_t *c = (udp_ctx_t *)ctx;
+    int sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        udp_send_burst(c);
+        udp_recv_burst(c, &sink);
+    }
+    bench_sink += (uint32_t)sink;
+}
+
+/* As udp/recvmmsg, sending one datagram per send(). */
+static void run_udp_send(void *ctx, size_t iterations) {
+    udp_ctx_t *c = (udp_ctx_t *)ctx;
+    int sink = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        for (size_t f = 0; f < BENCH_BURST; f++) {
+            send(c->tx_fd, c->frames->burst[f].buffer, c->frames->burst[f].length, 0);
+        }
+        udp_recv_burst(c, &sink);
+    }
+    bench_sink += (uint32_t)sink;
+}
+
+static int udp_open(udp_ctx_t *c) {
+    struct sockaddr_in address;
+    socklen_t address_length = sizeof(address);
+    struct timeval timeout = {1, 0};
+    int buffer_size = 4 << 20;
+
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    c->rx_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    c->tx_fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (c->rx_fd < 0 || c->tx_fd < 0 ||
+        bind(c->rx_fd, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+        getsockname(c->rx_fd, (struct sockaddr *)&address, &address_length) != 0 ||
+        connect(c->tx_fd, (struct sockaddr *)&address, sizeof(address)) != 0) {
+        return -1;
+    }
+    setsockopt(c->rx_fd, SOL_SOCKET, SO_RCVBUF, &buffer_size, sizeof(buffer_size));
+    setsockopt(c->rx_fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    sdlp_udp_config_t config = {4u * BENCH_BURST, sizeof(c->datagram), BENCH_BURST};
+
+    return sdlp_udp_rx_init(&c->rx, c->rx_fd, &config) == SDLP_SUCCESS ? 0 : -1;
+}
+
+static void bench_udp(void) {
+    udp_ctx_t *c = &udp_ctx;
+
+    c->frames = &frame_ctx;
+    if (udp_open(c) != 0) {
+        fprintf(stderr, "udp: cannot open loopback sockets, skipped\n");
+        return;
+    }
+
+    for (size_t s = 0; s < sizeof(frame_sizes) / sizeof(frame_sizes[0]); s++) {
+        size_t size = frame_sizes[s];
+
+        frame_setup(&frame_ctx, size, 0);
+        size_t bytes = frame_ctx.encoded_size;
+        bench_case_t cases[] = {
+            {"udp", "recv", size, bytes, BENCH_BURST, run_udp_recv, c},
+            {"udp", "recvmmsg", size, bytes, BENCH_BURST, run_udp_recvmmsg, c},
+            {"udp", "send", size, bytes, BENCH_BURST, run_udp_send, c},
+        };
+        for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+            bench_run_case(&cases[i]);
+        }
+    }
+
+    sdlp_udp_rx_free(&c->rx);
+    close(c->rx_fd);
+    close(c->tx_fd);
+}
+#endif
+
+/* ASM synchronizer */
+
+typedef struct {
+    sdlp_sync_t sync;
+    const uint8_t *stream;
+    size_t length;
+} sync_ctx_t;
+
+static void bench_sync_frame(void *user, const uint8_t *frame, size_t frame_length,
+                             sdlp_sync_state_t state) {
+    (void)user;
+    (void)state;
+    bench_sink += frame[frame_length - 1];
+}
+
+static void run_sync(void *ctx, size_t iterations) {
+    sync_ctx_t *c = (sync_ctx_t *)ctx;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sdlp_sync_process(&c->sync, c->stream, c->length);
+    }
+}
+
+static void bench_sync(const char *name, const uint8_t *stream, size_t length) {
+    static uint8_t frame_buffer[1115];
+    static sync_ctx_t ctx;
+    sdlp_sync_config_t config = {sizeof(frame_buffer), frame_buffer, 1, 2, 2, bench_sync_frame, NULL};
+    bench_case_t c = {"sync", name, length, length, 1, run_sync, &ctx};
+
+    sdlp_sync_init(&ctx.sync, &config);
+    ctx.stream = stream;
+    ctx.length = length;
+    bench_run_case(&c);
+}
+
+/* Reed-Solomon */
+
+typedef struct {
+    sdlp_rs_config_t config;
+    uint8_t block[SDLP_RS_MAX_INTERLEAVE * SDLP_RS_N];
+    size_t length;
+} rs_ctx_t;
+
+static void run_rs_encode(void *ctx, size_t iterations) {
+    rs_ctx_t *c = (rs_ctx_t *)ctx;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sdlp_rs_encode(&c->config, c->block, c->length);
+    }
+    bench_sink += c->block[c->length - 1u];
+}
+
+static void run_rs_decode(void *ctx, size_t iterations) {
+    rs_ctx_t *c = (rs_ctx_t *)ctx;
+    int corrected = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        sdlp_rs_decode(&c->config, c->block, c->length, &corrected);
+    }
+    bench_sink += (uint32_t)corrected;
+}
+
+/* 16 errors in every codeword, injected again before each decode. */
+static void run_rs_decode_errors(void *ctx, size_t iterations) {
+    rs_ctx_t *c = (rs_ctx_t *)ctx;
+    int corrected = 0;
+
+    for (size_t i = 0; i < iterations; i++) {
+        for (size_t e = 0; e < SDLP_RS_MAX_ERRORS * c->config.interleave; e++) {
+            c->block[e * 13u] ^= 0x5Au;
+        }
+        sdlp_rs_decode(&c->config, c->block, c->length, &corrected);
+    }
+    bench_sink += (uint32_t)corrected;
+}
+
+static void bench_rs(void) {
+    static const uint8_t depths[] = {1, 5};
+    static rs_ctx_t ctx;
+
+    for (size_t d = 0; d < sizeof(depths) / sizeof(depths[0]); d++) {
+        ctx.config = (sdlp_rs_config_t){depths[d], 1, 0};
+        ctx.length = sdlp_rs_codeblock_length(&ctx.config);
+        memcpy(ctx.block, bench_data, ctx.length);
+
+        size_t data = sdlp_rs_data_length(&ctx.config);
+        bench_case_t cases[] = {
+            {"rs", "encode", data, data, 1, run_rs_encode, &ctx},
+            {"rs", "decode_clean", data, data, 1, run_rs_decode, &ctx},
+            {"rs", "decode_16err", data, data, 1, run_rs_decode_errors, &ctx},
+        };
+
+        for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+            bench_run_case(&cases[i]);
+        }
+    }
+}
+
+/* Output */
+
+static int write_csv(const char *path) {
+    FILE *f = fopen(path, "w");
+
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "group,name,size,bytes,iterations,repetitions,ns_min,ns_p10,ns_p50,ns_p90,ns_max,"
+               "mb_s,cycles_per_byte\n");
+    for (size_t i = 0; i < bench_result_count; i++) {
+        const bench_result_t *r = &bench_results[i];
+
+        fprintf(f, "%s,%s,%zu,%zu,%zu,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,", r->group, r->name, r->size,
+                r->bytes, r->iterations, r->repetitions, r->ns[0], r->ns[1], r->ns[2], r->ns[3],
+                r->ns[4], r->mb_s);
+        if (r->cycles_per_byte >= 0.0) {
+            fprintf(f, "%.4f", r->cycles_per_byte);
+        }
+        fprintf(f, "\n");
+    }
+
+    return fclose(f) != 0;
+}
+
+static int write_json(const char *path) {
+    FILE *f = fopen(path, "w");
+
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+
+    fprintf(f, "{\n  \"crc16_backend\": \"%s\",\n  \"results\": [\n", portable_backend_name());
+    for (size_t i = 0; i < bench_result_count; i++) {
+        const bench_result_t *r = &bench_results[i];
+
+        fprintf(f, "    {\"group\": \"%s\", \"name\": \"%s\", \"size\": %zu, \"bytes\": %zu, "
+                   "\"iterations\": %zu, \"repetitions\": %d, \"ns_min\": %.3f, \"ns_p10\": %.3f, "
+                   "\"ns_p50\": %.3f, \"ns_p90\": %.3f, \"ns_max\": %.3f, \"mb_s\": %.3f, ",
+                r->group, r->name, r->size, r->bytes, r->iterations, r->repetitions, r->ns[0],
+                r->ns[1], r->ns[2], r->ns[3], r->ns[4], r->mb_s);
+        if (r->cycles_per_byte >= 0.0) {
+            fprintf(f, "\"cycles_per_byte\": %.4f}", r->cycles_per_byte);
+        } else {
+            fprintf(f, "\"cycles_per_byte\": null}");
+        }
+        fprintf(f, "%s\n", i + 1 < bench_result_count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+
+    return fclose(f) != 0;
+}
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--csv FILE] [--json FILE] [--filter GROUP/NAME] [--reps N] [--target-ms MS]\n",
+            argv0);
+}
+
+int main(int argc, char **argv) {
+    const char *csv_path = NULL;
+    const char *json_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "--csv") == 0) {
+            csv_path = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--json") == 0) {
+            json_path = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--filter") == 0) {
+            bench_filter = argv[++i];
+        } else if (i + 1 < argc && strcmp(argv[i], "--reps") == 0) {
+            bench_reps = atoi(argv[++i]);
+        } else if (i + 1 < argc && strcmp(argv[i], "--target-ms") == 0) {
+            bench_target_ns = atof(argv[++i]) * 1e6;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (bench_reps < 1 || bench_reps > BENCH_MAX_REPS || bench_target_ns <= 0.0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    uint32_t seed = 1;
+    for (size_t i = 0; i < sizeof(bench_data); i++) {
+        seed = seed * 1103515245u + 12345u;
+        bench_data[i] = (uint8_t)(seed >> 16);
+    }
+
+    printf("crc16 backend: %s, %d repetitions, %.0f ms each\n", portable_backend_name(), bench_reps,
+           bench_target_ns / 1e6);
+    printf("%-28s %8s %8s %12s %12s %12s %10s %8s\n", "case", "size", "bytes", "ns/op p50",
+           "p10", "p90", "MB/s", "cyc/B");
+
+    bench_crc16(portable_backend_name(), sdlp_crc16_update_portable);
+#if defined(SDLP_CRC16_CLMUL)
+    if (sdlp_crc16_clmul_supported()) {
+        bench_crc16("clmul", sdlp_crc16_update_clmul);
+    }
+#endif
+    bench_crc16("dispatch", sdlp_crc16_update);
+    bench_crc16_combine();
+    bench_crc16_copy("memcpy_update", NULL);
+    bench_crc16_copy("copy_portable", sdlp_crc16_copy_portable);
+#if defined(SDLP_CRC16_CLMUL)
+    if (sdlp_crc16_clmul_supported()) {
+        bench_crc16_copy("copy_clmul", sdlp_crc16_copy_clmul);
+    }
+#endif
+    bench_crc16_copy("copy", sdlp_crc16_copy);
+
+    bench_frames();
+#if defined(BENCH_HAVE_UDP)
+    bench_udp();
+#endif
+
+    /* Random data never locks; a marker every 1119 bytes locks immediately. */
+    bench_sync("search", bench_data, BENCH_MAX_SIZE);
+    static uint8_t locked[1119 * 64];
+    for (size_t f = 0; f < 64; f++) {
+        uint8_t *p = &locked[f * 1119];
+        p[0] = 0x1A;
+        p[1] = 0xCF;
+        p[2] = 0xFC;
+        p[3] = 0x1D;
+        memcpy(&p[4], &bench_data[f * 1115], 1115);
+    }
+    bench_sync("locked", locked, sizeof(locked));
+
+    bench_rs();
+
+    int failed = 0;
+
+    if (csv_path) {
+        failed |= write_csv(csv_path);
+    }
+    if (json_path) {
+        failed |= write_json(json_path);
+    }
+
+    return failed;
+}
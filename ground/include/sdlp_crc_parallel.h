@@ -0,0 +1,17 @@
+#ifndef SDLP_CRC_PARALLEL_H
+#define SDLP_CRC_PARALLEL_H
+
+#include "sdlp_common.h"
+
+/* Pieces shorter than this are not worth a thread: starting one costs about
+ * as much as checksumming a few hundred KB with the CLMUL kernel. */
+#define SDLP_CRC16_PARALLEL_MIN_CHUNK (256u * 1024u)
+#define SDLP_CRC16_PARALLEL_MAX_THREADS 64u
+
+/* sdlp_crc16() of a large buffer, such as a mapped pass recording, split over
+ * up to threads threads (the caller's included). The partial CRCs are merged
+ * with sdlp_crc16_combine(), so the result is that of one sequential pass. If
+ * a thread cannot be started its piece is checksummed by the caller. */
+int sdlp_crc16_parallel(const uint8_t *data, size_t length, unsigned threads, uint16_t *crc);
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef SDLP_PIPELINE_H
+#define SDLP_PIPELINE_H
+
+#include <pthread.h>
+
+#include "sdlp_filter.h"
+#include "sdlp_packet.h"
+#include "sdlp_spsc.h"
+#include "sdlp_sync.h"
+
+/* Multi-threaded TM receive pipeline for ground stations (not flight code):
+ *
+ *   caller:   sync -> frame pool slot --ring--> check thread
+ *   check:    batch decode + FECF check --ring per worker--> workers
+ *   workers:  per-VC packet extraction -> on_packet
+ *
+ * Virtual channels are sharded onto workers by VC % worker_count, and each
+ * worker may hold at most frame_slots / worker_count slots, so a saturated VC
+ * only occupies its own worker and its own share of the pool. Frames travel as
+ * pool slot indices; workers hand slots back to the caller over their own rings. */
+#define SDLP_PIPELINE_MAX_WORKERS TM_MAX_VIRTUAL_CHANNELS
+#define SDLP_PIPELINE_BURST 32
+#define SDLP_PIPELINE_WAIT_FOREVER UINT32_MAX   /* stall_timeout_us: never drop */
+
+/* Called from the worker owning virtual_channel_id, so packets of one VC are
+ * delivered in order and never concurrently; different VCs may be delivered
+ * in parallel. packet is valid only for the duration of the call. */
+typedef void (*sdlp_pipeline_packet_cb)(void *user, uint8_t virtual_channel_id,
+                                        const uint8_t *packet, size_t length);
+
+typedef struct {
+    size_t frame_length;            /* TM transfer frame length, ASM excluded */
+    uint32_t frame_slots;           /* frames in flight, power of two, >= worker_count */
+    uint8_t worker_count;           /* 1..SDLP_PIPELINE_MAX_WORKERS */
+    size_t max_packet_length;       /* per-VC reassembly buffer */
+    uint8_t check_threshold;        /* synchronizer settings, see sdlp_sync_config_t */
+    uint8_t flywheel;
+    uint8_t max_marker_errors;
+    uint8_t randomized;             /* CCSDS randomized link: derandomized into the pool */
+    sdlp_pipeline_packet_cb on_packet;
+    void *user;
+    const sdlp_tm_filter_t *filter; /* optional: rejected frames are dropped before the copy */
+    uint32_t stall_timeout_us;      /* wait for a worker with no slot left before dropping
+                                     * its frame; every VC waits meanwhile */
+} sdlp_pipeline_config_t;
+
+/* Each counter is written by one stage only; read them after sdlp_pipeline_stop(). */
+typedef struct {
+    uint32_t frames;                /* frames entering the pipeline */
+    uint32_t filtered;              /* frames dropped by config.filter */
+    uint32_t stalls;                /* frames whose worker had no slot left */
+    uint32_t dropped;               /* of those, not taken within stall_timeout_us */
+    uint32_t crc_errors;
+    uint32_t invalid_frames;
+    uint32_t vc_frames[TM_MAX_VIRTUAL_CHANNELS];
+    uint32_t vc_dropped[TM_MAX_VIRTUAL_CHANNELS];   /* by header VC, before the FECF check */
+} sdlp_pipeline_stats_t;
+
+/* Where an idle stage sleeps after a short spin; the stage feeding it only
+ * takes the lock when waiting is set. */
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    atomic_int waiting;
+} sdlp_pipeline_event_t;
+
+typedef struct sdlp_pipeline sdlp_pipeline_t;
+
+typedef struct {
+    sdlp_spsc_ring_t work;          /* check -> worker */
+    sdlp_spsc_ring_t done;          /* worker -> caller, slots to reuse */
+    sdlp_pipeline_event_t work_ready;
+    sdlp_pipeline_t *pipeline;
+    pthread_t thread;
+    uint8_t current_vc;             /* VC of the frame being extracted */
+    sdlp_packet_extractor_t extractors[TM_MAX_VIRTUAL_CHANNELS];   /* VCs of this worker only */
+} sdlp_pipeline_worker_t;
+
+struct sdlp_pipeline {
+    sdlp_pipeline_config_t config;
+    sdlp_pipeline_stats_t stats;
+    sdlp_packet_extractor_stats_t vc_stats[TM_MAX_VIRTUAL_CHANNELS];   /* filled by stop */
+    sdlp_sync_t sync;
+    sdlp_spsc_ring_t input;         /* caller -> check */
+    sdlp_spsc_ring_t rejected;      /* check -> caller, slots of bad frames */
+    sdlp_pipeline_event_t input_ready;
+    sdlp_pipeline_event_t slots_ready;  /* done or rejected pushed, for a stalled caller */
+    sdlp_pipeline_worker_t workers[SDLP_PIPELINE_MAX_WORKERS];
+    pthread_t check_thread;
+    uint8_t *pool;                  /* frame_slots * frame_length bytes */
+    uint8_t *sync_buffer;
+    uint8_t *reassembly;
+    sdlp_frame_ref_t *ring_entries;
+    uint32_t *free_slots;           /* caller's stack of reusable slots */
+    uint32_t free_count;
+    uint8_t *slot_worker;           /* per slot: worker it is charged to */
+    uint32_t worker_slots;          /* slots each worker may hold */
+    uint32_t in_flight[SDLP_PIPELINE_MAX_WORKERS];
+    int running;
+};
+
+/* Allocate the pipeline and start its threads. SDLP_ERROR_SYSTEM if memory or
+ * threads are not available. */
+int sdlp_pipeline_start(sdlp_pipeline_t *pipeline, const sdlp_pipeline_config_t *config);
+
+/* Feed the next piece of the raw (ASM-framed) stream. A frame whose worker
+ * holds all of its slots waits up to config.stall_timeout_us for one, then is
+ * dropped. */
+int sdlp_pipeline_push(sdlp_pipeline_t *pipeline, const uint8_t *data, size_t length);
+
+/* Feed one already synchronised frame of frame_length bytes. */
+int sdlp_pipeline_push_frame(sdlp_pipeline_t *pipeline, const uint8_t *frame, size_t frame_length);
+
+/* Drain every frame pushed so far, join the threads and free the pipeline's
+ * memory. stats and vc_stats stay readable. */
+int sdlp_pipeline_stop(sdlp_pipeline_t *pipeline);
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef SDLP_SPSC_H
+#define SDLP_SPSC_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SDLP_CACHE_LINE 64
+
+/* Frame descriptor passed between pipeline stages: a slot of the frame pool
+ * and the number of valid bytes in it. */
+typedef struct {
+    uint32_t slot;
+    uint32_t length;
+} sdlp_frame_ref_t;
+
+/* Lock-free single-producer/single-consumer ring of frame descriptors.
+ * head is written only by the producer and tail only by the consumer; each
+ * sits on its own cache line next to the side's cached copy of the other
+ * index, so the line only bounces when the cached value runs out. */
+typedef struct {
+    _Alignas(SDLP_CACHE_LINE) atomic_size_t head;
+    size_t cached_tail;
+    _Alignas(SDLP_CACHE_LINE) atomic_size_t tail;
+    size_t cached_head;
+    _Alignas(SDLP_CACHE_LINE) sdlp_frame_ref_t *entries;
+    size_t mask;
+} sdlp_spsc_ring_t;
+
+/* capacity must be a power of two. */
+static inline void sdlp_spsc_init(sdlp_spsc_ring_t *ring, sdlp_frame_ref_t *entries,
+                                  size_t capacity) {
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    ring->cached_tail = 0;
+    ring->cached_head = 0;
+    ring->entries = entries;
+    ring->mask = capacity - 1u;
+}
+
+/* Producer side. Returns 0 if the ring is full. */
+static inline int sdlp_spsc_push(sdlp_spsc_ring_t *ring, sdlp_frame_ref_t ref) {
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    if (head - ring->cached_tail > ring->mask) {
+        ring->cached_tail = atomic_load_explicit(&ring->tail, memory_order_acquire);
+        if (head - ring->cached_tail > ring->mask) {
+            return 0;
+        }
+    }
+
+    ring->entries[head & ring->mask] = ref;
+    atomic_store_explicit(&ring->head, head + 1u, memory_order_release);
+    return 1;
+}
+
+/* Consumer side. Nonzero if there is nothing to pop. */
+static inline int sdlp_spsc_empty(sdlp_spsc_ring_t *ring) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    if (ring->cached_head != tail) {
+        return 0;
+    }
+    ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+    return ring->cached_head == tail;
+}
+
+/* Consumer side. Moves up to max descriptors to out; returns how many. */
+static inline size_t sdlp_spsc_pop_burst(sdlp_spsc_ring_t *ring, sdlp_frame_ref_t *out,
+                                         size_t max) {
+    size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+    if (ring->cached_head - tail < max) {
+        ring->cached_head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        if (ring->cached_head == tail) {
+            return 0;
+        }
+    }
+
+    size_t count = ring->cached_head - tail;
+
+    if (count > max) {
+        count = max;
+    }
+    for (size_t i = 0; i < count; i++) {
+        out[i] = ring->entries[(tail + i) & ring->mask];
+    }
+    atomic_store_explicit(&ring->tail, tail + count, memory_order_release);
+    return count;
+}
+
+#endif
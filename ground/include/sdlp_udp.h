@@ -0,0 +1,69 @@
+#ifndef SDLP_UDP_H
+#define SDLP_UDP_H
+
+#include "sdlp_common.h"
+
+/* Batched UDP transport of transfer frames, one frame per datagram (Linux
+ * only; elsewhere every call returns SDLP_ERROR_SYSTEM). The caller creates,
+ * binds or connects and closes the socket.
+ *
+ * The receiver owns a ring of slot buffers. Each sdlp_udp_rx_recv() fills the
+ * free slots after the newest frame with one recvmmsg() and returns their
+ * descriptors, which go to sdlp_tm_decode_batch() / sdlp_tc_decode_batch() as
+ * they are: the frames are decoded where the kernel wrote them. Frames stay
+ * valid, in receive order, until released, so views into them may be held
+ * across several receives. */
+#define SDLP_UDP_MAX_BATCH 1024u /* datagrams per recvmmsg() (UIO_MAXIOV) */
+#define SDLP_UDP_SEND_BATCH 64u  /* datagrams per sendmmsg(), headers on the stack */
+
+struct mmsghdr;
+struct iovec;
+
+typedef struct {
+    uint32_t slots;     /* ring size, power of two */
+    size_t slot_size;   /* largest datagram kept whole */
+    uint32_t batch;     /* datagrams per recvmmsg(), 1..SDLP_UDP_MAX_BATCH */
+} sdlp_udp_config_t;
+
+typedef struct {
+    uint64_t datagrams;
+    uint64_t truncated;     /* longer than slot_size, returned with length 0 */
+    uint64_t calls;         /* recvmmsg() calls that returned datagrams */
+} sdlp_udp_stats_t;
+
+typedef struct {
+    int fd;
+    sdlp_udp_config_t config;
+    sdlp_udp_stats_t stats;
+    uint32_t head;              /* slots filled so far, free-running */
+    uint32_t tail;              /* slots released so far */
+    uint8_t *buffers;           /* slots * slot_size bytes */
+    sdlp_frame_desc_t *frames;  /* per slot */
+    struct mmsghdr *messages;   /* per slot, pointing at its buffer */
+    struct iovec *iov;
+} sdlp_udp_rx_t;
+
+/* Allocate the ring for the socket fd. SDLP_ERROR_SYSTEM if out of memory. */
+int sdlp_udp_rx_init(sdlp_udp_rx_t *rx, int fd, const sdlp_udp_config_t *config);
+
+/* Receive up to config.batch datagrams into the free slots following the
+ * newest frame; *frames and *count describe them. wait blocks for the first
+ * datagram, otherwise *count is 0 when none is queued. A full ring returns
+ * SDLP_ERROR_BUFFER_TOO_SMALL until frames are released. Fewer than batch
+ * frames may be returned where the free slots wrap around the ring. */
+int sdlp_udp_rx_recv(sdlp_udp_rx_t *rx, int wait, const sdlp_frame_desc_t **frames,
+                     size_t *count);
+
+/* Give the count oldest frames back to the ring. */
+int sdlp_udp_rx_release(sdlp_udp_rx_t *rx, size_t count);
+
+/* Free the ring; the socket stays open. */
+void sdlp_udp_rx_free(sdlp_udp_rx_t *rx);
+
+/* Send each frame as one datagram on the connected socket fd, up to
+ * SDLP_UDP_SEND_BATCH per sendmmsg(). A non-blocking socket whose send buffer
+ * fills returns SDLP_ERROR_BUFFER_TOO_SMALL; *sent counts the datagrams
+ * accepted either way. */
+int sdlp_udp_send(int fd, const sdlp_frame_desc_t *frames, size_t count, size_t *sent);
+
+#endif
@@ -0,0 +1,64 @@
+#include "sdlp_crc_parallel.h"
+
+#include <pthread.h>
+
+typedef struct {
+    const uint8_t *data;
+    size_t length;
+    uint16_t crc;
+    pthread_t thread;
+    int started;
+} crc_piece_t;
+
+static void *crc_piece_thread(void *arg) {
+    crc_piece_t *piece = (crc_piece_t *)arg;
+
+    piece->crc = sdlp_crc16(piece->data, piece->length);
+    return NULL;
+}
+
+int sdlp_crc16_parallel(const uint8_t *data, size_t length, unsigned threads, uint16_t *crc) {
+    if ((!data && length > 0) || !crc || threads == 0) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    crc_piece_t pieces[SDLP_CRC16_PARALLEL_MAX_THREADS];
+    size_t count = length / SDLP_CRC16_PARALLEL_MIN_CHUNK;
+
+    if (count > threads) {
+        count = threads;
+    }
+    if (count > SDLP_CRC16_PARALLEL_MAX_THREADS) {
+        count = SDLP_CRC16_PARALLEL_MAX_THREADS;
+    }
+    if (count < 2) {
+        *crc = sdlp_crc16(data, length);
+        return SDLP_SUCCESS;
+    }
+
+    size_t piece_length = length / count;
+
+    for (size_t i = 0; i < count; i++) {
+        pieces[i].data = &data[i * piece_length];
+        pieces[i].length = i + 1 < count ? piece_length : length - i * piece_length;
+        pieces[i].started = i > 0 &&
+                            pthread_create(&pieces[i].thread, NULL, crc_piece_thread, &pieces[i]) == 0;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (pieces[i].started) {
+            pthread_join(pieces[i].thread, NULL);
+        } else {
+            crc_piece_thread(&pieces[i]);
+        }
+    }
+
+    uint16_t total = pieces[0].crc;
+
+    for (size_t i = 1; i < count; i++) {
+        total = sdlp_crc16_combine(total, pieces[i].crc, pieces[i].length);
+    }
+    *crc = total;
+
+    return SDLP_SUCCESS;
+}
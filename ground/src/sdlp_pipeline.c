@@ -0,0 +1,517 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "sdlp_pipeline.h"
+#include "sdlp_randomizer.h"
+
+#include <errno.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Descriptor that tells a stage to forward it and exit. */
+#define PIPELINE_END UINT32_MAX
+
+/* Polls an idle stage makes before it sleeps. */
+#define PIPELINE_SPIN 64
+
+/* Every ring holds 2 * frame_slots entries, more than all slots plus the end
+ * marker, so a push always finds room. */
+static void ring_put(sdlp_spsc_ring_t *ring, uint32_t slot, uint32_t length) {
+    sdlp_frame_ref_t ref = {slot, length};
+
+    (void)sdlp_spsc_push(ring, ref);
+}
+
+static int ring_ready(void *ring) {
+    return !sdlp_spsc_empty((sdlp_spsc_ring_t *)ring);
+}
+
+static int event_init(sdlp_pipeline_event_t *event) {
+    pthread_condattr_t attr;
+
+    if (pthread_condattr_init(&attr) != 0) {
+        return SDLP_ERROR_SYSTEM;
+    }
+
+    int result = pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+
+    if (result == 0) {
+        result = pthread_cond_init(&event->cond, &attr);
+    }
+    pthread_condattr_destroy(&attr);
+    if (result != 0) {
+        return SDLP_ERROR_SYSTEM;
+    }
+    if (pthread_mutex_init(&event->lock, NULL) != 0) {
+        pthread_cond_destroy(&event->cond);
+        return SDLP_ERROR_SYSTEM;
+    }
+    atomic_init(&event->waiting, 0);
+
+    return SDLP_SUCCESS;
+}
+
+static void event_destroy(sdlp_pipeline_event_t *event) {
+    pthread_cond_destroy(&event->cond);
+    pthread_mutex_destroy(&event->lock);
+}
+
+/* Called after a push. The fence pairs with the one in event_wait(): either
+ * the sleeper's last check sees the push, or this sees waiting set. */
+static void event_signal(sdlp_pipeline_event_t *event) {
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&event->waiting, memory_order_relaxed)) {
+        pthread_mutex_lock(&event->lock);
+        pthread_cond_signal(&event->cond);
+        pthread_mutex_unlock(&event->lock);
+    }
+}
+
+/* Spin briefly, then sleep until ready(arg) or, unless deadline_us is 0, the
+ * CLOCK_MONOTONIC deadline. Returns the last ready(arg). */
+static int event_wait(sdlp_pipeline_event_t *event, int (*ready)(void *), void *arg,
+                      uint64_t deadline_us) {
+    for (int i = 0; i < PIPELINE_SPIN; i++) {
+        if (ready(arg)) {
+            return 1;
+        }
+        sched_yield();
+    }
+
+    struct timespec deadline = {(time_t)(deadline_us / 1000000u),
+                                (long)(deadline_us % 1000000u) * 1000};
+    int result;
+
+    pthread_mutex_lock(&event->lock);
+    atomic_store_explicit(&event->waiting, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    while (!(result = ready(arg))) {
+        if (deadline_us == 0) {
+            pthread_cond_wait(&event->cond, &event->lock);
+        } else if (pthread_cond_timedwait(&event->cond, &event->lock, &deadline) == ETIMEDOUT) {
+            result = ready(arg);
+            break;
+        }
+    }
+    atomic_store_explicit(&event->waiting, 0, memory_order_relaxed);
+    pthread_mutex_unlock(&event->lock);
+
+    return result;
+}
+
+static uint8_t *slot_frame(const sdlp_pipeline_t *pipeline, uint32_t slot) {
+    return &pipeline->pool[(size_t)slot * pipeline->config.frame_length];
+}
+
+static void reclaim_slots(sdlp_pipeline_t *pipeline) {
+    uint32_t slots = pipeline->config.frame_slots;
+    sdlp_frame_ref_t refs[SDLP_PIPELINE_BURST];
+    size_t count;
+
+    for (uint8_t w = 0; w <= pipeline->config.worker_count; w++) {
+        sdlp_spsc_ring_t *ring =
+            w < pipeline->config.worker_count ? &pipeline->workers[w].done : &pipeline->rejected;
+
+        while (pipeline->free_count < slots &&
+               (count = sdlp_spsc_pop_burst(ring, refs, SDLP_PIPELINE_BURST)) > 0) {
+            for (size_t i = 0; i < count; i++) {
+                pipeline->in_flight[pipeline->slot_worker[refs[i].slot]]--;
+                pipeline->free_slots[pipeline->free_count++] = refs[i].slot;
+            }
+        }
+    }
+}
+
+static uint64_t monotonic_us(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000u + (uint64_t)now.tv_nsec / 1000u;
+}
+
+typedef struct {
+    sdlp_pipeline_t *pipeline;
+    uint8_t worker;
+} pipeline_claim_t;
+
+static int worker_has_slot(void *arg) {
+    pipeline_claim_t *claim = (pipeline_claim_t *)arg;
+
+    reclaim_slots(claim->pipeline);
+    return claim->pipeline->in_flight[claim->worker] < claim->pipeline->worker_slots;
+}
+
+/* Each worker holds at most worker_slots slots, so the sum over the workers
+ * never exceeds frame_slots: once this succeeds a free slot exists, and a
+ * worker that falls behind only ever runs out of its own share. */
+static int pipeline_reserve(sdlp_pipeline_t *pipeline, uint8_t worker) {
+    pipeline_claim_t claim = {pipeline, worker};
+
+    if (pipeline->in_flight[worker] < pipeline->worker_slots || worker_has_slot(&claim)) {
+        return 1;
+    }
+
+    uint32_t timeout = pipeline->config.stall_timeout_us;
+
+    pipeline->stats.stalls++;
+    if (timeout == 0) {
+        return 0;
+    }
+    return event_wait(&pipeline->slots_ready, worker_has_slot, &claim,
+                      timeout == SDLP_PIPELINE_WAIT_FOREVER ? 0 : monotonic_us() + timeout);
+}
+
+static void pipeline_enqueue(sdlp_pipeline_t *pipeline, const uint8_t *frame) {
+    uint8_t buffer[2];
+    const uint8_t *header = frame;
+
+    if (pipeline->config.randomized) {
+        sdlp_randomize_copy(buffer, frame, sizeof(buffer));
+        header = buffer;
+    }
+    if (pipeline->config.filter && !sdlp_tm_filter_accept(pipeline->config.filter, header)) {
+        pipeline->stats.filtered++;
+        return;
+    }
+
+    /* The header is not verified yet; a corrupted VC only charges the wrong
+     * worker for a frame the check stage rejects anyway. */
+    uint8_t vc = (uint8_t)((header[1] >> 1) & 0x07u);
+    uint8_t worker = (uint8_t)(vc % pipeline->config.worker_count);
+
+    if (!pipeline_reserve(pipeline, worker)) {
+        pipeline->stats.dropped++;
+        pipeline->stats.vc_dropped[vc]++;
+        return;
+    }
+
+    uint32_t slot = pipeline->free_slots[--pipeline->free_count];
+
+    pipeline->in_flight[worker]++;
+    pipeline->slot_worker[slot] = worker;
+    /* The slot copy is needed anyway; derandomizing costs nothing extra on top. */
+    if (pipeline->config.randomized) {
+        sdlp_randomize_copy(slot_frame(pipeline, slot), frame, pipeline->config.frame_length);
+    } else {
+        memcpy(slot_frame(pipeline, slot), frame, pipeline->config.frame_length);
+    }
+    pipeline->stats.frames++;
+    ring_put(&pipeline->input, slot, (uint32_t)pipeline->config.frame_length);
+    event_signal(&pipeline->input_ready);
+}
+
+static void pipeline_sync_frame(void *user, const uint8_t *frame, size_t frame_length,
+                                sdlp_sync_state_t state) {
+    (void)frame_length;
+    (void)state;
+    pipeline_enqueue((sdlp_pipeline_t *)user, frame);
+}
+
+/* Check stage: FECF of a whole burst at once (interleaved CRC streams), then
+ * hand good frames to the worker owning their VC. Counters are kept locally
+ * and published on exit so they do not share a cache line with the caller's. */
+static void *check_thread(void *arg) {
+    sdlp_pipeline_t *pipeline = (sdlp_pipeline_t *)arg;
+    sdlp_pipeline_stats_t stats;
+    sdlp_frame_ref_t refs[SDLP_PIPELINE_BURST];
+    sdlp_frame_desc_t frames[SDLP_PIPELINE_BURST];
+    sdlp_tm_frame_view_t views[SDLP_PIPELINE_BURST];
+    int results[SDLP_PIPELINE_BURST];
+    uint8_t workers = pipeline->config.worker_count;
+    int end = 0;
+
+    memset(&stats, 0, sizeof(stats));
+
+    while (!end) {
+        size_t count = sdlp_spsc_pop_burst(&pipeline->input, refs, SDLP_PIPELINE_BURST);
+        uint32_t fed = 0;   /* workers given frames, then the caller */
+
+        if (count == 0) {
+            event_wait(&pipeline->input_ready, ring_ready, &pipeline->input, 0);
+            continue;
+        }
+        if (refs[count - 1].slot == PIPELINE_END) {
+            end = 1;
+            count--;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            frames[i].buffer = slot_frame(pipeline, refs[i].slot);
+            frames[i].length = refs[i].length;
+        }
+        sdlp_tm_decode_batch(frames, count, views, results);
+
+        for (size_t i = 0; i < count; i++) {
+            if (results[i] != SDLP_SUCCESS) {
+                if (results[i] == SDLP_ERROR_CRC_MISMATCH) {
+                    stats.crc_errors++;
+                } else {
+                    stats.invalid_frames++;
+                }
+                ring_put(&pipeline->rejected, refs[i].slot, 0);
+                fed |= 1u << workers;
+                continue;
+            }
+
+            uint8_t vc = (uint8_t)views[i].header.virtual_channel_id;
+
+            stats.vc_frames[vc]++;
+            ring_put(&pipeline->workers[vc % workers].work, refs[i].slot, refs[i].length);
+            fed |= 1u << (vc % workers);
+        }
+
+        for (uint8_t w = 0; w < workers; w++) {
+            if (fed & (1u << w)) {
+                event_signal(&pipeline->workers[w].work_ready);
+            }
+        }
+        if (fed & (1u << workers)) {
+            event_signal(&pipeline->slots_ready);
+        }
+    }
+
+    for (uint8_t w = 0; w < workers; w++) {
+        ring_put(&pipeline->workers[w].work, PIPELINE_END, 0);
+        event_signal(&pipeline->workers[w].work_ready);
+    }
+
+    pipeline->stats.crc_errors = stats.crc_errors;
+    pipeline->stats.invalid_frames = stats.invalid_frames;
+    memcpy(pipeline->stats.vc_frames, stats.vc_frames, sizeof(stats.vc_frames));
+
+    return NULL;
+}
+
+static void worker_packet(void *user, const uint8_t *packet, size_t length) {
+    sdlp_pipeline_worker_t *worker = (sdlp_pipeline_worker_t *)user;
+    const sdlp_pipeline_config_t *config = &worker->pipeline->config;
+
+    if (config->on_packet) {
+        config->on_packet(config->user, worker->current_vc, packet, length);
+    }
+}
+
+static void *worker_thread(void *arg) {
+    sdlp_pipeline_worker_t *worker = (sdlp_pipeline_worker_t *)arg;
+    sdlp_pipeline_t *pipeline = worker->pipeline;
+    sdlp_frame_ref_t refs[SDLP_PIPELINE_BURST];
+
+    for (;;) {
+        size_t count = sdlp_spsc_pop_burst(&worker->work, refs, SDLP_PIPELINE_BURST);
+
+        if (count == 0) {
+            event_wait(&worker->work_ready, ring_ready, &worker->work, 0);
+            continue;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            sdlp_tm_frame_view_t view;
+
+            if (refs[i].slot == PIPELINE_END) {
+                event_signal(&pipeline->slots_ready);
+                return NULL;
+            }
+
+            /* The check stage verified the FECF; only the header is parsed again. */
+            if (sdlp_tm_decode_view(slot_frame(pipeline, refs[i].slot), refs[i].length, &view, 0) ==
+                SDLP_SUCCESS) {
+                worker->current_vc = (uint8_t)view.header.virtual_channel_id;
+                sdlp_packet_extractor_push_view(&worker->extractors[worker->current_vc], &view);
+            }
+            ring_put(&worker->done, refs[i].slot, 0);
+        }
+        event_signal(&pipeline->slots_ready);
+    }
+}
+
+static void pipeline_free(sdlp_pipeline_t *pipeline) {
+    free(pipeline->pool);
+    free(pipeline->sync_buffer);
+    free(pipeline->reassembly);
+    free(pipeline->ring_entries);
+    free(pipeline->free_slots);
+    free(pipeline->slot_worker);
+    pipeline->pool = NULL;
+    pipeline->sync_buffer = NULL;
+    pipeline->reassembly = NULL;
+    pipeline->ring_entries = NULL;
+    pipeline->free_slots = NULL;
+    pipeline->slot_worker = NULL;
+}
+
+/* Event i: the caller's two, then one per worker. */
+static sdlp_pipeline_event_t *pipeline_event(sdlp_pipeline_t *pipeline, uint8_t i) {
+    if (i < 2) {
+        return i == 0 ? &pipeline->input_ready : &pipeline->slots_ready;
+    }
+    return &pipeline->workers[i - 2].work_ready;
+}
+
+static void pipeline_destroy_events(sdlp_pipeline_t *pipeline, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        event_destroy(pipeline_event(pipeline, i));
+    }
+}
+
+static int pipeline_init_events(sdlp_pipeline_t *pipeline) {
+    uint8_t count = (uint8_t)(2u + pipeline->config.worker_count);
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (event_init(pipeline_event(pipeline, i)) != SDLP_SUCCESS) {
+            pipeline_destroy_events(pipeline, i);
+            return SDLP_ERROR_SYSTEM;
+        }
+    }
+
+    return SDLP_SUCCESS;
+}
+
+static int pipeline_alloc(sdlp_pipeline_t *pipeline) {
+    const sdlp_pipeline_config_t *config = &pipeline->config;
+    size_t capacity = (size_t)config->frame_slots * 2u;
+    size_t rings = 2u + 2u * config->worker_count;
+
+    pipeline->pool = malloc((size_t)config->frame_slots * config->frame_length);
+    pipeline->sync_buffer = malloc(config->frame_length);
+    pipeline->reassembly = malloc(TM_MAX_VIRTUAL_CHANNELS * config->max_packet_length);
+    pipeline->ring_entries = malloc(rings * capacity * sizeof(sdlp_frame_ref_t));
+    pipeline->free_slots = malloc(config->frame_slots * sizeof(uint32_t));
+    pipeline->slot_worker = malloc(config->frame_slots);
+
+    if (!pipeline->pool || !pipeline->sync_buffer || !pipeline->reassembly ||
+        !pipeline->ring_entries || !pipeline->free_slots || !pipeline->slot_worker) {
+        pipeline_free(pipeline);
+        return SDLP_ERROR_SYSTEM;
+    }
+
+    sdlp_frame_ref_t *entries = pipeline->ring_entries;
+
+    sdlp_spsc_init(&pipeline->input, entries, capacity);
+    sdlp_spsc_init(&pipeline->rejected, entries + capacity, capacity);
+    for (uint8_t w = 0; w < config->worker_count; w++) {
+        entries += 2u * capacity;
+        sdlp_spsc_init(&pipeline->workers[w].work, entries, capacity);
+        sdlp_spsc_init(&pipeline->workers[w].done, entries + capacity, capacity);
+    }
+
+    for (uint32_t i = 0; i < config->frame_slots; i++) {
+        pipeline->free_slots[i] = config->frame_slots - 1u - i;
+    }
+    pipeline->free_count = config->frame_slots;
+    pipeline->worker_slots = config->frame_slots / config->worker_count;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_pipeline_start(sdlp_pipeline_t *pipeline, const sdlp_pipeline_config_t *config) {
+    if (!pipeline || !config || config->worker_count == 0 ||
+        config->worker_count > SDLP_PIPELINE_MAX_WORKERS ||
+        config->frame_length <= TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE ||
+        config->frame_length > TM_PRIMARY_HEADER_SIZE + TM_MAX_DATA_SIZE + TM_FRAME_ERROR_CONTROL_SIZE ||
+        config->frame_slots < 2 || config->frame_slots > (UINT32_MAX >> 2) ||
+        (config->frame_slots & (config->frame_slots - 1u)) != 0 ||
+        config->frame_slots < config->worker_count ||
+        config->max_packet_length < SDLP_SPACE_PACKET_HEADER_SIZE + 1u) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(pipeline, 0, sizeof(sdlp_pipeline_t));
+    pipeline->config = *config;
+
+    int result = pipeline_alloc(pipeline);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    sdlp_sync_config_t sync_config = {config->frame_length, pipeline->sync_buffer,
+                                      config->check_threshold, config->flywheel,
+                                      config->max_marker_errors, pipeline_sync_frame, pipeline};
+
+    result = sdlp_sync_init(&pipeline->sync, &sync_config);
+    for (uint8_t vc = 0; result == SDLP_SUCCESS && vc < TM_MAX_VIRTUAL_CHANNELS; vc++) {
+        sdlp_pipeline_worker_t *worker = &pipeline->workers[vc % config->worker_count];
+        sdlp_packet_extractor_config_t extractor_config = {
+            &pipeline->reassembly[vc * config->max_packet_length], config->max_packet_length,
+            worker_packet, worker};
+
+        result = sdlp_packet_extractor_init(&worker->extractors[vc], &extractor_config);
+    }
+    if (result == SDLP_SUCCESS) {
+        result = pipeline_init_events(pipeline);
+    }
+    if (result != SDLP_SUCCESS) {
+        pipeline_free(pipeline);
+        return result;
+    }
+
+    uint8_t started = 0;
+
+    while (started < config->worker_count) {
+        sdlp_pipeline_worker_t *worker = &pipeline->workers[started];
+
+        worker->pipeline = pipeline;
+        if (pthread_create(&worker->thread, NULL, worker_thread, worker) != 0) {
+            break;
+        }
+        started++;
+    }
+    if (started == config->worker_count &&
+        pthread_create(&pipeline->check_thread, NULL, check_thread, pipeline) == 0) {
+        pipeline->running = 1;
+        return SDLP_SUCCESS;
+    }
+
+    /* No check thread exists, so the caller may act as producer of the work rings. */
+    for (uint8_t w = 0; w < started; w++) {
+        ring_put(&pipeline->workers[w].work, PIPELINE_END, 0);
+        event_signal(&pipeline->workers[w].work_ready);
+        pthread_join(pipeline->workers[w].thread, NULL);
+    }
+    pipeline_destroy_events(pipeline, (uint8_t)(2u + config->worker_count));
+    pipeline_free(pipeline);
+
+    return SDLP_ERROR_SYSTEM;
+}
+
+int sdlp_pipeline_push(sdlp_pipeline_t *pipeline, const uint8_t *data, size_t length) {
+    if (!pipeline || !pipeline->running) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    return sdlp_sync_process(&pipeline->sync, data, length);
+}
+
+int sdlp_pipeline_push_frame(sdlp_pipeline_t *pipeline, const uint8_t *frame, size_t frame_length) {
+    if (!pipeline || !pipeline->running || !frame || frame_length != pipeline->config.frame_length) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    pipeline_enqueue(pipeline, frame);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_pipeline_stop(sdlp_pipeline_t *pipeline) {
+    if (!pipeline || !pipeline->running) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    ring_put(&pipeline->input, PIPELINE_END, 0);
+    event_signal(&pipeline->input_ready);
+    pthread_join(pipeline->check_thread, NULL);
+    for (uint8_t w = 0; w < pipeline->config.worker_count; w++) {
+        pthread_join(pipeline->workers[w].thread, NULL);
+    }
+
+    for (uint8_t vc = 0; vc < TM_MAX_VIRTUAL_CHANNELS; vc++) {
+        pipeline->vc_stats[vc] =
+            pipeline->workers[vc % pipeline->config.worker_count].extractors[vc].stats;
+    }
+    pipeline_destroy_events(pipeline, (uint8_t)(2u + pipeline->config.worker_count));
+    pipeline_free(pipeline);
+    pipeline->running = 0;
+
+    return SDLP_SUCCESS;
+}
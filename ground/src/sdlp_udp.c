@@ -0,0 +1,200 @@
+#define _GNU_SOURCE /* recvmmsg(), sendmmsg() */
+
+#include "sdlp_udp.h"
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+static void udp_rx_clear(sdlp_udp_rx_t *rx) {
+    free(rx->buffers);
+    free(rx->frames);
+    free(rx->messages);
+    free(rx->iov);
+    rx->buffers = NULL;
+    rx->frames = NULL;
+    rx->messages = NULL;
+    rx->iov = NULL;
+}
+
+int sdlp_udp_rx_init(sdlp_udp_rx_t *rx, int fd, const sdlp_udp_config_t *config) {
+    if (!rx || fd < 0 || !config || config->slots == 0 ||
+        (config->slots & (config->slots - 1u)) != 0 || config->slot_size == 0 ||
+        config->batch == 0 || config->batch > SDLP_UDP_MAX_BATCH) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(rx, 0, sizeof(*rx));
+    rx->fd = fd;
+    rx->config = *config;
+    rx->buffers = malloc((size_t)config->slots * config->slot_size);
+    rx->frames = malloc(config->slots * sizeof(sdlp_frame_desc_t));
+    rx->messages = calloc(config->slots, sizeof(struct mmsghdr));
+    rx->iov = malloc(config->slots * sizeof(struct iovec));
+
+    if (!rx->buffers || !rx->frames || !rx->messages || !rx->iov) {
+        udp_rx_clear(rx);
+        return SDLP_ERROR_SYSTEM;
+    }
+
+    /* The headers never change: each slot always receives into its own buffer. */
+    for (uint32_t i = 0; i < config->slots; i++) {
+        uint8_t *buffer = &rx->buffers[(size_t)i * config->slot_size];
+
+        rx->iov[i].iov_base = buffer;
+        rx->iov[i].iov_len = config->slot_size;
+        rx->messages[i].msg_hdr.msg_iov = &rx->iov[i];
+        rx->messages[i].msg_hdr.msg_iovlen = 1;
+        rx->frames[i].buffer = buffer;
+        rx->frames[i].length = 0;
+    }
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_udp_rx_recv(sdlp_udp_rx_t *rx, int wait, const sdlp_frame_desc_t **frames,
+                     size_t *count) {
+    if (!rx || !rx->buffers || !frames || !count) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    uint32_t first = rx->head & (rx->config.slots - 1u);
+    uint32_t room = rx->config.slots - (rx->head - rx->tail);
+
+    *frames = &rx->frames[first];
+    *count = 0;
+
+    if (room == 0) {
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+    /* One call fills a contiguous run of slots, so the descriptors it returns
+     * are contiguous too. */
+    if (room > rx->config.slots - first) {
+        room = rx->config.slots - first;
+    }
+    if (room > rx->config.batch) {
+        room = rx->config.batch;
+    }
+
+    int received;
+
+    do {
+        received = recvmmsg(rx->fd, &rx->messages[first], room,
+                            wait ? MSG_WAITFORONE : MSG_DONTWAIT, NULL);
+    } while (received < 0 && errno == EINTR);
+
+    if (received < 0) {
+        return errno == EAGAIN || errno == EWOULDBLOCK ? SDLP_SUCCESS : SDLP_ERROR_SYSTEM;
+    }
+
+    for (int i = 0; i < received; i++) {
+        const struct mmsghdr *message = &rx->messages[first + (uint32_t)i];
+
+        if (message->msg_hdr.msg_flags & MSG_TRUNC) {
+            rx->frames[first + (uint32_t)i].length = 0;
+            rx->stats.truncated++;
+        } else {
+            rx->frames[first + (uint32_t)i].length = message->msg_len;
+        }
+    }
+
+    rx->head += (uint32_t)received;
+    rx->stats.datagrams += (uint64_t)received;
+    rx->stats.calls++;
+    *count = (size_t)received;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_udp_rx_release(sdlp_udp_rx_t *rx, size_t count) {
+    if (!rx || count > rx->head - rx->tail) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    rx->tail += (uint32_t)count;
+
+    return SDLP_SUCCESS;
+}
+
+void sdlp_udp_rx_free(sdlp_udp_rx_t *rx) {
+    if (rx) {
+        udp_rx_clear(rx);
+    }
+}
+
+int sdlp_udp_send(int fd, const sdlp_frame_desc_t *frames, size_t count, size_t *sent) {
+    if (fd < 0 || (!frames && count > 0) || !sent) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    struct mmsghdr messages[SDLP_UDP_SEND_BATCH];
+    struct iovec iov[SDLP_UDP_SEND_BATCH];
+
+    *sent = 0;
+    while (*sent < count) {
+        size_t batch = count - *sent < SDLP_UDP_SEND_BATCH ? count - *sent : SDLP_UDP_SEND_BATCH;
+
+        memset(messages, 0, batch * sizeof(messages[0]));
+        for (size_t i = 0; i < batch; i++) {
+            iov[i].iov_base = (void *)(uintptr_t)frames[*sent + i].buffer;
+            iov[i].iov_len = frames[*sent + i].length;
+            messages[i].msg_hdr.msg_iov = &iov[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        int accepted = sendmmsg(fd, messages, (unsigned int)batch, 0);
+
+        if (accepted < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK ? SDLP_ERROR_BUFFER_TOO_SMALL
+                                                           : SDLP_ERROR_SYSTEM;
+        }
+        *sent += (size_t)accepted;
+    }
+
+    return SDLP_SUCCESS;
+}
+
+#else
+
+int sdlp_udp_rx_init(sdlp_udp_rx_t *rx, int fd, const sdlp_udp_config_t *config) {
+    (void)rx;
+    (void)fd;
+    (void)config;
+    return SDLP_ERROR_SYSTEM;
+}
+
+int sdlp_udp_rx_recv(sdlp_udp_rx_t *rx, int wait, const sdlp_frame_desc_t **frames,
+                     size_t *count) {
+    (void)rx;
+    (void)wait;
+    (void)frames;
+    (void)count;
+    return SDLP_ERROR_SYSTEM;
+}
+
+int sdlp_udp_rx_release(sdlp_udp_rx_t *rx, size_t count) {
+    (void)rx;
+    (void)count;
+    return SDLP_ERROR_SYSTEM;
+}
+
+void sdlp_udp_rx_free(sdlp_udp_rx_t *rx) {
+    (void)rx;
+}
+
+int sdlp_udp_send(int fd, const sdlp_frame_desc_t *frames, size_t count, size_t *sent) {
+    (void)fd;
+    (void)frames;
+    (void)count;
+    (void)sent;
+    return SDLP_ERROR_SYSTEM;
+}
+
+#endif
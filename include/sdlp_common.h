@@ -11,7 +11,68 @@
 #define SDLP_ERROR_BUFFER_TOO_SMALL -2
 #define SDLP_ERROR_INVALID_FRAME -3
 #define SDLP_ERROR_CRC_MISMATCH -4
+#define SDLP_ERROR_SYSTEM -5 /* ground modules: allocation, thread or socket failure */
+#define SDLP_ERROR_UNCORRECTABLE -6 /* Reed-Solomon: more symbol errors than the code corrects */
+
+/* CRC-16 backends, selected at compile time with SDLP_CRC16_BACKEND.
+ * All backends produce identical results; they trade code/table size for speed.
+ *   SDLP_CRC16_BITWISE  no table, 8 shift steps per byte (smallest footprint)
+ *   SDLP_CRC16_TABLE    256-entry table, one lookup per byte (512 bytes)
+ *   SDLP_CRC16_SLICE4   slicing-by-4, four lookups per 4 bytes (2 KB)
+ *   SDLP_CRC16_SLICE8   slicing-by-8, eight lookups per 8 bytes (4 KB) */
+#define SDLP_CRC16_BITWISE 0
+#define SDLP_CRC16_TABLE 1
+#define SDLP_CRC16_SLICE4 4
+#define SDLP_CRC16_SLICE8 8
+
+#ifndef SDLP_CRC16_BACKEND
+#define SDLP_CRC16_BACKEND SDLP_CRC16_TABLE
+#endif
+
+#define SDLP_CRC16_INIT 0xFFFFu
+
+/* Frame counters shared between producer threads. They are lock-free C11
+ * atomics where available; toolchains without <stdatomic.h> get a plain counter
+ * and callers must then serialise access to a channel themselves. */
+#if defined(__STDC_NO_ATOMICS__)
+typedef unsigned int sdlp_counter_t;
+#define SDLP_COUNTER_INIT(counter, value) (*(counter) = (value))
+#define SDLP_COUNTER_FETCH_ADD(counter) ((*(counter))++)
+#else
+#include <stdatomic.h>
+typedef atomic_uint sdlp_counter_t;
+#define SDLP_COUNTER_INIT(counter, value) atomic_init((counter), (value))
+#define SDLP_COUNTER_FETCH_ADD(counter) atomic_fetch_add_explicit((counter), 1u, memory_order_relaxed)
+#endif
+
+/* One received frame for the batch decoders. */
+typedef struct {
+    const uint8_t *buffer;
+    size_t length;
+} sdlp_frame_desc_t;
+
+/* One piece of a scattered data field for the _encode_iov functions. */
+typedef struct {
+    const uint8_t *data;
+    size_t length;
+} sdlp_iovec_t;
 
 uint16_t sdlp_crc16(const uint8_t *data, size_t length);
 
+/* Streaming CRC: crc = sdlp_crc16_init(); crc = sdlp_crc16_update(crc, ...) for
+ * each piece; sdlp_crc16_final(crc) equals sdlp_crc16() over the concatenation. */
+uint16_t sdlp_crc16_init(void);
+uint16_t sdlp_crc16_update(uint16_t crc, const uint8_t *data, size_t length);
+uint16_t sdlp_crc16_final(uint16_t crc);
+
+/* sdlp_crc16_update() over src that also copies it to dst, in one pass over
+ * the bytes instead of a memcpy() and a second read. dst and src must not
+ * overlap. */
+uint16_t sdlp_crc16_copy(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length);
+
+/* CRC of the concatenation A || B from sdlp_crc16(A), sdlp_crc16(B) and the
+ * length of B, in O(log length_b). Pieces checksummed independently (e.g. on
+ * different threads) merge into exactly the result of one sequential pass. */
+uint16_t sdlp_crc16_combine(uint16_t crc_a, uint16_t crc_b, size_t length_b);
+
 #endif
@@ -0,0 +1,182 @@
+#ifndef SDLP_COP1_H
+#define SDLP_COP1_H
+
+#include "sdlp_tc.h"
+#include "sdlp_tm.h"
+
+/* Communications Operation Procedure-1 (CCSDS 232.1-B-2): FOP-1 on the sending
+ * end, FARM-1 on the receiving end, and the CLCW reported back in the TM
+ * Operational Control Field. */
+#define SDLP_CLCW_SIZE 4
+#define SDLP_COP_IN_EFFECT_COP1 1
+
+/* Largest encoded TC frame a FOP-1 slot holds. */
+#define SDLP_FOP_SLOT_SIZE \
+    (TC_PRIMARY_HEADER_SIZE + TC_SEGMENT_HEADER_SIZE + TC_MAX_DATA_SIZE + TC_FRAME_ERROR_CONTROL_SIZE)
+
+/* Communications Link Control Word (CCSDS 232.0-B-4, 4.2). */
+typedef struct {
+    uint8_t status_field;       /* mission specific, 3 bits */
+    uint8_t cop_in_effect;      /* SDLP_COP_IN_EFFECT_COP1 */
+    uint8_t virtual_channel_id;
+    uint8_t no_rf_available;
+    uint8_t no_bit_lock;
+    uint8_t lockout;
+    uint8_t wait;
+    uint8_t retransmit;
+    uint8_t farm_b_counter;     /* 2 bits */
+    uint8_t report_value;       /* N(R): next expected frame sequence number */
+} sdlp_clcw_t;
+
+int sdlp_clcw_encode(const sdlp_clcw_t *clcw, uint8_t *buffer, size_t buffer_size);
+
+int sdlp_clcw_decode(const uint8_t *buffer, size_t buffer_size, sdlp_clcw_t *clcw);
+
+/* Read the CLCW from the OCF (last four data field bytes) of a TM frame with
+ * ocf_flag set. To send one, set ocf_flag on the builder and encode the CLCW
+ * into the last SDLP_CLCW_SIZE bytes of the data field. */
+int sdlp_clcw_decode_tm_view(const sdlp_tm_frame_view_t *view, sdlp_clcw_t *clcw);
+
+typedef enum {
+    SDLP_FOP_INITIAL = 0,                   /* AD service not running */
+    SDLP_FOP_ACTIVE = 1,
+    SDLP_FOP_RETRANSMIT_WITHOUT_WAIT = 2,
+    SDLP_FOP_RETRANSMIT_WITH_WAIT = 3,      /* FARM has no buffer; AD frames held */
+    SDLP_FOP_INITIALIZING = 4               /* Unlock / Set V(R) sent, awaiting CLCW */
+} sdlp_fop_state_t;
+
+typedef enum {
+    SDLP_FOP_ALERT_NONE = 0,
+    SDLP_FOP_ALERT_LIMIT = 1,       /* transmission limit reached */
+    SDLP_FOP_ALERT_LOCKOUT = 2,     /* CLCW reported FARM lockout */
+    SDLP_FOP_ALERT_NNR = 3          /* CLCW acknowledged a frame never sent */
+} sdlp_fop_alert_t;
+
+/* One sent-queue entry: an encoded Type-AD frame kept for retransmission. */
+typedef struct {
+    uint8_t frame[SDLP_FOP_SLOT_SIZE];
+    uint16_t length;
+} sdlp_fop_slot_t;
+
+typedef struct {
+    uint16_t spacecraft_id;
+    uint8_t virtual_channel_id;
+    sdlp_fop_slot_t *slots;         /* caller-provided sent queue */
+    uint8_t slot_count;
+    uint8_t window_width;           /* K: unacknowledged frames, 1..slot_count */
+    uint8_t transmission_limit;     /* transmissions of a frame, first included */
+    uint32_t timeout;               /* T1, in the units of the caller's clock */
+} sdlp_fop_config_t;
+
+typedef struct {
+    uint32_t frames;                /* frames handed out for transmission */
+    uint32_t retransmissions;       /* of those, AD frames sent again */
+    uint32_t acknowledged;          /* AD frames acknowledged by CLCW */
+    uint32_t timeouts;
+    uint32_t alerts;
+} sdlp_fop_stats_t;
+
+/* Frame Operation Procedure for one virtual channel. The sent queue is a ring
+ * indexed from the oldest unacknowledged frame, so acknowledging any number of
+ * frames and rewinding for retransmission are O(1). Not thread-safe. */
+typedef struct {
+    sdlp_fop_config_t config;
+    sdlp_fop_stats_t stats;
+    sdlp_fop_state_t state;
+    sdlp_fop_alert_t alert;         /* reason for the last return to INITIAL */
+    uint8_t vs;                     /* V(S): sequence number of the next new AD frame */
+    uint8_t nnr;                    /* NN(R): oldest unacknowledged frame */
+    uint8_t head;                   /* slot holding NN(R) */
+    uint8_t sent;                   /* queued frames transmitted at least once */
+    uint8_t next;                   /* queue offset of the next frame to transmit */
+    uint8_t transmission_count;
+    uint8_t timer_running;
+    uint32_t timer_start;
+    uint8_t bc_pending;             /* BC frame due for (re)transmission */
+    uint8_t bc_unlock;              /* the BC frame is Unlock, else Set V(R) */
+    uint8_t bc_length;
+    uint8_t bc_frame[16];
+} sdlp_fop_t;
+
+int sdlp_fop_init(sdlp_fop_t *fop, const sdlp_fop_config_t *config);
+
+/* Directives. start: AD service without CLCW check; start_unlock and
+ * start_set_vr send the control command and wait for the CLCW confirming it.
+ * All of them purge the sent queue. */
+int sdlp_fop_start(sdlp_fop_t *fop);
+int sdlp_fop_start_unlock(sdlp_fop_t *fop);
+int sdlp_fop_start_set_vr(sdlp_fop_t *fop, uint8_t vr);
+void sdlp_fop_terminate(sdlp_fop_t *fop);
+
+/* Queue a Type-AD frame built in place in the next slot. begin returns
+ * SDLP_ERROR_BUFFER_TOO_SMALL while the window is full. */
+int sdlp_fop_begin(sdlp_fop_t *fop, sdlp_tc_builder_t *builder);
+int sdlp_fop_commit(sdlp_fop_t *fop, sdlp_tc_builder_t *builder, uint16_t data_length);
+
+/* begin + copy of data into the data field + commit. */
+int sdlp_fop_transfer(sdlp_fop_t *fop, const uint8_t *data, uint16_t data_length);
+
+/* Number of AD frames not yet acknowledged. */
+uint8_t sdlp_fop_outstanding(const sdlp_fop_t *fop);
+
+/* Next frame to put on the link: a pending BC frame, then retransmissions, then
+ * new AD frames. *length is 0 when there is nothing to send. *frame points into
+ * the FOP and stays valid until the frame is acknowledged or purged. */
+int sdlp_fop_next_frame(sdlp_fop_t *fop, uint32_t now, const uint8_t **frame, size_t *length);
+
+/* Feed back a CLCW received for this virtual channel. */
+int sdlp_fop_process_clcw(sdlp_fop_t *fop, const sdlp_clcw_t *clcw, uint32_t now);
+
+/* Check timer T1; on expiry everything unacknowledged is sent again. */
+int sdlp_fop_poll(sdlp_fop_t *fop, uint32_t now);
+
+typedef enum {
+    SDLP_FARM_OPEN = 0,
+    SDLP_FARM_WAIT = 1,             /* no buffer for the last in-sequence frame */
+    SDLP_FARM_LOCKOUT = 2           /* sequence number outside both windows */
+} sdlp_farm_state_t;
+
+/* Called for every accepted Type-AD and Type-BD frame. Return 0 if the frame was
+ * taken, nonzero if there is no buffer for it (Type-AD only: the FARM then waits
+ * until sdlp_farm_buffer_release()). view is valid only during the call. */
+typedef int (*sdlp_farm_frame_cb)(void *user, const sdlp_tc_frame_view_t *view);
+
+typedef struct {
+    uint8_t virtual_channel_id;
+    uint8_t window_width;           /* W: even, 2..254 */
+    sdlp_farm_frame_cb on_frame;
+    void *user;
+} sdlp_farm_config_t;
+
+typedef struct {
+    uint32_t frames;                /* frames pushed */
+    uint32_t accepted_ad;
+    uint32_t accepted_bd;
+    uint32_t control_commands;      /* Unlock and Set V(R) accepted */
+    uint32_t discarded;             /* frames not accepted, lockout included */
+    uint32_t lockouts;
+} sdlp_farm_stats_t;
+
+/* Frame Acceptance and Reporting Mechanism for one virtual channel. */
+typedef struct {
+    sdlp_farm_config_t config;
+    sdlp_farm_stats_t stats;
+    sdlp_farm_state_t state;
+    uint8_t vr;                     /* V(R): next expected frame sequence number */
+    uint8_t retransmit;
+    uint8_t farm_b_counter;
+} sdlp_farm_t;
+
+int sdlp_farm_init(sdlp_farm_t *farm, const sdlp_farm_config_t *config);
+
+int sdlp_farm_push_view(sdlp_farm_t *farm, const sdlp_tc_frame_view_t *view);
+
+/* Decode, verify the FECF and push one encoded frame. */
+int sdlp_farm_push(sdlp_farm_t *farm, const uint8_t *frame, size_t frame_length);
+
+/* A buffer became available: leave WAIT. */
+void sdlp_farm_buffer_release(sdlp_farm_t *farm);
+
+int sdlp_farm_get_clcw(const sdlp_farm_t *farm, sdlp_clcw_t *clcw);
+
+#endif
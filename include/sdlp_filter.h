@@ -0,0 +1,50 @@
+#ifndef SDLP_FILTER_H
+#define SDLP_FILTER_H
+
+#include "sdlp_common.h"
+
+/* Accept filters for frames received for many spacecraft on a shared link:
+ * one bit per (SCID, VCID) pair, tested straight from the first primary
+ * header bytes before the rest of the frame is read. The frame passed to
+ * the accept functions must hold at least its primary header. */
+#define SDLP_TM_FILTER_KEYS (1u << 13) /* 10-bit SCID, 3-bit VCID: 1 KB */
+#define SDLP_TC_FILTER_KEYS (1u << 16) /* 10-bit SCID, 6-bit VCID: 8 KB */
+
+/* Pass as virtual_channel_id to cover every VC of the spacecraft. */
+#define SDLP_FILTER_ALL_VCS 0xFFu
+
+typedef struct {
+    uint64_t bits[SDLP_TM_FILTER_KEYS / 64u];
+} sdlp_tm_filter_t;
+
+typedef struct {
+    uint64_t bits[SDLP_TC_FILTER_KEYS / 64u];
+} sdlp_tc_filter_t;
+
+/* Start with an empty filter that rejects everything. */
+int sdlp_tm_filter_init(sdlp_tm_filter_t *filter);
+int sdlp_tm_filter_add(sdlp_tm_filter_t *filter, uint16_t spacecraft_id, uint8_t virtual_channel_id);
+int sdlp_tm_filter_remove(sdlp_tm_filter_t *filter, uint16_t spacecraft_id,
+                          uint8_t virtual_channel_id);
+
+int sdlp_tc_filter_init(sdlp_tc_filter_t *filter);
+int sdlp_tc_filter_add(sdlp_tc_filter_t *filter, uint16_t spacecraft_id, uint8_t virtual_channel_id);
+int sdlp_tc_filter_remove(sdlp_tc_filter_t *filter, uint16_t spacecraft_id,
+                          uint8_t virtual_channel_id);
+
+/* TM header bits 2-14 are SCID and VCID back to back. */
+static inline int sdlp_tm_filter_accept(const sdlp_tm_filter_t *filter, const uint8_t *frame) {
+    unsigned key = ((unsigned)(frame[0] & 0x3fu) << 7) | ((unsigned)frame[1] >> 1);
+
+    return (int)((filter->bits[key >> 6] >> (key & 63u)) & 1u);
+}
+
+/* TC header bits 6-21 are SCID and VCID back to back. */
+static inline int sdlp_tc_filter_accept(const sdlp_tc_filter_t *filter, const uint8_t *frame) {
+    unsigned key = ((unsigned)(frame[0] & 0x03u) << 14) | ((unsigned)frame[1] << 6) |
+                   ((unsigned)frame[2] >> 2);
+
+    return (int)((filter->bits[key >> 6] >> (key & 63u)) & 1u);
+}
+
+#endif
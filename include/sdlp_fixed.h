@@ -0,0 +1,81 @@
+#ifndef SDLP_FIXED_H
+#define SDLP_FIXED_H
+
+#include "sdlp_tm.h"
+
+/* TM encoders and decoders specialised for a data field length fixed at
+ * compile time, for missions whose frames never change size:
+ *
+ *     SDLP_TM_FIXED_DEFINE(hk_frame, 1105)
+ *
+ * defines static inline hk_frame_encode() and hk_frame_decode(). With the
+ * length a constant there is nothing to check: the header is packed with
+ * straight-line stores, the CRC is called with a constant length and no
+ * sdlp_tm_frame_t is staged. Output is byte-identical to sdlp_tm_encode_frame().
+ * Built against the single header (make amalgamation) the CRC entry points
+ * inline too. Frames handled here are not counted in the link statistics. */
+
+#define SDLP_TM_FIXED_FRAME_LENGTH(data_length) \
+    (TM_PRIMARY_HEADER_SIZE + (data_length) + TM_FRAME_ERROR_CONTROL_SIZE)
+
+static inline void sdlp_tm_fixed_pack_header(const sdlp_tm_header_t *header, uint8_t *buffer) {
+    buffer[0] = (uint8_t)((header->transfer_frame_version << 6) |
+                          ((header->spacecraft_id >> 4) & 0x3fu));
+    buffer[1] = (uint8_t)(((header->spacecraft_id & 0x0fu) << 4) |
+                          ((header->virtual_channel_id & 0x07u) << 1) |
+                          (header->ocf_flag & 0x01u));
+    buffer[2] = header->master_channel_frame_count;
+    buffer[3] = header->virtual_channel_frame_count;
+    buffer[4] = (uint8_t)((header->transfer_frame_data_field_status >> 8) & 0xffu);
+    buffer[5] = (uint8_t)(header->transfer_frame_data_field_status & 0xffu);
+}
+
+static inline void sdlp_tm_fixed_unpack_header(const uint8_t *buffer, sdlp_tm_header_t *header) {
+    header->transfer_frame_version = (buffer[0] >> 6) & 0x03u;
+    header->spacecraft_id = (uint16_t)(((buffer[0] & 0x3fu) << 4) | ((buffer[1] >> 4) & 0x0fu));
+    header->virtual_channel_id = (uint8_t)((buffer[1] >> 1) & 0x07u);
+    header->ocf_flag = (uint8_t)(buffer[1] & 0x01u);
+    header->master_channel_frame_count = buffer[2];
+    header->virtual_channel_frame_count = buffer[3];
+    header->transfer_frame_data_field_status = (uint16_t)(((uint16_t)buffer[4] << 8) | buffer[5]);
+}
+
+/* name_encode(header, data, frame) writes SDLP_TM_FIXED_FRAME_LENGTH(field_length)
+ * bytes to frame and returns that length. name_decode(frame, view) fills view
+ * as sdlp_tm_decode_view() with verify_crc set and returns SDLP_SUCCESS or
+ * SDLP_ERROR_CRC_MISMATCH. */
+#define SDLP_TM_FIXED_DEFINE(name, field_length)                                                 \
+    _Static_assert((field_length) >= 1 &&                                                        \
+                       SDLP_TM_FIXED_FRAME_LENGTH(field_length) <= TM_MAX_FRAME_LENGTH,          \
+                   #name ": field_length out of range");                                         \
+                                                                                                 \
+    static inline size_t name##_encode(const sdlp_tm_header_t *header, const uint8_t *data,      \
+                                       uint8_t *frame) {                                         \
+        sdlp_tm_fixed_pack_header(header, frame);                                                \
+                                                                                                 \
+        uint16_t crc = sdlp_crc16_update(sdlp_crc16_init(), frame, TM_PRIMARY_HEADER_SIZE);      \
+                                                                                                 \
+        crc = sdlp_crc16_final(                                                                  \
+            sdlp_crc16_copy(crc, &frame[TM_PRIMARY_HEADER_SIZE], data, (field_length)));         \
+        frame[TM_PRIMARY_HEADER_SIZE + (field_length)] = (uint8_t)((crc >> 8) & 0xffu);          \
+        frame[TM_PRIMARY_HEADER_SIZE + (field_length) + 1] = (uint8_t)(crc & 0xffu);             \
+                                                                                                 \
+        return SDLP_TM_FIXED_FRAME_LENGTH(field_length);                                         \
+    }                                                                                            \
+                                                                                                 \
+    static inline int name##_decode(const uint8_t *frame, sdlp_tm_frame_view_t *view) {          \
+        const uint8_t *fecf = &frame[TM_PRIMARY_HEADER_SIZE + (field_length)];                   \
+                                                                                                 \
+        sdlp_tm_fixed_unpack_header(frame, &view->header);                                       \
+        view->frame = frame;                                                                     \
+        view->frame_length = SDLP_TM_FIXED_FRAME_LENGTH(field_length);                           \
+        view->data = &frame[TM_PRIMARY_HEADER_SIZE];                                             \
+        view->data_length = (uint16_t)(field_length);                                            \
+        view->fecf = (uint16_t)(((uint16_t)fecf[0] << 8) | fecf[1]);                             \
+                                                                                                 \
+        return sdlp_crc16(frame, TM_PRIMARY_HEADER_SIZE + (field_length)) == view->fecf          \
+                   ? SDLP_SUCCESS                                                                \
+                   : SDLP_ERROR_CRC_MISMATCH;                                                    \
+    }
+
+#endif
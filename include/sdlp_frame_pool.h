@@ -0,0 +1,61 @@
+#ifndef SDLP_FRAME_POOL_H
+#define SDLP_FRAME_POOL_H
+
+#include "sdlp_common.h"
+
+/* Fixed-capacity pool of equal-sized frame buffers in caller-provided, usually
+ * static, storage. Every buffer starts on its own cache line, so buffers held
+ * by different threads never share one. Acquire and release are O(1) and
+ * lock-free: the free buffers form a stack whose top is swapped with one
+ * compare-and-swap, tagged with a pop count against ABA.
+ *
+ * Buffer sizes are per pool, so each virtual channel can draw from a pool
+ * sized for its own frame length (e.g. TM_PRIMARY_HEADER_SIZE + data field +
+ * TM_FRAME_ERROR_CONTROL_SIZE) rather than the TM_MAX_DATA_SIZE of the build.
+ * Without <stdatomic.h> callers must serialise access to a pool. */
+#define SDLP_FRAME_POOL_ALIGN 64
+#define SDLP_FRAME_POOL_MAX_BUFFERS 65535u
+
+/* Bytes between consecutive buffers: buffer_size rounded up to a cache line. */
+#define SDLP_FRAME_POOL_STRIDE(buffer_size) \
+    (((buffer_size) + SDLP_FRAME_POOL_ALIGN - 1u) / SDLP_FRAME_POOL_ALIGN * SDLP_FRAME_POOL_ALIGN)
+
+#if defined(__STDC_NO_ATOMICS__)
+typedef uint16_t sdlp_frame_pool_link_t;
+typedef uint32_t sdlp_frame_pool_head_t;
+#else
+#include <stdatomic.h>
+typedef _Atomic uint16_t sdlp_frame_pool_link_t;
+typedef _Atomic uint32_t sdlp_frame_pool_head_t;
+#endif
+
+/* Define name_buffers and name_links for count buffers of buffer_size bytes,
+ * to pass to sdlp_frame_pool_init(). */
+#define SDLP_FRAME_POOL_STORAGE(name, count, buffer_size)                                       \
+    static _Alignas(SDLP_FRAME_POOL_ALIGN) uint8_t                                              \
+        name##_buffers[(count) * SDLP_FRAME_POOL_STRIDE(buffer_size)];                          \
+    static sdlp_frame_pool_link_t name##_links[(count)]
+
+typedef struct {
+    uint8_t *buffers;
+    sdlp_frame_pool_link_t *links;  /* free stack: index + 1 of the next free buffer, 0 ends */
+    size_t buffer_size;
+    size_t stride;
+    uint16_t count;
+    sdlp_frame_pool_head_t head;    /* pop count << 16 | index + 1 of the top, 0 if empty */
+} sdlp_frame_pool_t;
+
+/* buffers must be SDLP_FRAME_POOL_ALIGN-aligned and hold
+ * count * SDLP_FRAME_POOL_STRIDE(buffer_size) bytes; links holds count entries.
+ * All buffers start out free. */
+int sdlp_frame_pool_init(sdlp_frame_pool_t *pool, uint8_t *buffers, sdlp_frame_pool_link_t *links,
+                         size_t count, size_t buffer_size);
+
+/* Take a free buffer of pool->buffer_size bytes; SDLP_ERROR_BUFFER_TOO_SMALL
+ * if all are in use. */
+int sdlp_frame_pool_acquire(sdlp_frame_pool_t *pool, uint8_t **buffer);
+
+/* Return a buffer from sdlp_frame_pool_acquire(), from any thread. */
+int sdlp_frame_pool_release(sdlp_frame_pool_t *pool, uint8_t *buffer);
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef SDLP_MUX_H
+#define SDLP_MUX_H
+
+#include "sdlp_packet.h"
+
+/* Only Idle Data frames use the all-ones virtual channel (CCSDS 132.0-B-3). */
+#define TM_OID_VIRTUAL_CHANNEL 7
+#define SDLP_IDLE_FILL_BYTE 0x55u
+
+typedef enum {
+    SDLP_MUX_PRIORITY = 0,      /* highest priority VC with data goes first */
+    SDLP_MUX_WEIGHTED_RR = 1    /* VCs share frames in proportion to their weight */
+} sdlp_mux_policy_t;
+
+/* Virtual channel queue of the multiplexer. Packets are queued whole in the
+ * caller-provided byte ring and packed back to back into fixed-length frames.
+ * Not thread-safe: enqueue and frame generation must be serialised. */
+typedef struct {
+    sdlp_tm_virtual_channel_t channel;
+    uint8_t *ring;
+    size_t ring_size;
+    size_t head;                /* read position (monotonic) */
+    size_t tail;                /* write position (monotonic) */
+    size_t packet_remaining;    /* bytes of the packet at head not yet framed */
+    size_t pad_remaining;       /* bytes of a spanning idle packet not yet framed */
+    size_t pad_length;
+    uint8_t priority;           /* SDLP_MUX_PRIORITY: larger is served first */
+    uint8_t weight;             /* SDLP_MUX_WEIGHTED_RR: frames per round */
+    uint8_t credit;
+    uint32_t frames;
+    uint32_t packets;
+} sdlp_mux_vc_t;
+
+typedef struct {
+    sdlp_tm_master_channel_t master;
+    sdlp_tm_virtual_channel_t oid_channel;
+    sdlp_mux_vc_t *vcs[TM_MAX_VIRTUAL_CHANNELS];
+    uint8_t vc_count;
+    uint8_t cursor;             /* SDLP_MUX_WEIGHTED_RR position */
+    sdlp_mux_policy_t policy;
+    size_t frame_length;        /* encoded frame length, header and FECF included */
+    uint32_t frames;
+    uint32_t idle_frames;
+    uint16_t oid_crc;           /* FECF of the OID frame with both counts zero */
+    uint16_t oid_counts_shift;
+} sdlp_mux_t;
+
+int sdlp_mux_init(sdlp_mux_t *mux, uint16_t spacecraft_id, size_t frame_length,
+                  sdlp_mux_policy_t policy);
+
+/* Register a virtual channel (0-6) backed by ring[ring_size]. */
+int sdlp_mux_add_vc(sdlp_mux_t *mux, sdlp_mux_vc_t *vc, uint8_t virtual_channel_id,
+                    uint8_t *ring, size_t ring_size, uint8_t priority, uint8_t weight);
+
+/* Queue one complete Space Packet; SDLP_ERROR_BUFFER_TOO_SMALL if the ring is full. */
+int sdlp_mux_enqueue(sdlp_mux_vc_t *vc, const uint8_t *packet, size_t length);
+
+size_t sdlp_mux_queued(const sdlp_mux_vc_t *vc);
+
+/* Produce the next frame_length-byte frame: a VC with a full frame of data if
+ * any, else a VC with partial data padded with an idle packet, else an OID
+ * frame. */
+int sdlp_mux_next_frame(sdlp_mux_t *mux, uint8_t *buffer, size_t buffer_size,
+                        size_t *encoded_size);
+
+#endif
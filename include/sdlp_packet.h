@@ -0,0 +1,70 @@
+#ifndef SDLP_PACKET_H
+#define SDLP_PACKET_H
+
+#include "sdlp_tm.h"
+
+/* CCSDS Space Packet primary header (CCSDS 133.0-B). */
+#define SDLP_SPACE_PACKET_HEADER_SIZE 6
+#define SDLP_SPACE_PACKET_IDLE_APID 0x07FFu
+
+/* First Header Pointer: low 11 bits of the TM data field status
+ * (CCSDS 132.0-B-3). */
+#define TM_FHP_MASK 0x07FFu
+#define TM_FHP_NO_PACKET_START 0x07FFu
+#define TM_FHP_IDLE_DATA 0x07FEu
+
+/* Called for every complete packet. packet points either into the pushed frame
+ * (packet wholly inside one frame) or into the reassembly buffer, and is valid
+ * only for the duration of the call. */
+typedef void (*sdlp_packet_cb)(void *user, const uint8_t *packet, size_t length);
+
+typedef struct {
+    uint8_t *reassembly_buffer;     /* caller-provided, holds one spanning packet */
+    size_t reassembly_capacity;     /* longest spanning packet accepted */
+    sdlp_packet_cb on_packet;
+    void *user;
+} sdlp_packet_extractor_config_t;
+
+typedef struct {
+    uint32_t frames;            /* frames pushed */
+    uint32_t packets;           /* packets delivered */
+    uint32_t idle_packets;      /* idle packets skipped */
+    uint32_t idle_frames;       /* frames carrying only idle data */
+    uint32_t frame_gaps;        /* VC frame count discontinuities */
+    uint32_t resyncs;           /* packet boundaries inconsistent with the FHP */
+    uint32_t oversize_packets;  /* spanning packets longer than the reassembly buffer */
+    uint32_t discarded_bytes;   /* data field bytes dropped while out of sync */
+} sdlp_packet_extractor_stats_t;
+
+/* Per virtual channel packet extractor (CCSDS 132.0-B-3, packet service). */
+typedef struct {
+    sdlp_packet_extractor_config_t config;
+    sdlp_packet_extractor_stats_t stats;
+    size_t fill;                /* bytes of the spanning packet collected */
+    size_t expected;            /* its total length, 0 until the header is complete */
+    size_t skip;                /* bytes of an oversize packet still to drop */
+    uint8_t in_sync;            /* a packet boundary is known */
+    uint8_t have_frame_count;
+    uint8_t next_frame_count;   /* expected VC frame count of the next frame */
+} sdlp_packet_extractor_t;
+
+int sdlp_packet_extractor_init(sdlp_packet_extractor_t *extractor,
+                               const sdlp_packet_extractor_config_t *config);
+
+/* Drop any partial packet and wait for the next First Header Pointer. */
+void sdlp_packet_extractor_reset(sdlp_packet_extractor_t *extractor);
+
+/* Feed the data field of the next frame of this virtual channel. */
+int sdlp_packet_extractor_push(sdlp_packet_extractor_t *extractor, const sdlp_tm_header_t *header,
+                               const uint8_t *data, size_t data_length);
+
+int sdlp_packet_extractor_push_view(sdlp_packet_extractor_t *extractor,
+                                    const sdlp_tm_frame_view_t *view);
+
+int sdlp_packet_extractor_push_frame(sdlp_packet_extractor_t *extractor,
+                                     const sdlp_tm_frame_t *frame);
+
+/* Total length of the Space Packet starting at header (primary header + data). */
+size_t sdlp_space_packet_length(const uint8_t *header);
+
+#endif
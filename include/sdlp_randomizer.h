@@ -0,0 +1,32 @@
+#ifndef SDLP_RANDOMIZER_H
+#define SDLP_RANDOMIZER_H
+
+#include "sdlp_tm.h"
+
+/* CCSDS pseudo-randomizer (CCSDS 131.0-B, h(x) = x^8 + x^7 + x^5 + x^3 + 1).
+ * It covers the whole transfer frame, FECF included, but not the ASM. The
+ * sequence is XORed, so the same call randomizes and derandomizes. */
+#define SDLP_RANDOMIZER_PERIOD 255
+
+int sdlp_randomize(uint8_t *buffer, size_t length);
+
+int sdlp_randomize_copy(uint8_t *dst, const uint8_t *src, size_t length);
+
+/* sdlp_tm_encode_frame() / sdlp_tm_builder_commit() followed by randomization,
+ * with copy, CRC and XOR done in one pass over the frame. */
+int sdlp_tm_encode_frame_randomized(const sdlp_tm_frame_t *frame, uint8_t *buffer,
+                                    size_t buffer_size, size_t *encoded_size);
+
+int sdlp_tm_builder_commit_randomized(sdlp_tm_builder_t *builder, uint16_t data_length,
+                                      size_t *encoded_size);
+
+/* Derandomize a received frame in place and decode it into a view, FECF
+ * checked in the same pass. */
+int sdlp_tm_decode_view_randomized(uint8_t *buffer, size_t buffer_size,
+                                   sdlp_tm_frame_view_t *view);
+
+/* Derandomize into frame->data while checking the FECF; buffer is not modified. */
+int sdlp_tm_decode_frame_randomized(const uint8_t *buffer, size_t buffer_size,
+                                    sdlp_tm_frame_t *frame);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef SDLP_RS_H
+#define SDLP_RS_H
+
+#include "sdlp_common.h"
+
+/* CCSDS Reed-Solomon (255,223) (CCSDS 131.0-B), correcting up to 16 symbol
+ * errors per codeword. A codeblock of interleave depth I carries I codewords:
+ * symbol j of codeword i is byte j * I + i, so the transfer frame comes first
+ * and the I * 32 parity bytes follow it. Shortened codes drop virtual_fill
+ * leading zero symbols from every codeword; they are not transmitted. */
+#define SDLP_RS_N 255
+#define SDLP_RS_K 223
+#define SDLP_RS_PARITY 32
+#define SDLP_RS_MAX_ERRORS 16
+#define SDLP_RS_MAX_INTERLEAVE 8
+
+typedef struct {
+    uint8_t interleave;   /* 1..SDLP_RS_MAX_INTERLEAVE */
+    uint8_t dual_basis;   /* symbols in the CCSDS dual basis, as transmitted */
+    uint8_t virtual_fill; /* 0..SDLP_RS_K - 1 */
+} sdlp_rs_config_t;
+
+/* Bytes of the frame protected by one codeblock, I * (223 - virtual_fill). */
+size_t sdlp_rs_data_length(const sdlp_rs_config_t *config);
+
+/* Data plus parity, I * (255 - virtual_fill). */
+size_t sdlp_rs_codeblock_length(const sdlp_rs_config_t *config);
+
+/* Compute the parity of the frame at the start of codeblock and write it
+ * behind the frame, in place. */
+int sdlp_rs_encode(const sdlp_rs_config_t *config, uint8_t *codeblock, size_t codeblock_size);
+
+/* Correct the codeblock in place. corrected (optional) receives the number of
+ * symbols repaired. Returns SDLP_ERROR_UNCORRECTABLE if any codeword has more
+ * than 16 errors; such codewords are left as received. */
+int sdlp_rs_decode(const sdlp_rs_config_t *config, uint8_t *codeblock, size_t codeblock_size,
+                   int *corrected);
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef SDLP_SEGMENT_H
+#define SDLP_SEGMENT_H
+
+#include "sdlp_tc.h"
+
+/* TC segmentation and MAP reassembly (CCSDS 232.0-B-4, Segmentation sublayer).
+ * The segment header is part of the frame data field on the wire. With
+ * TC_SEGMENT_HEADER_ENABLED it is carried in segment_header of the builder and
+ * view; otherwise it is the first byte of their data field. The frames are
+ * identical either way. */
+#define TC_MAX_MAP_IDS 64
+#define TC_MAP_NO_CONTEXT 0xFFu
+
+#ifdef TC_SEGMENT_HEADER_ENABLED
+#define TC_MAX_SEGMENT_SIZE TC_MAX_DATA_SIZE
+#else
+#define TC_MAX_SEGMENT_SIZE (TC_MAX_DATA_SIZE - TC_SEGMENT_HEADER_SIZE)
+#endif
+
+/* Splits one SDU into FIRST/CONTINUE/LAST segments of segment_size bytes (an
+ * SDU that fits in one segment is sent unsegmented). The SDU is read in place
+ * and must stay valid until the last frame has been produced. */
+typedef struct {
+    uint16_t spacecraft_id;
+    uint8_t virtual_channel_id;
+    uint8_t map_id;
+    uint8_t frame_seq_num;      /* sequence number of the next frame */
+    uint16_t segment_size;      /* SDU bytes per frame, segment header excluded */
+    const uint8_t *sdu;
+    size_t sdu_length;
+    size_t offset;              /* SDU bytes already framed */
+    uint32_t frames;
+    uint32_t sdus;
+} sdlp_tc_segmenter_t;
+
+int sdlp_tc_segmenter_init(sdlp_tc_segmenter_t *segmenter, uint16_t spacecraft_id,
+                           uint8_t virtual_channel_id, uint8_t map_id, uint16_t segment_size);
+
+int sdlp_tc_segmenter_start(sdlp_tc_segmenter_t *segmenter, const uint8_t *sdu,
+                            size_t sdu_length);
+
+/* Nonzero while the current SDU has segments left to frame. */
+int sdlp_tc_segmenter_pending(const sdlp_tc_segmenter_t *segmenter);
+
+/* Encode the next segment as one TC frame into buffer. */
+int sdlp_tc_segmenter_next(sdlp_tc_segmenter_t *segmenter, uint8_t *buffer, size_t buffer_size,
+                           size_t *encoded_size);
+
+/* Encode a whole SDU as back-to-back frames in buffer. All frames but the last
+ * carry segment_size bytes of the SDU. *frame_count may be NULL. On
+ * SDLP_ERROR_BUFFER_TOO_SMALL nothing is consumed. */
+int sdlp_tc_segment_sdu(sdlp_tc_segmenter_t *segmenter, const uint8_t *sdu, size_t sdu_length,
+                        uint8_t *buffer, size_t buffer_size, size_t *encoded_size,
+                        size_t *frame_count);
+
+/* Called for every reassembled SDU. sdu points into the frame (unsegmented SDU)
+ * or into the MAP context buffer and is valid only for the duration of the call. */
+typedef void (*sdlp_tc_sdu_cb)(void *user, uint8_t map_id, const uint8_t *sdu, size_t length);
+
+/* Reassembly state of one MAP with an SDU in progress. */
+typedef struct {
+    uint8_t *buffer;            /* max_sdu_length bytes of the pool */
+    size_t fill;
+    uint8_t map_id;
+    uint8_t active;
+} sdlp_tc_map_context_t;
+
+typedef struct {
+    uint8_t *pool;              /* caller-provided, context_count * max_sdu_length bytes */
+    size_t max_sdu_length;
+    sdlp_tc_map_context_t *contexts;    /* caller-provided */
+    uint8_t context_count;      /* MAPs that can have an SDU in progress at once */
+    sdlp_tc_sdu_cb on_sdu;
+    void *user;
+} sdlp_tc_reassembler_config_t;
+
+typedef struct {
+    uint32_t frames;            /* frames pushed */
+    uint32_t segments;          /* FIRST/CONTINUE/LAST segments accepted */
+    uint32_t sdus;              /* SDUs delivered */
+    uint32_t control_frames;    /* control commands, which carry no segment header */
+    uint32_t aborted_sdus;      /* SDUs cut short by a new FIRST or unsegmented SDU */
+    uint32_t orphan_segments;   /* CONTINUE/LAST without a FIRST */
+    uint32_t oversize_sdus;     /* SDUs longer than max_sdu_length */
+    uint32_t no_context;        /* FIRST segments dropped, every context busy */
+} sdlp_tc_reassembler_stats_t;
+
+/* Per virtual channel reassembler; the caller routes frames by VCID. */
+typedef struct {
+    sdlp_tc_reassembler_config_t config;
+    sdlp_tc_reassembler_stats_t stats;
+    uint8_t map_context[TC_MAX_MAP_IDS];    /* context index, TC_MAP_NO_CONTEXT if idle */
+} sdlp_tc_reassembler_t;
+
+int sdlp_tc_reassembler_init(sdlp_tc_reassembler_t *reassembler,
+                             const sdlp_tc_reassembler_config_t *config);
+
+/* Drop every SDU in progress; statistics are kept. */
+void sdlp_tc_reassembler_reset(sdlp_tc_reassembler_t *reassembler);
+
+int sdlp_tc_reassembler_push_view(sdlp_tc_reassembler_t *reassembler,
+                                  const sdlp_tc_frame_view_t *view);
+
+/* Decode, verify the FECF and push one encoded frame. */
+int sdlp_tc_reassembler_push(sdlp_tc_reassembler_t *reassembler, const uint8_t *frame,
+                             size_t frame_length);
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef SDLP_STATS_H
+#define SDLP_STATS_H
+
+#include "sdlp_common.h"
+#include "sdlp_tm.h"
+
+/* Link statistics, compiled in with -DSDLP_STATS_ENABLED; without it the hooks
+ * in the encode/decode paths are empty macros and every snapshot is zero.
+ * -DSDLP_STATS_CYCLES adds cycle-count histograms (TSC on x86, CNTVCT on
+ * AArch64, or define SDLP_STATS_CYCLE_COUNTER() for other targets).
+ *
+ * Each thread counts into its own cache-line-aligned slot with plain relaxed
+ * stores; threads beyond SDLP_STATS_MAX_THREADS - 1 share the last slot with
+ * atomic adds. Build with -DSDLP_STATS_NO_TLS where thread-local storage is
+ * unavailable to use that shared slot only. Counters are 64-bit on every
+ * target; where 64-bit atomics are not lock-free the shared slot's adds may
+ * need libatomic. */
+#ifndef SDLP_STATS_MAX_THREADS
+#define SDLP_STATS_MAX_THREADS 8
+#endif
+
+/* Spacecraft whose frame counts each thread tracks at once. */
+#ifndef SDLP_STATS_MASTER_CHANNELS
+#define SDLP_STATS_MASTER_CHANNELS 4
+#endif
+
+#define SDLP_STATS_HISTOGRAM_BINS 32 /* bin b: [2^b, 2^(b+1)) cycles, the last open-ended */
+
+typedef enum {
+    SDLP_STATS_TIMER_ENCODE = 0, /* TM/TC encode and builder commit */
+    SDLP_STATS_TIMER_DECODE,     /* TM/TC decode with FECF check, per frame */
+    SDLP_STATS_TIMER_CRC,        /* sdlp_crc16() / sdlp_crc16_update() */
+    SDLP_STATS_TIMERS
+} sdlp_stats_timer_t;
+
+typedef struct {
+    uint64_t tm_frames_encoded;
+    uint64_t tm_frames_decoded; /* FECF verified */
+    uint64_t tc_frames_encoded;
+    uint64_t tc_frames_decoded;
+    uint64_t crc_mismatches;
+    uint64_t invalid_frames;    /* decodes returning SDLP_ERROR_INVALID_FRAME */
+    uint64_t buffer_too_small;
+    /* Frame count steps other than +1 between consecutive good TM frames of
+     * one spacecraft on one decoding thread, summed over spacecraft. Each
+     * thread follows the last SDLP_STATS_MASTER_CHANNELS spacecraft it saw;
+     * one beyond that replaces the oldest, whose tracking then restarts.
+     * Threads on the shared slot are not tracked. */
+    uint64_t tm_mc_discontinuities;
+    uint64_t tm_vc_discontinuities[TM_MAX_VIRTUAL_CHANNELS];
+    uint64_t cycles[SDLP_STATS_TIMERS][SDLP_STATS_HISTOGRAM_BINS];
+} sdlp_stats_t;
+
+/* Sum of all threads' counters since start-up, read without locks while
+ * frames are in flight. Each counter is exact, but counters are not read at
+ * one instant; diff two snapshots for rates. */
+int sdlp_stats_snapshot(sdlp_stats_t *stats);
+
+#endif
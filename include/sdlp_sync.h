@@ -0,0 +1,73 @@
+#ifndef SDLP_SYNC_H
+#define SDLP_SYNC_H
+
+#include "sdlp_common.h"
+
+/* Attached Sync Marker (CCSDS 131.0-B, TM Synchronization and Channel Coding). */
+#define SDLP_ASM 0x1ACFFC1Du
+#define SDLP_ASM_SIZE 4
+
+/* Synchronizer states.
+ *   SEARCH  scanning the stream for the ASM (or its inverse) at any bit offset
+ *   CHECK   marker found, waiting for check_threshold consecutive markers
+ *   LOCK    locked; up to flywheel consecutive bad markers are tolerated */
+typedef enum {
+    SDLP_SYNC_SEARCH = 0,
+    SDLP_SYNC_CHECK  = 1,
+    SDLP_SYNC_LOCK   = 2
+} sdlp_sync_state_t;
+
+/* Called for every frame recovered from the stream. frame is byte-aligned,
+ * polarity-corrected and valid only for the duration of the call. state is
+ * SDLP_SYNC_CHECK for frames not yet confirmed by a lock. */
+typedef void (*sdlp_sync_frame_cb)(void *user, const uint8_t *frame, size_t frame_length,
+                                   sdlp_sync_state_t state);
+
+typedef struct {
+    size_t frame_length;        /* transfer frame length in bytes, ASM excluded */
+    uint8_t *frame_buffer;      /* caller-provided, frame_length bytes */
+    uint8_t check_threshold;    /* verified markers needed for CHECK -> LOCK */
+    uint8_t flywheel;           /* consecutive bad markers tolerated in LOCK */
+    uint8_t max_marker_errors;  /* bit errors accepted in a marker while locked */
+    sdlp_sync_frame_cb on_frame;
+    void *user;
+} sdlp_sync_config_t;
+
+typedef struct {
+    uint32_t frames;            /* frames delivered */
+    uint32_t acquisitions;      /* SEARCH -> CHECK transitions */
+    uint32_t locks;             /* CHECK -> LOCK transitions */
+    uint32_t lock_losses;       /* LOCK -> SEARCH transitions (flywheel exhausted) */
+    uint32_t flywheel_frames;   /* frames delivered after a bad marker */
+    uint32_t marker_bit_errors; /* corrected bit errors in accepted markers */
+} sdlp_sync_stats_t;
+
+typedef struct {
+    sdlp_sync_config_t config;
+    sdlp_sync_state_t state;
+    sdlp_sync_stats_t stats;
+    uint32_t history;           /* last four input bytes before the current chunk */
+    size_t fill;                /* frame + marker bytes collected since the last marker */
+    uint8_t marker[SDLP_ASM_SIZE];
+    uint8_t prev;               /* previous input byte, for bit-slipped extraction */
+    uint8_t shift;              /* bit offset of the marker, 0-7 */
+    uint8_t invert;             /* 0xFF when the stream is inverted */
+    uint8_t verified;
+    uint8_t missed;
+    uint8_t key_count;
+    uint8_t next_key_count;
+    uint8_t keys[16];           /* byte b[n-2] of a marker for every shift and polarity */
+    uint8_t next_keys[16];      /* byte b[n-1] of a marker for every shift and polarity */
+    uint8_t key_map[32];        /* keys as 256-bit membership bitmaps */
+    uint8_t next_key_map[32];
+} sdlp_sync_t;
+
+int sdlp_sync_init(sdlp_sync_t *sync, const sdlp_sync_config_t *config);
+
+/* Drop any partial frame and return to SEARCH; statistics are kept. */
+void sdlp_sync_reset(sdlp_sync_t *sync);
+
+/* Feed the next piece of the raw stream. Chunks may have any length. */
+int sdlp_sync_process(sdlp_sync_t *sync, const uint8_t *data, size_t length);
+
+#endif
@@ -5,9 +5,16 @@
 
 #define TC_PRIMARY_HEADER_SIZE 5
 #define TC_FRAME_ERROR_CONTROL_SIZE 2
+
+/* Data field capacity of sdlp_tc_frame_t, per build like TM_MAX_DATA_SIZE.
+ * At most 1024, the range of the 10-bit frame length field. */
+#ifndef TC_MAX_DATA_SIZE
 #define TC_MAX_DATA_SIZE 1024
+#endif
 
-#ifdef TC_SEGMENT_HEADER_ENABLED
+#if TC_MAX_DATA_SIZE < 1 || TC_MAX_DATA_SIZE > 1024
+#error "TC_MAX_DATA_SIZE must be 1..1024"
+#endif
 
 #define TC_SEGMENT_HEADER_SIZE 1
 
@@ -30,8 +37,6 @@ typedef struct {
     uint8_t map_id : 6;          /* bits 2-7: MAP Identifier */
 } sdlp_tc_segment_header_t;
 
-#endif /* TC_SEGMENT_HEADER_ENABLED */
-
 typedef struct {
     uint16_t transfer_frame_version : 2;
     uint16_t bypass_flag : 1;
@@ -53,6 +58,34 @@ typedef struct {
     uint16_t fecf;
 } sdlp_tc_frame_t;
 
+/* Zero-copy view of an encoded TC frame. data points into the caller's buffer,
+ * which must outlive the view. */
+typedef struct {
+    sdlp_tc_header_t header;
+#ifdef TC_SEGMENT_HEADER_ENABLED
+    sdlp_tc_segment_header_t segment_header;
+#endif
+    const uint8_t *frame;
+    size_t frame_length;
+    const uint8_t *data;
+    uint16_t data_length;
+    uint16_t fecf;
+} sdlp_tc_frame_view_t;
+
+/* In-place frame builder, see sdlp_tm_builder_t. With TC_SEGMENT_HEADER_ENABLED
+ * the data field follows the segment header, so control_command_flag must not be
+ * changed between begin and commit. frame_length is derived at commit. */
+typedef struct {
+    sdlp_tc_header_t header;
+#ifdef TC_SEGMENT_HEADER_ENABLED
+    sdlp_tc_segment_header_t segment_header;
+#endif
+    uint8_t *buffer;
+    size_t buffer_size;
+    uint8_t *data;
+    uint16_t data_capacity;
+} sdlp_tc_builder_t;
+
 int sdlp_tc_create_frame(sdlp_tc_frame_t *frame, uint16_t spacecraft_id, 
                           uint8_t virtual_channel_id, uint8_t frame_seq_num,
                           const uint8_t *data, uint16_t data_length);
@@ -63,6 +96,35 @@ int sdlp_tc_encode_frame(const sdlp_tc_frame_t *frame, uint8_t *buffer,
 int sdlp_tc_decode_frame(const uint8_t *buffer, size_t buffer_size, 
                           sdlp_tc_frame_t *frame);
 
+/* Gathered encode, see sdlp_tm_encode_iov(). Byte-identical to
+ * sdlp_tc_create_frame() + sdlp_tc_encode_frame(). */
+int sdlp_tc_encode_iov(uint16_t spacecraft_id, uint8_t virtual_channel_id, uint8_t frame_seq_num,
+                       const sdlp_iovec_t *iov, size_t iov_count, uint8_t *buffer,
+                       size_t buffer_size, size_t *encoded_size);
+
+/* Parse only the primary header: no copy, no CRC. buffer_size need only cover
+ * the header. */
+int sdlp_tc_peek_header(const uint8_t *buffer, size_t buffer_size, sdlp_tc_header_t *header);
+
+/* Parse a TC frame without copying its data field. When verify_crc is zero the
+ * FECF is only extracted; check it later with sdlp_tc_view_verify_crc(). */
+int sdlp_tc_decode_view(const uint8_t *buffer, size_t buffer_size,
+                        sdlp_tc_frame_view_t *view, int verify_crc);
+
+int sdlp_tc_view_verify_crc(const sdlp_tc_frame_view_t *view);
+
+/* Decode count frames into views, CRC included. results[i] receives the status
+ * of frame i; the return value only reports invalid arguments. */
+int sdlp_tc_decode_batch(const sdlp_frame_desc_t *frames, size_t count,
+                         sdlp_tc_frame_view_t *views, int *results);
+
+int sdlp_tc_builder_begin(sdlp_tc_builder_t *builder, uint8_t *buffer, size_t buffer_size,
+                          uint16_t spacecraft_id, uint8_t virtual_channel_id,
+                          uint8_t frame_seq_num);
+
+int sdlp_tc_builder_commit(sdlp_tc_builder_t *builder, uint16_t data_length,
+                           size_t *encoded_size);
+
 #ifdef TC_SEGMENT_HEADER_ENABLED
 /* Set the segment header fields on a TC frame.
  * Must not be called for frames with control_command_flag set (per CCSDS 232.0-B-4 4.1.3.2.2.1.3).
@@ -5,7 +5,21 @@
 
 #define TM_PRIMARY_HEADER_SIZE 6
 #define TM_FRAME_ERROR_CONTROL_SIZE 2
+#define TM_MAX_VIRTUAL_CHANNELS 8
+#define TM_MAX_FRAME_LENGTH 2048 /* CCSDS 132.0-B-3 */
+
+/* Data field capacity of sdlp_tm_frame_t and the largest data field the
+ * encoders accept. Set it per build (-DTM_MAX_DATA_SIZE=...), identically for
+ * the library and its users: small values shrink every frame object, up to
+ * 2040 represents maximum-length frames. */
+#ifndef TM_MAX_DATA_SIZE
 #define TM_MAX_DATA_SIZE 1024
+#endif
+
+#if TM_MAX_DATA_SIZE < 1 || \
+    TM_MAX_DATA_SIZE > TM_MAX_FRAME_LENGTH - TM_PRIMARY_HEADER_SIZE - TM_FRAME_ERROR_CONTROL_SIZE
+#error "TM_MAX_DATA_SIZE must be 1..2040"
+#endif
 
 typedef struct {
     uint16_t transfer_frame_version : 2;
@@ -24,6 +38,55 @@ typedef struct {
     uint16_t fecf;
 } sdlp_tm_frame_t;
 
+/* Master channel context: owns the MC frame count of one spacecraft ID. */
+typedef struct {
+    uint16_t spacecraft_id;
+    sdlp_counter_t frame_count;
+} sdlp_tm_master_channel_t;
+
+/* Virtual channel context: owns the VC frame count. Each frame takes the next
+ * MC and VC counts with one atomic increment each, so producer threads may emit
+ * frames on different VCs of the same master channel without a lock. */
+typedef struct {
+    sdlp_tm_master_channel_t *master;
+    uint8_t virtual_channel_id;
+    sdlp_counter_t frame_count;
+} sdlp_tm_virtual_channel_t;
+
+/* Zero-copy view of an encoded TM frame. data points into the caller's buffer,
+ * which must outlive the view. */
+typedef struct {
+    sdlp_tm_header_t header;
+    const uint8_t *frame;
+    size_t frame_length;
+    const uint8_t *data;
+    uint16_t data_length;
+    uint16_t fecf;
+} sdlp_tm_frame_view_t;
+
+/* In-place frame builder. sdlp_tm_builder_begin() initialises the header like
+ * sdlp_tm_create_frame() and exposes the data field inside the caller's
+ * transmit buffer; the producer writes up to data_capacity bytes to data (and
+ * may adjust header), then sdlp_tm_builder_commit() packs the header and FECF.
+ * The result is byte-identical to sdlp_tm_create_frame() + _encode_frame(). */
+typedef struct {
+    sdlp_tm_header_t header;
+    uint8_t *buffer;
+    size_t buffer_size;
+    uint8_t *data;
+    uint16_t data_capacity;
+} sdlp_tm_builder_t;
+
+/* Encoded frame re-sent with small changes, e.g. idle or fixed-layout
+ * housekeeping frames. The FECF is patched from the CRC of the changed bytes
+ * alone, so an update costs O(changed bytes + log frame length). */
+typedef struct {
+    uint8_t *buffer;
+    size_t frame_length;
+    uint16_t counts_shift; /* x^(8 * bytes between the frame counts and the FECF) mod P */
+} sdlp_tm_template_t;
+
+/* Uses a process-wide default master channel with one counter per VC. */
 int sdlp_tm_create_frame(sdlp_tm_frame_t *frame, uint16_t spacecraft_id, 
                           uint8_t virtual_channel_id, const uint8_t *data, 
                           uint16_t data_length);
@@ -34,4 +97,63 @@ int sdlp_tm_encode_frame(const sdlp_tm_frame_t *frame, uint8_t *buffer,
 int sdlp_tm_decode_frame(const uint8_t *buffer, size_t buffer_size, 
                           sdlp_tm_frame_t *frame);
 
+/* Encode a frame whose data field is the concatenation of iov_count segments,
+ * gathered straight into buffer with the FECF computed as they are copied.
+ * Byte-identical to sdlp_tm_create_frame() + sdlp_tm_encode_frame(). */
+int sdlp_tm_encode_iov(uint16_t spacecraft_id, uint8_t virtual_channel_id, const sdlp_iovec_t *iov,
+                       size_t iov_count, uint8_t *buffer, size_t buffer_size,
+                       size_t *encoded_size);
+
+/* Parse only the primary header: no copy, no CRC. buffer_size need only cover
+ * the header. */
+int sdlp_tm_peek_header(const uint8_t *buffer, size_t buffer_size, sdlp_tm_header_t *header);
+
+/* Parse a TM frame without copying its data field. When verify_crc is zero the
+ * FECF is only extracted; check it later with sdlp_tm_view_verify_crc(). */
+int sdlp_tm_decode_view(const uint8_t *buffer, size_t buffer_size,
+                        sdlp_tm_frame_view_t *view, int verify_crc);
+
+int sdlp_tm_view_verify_crc(const sdlp_tm_frame_view_t *view);
+
+/* Decode count frames into views, CRC included. results[i] receives the status
+ * of frame i; the return value only reports invalid arguments. */
+int sdlp_tm_decode_batch(const sdlp_frame_desc_t *frames, size_t count,
+                         sdlp_tm_frame_view_t *views, int *results);
+
+int sdlp_tm_master_channel_init(sdlp_tm_master_channel_t *master, uint16_t spacecraft_id);
+
+int sdlp_tm_virtual_channel_init(sdlp_tm_virtual_channel_t *channel,
+                                 sdlp_tm_master_channel_t *master,
+                                 uint8_t virtual_channel_id);
+
+int sdlp_tm_vc_create_frame(sdlp_tm_virtual_channel_t *channel, sdlp_tm_frame_t *frame,
+                            const uint8_t *data, uint16_t data_length);
+
+int sdlp_tm_vc_encode_iov(sdlp_tm_virtual_channel_t *channel, const sdlp_iovec_t *iov,
+                          size_t iov_count, uint8_t *buffer, size_t buffer_size,
+                          size_t *encoded_size);
+
+int sdlp_tm_vc_builder_begin(sdlp_tm_virtual_channel_t *channel, sdlp_tm_builder_t *builder,
+                             uint8_t *buffer, size_t buffer_size);
+
+int sdlp_tm_builder_begin(sdlp_tm_builder_t *builder, uint8_t *buffer, size_t buffer_size,
+                          uint16_t spacecraft_id, uint8_t virtual_channel_id);
+
+int sdlp_tm_builder_commit(sdlp_tm_builder_t *builder, uint16_t data_length,
+                           size_t *encoded_size);
+
+/* Encode frame into buffer once and keep it as a template. */
+int sdlp_tm_template_init(sdlp_tm_template_t *tmpl, const sdlp_tm_frame_t *frame,
+                          uint8_t *buffer, size_t buffer_size);
+
+/* Overwrite length bytes at offset (header or data field) and patch the FECF. */
+int sdlp_tm_template_patch(sdlp_tm_template_t *tmpl, size_t offset, const uint8_t *bytes,
+                           size_t length);
+
+int sdlp_tm_template_set_counts(sdlp_tm_template_t *tmpl, uint8_t master_channel_frame_count,
+                                uint8_t virtual_channel_frame_count);
+
+/* Stamp the next MC/VC frame counts of channel into the template. */
+int sdlp_tm_vc_template_next(sdlp_tm_virtual_channel_t *channel, sdlp_tm_template_t *tmpl);
+
 #endif
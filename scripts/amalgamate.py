@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+"""Generate the single-header library (make amalgamation writes build/sdlp.h).
+
+usage: amalgamate.py OUTPUT
+
+Every public header is inlined once, in dependency order. The sources, with
+their private headers, follow under SDLP_IMPLEMENTATION: define it in exactly
+one translation unit before including sdlp.h. Compiling the library into the
+caller's own translation unit lets the compiler inline and specialise it
+(e.g. with the fixed-length frame functions of sdlp_fixed.h) without LTO.
+"""
+import os
+import re
+import sys
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INCLUDE_DIR = os.path.join(ROOT_DIR, "include")
+SRC_DIR = os.path.join(ROOT_DIR, "src")
+
+LOCAL_INCLUDE = re.compile(r'^\s*#\s*include\s+"([^"]+)"\s*$')
+
+
+def find(name):
+    for directory in (INCLUDE_DIR, SRC_DIR):
+        path = os.path.join(directory, name)
+        if os.path.exists(path):
+            return path
+    raise SystemExit("amalgamate.py: cannot find %s" % name)
+
+
+def inline(path, seen, out):
+    """Append path to out with its local includes expanded: public headers on
+    first use, private ones every time, since their guards may differ by the
+    macros in effect (sdlp_rs_tables.h with SDLP_RS_TABLES_SIMD)."""
+    rel = os.path.relpath(path, ROOT_DIR)
+    out.append("/* ---- %s ---- */\n" % rel)
+    with open(path) as f:
+        for line in f:
+            match = LOCAL_INCLUDE.match(line)
+            if not match:
+                out.append(line)
+                continue
+            header = find(match.group(1))
+            if header not in seen:
+                if os.path.dirname(header) == INCLUDE_DIR:
+                    seen.add(header)
+                inline(header, seen, out)
+    out.append("\n")
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write(__doc__)
+        return 2
+
+    seen = set()
+    out = ["/* Generated by scripts/amalgamate.py - do not edit.\n"
+           " * EmbeddedSDLP single-header build. In one translation unit:\n"
+           " *     #define SDLP_IMPLEMENTATION\n"
+           " *     #include \"sdlp.h\"\n"
+           " * Other translation units include it without the define. */\n"
+           "#ifndef SDLP_H\n#define SDLP_H\n\n"]
+
+    for name in sorted(os.listdir(INCLUDE_DIR)):
+        path = os.path.join(INCLUDE_DIR, name)
+        if name.endswith(".h") and path not in seen:
+            seen.add(path)
+            inline(path, seen, out)
+
+    out.append("#endif /* SDLP_H */\n\n"
+               "#if defined(SDLP_IMPLEMENTATION) && !defined(SDLP_IMPLEMENTATION_INCLUDED)\n"
+               "#define SDLP_IMPLEMENTATION_INCLUDED\n\n")
+    for name in sorted(os.listdir(SRC_DIR)):
+        if name.endswith(".c"):
+            inline(os.path.join(SRC_DIR, name), seen, out)
+    out.append("#endif /* SDLP_IMPLEMENTATION */\n")
+
+    with open(sys.argv[1], "w") as f:
+        f.write("".join(out))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
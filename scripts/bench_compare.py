@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+"""Compare two sdlp_bench CSV files (make bench writes build/bench.csv).
+
+usage: bench_compare.py BASELINE.csv CURRENT.csv [THRESHOLD_PERCENT]
+
+Prints the median ns/op change of every case present in both files and exits
+with status 1 if any case got slower than the threshold (default 5%).
+"""
+import csv
+import sys
+
+
+def load(path):
+    with open(path, newline="") as f:
+        return {(r["group"], r["name"], int(r["size"])): float(r["ns_p50"]) for r in csv.DictReader(f)}
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        sys.stderr.write(__doc__)
+        return 2
+
+    baseline = load(sys.argv[1])
+    current = load(sys.argv[2])
+    threshold = float(sys.argv[3]) if len(sys.argv) == 4 else 5.0
+    regressions = 0
+
+    print("%-28s %8s %12s %12s %8s" % ("case", "size", "base ns", "ns", "change"))
+    for key in sorted(baseline.keys() & current.keys()):
+        before, after = baseline[key], current[key]
+        change = (after - before) / before * 100.0 if before > 0 else 0.0
+        flag = ""
+        if change > threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print("%-28s %8d %12.1f %12.1f %+7.1f%%%s" % ("%s/%s" % key[:2], key[2], before, after, change, flag))
+
+    for key in sorted(baseline.keys() ^ current.keys()):
+        print("%-28s %8d only in %s" % ("%s/%s" % key[:2], key[2], "baseline" if key in baseline else "current"))
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+"""Generate src/sdlp_crc16_tables.h (CRC-16-CCITT, polynomial 0x1021)."""
+import os
+import sys
+
+POLY = 0x1021
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUT_FILE = sys.argv[1] if len(sys.argv) > 1 else os.path.join(ROOT_DIR, "src", "sdlp_crc16_tables.h")
+
+
+def build_tables():
+    tables = [[0] * 256 for _ in range(8)]
+    for b in range(256):
+        crc = b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ POLY if crc & 0x8000 else crc << 1) & 0xFFFF
+        tables[0][b] = crc
+    for k in range(1, 8):
+        for b in range(256):
+            prev = tables[k - 1][b]
+            tables[k][b] = ((prev << 8) & 0xFFFF) ^ tables[0][prev >> 8]
+    return tables
+
+
+def emit_rows(rows):
+    lines = []
+    for i in range(0, 256, 8):
+        lines.append("        " + ", ".join("0x%04X" % v for v in rows[i:i + 8]) + ",")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    tables = build_tables()
+    out = []
+    out.append("/* Generated by scripts/gen_crc16_tables.py - do not edit.\n"
+               " * CRC-16-CCITT (polynomial 0x1021) lookup tables. Table k advances a byte\n"
+               " * through k additional zero bytes (slicing-by-N). */\n")
+    out.append("#ifndef SDLP_CRC16_TABLES_H\n#define SDLP_CRC16_TABLES_H\n\n#include <stdint.h>\n\n")
+    out.append("static const uint16_t sdlp_crc16_table[SDLP_CRC16_TABLE_COUNT][256] = {\n")
+    for k in range(8):
+        if k == 1:
+            out.append("#if SDLP_CRC16_TABLE_COUNT > 1\n")
+        if k == 4:
+            out.append("#endif\n#if SDLP_CRC16_TABLE_COUNT > 4\n")
+        out.append("    {\n" + emit_rows(tables[k]) + "    },\n")
+    out.append("#endif\n};\n\n#endif\n")
+    with open(OUT_FILE, "w") as f:
+        f.write("".join(out))
+
+
+if __name__ == "__main__":
+    main()
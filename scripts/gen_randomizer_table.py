@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Generate src/sdlp_randomizer_table.h (CCSDS 131.0-B pseudo-randomizer sequence)."""
+import os
+import sys
+
+# h(x) = x^8 + x^7 + x^5 + x^3 + 1, all-ones seed; the sequence repeats every 255 bytes.
+PERIOD = 255
+# TM_MAX_FRAME_LENGTH, the longest TM frame any TM_MAX_DATA_SIZE build allows.
+TABLE_LENGTH = 2048
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUT_FILE = sys.argv[1] if len(sys.argv) > 1 else os.path.join(ROOT_DIR, "src", "sdlp_randomizer_table.h")
+
+
+def build_sequence():
+    state = [1] * 8  # x^0 .. x^7 register cells
+    bits = []
+    for _ in range(PERIOD * 8):
+        bits.append(state[0])
+        feedback = state[0] ^ state[3] ^ state[5] ^ state[7]
+        state = state[1:] + [feedback]
+    period = []
+    for i in range(PERIOD):
+        byte = 0
+        for b in bits[i * 8:i * 8 + 8]:
+            byte = (byte << 1) | b
+        period.append(byte)
+    return [period[i % PERIOD] for i in range(TABLE_LENGTH)]
+
+
+def main():
+    seq = build_sequence()
+    assert seq[:5] == [0xFF, 0x48, 0x0E, 0xC0, 0x9A]
+    out = []
+    out.append("/* Generated by scripts/gen_randomizer_table.py - do not edit.\n"
+               " * CCSDS pseudo-randomizer sequence (h(x) = x^8 + x^7 + x^5 + x^3 + 1, all-ones\n"
+               " * seed) unrolled over the longest TM frame; it repeats every %d bytes. */\n" % PERIOD)
+    out.append("#ifndef SDLP_RANDOMIZER_TABLE_H\n#define SDLP_RANDOMIZER_TABLE_H\n\n#include <stdint.h>\n\n")
+    out.append("#define SDLP_RANDOMIZER_TABLE_LENGTH %d\n\n" % TABLE_LENGTH)
+    out.append("static const uint8_t sdlp_randomizer_table[SDLP_RANDOMIZER_TABLE_LENGTH] = {\n")
+    for i in range(0, TABLE_LENGTH, 12):
+        out.append("    " + ", ".join("0x%02X" % v for v in seq[i:i + 12]) + ",\n")
+    out.append("};\n\n#endif\n")
+    with open(OUT_FILE, "w") as f:
+        f.write("".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+"""Generate src/sdlp_rs_tables.h (CCSDS Reed-Solomon (255,223), CCSDS 131.0-B)."""
+import os
+import sys
+
+GFPOLY = 0x187  # x^8 + x^7 + x^2 + x + 1
+FCR = 112       # first consecutive root, as a power of alpha^PRIM
+PRIM = 11
+NN = 255
+KK = 223
+NROOTS = NN - KK
+A0 = NN         # log of zero
+# Conventional -> dual basis (Berlekamp) transformation matrix, CCSDS 131.0-B Annex F.
+TAL = [0x8D, 0xEF, 0xEC, 0x86, 0xFA, 0x99, 0xAF, 0x7B]
+
+ROOT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUT_FILE = sys.argv[1] if len(sys.argv) > 1 else os.path.join(ROOT_DIR, "src", "sdlp_rs_tables.h")
+
+
+def build_field():
+    alpha_to = [0] * 256
+    index_of = [0] * 256
+    sr = 1
+    for i in range(NN):
+        index_of[sr] = i
+        alpha_to[i] = sr
+        sr <<= 1
+        if sr & 0x100:
+            sr ^= GFPOLY
+    index_of[0] = A0
+    alpha_to[A0] = 0
+    return alpha_to, index_of
+
+
+ALPHA_TO, INDEX_OF = build_field()
+
+
+def mul(a, b):
+    if a == 0 or b == 0:
+        return 0
+    return ALPHA_TO[(INDEX_OF[a] + INDEX_OF[b]) % NN]
+
+
+def build_genpoly():
+    genpoly = [1] + [0] * NROOTS
+    root = FCR * PRIM
+    for i in range(NROOTS):
+        genpoly[i + 1] = 1
+        for j in range(i, 0, -1):
+            genpoly[j] = genpoly[j - 1] ^ mul(genpoly[j], ALPHA_TO[root % NN])
+        genpoly[0] = mul(genpoly[0], ALPHA_TO[root % NN])
+        root += PRIM
+    return genpoly
+
+
+GENPOLY = build_genpoly()
+
+
+def encode(data):
+    """Karn's LFSR encoder: parity[0] is transmitted first."""
+    parity = [0] * NROOTS
+    for d in data:
+        feedback = d ^ parity[0]
+        for j in range(1, NROOTS):
+            parity[j] ^= mul(feedback, GENPOLY[NROOTS - j])
+        parity = parity[1:] + [mul(feedback, GENPOLY[0])]
+    return parity
+
+
+def syndromes(codeword):
+    out = []
+    for i in range(NROOTS):
+        s = 0
+        for c in codeword:
+            s = c ^ mul(s, ALPHA_TO[((FCR + i) * PRIM) % NN])
+        out.append(s)
+    return out
+
+
+def build_dual_basis():
+    taltab = [0] * 256
+    tal1tab = [0] * 256
+    for i in range(256):
+        for k in range(8):
+            if i & (1 << k):
+                taltab[i] ^= TAL[7 - k]
+        tal1tab[taltab[i]] = i
+    return taltab, tal1tab
+
+
+def emit(name, ctype, values, per_line=16, fmt="0x%02X"):
+    lines = ["static const %s %s = {\n" % (ctype, name)]
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",\n")
+    lines.append("};\n\n")
+    return "".join(lines)
+
+
+def emit_rows(name, ctype, rows):
+    lines = ["static const %s %s = {\n" % (ctype, name)]
+    for row in rows:
+        lines.append("    {" + ", ".join("0x%02X" % v for v in row) + "},\n")
+    lines.append("};\n\n")
+    return "".join(lines)
+
+
+def main():
+    # The CCSDS code has reciprocal root pairs, so g(x) is palindromic.
+    assert GENPOLY == GENPOLY[::-1]
+    taltab, tal1tab = build_dual_basis()
+
+    # Parity of a unit symbol at each data position: by linearity the parity of
+    # any message is the GF sum of these columns scaled by its symbols.
+    parity_cols = []
+    for j in range(KK):
+        unit = [0] * KK
+        unit[j] = 1
+        parity_cols.append(encode(unit))
+    # Syndrome contribution of a unit symbol at each codeword position.
+    syndrome_cols = [[ALPHA_TO[((FCR + i) * PRIM * (NN - 1 - j)) % NN] for i in range(NROOTS)]
+                     for j in range(NN)]
+    # Split-nibble products: row v holds v*x for x = 0..15, then v*(x << 4).
+    nibbles = [[mul(v, x) for x in range(16)] + [mul(v, x << 4) for x in range(16)] for v in range(256)]
+
+    message = [(i * 37 + 11) & 0xFF for i in range(KK)]
+    assert syndromes(message + encode(message)) == [0] * NROOTS
+
+    out = []
+    out.append("/* Generated by scripts/gen_rs_tables.py - do not edit.\n"
+               " * CCSDS RS(255,223): GF(2^8) over x^8+x^7+x^2+x+1, generator roots\n"
+               " * alpha^(11*j) for j = 112..143, dual basis per CCSDS 131.0-B Annex F. */\n")
+    out.append("#ifndef SDLP_RS_TABLES_H\n#define SDLP_RS_TABLES_H\n\n#include <stdint.h>\n\n")
+    out.append("#define SDLP_RS_GF_POLY 0x%X\n#define SDLP_RS_FCR %d\n#define SDLP_RS_PRIM %d\n"
+               "#define SDLP_RS_IPRIM %d\n#define SDLP_RS_A0 %d\n\n"
+               % (GFPOLY, FCR, PRIM, pow(PRIM, -1, NN), A0))
+    out.append(emit("sdlp_rs_alpha_to[256]", "uint8_t", ALPHA_TO))
+    out.append(emit("sdlp_rs_index_of[256]", "uint8_t", INDEX_OF))
+    out.append("/* Generator polynomial, index form, g[0] = constant term. */\n")
+    out.append(emit("sdlp_rs_genpoly[%d]" % (NROOTS + 1), "uint8_t", [INDEX_OF[g] for g in GENPOLY]))
+    out.append("/* Conventional -> dual basis, and back. */\n")
+    out.append(emit("sdlp_rs_to_dual[256]", "uint8_t", taltab))
+    out.append(emit("sdlp_rs_from_dual[256]", "uint8_t", tal1tab))
+    out.append("#endif\n\n/* Guarded apart, so a translation unit may include this again with\n"
+               " * SDLP_RS_TABLES_SIMD defined. */\n"
+               "#if defined(SDLP_RS_TABLES_SIMD) && !defined(SDLP_RS_TABLES_SIMD_H)\n"
+               "#define SDLP_RS_TABLES_SIMD_H\n\n")
+    out.append(emit_rows("sdlp_rs_nibble_mul[256][32]", "uint8_t", nibbles))
+    out.append(emit_rows("sdlp_rs_parity_col[%d][%d]" % (KK, NROOTS), "uint8_t", parity_cols))
+    out.append(emit_rows("sdlp_rs_syndrome_col[%d][%d]" % (NN, NROOTS), "uint8_t", syndrome_cols))
+    out.append("#endif\n")
+    with open(OUT_FILE, "w") as f:
+        f.write("".join(out))
+
+
+if __name__ == "__main__":
+    main()
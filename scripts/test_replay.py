@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+"""Check tools/sdlp_replay against generated captures.
+
+Usage: test_replay.py PATH/TO/sdlp_replay
+
+Each capture holds ten TM frames of one VC with counts 0..9, count 6 left out
+and the frame with count 3 corrupted, written as fixed-length records, as
+2-byte length-prefixed records behind an ASM, and randomized. The corrupted
+frame does not advance the counts, so 2 -> 4 and 5 -> 7 are both gaps."""
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+FRAME_LENGTH = 64
+SCID = 0x0AB
+VC = 5
+ASM = bytes([0x1A, 0xCF, 0xFC, 0x1D])
+COUNTS = [c for c in range(10) if c != 6]
+CORRUPTED = 3
+
+EXPECTED_FRAMES = len(COUNTS)
+EXPECTED_GOOD = EXPECTED_FRAMES - 1
+EXPECTED_GAPS = 2
+EXPECTED_LOST = 2
+
+
+def crc16(data):
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def randomizer_sequence(length):
+    state = [1] * 8
+    out = []
+    for _ in range(length):
+        byte = 0
+        for _ in range(8):
+            byte = (byte << 1) | state[0]
+            feedback = state[0] ^ state[3] ^ state[5] ^ state[7]
+            state = state[1:] + [feedback]
+        out.append(byte)
+    return out
+
+
+def tm_frame(count):
+    header = bytes([
+        (SCID >> 4) & 0x3F,
+        ((SCID & 0x0F) << 4) | (VC << 1),
+        count,
+        count,
+        0x18,
+        0x00,
+    ])
+    data = bytes((count * 7 + i) & 0xFF for i in range(FRAME_LENGTH - 8))
+    body = header + data
+    crc = crc16(body)
+    frame = bytearray(body + bytes([crc >> 8, crc & 0xFF]))
+    if count == CORRUPTED:
+        frame[20] ^= 0x01
+    return bytes(frame)
+
+
+def capture(kind):
+    sequence = randomizer_sequence(FRAME_LENGTH)
+    records = []
+    for count in COUNTS:
+        frame = tm_frame(count)
+        if kind == "prefixed":
+            records.append(bytes([FRAME_LENGTH >> 8, FRAME_LENGTH & 0xFF]) + ASM + frame)
+        elif kind == "randomized":
+            records.append(bytes(b ^ s for b, s in zip(frame, sequence)))
+        else:
+            records.append(frame)
+    return b"".join(records)
+
+
+def check(replay, name, data, args, split_dir=None):
+    with tempfile.NamedTemporaryFile(suffix=".raw", delete=False) as f:
+        f.write(data)
+        path = f.name
+    try:
+        command = [replay] + args + (["-o", split_dir] if split_dir else []) + [path]
+        result = subprocess.run(command, stdout=subprocess.PIPE, universal_newlines=True)
+    finally:
+        os.unlink(path)
+
+    failures = []
+    totals = re.search(r"^frames\s+(\d+) \(good (\d+), crc errors (\d+), invalid (\d+)\)",
+                       result.stdout, re.M)
+    vc_row = re.search(r"^0x%03X\s+%d\s+(\d+)\s+(\d+)\s+(\d+)\s+(\d+)$" % (SCID, VC),
+                       result.stdout, re.M)
+    mc_row = re.search(r"^0x%03X\s+MC\s+(\d+)\s+(\d+)\s+(\d+)$" % SCID, result.stdout, re.M)
+
+    if result.returncode != 3:
+        failures.append("exit status %d, expected 3" % result.returncode)
+    if not totals or tuple(map(int, totals.groups())) != (EXPECTED_FRAMES, EXPECTED_GOOD, 1, 0):
+        failures.append("frame totals")
+    if not vc_row or tuple(map(int, vc_row.groups())) != (EXPECTED_GOOD, 1, EXPECTED_GAPS,
+                                                         EXPECTED_LOST):
+        failures.append("VC row")
+    if not mc_row or tuple(map(int, mc_row.groups())) != (EXPECTED_GOOD, EXPECTED_GAPS,
+                                                         EXPECTED_LOST):
+        failures.append("MC row")
+    if split_dir:
+        split = os.path.join(split_dir, "scid%03X_vc%d.bin" % (SCID, VC))
+        if not os.path.exists(split) or os.path.getsize(split) != EXPECTED_GOOD * (FRAME_LENGTH - 8):
+            failures.append("split stream size")
+
+    for failure in failures:
+        print("FAIL %s: %s" % (name, failure))
+    if failures:
+        print(result.stdout)
+    else:
+        print("PASS %s" % name)
+    return not failures
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__)
+        return 2
+
+    replay = sys.argv[1]
+    length = str(FRAME_LENGTH)
+    ok = True
+
+    with tempfile.TemporaryDirectory() as split_dir:
+        ok &= check(replay, "fixed-length", capture("fixed"), ["-l", length], split_dir)
+    ok &= check(replay, "prefixed", capture("prefixed"), ["-p", "2", "-s", "4"])
+    ok &= check(replay, "randomized", capture("randomized"), ["-l", length, "-r"])
+
+    print("\nAll tests passed." if ok else "\nReplay checks failed.")
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,19 +1,352 @@
-#include "sdlp_common.h"
+#include "sdlp_internal.h"
+#include <string.h>
+
+#if SDLP_CRC16_BACKEND != SDLP_CRC16_BITWISE && SDLP_CRC16_BACKEND != SDLP_CRC16_TABLE && \
+    SDLP_CRC16_BACKEND != SDLP_CRC16_SLICE4 && SDLP_CRC16_BACKEND != SDLP_CRC16_SLICE8
+#error "SDLP_CRC16_BACKEND must be one of SDLP_CRC16_BITWISE, _TABLE, _SLICE4 or _SLICE8"
+#endif
+
+#if SDLP_CRC16_BACKEND != SDLP_CRC16_BITWISE
+#define SDLP_CRC16_TABLE_COUNT SDLP_CRC16_BACKEND
+#include "sdlp_crc16_tables.h"
+
+#define CRC16_T(k, b) sdlp_crc16_table[k][(b)]
+#endif
+
+uint16_t sdlp_crc16_init(void) {
+    return SDLP_CRC16_INIT;
+}
+
+uint16_t sdlp_crc16_final(uint16_t crc) {
+    return crc;
+}
+
+/* One step of the table backends: CRC16_BLOCK bytes per call. */
+#if SDLP_CRC16_BACKEND == SDLP_CRC16_SLICE8
+#define CRC16_BLOCK 8
+
+static inline uint16_t crc16_block(uint16_t crc, const uint8_t *p) {
+    return (uint16_t)(CRC16_T(7, (uint8_t)(p[0] ^ (crc >> 8))) ^
+                      CRC16_T(6, (uint8_t)(p[1] ^ (crc & 0xffu))) ^
+                      CRC16_T(5, p[2]) ^ CRC16_T(4, p[3]) ^
+                      CRC16_T(3, p[4]) ^ CRC16_T(2, p[5]) ^
+                      CRC16_T(1, p[6]) ^ CRC16_T(0, p[7]));
+}
+#elif SDLP_CRC16_BACKEND == SDLP_CRC16_SLICE4
+#define CRC16_BLOCK 4
+
+static inline uint16_t crc16_block(uint16_t crc, const uint8_t *p) {
+    return (uint16_t)(CRC16_T(3, (uint8_t)(p[0] ^ (crc >> 8))) ^
+                      CRC16_T(2, (uint8_t)(p[1] ^ (crc & 0xffu))) ^
+                      CRC16_T(1, p[2]) ^ CRC16_T(0, p[3]));
+}
+#elif SDLP_CRC16_BACKEND == SDLP_CRC16_TABLE
+#define CRC16_BLOCK 1
+
+static inline uint16_t crc16_block(uint16_t crc, const uint8_t *p) {
+    return (uint16_t)((crc << 8) ^ CRC16_T(0, (uint8_t)(p[0] ^ (crc >> 8))));
+}
+#endif
+
+static inline uint16_t crc16_byte(uint16_t crc, uint8_t byte) {
+#if SDLP_CRC16_BACKEND == SDLP_CRC16_BITWISE
+    crc ^= (uint16_t)(byte << 8);
+
+    for (int j = 0; j < 8; j++) {
+        if (crc & 0x8000) {
+            crc = (uint16_t)((crc << 1) ^ 0x1021);
+        } else {
+            crc = (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+#else
+    return (uint16_t)((crc << 8) ^ CRC16_T(0, (uint8_t)(byte ^ (crc >> 8))));
+#endif
+}
+
+uint16_t sdlp_crc16_update_portable(uint16_t crc, const uint8_t *data, size_t length) {
+    size_t i = 0;
+
+#if defined(CRC16_BLOCK) && CRC16_BLOCK > 1
+    for (; i + CRC16_BLOCK <= length; i += CRC16_BLOCK) {
+        crc = crc16_block(crc, &data[i]);
+    }
+#endif
+
+    for (; i < length; i++) {
+        crc = crc16_byte(crc, data[i]);
+    }
+
+    return crc;
+}
+
+/* Blocks of 8 bytes are loaded once, stored to dst and fed to the CRC from the
+ * same register. */
+uint16_t sdlp_crc16_copy_portable(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length) {
+    size_t i = 0;
+
+#if defined(CRC16_BLOCK)
+    for (; i + 8 <= length; i += 8) {
+        uint8_t block[8];
+
+        memcpy(block, &src[i], sizeof(block));
+        memcpy(&dst[i], block, sizeof(block));
+
+        for (size_t j = 0; j < sizeof(block); j += CRC16_BLOCK) {
+            crc = crc16_block(crc, &block[j]);
+        }
+    }
+#endif
+
+    for (; i < length; i++) {
+        uint8_t byte = src[i];
+
+        dst[i] = byte;
+        crc = crc16_byte(crc, byte);
+    }
+
+    return crc;
+}
+
+#if defined(SDLP_CRC16_CLMUL)
+#include <stdatomic.h>
+
+typedef uint16_t (*crc16_update_fn)(uint16_t crc, const uint8_t *data, size_t length);
+
+static uint16_t crc16_update_resolve(uint16_t crc, const uint8_t *data, size_t length);
+
+/* Resolved on first use. Concurrent first calls store the same pointer, and
+ * the pointer is all they share, so relaxed accesses suffice. */
+static _Atomic(crc16_update_fn) crc16_update_impl = crc16_update_resolve;
+
+static uint16_t crc16_update_resolve(uint16_t crc, const uint8_t *data, size_t length) {
+    crc16_update_fn impl = sdlp_crc16_clmul_supported() ? sdlp_crc16_update_clmul
+                                                        : sdlp_crc16_update_portable;
+
+    atomic_store_explicit(&crc16_update_impl, impl, memory_order_relaxed);
+    return impl(crc, data, length);
+}
+
+uint16_t sdlp_crc16_update(uint16_t crc, const uint8_t *data, size_t length) {
+    SDLP_STATS_TIMER_START(start);
+
+    crc = atomic_load_explicit(&crc16_update_impl, memory_order_relaxed)(crc, data, length);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_CRC, start, 1);
+
+    return crc;
+}
+
+typedef uint16_t (*crc16_copy_fn)(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length);
+
+static uint16_t crc16_copy_resolve(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length);
+
+/* Resolved on first use, like crc16_update_impl. */
+static _Atomic(crc16_copy_fn) crc16_copy_impl = crc16_copy_resolve;
+
+static uint16_t crc16_copy_resolve(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length) {
+    crc16_copy_fn impl = sdlp_crc16_clmul_supported() ? sdlp_crc16_copy_clmul
+                                                      : sdlp_crc16_copy_portable;
+
+    atomic_store_explicit(&crc16_copy_impl, impl, memory_order_relaxed);
+    return impl(crc, dst, src, length);
+}
+
+uint16_t sdlp_crc16_copy(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length) {
+    SDLP_STATS_TIMER_START(start);
+
+    crc = atomic_load_explicit(&crc16_copy_impl, memory_order_relaxed)(crc, dst, src, length);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_CRC, start, 1);
+
+    return crc;
+}
+#else
+uint16_t sdlp_crc16_update(uint16_t crc, const uint8_t *data, size_t length) {
+    SDLP_STATS_TIMER_START(start);
+
+    crc = sdlp_crc16_update_portable(crc, data, length);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_CRC, start, 1);
+
+    return crc;
+}
+
+uint16_t sdlp_crc16_copy(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length) {
+    SDLP_STATS_TIMER_START(start);
+
+    crc = sdlp_crc16_copy_portable(crc, dst, src, length);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_CRC, start, 1);
+
+    return crc;
+}
+#endif
 
 uint16_t sdlp_crc16(const uint8_t *data, size_t length) {
-    uint16_t crc = 0xFFFF;
-    
-    for (size_t i = 0; i < length; i++) {
-        crc ^= (uint16_t)data[i] << 8;
-        
-        for (int j = 0; j < 8; j++) {
-            if (crc & 0x8000) {
-                crc = (crc << 1) ^ 0x1021;
-            } else {
-                crc = crc << 1;
+    return sdlp_crc16_final(sdlp_crc16_update(sdlp_crc16_init(), data, length));
+}
+
+size_t sdlp_iov_length(const sdlp_iovec_t *iov, size_t iov_count) {
+    size_t total = 0;
+
+    if (!iov && iov_count) {
+        return SIZE_MAX;
+    }
+
+    for (size_t i = 0; i < iov_count; i++) {
+        if ((!iov[i].data && iov[i].length) || iov[i].length > SIZE_MAX - total) {
+            return SIZE_MAX;
+        }
+        total += iov[i].length;
+    }
+
+    return total;
+}
+
+#define CRC16_GATHER_BLOCK 2048u
+
+uint16_t sdlp_crc16_gather(uint8_t *frame, size_t offset, const sdlp_iovec_t *iov, size_t iov_count) {
+    uint16_t crc = sdlp_crc16_init();
+    size_t checked = 0;
+
+    for (size_t i = 0; i < iov_count; i++) {
+        const uint8_t *src = iov[i].data;
+        size_t left = iov[i].length;
+
+        while (left) {
+            size_t room = checked + CRC16_GATHER_BLOCK > offset ? checked + CRC16_GATHER_BLOCK - offset : 0;
+            size_t n = left < room ? left : room;
+
+            memcpy(&frame[offset], src, n);
+            offset += n;
+            src += n;
+            left -= n;
+
+            if (offset - checked >= CRC16_GATHER_BLOCK) {
+                crc = sdlp_crc16_update(crc, &frame[checked], offset - checked);
+                checked = offset;
+            }
+        }
+    }
+
+    return sdlp_crc16_update(crc, &frame[checked], offset - checked);
+}
+
+#if defined(SDLP_CRC16_CLMUL)
+static int crc16_clmul_active(void) {
+    static _Atomic int active = -1;
+    int value = atomic_load_explicit(&active, memory_order_relaxed);
+
+    if (value < 0) {
+        value = sdlp_crc16_clmul_supported();
+        atomic_store_explicit(&active, value, memory_order_relaxed);
+    }
+    return value;
+}
+#endif
+
+void sdlp_crc16_multi(const uint8_t *const *data, const size_t *length, uint16_t *crc,
+                      size_t count) {
+#if defined(CRC16_BLOCK)
+    int interleave = count == SDLP_CRC16_STREAMS;
+
+#if defined(SDLP_CRC16_CLMUL)
+    /* The folding kernel is throughput-bound already; it only leaves inputs
+     * below its minimum length to the table backend. */
+    for (size_t s = 0; interleave && s < count; s++) {
+        interleave = length[s] < SDLP_CRC16_CLMUL_MIN_LENGTH || !crc16_clmul_active();
+    }
+#endif
+
+    if (interleave) {
+        size_t common = length[0];
+
+        for (size_t s = 1; s < SDLP_CRC16_STREAMS; s++) {
+            if (length[s] < common) {
+                common = length[s];
             }
         }
+        common -= common % CRC16_BLOCK;
+
+        const uint8_t *d0 = data[0];
+        const uint8_t *d1 = data[1];
+        const uint8_t *d2 = data[2];
+        const uint8_t *d3 = data[3];
+        uint16_t c0 = SDLP_CRC16_INIT;
+        uint16_t c1 = SDLP_CRC16_INIT;
+        uint16_t c2 = SDLP_CRC16_INIT;
+        uint16_t c3 = SDLP_CRC16_INIT;
+
+        for (size_t i = 0; i < common; i += CRC16_BLOCK) {
+            c0 = crc16_block(c0, &d0[i]);
+            c1 = crc16_block(c1, &d1[i]);
+            c2 = crc16_block(c2, &d2[i]);
+            c3 = crc16_block(c3, &d3[i]);
+        }
+
+        crc[0] = sdlp_crc16_update_portable(c0, &d0[common], length[0] - common);
+        crc[1] = sdlp_crc16_update_portable(c1, &d1[common], length[1] - common);
+        crc[2] = sdlp_crc16_update_portable(c2, &d2[common], length[2] - common);
+        crc[3] = sdlp_crc16_update_portable(c3, &d3[common], length[3] - common);
+        return;
+    }
+#endif
+
+    for (size_t s = 0; s < count; s++) {
+        crc[s] = sdlp_crc16(data[s], length[s]);
+    }
+}
+
+uint16_t sdlp_crc16_mul(uint16_t a, uint16_t b) {
+    uint16_t multiple[16];
+    uint16_t product = 0;
+
+    /* a * n mod P for every nibble n, then b four bits per step. */
+    multiple[0] = 0;
+    multiple[1] = a;
+    for (unsigned n = 2; n < 16; n += 2) {
+        uint16_t half = multiple[n / 2u];
+
+        multiple[n] = (uint16_t)((half << 1) ^ (0x1021u & (0u - (unsigned)(half >> 15))));
+        multiple[n + 1u] = (uint16_t)(multiple[n] ^ a);
+    }
+    for (int shift = 12; shift >= 0; shift -= 4) {
+        unsigned high = product >> 12;
+
+        /* high * x^16 mod P is high * 0x1021, which cannot overflow 16 bits. */
+        product = (uint16_t)((product << 4) ^ (high << 12) ^ (high << 5) ^ high);
+        product ^= multiple[(b >> shift) & 0x0fu];
+    }
+    return product;
+}
+
+/* x^(8 * d * 16^k) mod P for digits d = 1..15. x has order 32767 modulo
+ * P = (x + 1)(x^15 + x^14 + x^13 + x^12 + x^4 + x^3 + x^2 + x + 1), so any
+ * shift reduces to four hex digits and at most four multiplies. */
+#define CRC16_SHIFT_PERIOD 32767u
+
+static const uint16_t crc16_pow8[4][15] = {
+    {0x0100, 0x1021, 0x3331, 0x3730, 0x76B4, 0xAA51, 0x45A0, 0xB861,
+     0x47D3, 0xEB23, 0x6F45, 0xD849, 0x0375, 0x4563, 0x7B61},
+    {0xAEFC, 0x8E29, 0xCDE2, 0x13FC, 0xDA35, 0x106F, 0xCBC5, 0x36C4,
+     0x400C, 0x30DF, 0x0A5D, 0x2764, 0x0224, 0x46CF, 0x6D5A},
+    {0xFD50, 0xAA9E, 0x26BD, 0x881C, 0x21EC, 0xDB20, 0x2473, 0x4458,
+     0x8807, 0x88B5, 0x385C, 0x21EF, 0xCCF1, 0xCBF0, 0x2F9F},
+    {0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080, 0x0100,
+     0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000},
+};
+
+uint16_t sdlp_crc16_shift(uint16_t crc, size_t length) {
+    length %= CRC16_SHIFT_PERIOD;
+
+    for (size_t k = 0; length > 0; k++, length >>= 4) {
+        if (length & 0x0fu) {
+            crc = sdlp_crc16_mul(crc, crc16_pow8[k][(length & 0x0fu) - 1u]);
+        }
     }
-    
     return crc;
 }
+
+uint16_t sdlp_crc16_combine(uint16_t crc_a, uint16_t crc_b, size_t length_b) {
+    /* Running B from register crc_a instead of the initial value adds the
+     * difference of the two registers, carried through length_b bytes. */
+    return (uint16_t)(crc_b ^ sdlp_crc16_shift((uint16_t)(crc_a ^ SDLP_CRC16_INIT), length_b));
+}
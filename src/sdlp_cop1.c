@@ -0,0 +1,529 @@
+#include "sdlp_cop1.h"
+#include <string.h>
+
+#define COP1_UNLOCK 0x00u
+#define COP1_SET_VR_0 0x82u
+#define COP1_SET_VR_1 0x00u
+
+int sdlp_clcw_encode(const sdlp_clcw_t *clcw, uint8_t *buffer, size_t buffer_size) {
+    if (!clcw || !buffer) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (buffer_size < SDLP_CLCW_SIZE) {
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    /* Control word type 0 and CLCW version 00 occupy the top three bits. */
+    buffer[0] = (uint8_t)(((clcw->status_field & 0x07u) << 2) | (clcw->cop_in_effect & 0x03u));
+    buffer[1] = (uint8_t)((clcw->virtual_channel_id & 0x3fu) << 2);
+    buffer[2] = (uint8_t)(((clcw->no_rf_available & 0x01u) << 7) |
+                ((clcw->no_bit_lock & 0x01u) << 6) |
+                ((clcw->lockout & 0x01u) << 5) |
+                ((clcw->wait & 0x01u) << 4) |
+                ((clcw->retransmit & 0x01u) << 3) |
+                ((clcw->farm_b_counter & 0x03u) << 1));
+    buffer[3] = clcw->report_value;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_clcw_decode(const uint8_t *buffer, size_t buffer_size, sdlp_clcw_t *clcw) {
+    if (!buffer || !clcw || buffer_size < SDLP_CLCW_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (buffer[0] & 0xe0u) {
+        return SDLP_ERROR_INVALID_FRAME;
+    }
+
+    clcw->status_field = (uint8_t)((buffer[0] >> 2) & 0x07u);
+    clcw->cop_in_effect = (uint8_t)(buffer[0] & 0x03u);
+    clcw->virtual_channel_id = (uint8_t)((buffer[1] >> 2) & 0x3fu);
+    clcw->no_rf_available = (uint8_t)((buffer[2] >> 7) & 0x01u);
+    clcw->no_bit_lock = (uint8_t)((buffer[2] >> 6) & 0x01u);
+    clcw->lockout = (uint8_t)((buffer[2] >> 5) & 0x01u);
+    clcw->wait = (uint8_t)((buffer[2] >> 4) & 0x01u);
+    clcw->retransmit = (uint8_t)((buffer[2] >> 3) & 0x01u);
+    clcw->farm_b_counter = (uint8_t)((buffer[2] >> 1) & 0x03u);
+    clcw->report_value = buffer[3];
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_clcw_decode_tm_view(const sdlp_tm_frame_view_t *view, sdlp_clcw_t *clcw) {
+    if (!view || !view->data || !clcw) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (!view->header.ocf_flag || view->data_length < SDLP_CLCW_SIZE) {
+        return SDLP_ERROR_INVALID_FRAME;
+    }
+
+    return sdlp_clcw_decode(&view->data[view->data_length - SDLP_CLCW_SIZE], SDLP_CLCW_SIZE, clcw);
+}
+
+static sdlp_fop_slot_t *fop_slot(const sdlp_fop_t *fop, uint8_t offset) {
+    return &fop->config.slots[((size_t)fop->head + offset) % fop->config.slot_count];
+}
+
+static void fop_purge(sdlp_fop_t *fop) {
+    fop->nnr = fop->vs;
+    fop->sent = 0;
+    fop->next = 0;
+    fop->bc_pending = 0;
+    fop->timer_running = 0;
+    fop->transmission_count = 1;
+}
+
+static void fop_alert(sdlp_fop_t *fop, sdlp_fop_alert_t alert) {
+    fop_purge(fop);
+    fop->state = SDLP_FOP_INITIAL;
+    fop->alert = alert;
+    fop->stats.alerts++;
+}
+
+static void fop_acknowledge(sdlp_fop_t *fop, uint8_t count) {
+    fop->head = (uint8_t)(((size_t)fop->head + count) % fop->config.slot_count);
+    fop->nnr = (uint8_t)(fop->nnr + count);
+    fop->sent = (uint8_t)(fop->sent - count);
+    fop->next = fop->next > count ? (uint8_t)(fop->next - count) : 0;
+    fop->transmission_count = 1;
+    fop->stats.acknowledged += count;
+}
+
+/* Rewind to the oldest unacknowledged frame, or alert past the limit. */
+static int fop_retransmit(sdlp_fop_t *fop) {
+    if (fop->transmission_count >= fop->config.transmission_limit) {
+        fop_alert(fop, SDLP_FOP_ALERT_LIMIT);
+        return 0;
+    }
+
+    fop->transmission_count++;
+    if (fop->state == SDLP_FOP_INITIALIZING) {
+        fop->bc_pending = 1;
+    } else {
+        fop->next = 0;
+    }
+
+    return 1;
+}
+
+static int fop_send_bc(sdlp_fop_t *fop, const uint8_t *command, uint16_t command_length) {
+    sdlp_tc_frame_t frame;
+    size_t encoded_size = 0;
+    int result = sdlp_tc_create_frame(&frame, fop->config.spacecraft_id,
+                                      fop->config.virtual_channel_id, 0, command, command_length);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    frame.header.bypass_flag = 1;
+    frame.header.control_command_flag = 1;
+    result = sdlp_tc_encode_frame(&frame, fop->bc_frame, sizeof(fop->bc_frame), &encoded_size);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    fop->bc_length = (uint8_t)encoded_size;
+    fop->bc_pending = 1;
+    fop->state = SDLP_FOP_INITIALIZING;
+    fop->alert = SDLP_FOP_ALERT_NONE;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_fop_init(sdlp_fop_t *fop, const sdlp_fop_config_t *config) {
+    if (!fop || !config || !config->slots || config->slot_count == 0 ||
+        config->window_width == 0 || config->window_width > config->slot_count ||
+        config->transmission_limit == 0 || config->virtual_channel_id > 0x3fu) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(fop, 0, sizeof(sdlp_fop_t));
+    fop->config = *config;
+    fop_purge(fop);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_fop_start(sdlp_fop_t *fop) {
+    if (!fop) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    fop_purge(fop);
+    fop->state = SDLP_FOP_ACTIVE;
+    fop->alert = SDLP_FOP_ALERT_NONE;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_fop_start_unlock(sdlp_fop_t *fop) {
+    const uint8_t command[] = {COP1_UNLOCK};
+
+    if (!fop) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    fop_purge(fop);
+    fop->bc_unlock = 1;
+
+    return fop_send_bc(fop, command, sizeof(command));
+}
+
+int sdlp_fop_start_set_vr(sdlp_fop_t *fop, uint8_t vr) {
+    const uint8_t command[] = {COP1_SET_VR_0, COP1_SET_VR_1, vr};
+
+    if (!fop) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    fop->vs = vr;
+    fop_purge(fop);
+    fop->bc_unlock = 0;
+
+    return fop_send_bc(fop, command, sizeof(command));
+}
+
+void sdlp_fop_terminate(sdlp_fop_t *fop) {
+    if (!fop) {
+        return;
+    }
+
+    fop_purge(fop);
+    fop->state = SDLP_FOP_INITIAL;
+}
+
+uint8_t sdlp_fop_outstanding(const sdlp_fop_t *fop) {
+    return fop ? (uint8_t)(fop->vs - fop->nnr) : 0;
+}
+
+int sdlp_fop_begin(sdlp_fop_t *fop, sdlp_tc_builder_t *builder) {
+    if (!fop || !builder || fop->state == SDLP_FOP_INITIAL || fop->state == SDLP_FOP_INITIALIZING) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (sdlp_fop_outstanding(fop) >= fop->config.window_width) {
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    sdlp_fop_slot_t *slot = fop_slot(fop, sdlp_fop_outstanding(fop));
+    int result = sdlp_tc_builder_begin(builder, slot->frame, sizeof(slot->frame),
+                                       fop->config.spacecraft_id, fop->config.virtual_channel_id,
+                                       fop->vs);
+
+#ifdef TC_SEGMENT_HEADER_ENABLED
+    builder->segment_header.sequence_flags = TC_SEQ_FLAG_NO_SEG;
+#endif
+
+    return result;
+}
+
+int sdlp_fop_commit(sdlp_fop_t *fop, sdlp_tc_builder_t *builder, uint16_t data_length) {
+    if (!fop || !builder || fop->state == SDLP_FOP_INITIAL || fop->state == SDLP_FOP_INITIALIZING ||
+        sdlp_fop_outstanding(fop) >= fop->config.window_width) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    sdlp_fop_slot_t *slot = fop_slot(fop, sdlp_fop_outstanding(fop));
+
+    /* Type-AD frames only, in the slot and with the sequence number from begin. */
+    if (builder->buffer != slot->frame || builder->header.bypass_flag ||
+        builder->header.control_command_flag || builder->header.frame_sequence_number != fop->vs) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t encoded_size = 0;
+    int result = sdlp_tc_builder_commit(builder, data_length, &encoded_size);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    slot->length = (uint16_t)encoded_size;
+    fop->vs++;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_fop_transfer(sdlp_fop_t *fop, const uint8_t *data, uint16_t data_length) {
+    sdlp_tc_builder_t builder;
+
+    if (!data) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    int result = sdlp_fop_begin(fop, &builder);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    if (data_length > builder.data_capacity) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memcpy(builder.data, data, data_length);
+
+    return sdlp_fop_commit(fop, &builder, data_length);
+}
+
+int sdlp_fop_next_frame(sdlp_fop_t *fop, uint32_t now, const uint8_t **frame, size_t *length) {
+    if (!fop || !frame || !length) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    *frame = NULL;
+    *length = 0;
+
+    if (fop->bc_pending) {
+        *frame = fop->bc_frame;
+        *length = fop->bc_length;
+        fop->bc_pending = 0;
+    } else if ((fop->state == SDLP_FOP_ACTIVE || fop->state == SDLP_FOP_RETRANSMIT_WITHOUT_WAIT) &&
+               fop->next < sdlp_fop_outstanding(fop)) {
+        sdlp_fop_slot_t *slot = fop_slot(fop, fop->next);
+
+        if (fop->next < fop->sent) {
+            fop->stats.retransmissions++;
+        }
+        fop->next++;
+        if (fop->next > fop->sent) {
+            fop->sent = fop->next;
+        }
+        *frame = slot->frame;
+        *length = slot->length;
+    } else {
+        return SDLP_SUCCESS;
+    }
+
+    fop->stats.frames++;
+    fop->timer_running = 1;
+    fop->timer_start = now;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_fop_process_clcw(sdlp_fop_t *fop, const sdlp_clcw_t *clcw, uint32_t now) {
+    if (!fop || !clcw) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (clcw->virtual_channel_id != fop->config.virtual_channel_id ||
+        clcw->cop_in_effect != SDLP_COP_IN_EFFECT_COP1 || fop->state == SDLP_FOP_INITIAL) {
+        return SDLP_SUCCESS;
+    }
+
+    if (clcw->lockout) {
+        /* Lockout is the expected report until an Unlock gets through. */
+        if (!(fop->state == SDLP_FOP_INITIALIZING && fop->bc_unlock)) {
+            fop_alert(fop, SDLP_FOP_ALERT_LOCKOUT);
+        }
+        return SDLP_SUCCESS;
+    }
+
+    if (fop->state == SDLP_FOP_INITIALIZING) {
+        if (fop->bc_unlock) {
+            fop->vs = clcw->report_value;
+        }
+        if (clcw->report_value == fop->vs) {
+            fop_purge(fop);
+            fop->state = SDLP_FOP_ACTIVE;
+        }
+        return SDLP_SUCCESS;
+    }
+
+    uint8_t acknowledged = (uint8_t)(clcw->report_value - fop->nnr);
+
+    if (acknowledged > fop->sent) {
+        fop_alert(fop, SDLP_FOP_ALERT_NNR);
+        return SDLP_SUCCESS;
+    }
+
+    sdlp_fop_state_t previous = fop->state;
+
+    if (acknowledged) {
+        fop_acknowledge(fop, acknowledged);
+        fop->timer_start = now;
+    }
+
+    if (sdlp_fop_outstanding(fop) == 0) {
+        fop->timer_running = 0;
+        fop->state = SDLP_FOP_ACTIVE;
+        return SDLP_SUCCESS;
+    }
+
+    if (!clcw->retransmit) {
+        fop->state = SDLP_FOP_ACTIVE;
+        return SDLP_SUCCESS;
+    }
+
+    /* While the FARM waits nothing is sent; retransmission starts when it leaves. */
+    if (clcw->wait) {
+        fop->state = SDLP_FOP_RETRANSMIT_WITH_WAIT;
+        return SDLP_SUCCESS;
+    }
+
+    /* A retransmission already running is only restarted by progress; otherwise
+     * every CLCW repeating the flag would rewind the queue. */
+    if (previous != SDLP_FOP_RETRANSMIT_WITHOUT_WAIT || acknowledged) {
+        if (!fop_retransmit(fop)) {
+            return SDLP_SUCCESS;
+        }
+    }
+    fop->state = SDLP_FOP_RETRANSMIT_WITHOUT_WAIT;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_fop_poll(sdlp_fop_t *fop, uint32_t now) {
+    if (!fop) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (!fop->timer_running || (uint32_t)(now - fop->timer_start) < fop->config.timeout) {
+        return SDLP_SUCCESS;
+    }
+
+    fop->stats.timeouts++;
+    fop->timer_start = now;
+    fop_retransmit(fop);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_farm_init(sdlp_farm_t *farm, const sdlp_farm_config_t *config) {
+    if (!farm || !config || config->window_width < 2 || config->window_width > 254 ||
+        (config->window_width & 1u) || config->virtual_channel_id > 0x3fu) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(farm, 0, sizeof(sdlp_farm_t));
+    farm->config = *config;
+    farm->state = SDLP_FARM_OPEN;
+
+    return SDLP_SUCCESS;
+}
+
+static void farm_discard(sdlp_farm_t *farm) {
+    farm->stats.discarded++;
+}
+
+static void farm_control(sdlp_farm_t *farm, const sdlp_tc_frame_view_t *view) {
+    if (view->data_length == 1 && view->data[0] == COP1_UNLOCK) {
+        farm->state = SDLP_FARM_OPEN;
+        farm->retransmit = 0;
+    } else if (view->data_length == 3 && view->data[0] == COP1_SET_VR_0 &&
+               view->data[1] == COP1_SET_VR_1) {
+        /* Accepted but without effect in lockout. */
+        if (farm->state != SDLP_FARM_LOCKOUT) {
+            farm->state = SDLP_FARM_OPEN;
+            farm->vr = view->data[2];
+            farm->retransmit = 0;
+        }
+    } else {
+        farm_discard(farm);
+        return;
+    }
+
+    farm->farm_b_counter++;
+    farm->stats.control_commands++;
+}
+
+int sdlp_farm_push_view(sdlp_farm_t *farm, const sdlp_tc_frame_view_t *view) {
+    if (!farm || !view || !view->data) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    farm->stats.frames++;
+
+    if (view->header.virtual_channel_id != farm->config.virtual_channel_id) {
+        farm_discard(farm);
+        return SDLP_SUCCESS;
+    }
+
+    if (view->header.bypass_flag) {
+        if (view->header.control_command_flag) {
+            farm_control(farm, view);
+        } else {
+            farm->farm_b_counter++;
+            farm->stats.accepted_bd++;
+            if (farm->config.on_frame) {
+                farm->config.on_frame(farm->config.user, view);
+            }
+        }
+        return SDLP_SUCCESS;
+    }
+
+    /* Type-AD. A control command must be sent as Type-BC. */
+    if (view->header.control_command_flag || farm->state == SDLP_FARM_LOCKOUT) {
+        farm_discard(farm);
+        return SDLP_SUCCESS;
+    }
+
+    uint8_t ahead = (uint8_t)(view->header.frame_sequence_number - farm->vr);
+    uint8_t half_window = (uint8_t)(farm->config.window_width / 2u);
+
+    if (ahead == 0) {
+        if (farm->state == SDLP_FARM_WAIT ||
+            (farm->config.on_frame && farm->config.on_frame(farm->config.user, view) != 0)) {
+            farm->state = SDLP_FARM_WAIT;
+            farm->retransmit = 1;
+            farm_discard(farm);
+            return SDLP_SUCCESS;
+        }
+        farm->vr++;
+        farm->retransmit = 0;
+        farm->stats.accepted_ad++;
+    } else if (ahead < half_window) {
+        /* Positive window: a frame was lost, ask for retransmission. */
+        farm->retransmit = 1;
+        farm_discard(farm);
+    } else if ((uint8_t)(farm->vr - view->header.frame_sequence_number) <= half_window) {
+        /* Negative window: already accepted. */
+        farm_discard(farm);
+    } else {
+        farm->state = SDLP_FARM_LOCKOUT;
+        farm->stats.lockouts++;
+        farm_discard(farm);
+    }
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_farm_push(sdlp_farm_t *farm, const uint8_t *frame, size_t frame_length) {
+    sdlp_tc_frame_view_t view;
+    int result = sdlp_tc_decode_view(frame, frame_length, &view, 1);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    return sdlp_farm_push_view(farm, &view);
+}
+
+void sdlp_farm_buffer_release(sdlp_farm_t *farm) {
+    if (farm && farm->state == SDLP_FARM_WAIT) {
+        farm->state = SDLP_FARM_OPEN;
+    }
+}
+
+int sdlp_farm_get_clcw(const sdlp_farm_t *farm, sdlp_clcw_t *clcw) {
+    if (!farm || !clcw) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(clcw, 0, sizeof(sdlp_clcw_t));
+    clcw->cop_in_effect = SDLP_COP_IN_EFFECT_COP1;
+    clcw->virtual_channel_id = farm->config.virtual_channel_id;
+    clcw->lockout = (uint8_t)(farm->state == SDLP_FARM_LOCKOUT);
+    clcw->wait = (uint8_t)(farm->state == SDLP_FARM_WAIT);
+    clcw->retransmit = farm->retransmit;
+    clcw->farm_b_counter = (uint8_t)(farm->farm_b_counter & 0x03u);
+    clcw->report_value = farm->vr;
+
+    return SDLP_SUCCESS;
+}
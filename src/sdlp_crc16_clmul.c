@@ -0,0 +1,127 @@
+#include "sdlp_internal.h"
+
+#if defined(SDLP_CRC16_CLMUL)
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+/* Folding CRC16 over 128-bit lanes (Gopal et al., "Fast CRC Computation for
+ * Generic Polynomials Using PCLMULQDQ"). The CRC is MSB-first, so every lane is
+ * byte-reversed on load and bit i of a lane is the coefficient of x^i. Folding a
+ * lane X = X_hi * x^64 + X_lo forward by F bits replaces it with
+ * X_hi * (x^(F+64) mod P) + X_lo * (x^F mod P), which is congruent mod P and,
+ * P being of degree 16, never exceeds 80 bits. The remaining 128-bit lane is
+ * reduced by running the portable CRC over it with a zero register. */
+
+#define CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+
+/* { x^F mod P, x^(F+64) mod P } for P = 0x11021. */
+#define CLMUL_K128 0xAEFCu, 0x650Bu
+#define CLMUL_K256 0x8E29u, 0x26AAu
+#define CLMUL_K384 0xCDE2u, 0x2535u
+#define CLMUL_K512 0x13FCu, 0x8832u
+
+#define CLMUL_CONST(lo, hi) _mm_set_epi64x((long long)(hi), (long long)(lo))
+#define CLMUL_FOLD_CONST(k) CLMUL_CONST(k)
+
+/* Lanes are stored to copy, if not NULL, as loaded: the copy kernel writes
+ * dst from the registers the fold reads instead of re-reading src. */
+CLMUL_TARGET static inline __m128i clmul_load(const uint8_t *p, uint8_t *copy, __m128i bswap) {
+    __m128i lane = _mm_loadu_si128((const __m128i *)p);
+
+    if (copy) {
+        _mm_storeu_si128((__m128i *)copy, lane);
+    }
+    return _mm_shuffle_epi8(lane, bswap);
+}
+
+CLMUL_TARGET static inline __m128i clmul_fold(__m128i x, __m128i k) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+int sdlp_crc16_clmul_supported(void) {
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return 0;
+    }
+    return (ecx & bit_PCLMUL) && (ecx & bit_SSSE3);
+}
+
+/* Inlined into both kernels so the dst checks fold away in the update one. */
+CLMUL_TARGET __attribute__((always_inline)) static inline uint16_t
+clmul_crc16(uint16_t crc, uint8_t *dst, const uint8_t *data, size_t length) {
+    const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i k128 = CLMUL_FOLD_CONST(CLMUL_K128);
+
+#define CLMUL_DST(offset) (dst ? dst + (offset) : NULL)
+#define CLMUL_ADVANCE(n) \
+    do { \
+        data += (n); \
+        dst = dst ? dst + (n) : NULL; \
+        length -= (n); \
+    } while (0)
+
+    /* The CRC register is equivalent to XOR-ing it into the first 16 message bits. */
+    __m128i x0 = _mm_xor_si128(clmul_load(data, CLMUL_DST(0), bswap),
+                               _mm_insert_epi16(_mm_setzero_si128(), crc, 7));
+    __m128i x1 = clmul_load(data + 16, CLMUL_DST(16), bswap);
+    __m128i x2 = clmul_load(data + 32, CLMUL_DST(32), bswap);
+    __m128i x3 = clmul_load(data + 48, CLMUL_DST(48), bswap);
+    CLMUL_ADVANCE(64);
+
+    if (length >= 64) {
+        const __m128i k512 = CLMUL_FOLD_CONST(CLMUL_K512);
+
+        do {
+            x0 = _mm_xor_si128(clmul_fold(x0, k512), clmul_load(data, CLMUL_DST(0), bswap));
+            x1 = _mm_xor_si128(clmul_fold(x1, k512), clmul_load(data + 16, CLMUL_DST(16), bswap));
+            x2 = _mm_xor_si128(clmul_fold(x2, k512), clmul_load(data + 32, CLMUL_DST(32), bswap));
+            x3 = _mm_xor_si128(clmul_fold(x3, k512), clmul_load(data + 48, CLMUL_DST(48), bswap));
+            CLMUL_ADVANCE(64);
+        } while (length >= 64);
+    }
+
+    __m128i x = _mm_xor_si128(_mm_xor_si128(clmul_fold(x0, CLMUL_FOLD_CONST(CLMUL_K384)),
+                                            clmul_fold(x1, CLMUL_FOLD_CONST(CLMUL_K256))),
+                              _mm_xor_si128(clmul_fold(x2, k128), x3));
+
+    while (length >= 16) {
+        x = _mm_xor_si128(clmul_fold(x, k128), clmul_load(data, CLMUL_DST(0), bswap));
+        CLMUL_ADVANCE(16);
+    }
+
+#undef CLMUL_DST
+#undef CLMUL_ADVANCE
+
+    uint8_t lane[16];
+    _mm_storeu_si128((__m128i *)lane, _mm_shuffle_epi8(x, bswap));
+    crc = sdlp_crc16_update_portable(0, lane, sizeof(lane));
+
+    return dst ? sdlp_crc16_copy_portable(crc, dst, data, length)
+               : sdlp_crc16_update_portable(crc, data, length);
+}
+
+CLMUL_TARGET uint16_t sdlp_crc16_update_clmul(uint16_t crc, const uint8_t *data, size_t length) {
+    if (length < SDLP_CRC16_CLMUL_MIN_LENGTH) {
+        return sdlp_crc16_update_portable(crc, data, length);
+    }
+
+    return clmul_crc16(crc, NULL, data, length);
+}
+
+CLMUL_TARGET uint16_t sdlp_crc16_copy_clmul(uint16_t crc, uint8_t *dst, const uint8_t *src,
+                                            size_t length) {
+    if (length < SDLP_CRC16_CLMUL_MIN_LENGTH) {
+        return sdlp_crc16_copy_portable(crc, dst, src, length);
+    }
+
+    return clmul_crc16(crc, dst, src, length);
+}
+
+#else
+
+/* ISO C forbids an empty translation unit. */
+typedef int sdlp_crc16_clmul_unused_t;
+
+#endif /* SDLP_CRC16_CLMUL */
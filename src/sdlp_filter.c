@@ -0,0 +1,74 @@
+#include "sdlp_filter.h"
+#include <string.h>
+
+/* Set or clear the bits of keys (scid << vc_bits) + vc for one VC or all. */
+static int filter_update(uint64_t *bits, unsigned vc_bits, uint16_t spacecraft_id,
+                         uint8_t virtual_channel_id, int accept) {
+    unsigned vcs = 1u << vc_bits;
+
+    if (spacecraft_id > 0x3ffu ||
+        (virtual_channel_id != SDLP_FILTER_ALL_VCS && virtual_channel_id >= vcs)) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    unsigned first = virtual_channel_id == SDLP_FILTER_ALL_VCS ? 0u : virtual_channel_id;
+    unsigned last = virtual_channel_id == SDLP_FILTER_ALL_VCS ? vcs - 1u : virtual_channel_id;
+
+    for (unsigned vc = first; vc <= last; vc++) {
+        unsigned key = ((unsigned)spacecraft_id << vc_bits) | vc;
+        uint64_t mask = (uint64_t)1u << (key & 63u);
+
+        if (accept) {
+            bits[key >> 6] |= mask;
+        } else {
+            bits[key >> 6] &= ~mask;
+        }
+    }
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_filter_init(sdlp_tm_filter_t *filter) {
+    if (!filter) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    memset(filter, 0, sizeof(*filter));
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_filter_add(sdlp_tm_filter_t *filter, uint16_t spacecraft_id, uint8_t virtual_channel_id) {
+    if (!filter) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    return filter_update(filter->bits, 3, spacecraft_id, virtual_channel_id, 1);
+}
+
+int sdlp_tm_filter_remove(sdlp_tm_filter_t *filter, uint16_t spacecraft_id,
+                          uint8_t virtual_channel_id) {
+    if (!filter) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    return filter_update(filter->bits, 3, spacecraft_id, virtual_channel_id, 0);
+}
+
+int sdlp_tc_filter_init(sdlp_tc_filter_t *filter) {
+    if (!filter) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    memset(filter, 0, sizeof(*filter));
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tc_filter_add(sdlp_tc_filter_t *filter, uint16_t spacecraft_id, uint8_t virtual_channel_id) {
+    if (!filter) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    return filter_update(filter->bits, 6, spacecraft_id, virtual_channel_id, 1);
+}
+
+int sdlp_tc_filter_remove(sdlp_tc_filter_t *filter, uint16_t spacecraft_id,
+                          uint8_t virtual_channel_id) {
+    if (!filter) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    return filter_update(filter->bits, 6, spacecraft_id, virtual_channel_id, 0);
+}
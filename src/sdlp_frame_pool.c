@@ -0,0 +1,86 @@
+#include "sdlp_frame_pool.h"
+
+#define POOL_TOP(head) ((uint16_t)((head) & 0xffffu))
+#define POOL_TAG(head) ((head) & 0xffff0000u)
+#define POOL_TAG_STEP 0x10000u
+
+#if defined(__STDC_NO_ATOMICS__)
+#define POOL_LOAD(object, order) (*(object))
+#define POOL_STORE(object, value, order) (*(object) = (value))
+#define POOL_CAS(object, expected, desired, success, failure) \
+    (*(object) == *(expected) ? (*(object) = (desired), 1) : (*(expected) = *(object), 0))
+#else
+#define POOL_LOAD(object, order) atomic_load_explicit((object), (order))
+#define POOL_STORE(object, value, order) atomic_store_explicit((object), (value), (order))
+#define POOL_CAS(object, expected, desired, success, failure) \
+    atomic_compare_exchange_weak_explicit((object), (expected), (desired), (success), (failure))
+#endif
+
+int sdlp_frame_pool_init(sdlp_frame_pool_t *pool, uint8_t *buffers, sdlp_frame_pool_link_t *links,
+                         size_t count, size_t buffer_size) {
+    if (!pool || !buffers || !links || count == 0 || count > SDLP_FRAME_POOL_MAX_BUFFERS ||
+        buffer_size == 0 || (uintptr_t)buffers % SDLP_FRAME_POOL_ALIGN != 0) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    pool->buffers = buffers;
+    pool->links = links;
+    pool->buffer_size = buffer_size;
+    pool->stride = SDLP_FRAME_POOL_STRIDE(buffer_size);
+    pool->count = (uint16_t)count;
+
+    /* Buffer 0 on top, so a fresh pool hands buffers out in address order. */
+    for (size_t i = 0; i < count; i++) {
+        POOL_STORE(&links[i], (uint16_t)(i + 1u < count ? i + 2u : 0u), memory_order_relaxed);
+    }
+    POOL_STORE(&pool->head, 1u, memory_order_release);
+
+    return SDLP_SUCCESS;
+}
+
+/* A pop that read the top and its link before another thread popped it,
+ * popped more and pushed it back would install a stale link; the pop count in
+ * the tag makes its compare-and-swap fail instead. */
+int sdlp_frame_pool_acquire(sdlp_frame_pool_t *pool, uint8_t **buffer) {
+    if (!pool || !buffer) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    uint32_t head = POOL_LOAD(&pool->head, memory_order_acquire);
+    uint16_t top;
+
+    do {
+        top = POOL_TOP(head);
+        if (top == 0) {
+            return SDLP_ERROR_BUFFER_TOO_SMALL;
+        }
+    } while (!POOL_CAS(&pool->head, &head,
+                       (uint32_t)(POOL_TAG(head) + POOL_TAG_STEP) |
+                           POOL_LOAD(&pool->links[top - 1u], memory_order_relaxed),
+                       memory_order_acquire, memory_order_acquire));
+
+    *buffer = &pool->buffers[(size_t)(top - 1u) * pool->stride];
+    return SDLP_SUCCESS;
+}
+
+int sdlp_frame_pool_release(sdlp_frame_pool_t *pool, uint8_t *buffer) {
+    if (!pool || !buffer || (uintptr_t)buffer < (uintptr_t)pool->buffers) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t offset = (size_t)((uintptr_t)buffer - (uintptr_t)pool->buffers);
+    size_t index = offset / pool->stride;
+
+    if (offset % pool->stride != 0 || index >= pool->count) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    uint32_t head = POOL_LOAD(&pool->head, memory_order_relaxed);
+
+    do {
+        POOL_STORE(&pool->links[index], POOL_TOP(head), memory_order_relaxed);
+    } while (!POOL_CAS(&pool->head, &head, POOL_TAG(head) | (uint32_t)(index + 1u),
+                       memory_order_release, memory_order_relaxed));
+
+    return SDLP_SUCCESS;
+}
@@ -0,0 +1,201 @@
+/* Library-internal declarations shared between translation units. Not part of
+ * the public API. */
+#ifndef SDLP_INTERNAL_H
+#define SDLP_INTERNAL_H
+
+#include "sdlp_common.h"
+#include "sdlp_tm.h"
+
+/* Carry-less multiply CRC16 kernel, dispatched at runtime by CPUID. Disable
+ * with -DSDLP_CRC16_NO_ACCEL. */
+#if !defined(SDLP_CRC16_NO_ACCEL) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SDLP_CRC16_CLMUL 1
+#endif
+
+/* Compile-time selected table/bitwise backend (SDLP_CRC16_BACKEND). */
+uint16_t sdlp_crc16_update_portable(uint16_t crc, const uint8_t *data, size_t length);
+uint16_t sdlp_crc16_copy_portable(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length);
+
+/* CRC16 of up to SDLP_CRC16_STREAMS independent buffers. The streams are
+ * interleaved so the lookups of one hide the latency of the others. */
+#define SDLP_CRC16_STREAMS 4
+
+void sdlp_crc16_multi(const uint8_t *const *data, const size_t *length, uint16_t *crc,
+                      size_t count);
+
+/* The register after feeding length zero bytes: crc * x^(8 * length) mod P, in
+ * O(log length). Since the CRC is linear, the CRC of a message changes by the
+ * zero-init CRC of the XOR difference of the changed bytes, shifted by the
+ * number of bytes that follow them. */
+uint16_t sdlp_crc16_shift(uint16_t crc, size_t length);
+
+/* a * b mod P, both in CRC register order (bit 15 is x^15). */
+uint16_t sdlp_crc16_mul(uint16_t a, uint16_t b);
+
+/* Total length of iov, or SIZE_MAX if a non-empty segment has no data or the
+ * sum overflows. */
+size_t sdlp_iov_length(const sdlp_iovec_t *iov, size_t iov_count);
+
+/* Append the segments to the offset bytes already in frame and return the
+ * CRC register over all of it (sdlp_crc16_final() not applied). The CRC trails
+ * the copy in blocks small enough to still be in L1, so whole TM/TC frames
+ * take a single CRC call over just-written bytes. */
+uint16_t sdlp_crc16_gather(uint8_t *frame, size_t offset, const sdlp_iovec_t *iov, size_t iov_count);
+
+/* Write the packed TM primary header; returns TM_PRIMARY_HEADER_SIZE. */
+size_t sdlp_tm_pack_header(const sdlp_tm_header_t *header, uint8_t *buffer);
+
+#if defined(SDLP_CRC16_CLMUL)
+/* Inputs shorter than this are cheaper on the table backend. */
+#define SDLP_CRC16_CLMUL_MIN_LENGTH 64u
+
+int sdlp_crc16_clmul_supported(void);
+uint16_t sdlp_crc16_update_clmul(uint16_t crc, const uint8_t *data, size_t length);
+uint16_t sdlp_crc16_copy_clmul(uint16_t crc, uint8_t *dst, const uint8_t *src, size_t length);
+#endif
+
+/* Split-nibble GF(2^8) Reed-Solomon kernels, dispatched at runtime by CPUID.
+ * Disable with -DSDLP_RS_NO_ACCEL. */
+#if !defined(SDLP_RS_NO_ACCEL) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SDLP_RS_SSSE3 1
+
+int sdlp_rs_ssse3_supported(void);
+
+/* Parity or syndromes of the count symbols at symbols[0], symbols[stride], ...
+ * where first is the codeword position of symbols[0] and basis, if not NULL,
+ * maps each symbol to the conventional basis. */
+void sdlp_rs_parity_ssse3(const uint8_t *symbols, size_t stride, size_t count, size_t first,
+                          const uint8_t *basis, uint8_t *parity);
+void sdlp_rs_syndromes_ssse3(const uint8_t *symbols, size_t stride, size_t count, size_t first,
+                             const uint8_t *basis, uint8_t *syndromes);
+#endif
+
+/* Statistics hooks (sdlp_stats.h). Compiled out they expand to nothing. */
+enum {
+    SDLP_STAT_TM_ENCODED = 0,
+    SDLP_STAT_TM_DECODED,
+    SDLP_STAT_TC_ENCODED,
+    SDLP_STAT_TC_DECODED,
+    SDLP_STAT_CRC_MISMATCH,
+    SDLP_STAT_INVALID_FRAME,
+    SDLP_STAT_BUFFER_TOO_SMALL,
+    SDLP_STAT_MC_GAP,
+    SDLP_STAT_VC_GAP, /* one per VC */
+    SDLP_STAT_COUNTERS = SDLP_STAT_VC_GAP + TM_MAX_VIRTUAL_CHANNELS
+};
+
+#if defined(SDLP_STATS_ENABLED)
+#include "sdlp_stats.h"
+
+#define SDLP_STATS_CACHE_LINE 64
+
+#if defined(__STDC_NO_ATOMICS__)
+typedef unsigned long long sdlp_stats_word_t;
+#define SDLP_STATS_LOAD(word) (*(word))
+#else
+#include <stdatomic.h>
+typedef atomic_ullong sdlp_stats_word_t;
+#define SDLP_STATS_LOAD(word) atomic_load_explicit((word), memory_order_relaxed)
+#endif
+
+/* Last frame counts seen from one spacecraft. */
+typedef struct {
+    uint16_t spacecraft_id;
+    uint8_t mc_valid;
+    uint8_t vc_valid; /* bit v: vc_count[v] holds the last count seen on VC v */
+    uint8_t mc_count;
+    uint8_t vc_count[TM_MAX_VIRTUAL_CHANNELS];
+} sdlp_stats_mc_t;
+
+/* Written by one thread unless shared; the decoder-side frame count tracking
+ * after the counters belongs to the owner alone. */
+typedef struct {
+    _Alignas(SDLP_STATS_CACHE_LINE) sdlp_stats_word_t counters[SDLP_STAT_COUNTERS];
+#if defined(SDLP_STATS_CYCLES)
+    sdlp_stats_word_t cycles[SDLP_STATS_TIMERS][SDLP_STATS_HISTOGRAM_BINS];
+#endif
+    uint8_t shared;
+    uint8_t mc_last;  /* master_channels entry of the last frame */
+    uint8_t mc_next;  /* entry a new spacecraft replaces */
+    sdlp_stats_mc_t master_channels[SDLP_STATS_MASTER_CHANNELS];
+} sdlp_stats_slot_t;
+
+sdlp_stats_slot_t *sdlp_stats_claim(void);
+
+#if defined(SDLP_STATS_NO_TLS) || defined(__STDC_NO_ATOMICS__)
+static inline sdlp_stats_slot_t *sdlp_stats_slot(void) {
+    return sdlp_stats_claim();
+}
+#else
+extern _Thread_local sdlp_stats_slot_t *sdlp_stats_current;
+
+static inline sdlp_stats_slot_t *sdlp_stats_slot(void) {
+    sdlp_stats_slot_t *slot = sdlp_stats_current;
+
+    return slot ? slot : sdlp_stats_claim();
+}
+#endif
+
+/* An owned slot has a single writer, so a relaxed load and store suffice and
+ * compile to a plain increment; only the shared slot needs a locked add. */
+static inline void sdlp_stats_word_add(const sdlp_stats_slot_t *slot, sdlp_stats_word_t *word,
+                                       unsigned long long n) {
+#if defined(__STDC_NO_ATOMICS__)
+    (void)slot;
+    *word += n;
+#else
+    if (slot->shared) {
+        atomic_fetch_add_explicit(word, n, memory_order_relaxed);
+    } else {
+        atomic_store_explicit(word, atomic_load_explicit(word, memory_order_relaxed) + n,
+                              memory_order_relaxed);
+    }
+#endif
+}
+
+static inline void sdlp_stats_add(unsigned counter, unsigned long n) {
+    sdlp_stats_slot_t *slot = sdlp_stats_slot();
+
+    sdlp_stats_word_add(slot, &slot->counters[counter], n);
+}
+
+/* A TM frame passed its FECF check: count it and step the frame counts. */
+void sdlp_stats_tm_decoded(const sdlp_tm_header_t *header);
+
+#define SDLP_STATS_COUNT(counter) sdlp_stats_add((counter), 1)
+#define SDLP_STATS_TM_DECODED(header) sdlp_stats_tm_decoded(header)
+#else
+#define SDLP_STATS_COUNT(counter) ((void)0)
+#define SDLP_STATS_TM_DECODED(header) ((void)0)
+#endif
+
+#if defined(SDLP_STATS_ENABLED) && defined(SDLP_STATS_CYCLES)
+#if !defined(SDLP_STATS_CYCLE_COUNTER)
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define SDLP_STATS_CYCLE_COUNTER() __rdtsc()
+#elif defined(__aarch64__)
+static inline uint64_t sdlp_stats_cntvct(void) {
+    uint64_t value;
+
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+}
+#define SDLP_STATS_CYCLE_COUNTER() sdlp_stats_cntvct()
+#else
+#error "SDLP_STATS_CYCLES: define SDLP_STATS_CYCLE_COUNTER() for this target"
+#endif
+#endif
+
+/* Record count samples of cycles / count each. */
+void sdlp_stats_cycles(sdlp_stats_timer_t timer, uint64_t cycles, size_t count);
+
+#define SDLP_STATS_TIMER_START(start) uint64_t start = (uint64_t)SDLP_STATS_CYCLE_COUNTER()
+#define SDLP_STATS_TIMER_STOP(timer, start, count) \
+    sdlp_stats_cycles((timer), (uint64_t)SDLP_STATS_CYCLE_COUNTER() - (start), (count))
+#else
+#define SDLP_STATS_TIMER_START(start)
+#define SDLP_STATS_TIMER_STOP(timer, start, count) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,290 @@
+#include "sdlp_mux.h"
+#include "sdlp_internal.h"
+#include <string.h>
+
+#define MUX_OVERHEAD (TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE)
+#define MUX_MIN_PACKET_SIZE (SDLP_SPACE_PACKET_HEADER_SIZE + 1u)
+
+static size_t mux_data_size(const sdlp_mux_t *mux) {
+    return mux->frame_length - MUX_OVERHEAD;
+}
+
+static void ring_read(const sdlp_mux_vc_t *vc, size_t pos, uint8_t *dst, size_t length) {
+    size_t index = pos % vc->ring_size;
+    size_t first = vc->ring_size - index;
+
+    if (first > length) {
+        first = length;
+    }
+    memcpy(dst, &vc->ring[index], first);
+    memcpy(&dst[first], vc->ring, length - first);
+}
+
+static void ring_write(sdlp_mux_vc_t *vc, size_t pos, const uint8_t *src, size_t length) {
+    size_t index = pos % vc->ring_size;
+    size_t first = vc->ring_size - index;
+
+    if (first > length) {
+        first = length;
+    }
+    memcpy(&vc->ring[index], src, first);
+    memcpy(vc->ring, &src[first], length - first);
+}
+
+/* Byte k of an idle packet of the given total length. */
+static uint8_t idle_packet_byte(size_t k, size_t length) {
+    switch (k) {
+    case 0:
+        return (uint8_t)(SDLP_SPACE_PACKET_IDLE_APID >> 8);
+    case 1:
+        return (uint8_t)(SDLP_SPACE_PACKET_IDLE_APID & 0xffu);
+    case 2:
+        return 0xc0u; /* unsegmented, sequence count 0 */
+    case 3:
+        return 0x00u;
+    case 4:
+        return (uint8_t)(((length - MUX_MIN_PACKET_SIZE) >> 8) & 0xffu);
+    case 5:
+        return (uint8_t)((length - MUX_MIN_PACKET_SIZE) & 0xffu);
+    default:
+        return SDLP_IDLE_FILL_BYTE;
+    }
+}
+
+static size_t mux_write_idle(sdlp_mux_vc_t *vc, uint8_t *dst, size_t space) {
+    size_t n = vc->pad_remaining < space ? vc->pad_remaining : space;
+    size_t offset = vc->pad_length - vc->pad_remaining;
+
+    for (size_t k = 0; k < n; k++) {
+        dst[k] = idle_packet_byte(offset + k, vc->pad_length);
+    }
+    vc->pad_remaining -= n;
+
+    return n;
+}
+
+/* Pack queued packets (and idle padding if the queue runs dry) into data. */
+static uint16_t mux_fill_data(sdlp_mux_vc_t *vc, uint8_t *data, size_t size) {
+    size_t pos = 0;
+    uint16_t fhp = TM_FHP_NO_PACKET_START;
+
+    while (pos < size) {
+        if (vc->pad_remaining) {
+            if (vc->pad_remaining == vc->pad_length && fhp == TM_FHP_NO_PACKET_START) {
+                fhp = (uint16_t)pos;
+            }
+            pos += mux_write_idle(vc, &data[pos], size - pos);
+            continue;
+        }
+
+        if (vc->packet_remaining) {
+            size_t n = vc->packet_remaining < size - pos ? vc->packet_remaining : size - pos;
+
+            ring_read(vc, vc->head, &data[pos], n);
+            vc->head += n;
+            vc->packet_remaining -= n;
+            pos += n;
+            continue;
+        }
+
+        if (fhp == TM_FHP_NO_PACKET_START) {
+            fhp = (uint16_t)pos;
+        }
+
+        if (vc->tail != vc->head) {
+            uint8_t header[SDLP_SPACE_PACKET_HEADER_SIZE];
+
+            ring_read(vc, vc->head, header, sizeof(header));
+            vc->packet_remaining = sdlp_space_packet_length(header);
+            vc->packets++;
+        } else {
+            /* An idle packet shorter than a header cannot exist; let it span. */
+            size_t space = size - pos;
+            vc->pad_length = space < MUX_MIN_PACKET_SIZE ? MUX_MIN_PACKET_SIZE : space;
+            vc->pad_remaining = vc->pad_length;
+        }
+    }
+
+    return fhp;
+}
+
+static int mux_has_full_frame(const sdlp_mux_t *mux, const sdlp_mux_vc_t *vc) {
+    return sdlp_mux_queued(vc) + vc->pad_remaining >= mux_data_size(mux);
+}
+
+/* Pick a VC among those satisfying the full/partial class, per policy. */
+static sdlp_mux_vc_t *mux_select(sdlp_mux_t *mux, int need_full) {
+    sdlp_mux_vc_t *best = NULL;
+
+    if (mux->policy == SDLP_MUX_PRIORITY) {
+        for (uint8_t i = 0; i < mux->vc_count; i++) {
+            sdlp_mux_vc_t *vc = mux->vcs[i];
+
+            if (sdlp_mux_queued(vc) == 0 || (need_full && !mux_has_full_frame(mux, vc))) {
+                continue;
+            }
+            if (!best || vc->priority > best->priority) {
+                best = vc;
+            }
+        }
+        return best;
+    }
+
+    for (int pass = 0; pass < 2 && !best; pass++) {
+        int eligible = 0;
+
+        for (uint8_t n = 0; n < mux->vc_count; n++) {
+            uint8_t i = (uint8_t)((mux->cursor + n) % mux->vc_count);
+            sdlp_mux_vc_t *vc = mux->vcs[i];
+
+            if (sdlp_mux_queued(vc) == 0 || (need_full && !mux_has_full_frame(mux, vc))) {
+                continue;
+            }
+            eligible = 1;
+            if (vc->credit > 0) {
+                best = vc;
+                vc->credit--;
+                mux->cursor = vc->credit ? i : (uint8_t)((i + 1u) % mux->vc_count);
+                break;
+            }
+        }
+
+        if (!eligible) {
+            break;
+        }
+        if (!best) {
+            /* Every eligible VC spent its credit: start a new round. */
+            for (uint8_t i = 0; i < mux->vc_count; i++) {
+                mux->vcs[i]->credit = mux->vcs[i]->weight;
+            }
+        }
+    }
+
+    return best;
+}
+
+int sdlp_mux_init(sdlp_mux_t *mux, uint16_t spacecraft_id, size_t frame_length,
+                  sdlp_mux_policy_t policy) {
+    if (!mux || frame_length <= MUX_OVERHEAD || frame_length - MUX_OVERHEAD > TM_MAX_DATA_SIZE ||
+        (policy != SDLP_MUX_PRIORITY && policy != SDLP_MUX_WEIGHTED_RR)) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(mux, 0, sizeof(sdlp_mux_t));
+    mux->policy = policy;
+    mux->frame_length = frame_length;
+    sdlp_tm_master_channel_init(&mux->master, spacecraft_id);
+    sdlp_tm_virtual_channel_init(&mux->oid_channel, &mux->master, TM_OID_VIRTUAL_CHANNEL);
+
+    /* OID frames only differ in their frame counts: keep the CRC of one with
+     * zero counts and patch in the counts of each frame. */
+    sdlp_tm_header_t header = {SDLP_VERSION, spacecraft_id & 0x3ffu, TM_OID_VIRTUAL_CHANNEL, 0, 0, 0,
+                               TM_FHP_IDLE_DATA};
+    uint8_t chunk[64];
+    uint16_t crc = sdlp_crc16_update(sdlp_crc16_init(), chunk, sdlp_tm_pack_header(&header, chunk));
+
+    memset(chunk, SDLP_IDLE_FILL_BYTE, sizeof(chunk));
+    for (size_t left = mux_data_size(mux); left > 0;) {
+        size_t n = left < sizeof(chunk) ? left : sizeof(chunk);
+
+        crc = sdlp_crc16_update(crc, chunk, n);
+        left -= n;
+    }
+    mux->oid_crc = sdlp_crc16_final(crc);
+    mux->oid_counts_shift = sdlp_crc16_shift(1u, frame_length - TM_FRAME_ERROR_CONTROL_SIZE - 4u);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_mux_add_vc(sdlp_mux_t *mux, sdlp_mux_vc_t *vc, uint8_t virtual_channel_id,
+                    uint8_t *ring, size_t ring_size, uint8_t priority, uint8_t weight) {
+    if (!mux || !vc || !ring || ring_size < MUX_MIN_PACKET_SIZE || weight == 0 ||
+        virtual_channel_id >= TM_OID_VIRTUAL_CHANNEL || mux->vc_count >= TM_MAX_VIRTUAL_CHANNELS) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    for (uint8_t i = 0; i < mux->vc_count; i++) {
+        if (mux->vcs[i]->channel.virtual_channel_id == virtual_channel_id) {
+            return SDLP_ERROR_INVALID_PARAM;
+        }
+    }
+
+    memset(vc, 0, sizeof(sdlp_mux_vc_t));
+    sdlp_tm_virtual_channel_init(&vc->channel, &mux->master, virtual_channel_id);
+    vc->ring = ring;
+    vc->ring_size = ring_size;
+    vc->priority = priority;
+    vc->weight = weight;
+    vc->credit = weight;
+    mux->vcs[mux->vc_count++] = vc;
+
+    return SDLP_SUCCESS;
+}
+
+size_t sdlp_mux_queued(const sdlp_mux_vc_t *vc) {
+    return vc ? vc->tail - vc->head : 0;
+}
+
+int sdlp_mux_enqueue(sdlp_mux_vc_t *vc, const uint8_t *packet, size_t length) {
+    if (!vc || !packet || length < MUX_MIN_PACKET_SIZE ||
+        sdlp_space_packet_length(packet) != length) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (vc->ring_size - sdlp_mux_queued(vc) < length) {
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    ring_write(vc, vc->tail, packet, length);
+    vc->tail += length;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_mux_next_frame(sdlp_mux_t *mux, uint8_t *buffer, size_t buffer_size,
+                        size_t *encoded_size) {
+    if (!mux || !buffer || !encoded_size) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (buffer_size < mux->frame_length) {
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    sdlp_mux_vc_t *vc = mux_select(mux, 1);
+
+    if (!vc) {
+        vc = mux_select(mux, 0);
+    }
+
+    sdlp_tm_builder_t builder;
+    size_t size = mux_data_size(mux);
+    int result = sdlp_tm_vc_builder_begin(vc ? &vc->channel : &mux->oid_channel, &builder,
+                                          buffer, mux->frame_length);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    if (vc) {
+        builder.header.transfer_frame_data_field_status = mux_fill_data(vc, builder.data, size);
+        vc->frames++;
+    } else {
+        builder.header.transfer_frame_data_field_status = TM_FHP_IDLE_DATA;
+        memset(builder.data, SDLP_IDLE_FILL_BYTE, size);
+        mux->idle_frames++;
+        mux->frames++;
+
+        size_t offset = sdlp_tm_pack_header(&builder.header, buffer) + size;
+        uint16_t crc = (uint16_t)(mux->oid_crc ^ sdlp_crc16_mul(sdlp_crc16_update(0, &buffer[2], 2),
+                                                                 mux->oid_counts_shift));
+
+        buffer[offset++] = (uint8_t)(crc >> 8);
+        buffer[offset++] = (uint8_t)(crc & 0xffu);
+        *encoded_size = offset;
+        return SDLP_SUCCESS;
+    }
+    mux->frames++;
+
+    return sdlp_tm_builder_commit(&builder, (uint16_t)size, encoded_size);
+}
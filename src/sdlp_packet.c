@@ -0,0 +1,219 @@
+#include "sdlp_packet.h"
+#include <string.h>
+
+size_t sdlp_space_packet_length(const uint8_t *header) {
+    return SDLP_SPACE_PACKET_HEADER_SIZE + 1u + (((size_t)header[4] << 8) | header[5]);
+}
+
+static void extractor_deliver(sdlp_packet_extractor_t *extractor, const uint8_t *packet,
+                              size_t length) {
+    uint16_t apid = (uint16_t)(((packet[0] & 0x07u) << 8) | packet[1]);
+
+    if (apid == SDLP_SPACE_PACKET_IDLE_APID) {
+        extractor->stats.idle_packets++;
+        return;
+    }
+
+    extractor->stats.packets++;
+    if (extractor->config.on_packet) {
+        extractor->config.on_packet(extractor->config.user, packet, length);
+    }
+}
+
+static int extractor_in_packet(const sdlp_packet_extractor_t *extractor) {
+    return extractor->fill > 0 || extractor->skip > 0;
+}
+
+static void extractor_drop_packet(sdlp_packet_extractor_t *extractor) {
+    extractor->fill = 0;
+    extractor->expected = 0;
+    extractor->skip = 0;
+}
+
+/* Add bytes to the spanning packet; completes at most one packet. Returns the
+ * number of bytes consumed. */
+static size_t extractor_continue(sdlp_packet_extractor_t *extractor, const uint8_t *data,
+                                 size_t length) {
+    size_t used = 0;
+
+    if (extractor->skip == 0 && extractor->expected == 0) {
+        size_t n = SDLP_SPACE_PACKET_HEADER_SIZE - extractor->fill;
+
+        if (n > length) {
+            n = length;
+        }
+        memcpy(&extractor->config.reassembly_buffer[extractor->fill], data, n);
+        extractor->fill += n;
+        used = n;
+
+        if (extractor->fill < SDLP_SPACE_PACKET_HEADER_SIZE) {
+            return used;
+        }
+
+        extractor->expected = sdlp_space_packet_length(extractor->config.reassembly_buffer);
+
+        if (extractor->expected > extractor->config.reassembly_capacity) {
+            extractor->stats.oversize_packets++;
+            extractor->skip = extractor->expected - extractor->fill;
+            extractor->fill = 0;
+            extractor->expected = 0;
+        }
+    }
+
+    if (extractor->skip) {
+        size_t n = extractor->skip < length - used ? extractor->skip : length - used;
+
+        extractor->skip -= n;
+        return used + n;
+    }
+
+    size_t n = extractor->expected - extractor->fill;
+
+    if (n > length - used) {
+        n = length - used;
+    }
+    memcpy(&extractor->config.reassembly_buffer[extractor->fill], &data[used], n);
+    extractor->fill += n;
+    used += n;
+
+    if (extractor->fill == extractor->expected) {
+        extractor_deliver(extractor, extractor->config.reassembly_buffer, extractor->expected);
+        extractor_drop_packet(extractor);
+    }
+
+    return used;
+}
+
+int sdlp_packet_extractor_init(sdlp_packet_extractor_t *extractor,
+                               const sdlp_packet_extractor_config_t *config) {
+    if (!extractor || !config || !config->reassembly_buffer ||
+        config->reassembly_capacity < SDLP_SPACE_PACKET_HEADER_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(extractor, 0, sizeof(sdlp_packet_extractor_t));
+    extractor->config = *config;
+
+    return SDLP_SUCCESS;
+}
+
+void sdlp_packet_extractor_reset(sdlp_packet_extractor_t *extractor) {
+    if (extractor) {
+        extractor_drop_packet(extractor);
+        extractor->in_sync = 0;
+        extractor->have_frame_count = 0;
+    }
+}
+
+int sdlp_packet_extractor_push(sdlp_packet_extractor_t *extractor, const sdlp_tm_header_t *header,
+                               const uint8_t *data, size_t data_length) {
+    if (!extractor || !header || (!data && data_length)) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    extractor->stats.frames++;
+
+    if (extractor->have_frame_count &&
+        header->virtual_channel_frame_count != extractor->next_frame_count) {
+        extractor->stats.frame_gaps++;
+        if (extractor_in_packet(extractor)) {
+            extractor_drop_packet(extractor);
+        }
+        extractor->in_sync = 0;
+    }
+    extractor->have_frame_count = 1;
+    extractor->next_frame_count = (uint8_t)(header->virtual_channel_frame_count + 1u);
+
+    size_t fhp = header->transfer_frame_data_field_status & TM_FHP_MASK;
+
+    if (fhp == TM_FHP_IDLE_DATA) {
+        extractor->stats.idle_frames++;
+        return SDLP_SUCCESS;
+    }
+
+    if (fhp != TM_FHP_NO_PACKET_START && fhp >= data_length) {
+        extractor->stats.discarded_bytes += (uint32_t)data_length;
+        extractor_drop_packet(extractor);
+        extractor->in_sync = 0;
+        return SDLP_ERROR_INVALID_FRAME;
+    }
+
+    size_t pos = 0;
+
+    if (!extractor->in_sync) {
+        pos = (fhp == TM_FHP_NO_PACKET_START) ? data_length : fhp;
+        extractor->stats.discarded_bytes += (uint32_t)pos;
+        if (fhp == TM_FHP_NO_PACKET_START) {
+            return SDLP_SUCCESS;
+        }
+        extractor->in_sync = 1;
+    } else if (extractor_in_packet(extractor)) {
+        size_t limit = (fhp == TM_FHP_NO_PACKET_START) ? data_length : fhp;
+
+        pos = extractor_continue(extractor, data, limit);
+
+        if (fhp == TM_FHP_NO_PACKET_START) {
+            if (pos < data_length) {
+                /* A packet ended inside a frame that announces no packet start. */
+                extractor->stats.resyncs++;
+                extractor->stats.discarded_bytes += (uint32_t)(data_length - pos);
+                extractor->in_sync = 0;
+            }
+            return SDLP_SUCCESS;
+        }
+
+        if (extractor_in_packet(extractor) || pos < fhp) {
+            /* The spanning packet disagrees with the FHP: trust the pointer. */
+            extractor->stats.resyncs++;
+            extractor->stats.discarded_bytes += (uint32_t)(fhp - pos);
+            extractor_drop_packet(extractor);
+        }
+        pos = fhp;
+    } else {
+        /* Nothing is pending, so the frame must start with a packet. */
+        if (fhp != 0) {
+            extractor->stats.resyncs++;
+        }
+        if (fhp == TM_FHP_NO_PACKET_START) {
+            extractor->stats.discarded_bytes += (uint32_t)data_length;
+            extractor->in_sync = 0;
+            return SDLP_SUCCESS;
+        }
+        extractor->stats.discarded_bytes += (uint32_t)fhp;
+        pos = fhp;
+    }
+
+    while (pos < data_length) {
+        size_t remaining = data_length - pos;
+
+        if (remaining >= SDLP_SPACE_PACKET_HEADER_SIZE) {
+            size_t length = sdlp_space_packet_length(&data[pos]);
+
+            if (length <= remaining) {
+                extractor_deliver(extractor, &data[pos], length);
+                pos += length;
+                continue;
+            }
+        }
+
+        pos += extractor_continue(extractor, &data[pos], remaining);
+    }
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_packet_extractor_push_view(sdlp_packet_extractor_t *extractor,
+                                    const sdlp_tm_frame_view_t *view) {
+    if (!view) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    return sdlp_packet_extractor_push(extractor, &view->header, view->data, view->data_length);
+}
+
+int sdlp_packet_extractor_push_frame(sdlp_packet_extractor_t *extractor,
+                                     const sdlp_tm_frame_t *frame) {
+    if (!frame) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    return sdlp_packet_extractor_push(extractor, &frame->header, frame->data, frame->data_length);
+}
@@ -0,0 +1,224 @@
+#include "sdlp_randomizer.h"
+#include "sdlp_internal.h"
+#include "sdlp_randomizer_table.h"
+#include <string.h>
+
+/* CRC and XOR alternate over blocks of this size, so each block is read from
+ * memory once and processed twice while it sits in L1. Whole frames fit in one
+ * block: splitting them further would only add CRC call overhead. */
+#define RANDOMIZER_BLOCK 4096u
+
+/* dst = src XOR the sequence from byte position of the frame. 64-bit words,
+ * which the compiler widens to SIMD where the target has it. */
+static void randomizer_xor(uint8_t *dst, const uint8_t *src, size_t length, size_t position) {
+    while (length > 0) {
+        size_t phase = position % SDLP_RANDOMIZER_PERIOD;
+        size_t n = SDLP_RANDOMIZER_TABLE_LENGTH - phase;
+        const uint8_t *sequence = &sdlp_randomizer_table[phase];
+        size_t i = 0;
+
+        if (n > length) {
+            n = length;
+        }
+        for (; i + 8u <= n; i += 8u) {
+            uint64_t word;
+            uint64_t mask;
+
+            memcpy(&word, &src[i], sizeof(word));
+            memcpy(&mask, &sequence[i], sizeof(mask));
+            word ^= mask;
+            memcpy(&dst[i], &word, sizeof(word));
+        }
+        for (; i < n; i++) {
+            dst[i] = (uint8_t)(src[i] ^ sequence[i]);
+        }
+
+        dst += n;
+        src += n;
+        length -= n;
+        position += n;
+    }
+}
+
+/* randomizer_xor() with the CRC16 of src (crc_of_output == 0) or of dst folded
+ * into crc. dst may equal src. */
+static uint16_t randomizer_xor_crc16(uint16_t crc, uint8_t *dst, const uint8_t *src,
+                                     size_t length, size_t position, int crc_of_output) {
+    while (length > 0) {
+        size_t n = length < RANDOMIZER_BLOCK ? length : RANDOMIZER_BLOCK;
+
+        if (crc_of_output) {
+            randomizer_xor(dst, src, n, position);
+            crc = sdlp_crc16_update(crc, dst, n);
+        } else {
+            crc = sdlp_crc16_update(crc, src, n);
+            randomizer_xor(dst, src, n, position);
+        }
+
+        dst += n;
+        src += n;
+        length -= n;
+        position += n;
+    }
+
+    return crc;
+}
+
+static size_t randomizer_append_fecf(uint8_t *buffer, size_t offset, uint16_t crc) {
+    crc = sdlp_crc16_final(crc);
+    buffer[offset] = (uint8_t)((crc >> 8) & 0xffu);
+    buffer[offset + 1] = (uint8_t)(crc & 0xffu);
+    randomizer_xor(&buffer[offset], &buffer[offset], TM_FRAME_ERROR_CONTROL_SIZE, offset);
+
+    return offset + TM_FRAME_ERROR_CONTROL_SIZE;
+}
+
+static int randomizer_check_fecf(uint16_t crc, const sdlp_tm_header_t *header, uint16_t fecf) {
+    (void)header; /* read by the statistics hook only */
+
+    if (sdlp_crc16_final(crc) != fecf) {
+        SDLP_STATS_COUNT(SDLP_STAT_CRC_MISMATCH);
+        return SDLP_ERROR_CRC_MISMATCH;
+    }
+
+    SDLP_STATS_TM_DECODED(header);
+    return SDLP_SUCCESS;
+}
+
+int sdlp_randomize(uint8_t *buffer, size_t length) {
+    if (!buffer) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    randomizer_xor(buffer, buffer, length, 0);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_randomize_copy(uint8_t *dst, const uint8_t *src, size_t length) {
+    if (!dst || !src) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    randomizer_xor(dst, src, length, 0);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_encode_frame_randomized(const sdlp_tm_frame_t *frame, uint8_t *buffer,
+                                    size_t buffer_size, size_t *encoded_size) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!frame || !buffer || !encoded_size || frame->data_length > TM_MAX_DATA_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (buffer_size < TM_PRIMARY_HEADER_SIZE + (size_t)frame->data_length + TM_FRAME_ERROR_CONTROL_SIZE) {
+        SDLP_STATS_COUNT(SDLP_STAT_BUFFER_TOO_SMALL);
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    size_t offset = sdlp_tm_pack_header(&frame->header, buffer);
+    uint16_t crc = randomizer_xor_crc16(sdlp_crc16_init(), buffer, buffer, offset, 0, 0);
+
+    crc = randomizer_xor_crc16(crc, &buffer[offset], frame->data, frame->data_length, offset, 0);
+    *encoded_size = randomizer_append_fecf(buffer, offset + frame->data_length, crc);
+
+    SDLP_STATS_COUNT(SDLP_STAT_TM_ENCODED);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_ENCODE, start, 1);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_builder_commit_randomized(sdlp_tm_builder_t *builder, uint16_t data_length,
+                                      size_t *encoded_size) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!builder || !builder->buffer || !encoded_size || data_length > builder->data_capacity) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t offset = sdlp_tm_pack_header(&builder->header, builder->buffer) + data_length;
+    uint16_t crc = randomizer_xor_crc16(sdlp_crc16_init(), builder->buffer, builder->buffer,
+                                        offset, 0, 0);
+
+    *encoded_size = randomizer_append_fecf(builder->buffer, offset, crc);
+
+    SDLP_STATS_COUNT(SDLP_STAT_TM_ENCODED);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_ENCODE, start, 1);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_decode_view_randomized(uint8_t *buffer, size_t buffer_size,
+                                   sdlp_tm_frame_view_t *view) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!buffer || !view) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (buffer_size < TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t fecf_offset = buffer_size - TM_FRAME_ERROR_CONTROL_SIZE;
+    uint16_t crc = randomizer_xor_crc16(sdlp_crc16_init(), buffer, buffer, fecf_offset, 0, 1);
+
+    randomizer_xor(&buffer[fecf_offset], &buffer[fecf_offset], TM_FRAME_ERROR_CONTROL_SIZE,
+                   fecf_offset);
+
+    int result = sdlp_tm_decode_view(buffer, buffer_size, view, 0);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    result = randomizer_check_fecf(crc, &view->header, view->fecf);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_DECODE, start, 1);
+
+    return result;
+}
+
+int sdlp_tm_decode_frame_randomized(const uint8_t *buffer, size_t buffer_size,
+                                    sdlp_tm_frame_t *frame) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!buffer || !frame) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (buffer_size < TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t data_length = buffer_size - TM_PRIMARY_HEADER_SIZE - TM_FRAME_ERROR_CONTROL_SIZE;
+    size_t fecf_offset = buffer_size - TM_FRAME_ERROR_CONTROL_SIZE;
+
+    if (data_length > TM_MAX_DATA_SIZE) {
+        SDLP_STATS_COUNT(SDLP_STAT_INVALID_FRAME);
+        return SDLP_ERROR_INVALID_FRAME;
+    }
+
+    /* Header and FECF back to back form an empty frame the view parser accepts. */
+    uint8_t outer[TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE];
+    sdlp_tm_frame_view_t view;
+    uint16_t crc = randomizer_xor_crc16(sdlp_crc16_init(), outer, buffer, TM_PRIMARY_HEADER_SIZE,
+                                        0, 1);
+
+    randomizer_xor(&outer[TM_PRIMARY_HEADER_SIZE], &buffer[fecf_offset],
+                   TM_FRAME_ERROR_CONTROL_SIZE, fecf_offset);
+    sdlp_tm_decode_view(outer, sizeof(outer), &view, 0);
+
+    crc = randomizer_xor_crc16(crc, frame->data, &buffer[TM_PRIMARY_HEADER_SIZE], data_length,
+                               TM_PRIMARY_HEADER_SIZE, 1);
+
+    frame->header = view.header;
+    frame->data_length = (uint16_t)data_length;
+    frame->fecf = view.fecf;
+
+    int result = randomizer_check_fecf(crc, &frame->header, frame->fecf);
+
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_DECODE, start, 1);
+    return result;
+}
@@ -0,0 +1,345 @@
+#include "sdlp_rs.h"
+#include "sdlp_internal.h"
+#include "sdlp_rs_tables.h"
+#include <string.h>
+
+/* Portable arithmetic follows Karn's libfec: elements are kept in polynomial
+ * form, or in index form (log to the base alpha, SDLP_RS_A0 for zero) where a
+ * product is an addition modulo 255. */
+
+static inline unsigned rs_modnn(unsigned x) {
+    return x % SDLP_RS_N;
+}
+
+/* Sum of two logs, below 2 * 255. */
+static inline unsigned rs_modnn_sum(unsigned x) {
+    return x >= SDLP_RS_N ? x - SDLP_RS_N : x;
+}
+
+static inline uint8_t rs_symbol(const uint8_t *symbols, size_t j, size_t stride,
+                                const uint8_t *basis) {
+    uint8_t v = symbols[j * stride];
+
+    return basis != NULL ? basis[v] : v;
+}
+
+static void rs_parity_portable(const uint8_t *symbols, size_t stride, size_t count,
+                               const uint8_t *basis, uint8_t *parity) {
+    memset(parity, 0, SDLP_RS_PARITY);
+
+    for (size_t j = 0; j < count; j++) {
+        unsigned feedback = sdlp_rs_index_of[rs_symbol(symbols, j, stride, basis) ^ parity[0]];
+
+        if (feedback != SDLP_RS_A0) {
+            for (size_t k = 1; k < SDLP_RS_PARITY; k++) {
+                parity[k] ^= sdlp_rs_alpha_to[rs_modnn_sum(feedback + sdlp_rs_genpoly[SDLP_RS_PARITY - k])];
+            }
+        }
+        memmove(&parity[0], &parity[1], SDLP_RS_PARITY - 1u);
+        parity[SDLP_RS_PARITY - 1u] =
+            feedback != SDLP_RS_A0 ? sdlp_rs_alpha_to[rs_modnn_sum(feedback + sdlp_rs_genpoly[0])] : 0;
+    }
+}
+
+static void rs_syndromes_portable(const uint8_t *symbols, size_t stride, size_t count,
+                                  const uint8_t *basis, uint8_t *syndromes) {
+    unsigned root[SDLP_RS_PARITY];
+
+    /* Horner per root; the 32 chains are independent, so step them together. */
+    for (unsigned i = 0; i < SDLP_RS_PARITY; i++) {
+        root[i] = rs_modnn((SDLP_RS_FCR + i) * SDLP_RS_PRIM);
+    }
+    memset(syndromes, 0, SDLP_RS_PARITY);
+
+    for (size_t j = 0; j < count; j++) {
+        uint8_t v = rs_symbol(symbols, j, stride, basis);
+
+        for (size_t i = 0; i < SDLP_RS_PARITY; i++) {
+            uint8_t s = syndromes[i];
+            uint8_t product = s != 0 ? sdlp_rs_alpha_to[rs_modnn_sum(sdlp_rs_index_of[s] + root[i])] : 0;
+
+            syndromes[i] = (uint8_t)(v ^ product);
+        }
+    }
+}
+
+#if defined(SDLP_RS_SSSE3)
+#include <stdatomic.h>
+
+/* Probed on first use; concurrent first calls store the same value. */
+static int rs_ssse3_active(void) {
+    static _Atomic int active = -1;
+    int value = atomic_load_explicit(&active, memory_order_relaxed);
+
+    if (value < 0) {
+        value = sdlp_rs_ssse3_supported();
+        atomic_store_explicit(&active, value, memory_order_relaxed);
+    }
+    return value;
+}
+#endif
+
+static void rs_parity(const uint8_t *symbols, size_t stride, size_t count, size_t first,
+                      const uint8_t *basis, uint8_t *parity) {
+#if defined(SDLP_RS_SSSE3)
+    if (rs_ssse3_active()) {
+        sdlp_rs_parity_ssse3(symbols, stride, count, first, basis, parity);
+        return;
+    }
+#endif
+    (void)first;
+    rs_parity_portable(symbols, stride, count, basis, parity);
+}
+
+static void rs_syndromes(const uint8_t *symbols, size_t stride, size_t count, size_t first,
+                         const uint8_t *basis, uint8_t *syndromes) {
+#if defined(SDLP_RS_SSSE3)
+    if (rs_ssse3_active()) {
+        sdlp_rs_syndromes_ssse3(symbols, stride, count, first, basis, syndromes);
+        return;
+    }
+#endif
+    (void)first;
+    rs_syndromes_portable(symbols, stride, count, basis, syndromes);
+}
+
+/* Berlekamp-Massey, Chien search and Forney on non-zero syndromes. Fills the
+ * codeword positions and conventional-basis error values; returns the error
+ * count, or -1 if the errors are beyond the code. */
+static int rs_locate(const uint8_t *syndromes, unsigned *loc, uint8_t *value) {
+    uint8_t s[SDLP_RS_PARITY];
+    uint8_t lambda[SDLP_RS_PARITY + 1] = {1};
+    uint8_t b[SDLP_RS_PARITY + 1];
+    uint8_t t[SDLP_RS_PARITY + 1];
+    uint8_t omega[SDLP_RS_PARITY + 1];
+    uint8_t reg[SDLP_RS_PARITY + 1];
+    unsigned root[SDLP_RS_PARITY];
+    unsigned el = 0;
+    int deg_lambda = 0;
+    int count = 0;
+
+    for (size_t i = 0; i < SDLP_RS_PARITY; i++) {
+        s[i] = sdlp_rs_index_of[syndromes[i]];
+    }
+    for (size_t i = 0; i <= SDLP_RS_PARITY; i++) {
+        b[i] = sdlp_rs_index_of[lambda[i]];
+    }
+
+    for (unsigned r = 1; r <= SDLP_RS_PARITY; r++) {
+        uint8_t discr = 0;
+
+        for (unsigned i = 0; i < r; i++) {
+            if (lambda[i] != 0 && s[r - i - 1u] != SDLP_RS_A0) {
+                discr ^= sdlp_rs_alpha_to[rs_modnn(sdlp_rs_index_of[lambda[i]] + s[r - i - 1u])];
+            }
+        }
+        discr = sdlp_rs_index_of[discr];
+
+        if (discr == SDLP_RS_A0) {
+            memmove(&b[1], &b[0], SDLP_RS_PARITY);
+            b[0] = SDLP_RS_A0;
+            continue;
+        }
+
+        t[0] = lambda[0];
+        for (size_t i = 0; i < SDLP_RS_PARITY; i++) {
+            t[i + 1u] = b[i] != SDLP_RS_A0
+                            ? (uint8_t)(lambda[i + 1u] ^ sdlp_rs_alpha_to[rs_modnn(discr + b[i])])
+                            : lambda[i + 1u];
+        }
+        if (2u * el <= r - 1u) {
+            el = r - el;
+            for (size_t i = 0; i <= SDLP_RS_PARITY; i++) {
+                b[i] = lambda[i] == 0 ? SDLP_RS_A0
+                                      : (uint8_t)rs_modnn((unsigned)sdlp_rs_index_of[lambda[i]] + SDLP_RS_N - discr);
+            }
+        } else {
+            memmove(&b[1], &b[0], SDLP_RS_PARITY);
+            b[0] = SDLP_RS_A0;
+        }
+        memcpy(lambda, t, sizeof(lambda));
+    }
+
+    for (int i = 0; i <= SDLP_RS_PARITY; i++) {
+        lambda[i] = sdlp_rs_index_of[lambda[i]];
+        if (lambda[i] != SDLP_RS_A0) {
+            deg_lambda = i;
+        }
+    }
+    if (deg_lambda == 0 || deg_lambda > SDLP_RS_MAX_ERRORS) {
+        return -1;
+    }
+
+    /* Chien search: the roots of lambda are the inverse error locators. */
+    memcpy(reg, lambda, sizeof(reg));
+    for (unsigned i = 1, k = SDLP_RS_IPRIM - 1u; i <= SDLP_RS_N; i++, k = rs_modnn(k + SDLP_RS_IPRIM)) {
+        uint8_t q = 1;
+
+        for (int j = deg_lambda; j > 0; j--) {
+            if (reg[j] != SDLP_RS_A0) {
+                reg[j] = (uint8_t)rs_modnn(reg[j] + (unsigned)j);
+                q ^= sdlp_rs_alpha_to[reg[j]];
+            }
+        }
+        if (q != 0) {
+            continue;
+        }
+        root[count] = i;
+        loc[count] = k;
+        if (++count == deg_lambda) {
+            break;
+        }
+    }
+    if (count != deg_lambda) {
+        return -1;
+    }
+
+    /* omega(x) = s(x) * lambda(x) mod x^32, index form. */
+    int deg_omega = deg_lambda - 1;
+
+    for (int i = 0; i <= deg_omega; i++) {
+        uint8_t tmp = 0;
+
+        for (int j = i; j >= 0; j--) {
+            if (s[i - j] != SDLP_RS_A0 && lambda[j] != SDLP_RS_A0) {
+                tmp ^= sdlp_rs_alpha_to[rs_modnn((unsigned)s[i - j] + lambda[j])];
+            }
+        }
+        omega[i] = sdlp_rs_index_of[tmp];
+    }
+
+    /* Forney: value = omega(X^-1) * X^(1 - FCR) / lambda'(X^-1). */
+    for (int j = 0; j < count; j++) {
+        uint8_t num1 = 0;
+        uint8_t num2 = sdlp_rs_alpha_to[rs_modnn(root[j] * (SDLP_RS_FCR - 1u) + SDLP_RS_N)];
+        uint8_t den = 0;
+
+        for (int i = deg_omega; i >= 0; i--) {
+            if (omega[i] != SDLP_RS_A0) {
+                num1 ^= sdlp_rs_alpha_to[rs_modnn(omega[i] + (unsigned)i * root[j])];
+            }
+        }
+        /* lambda[i + 1] for even i is the formal derivative coefficient of x^i. */
+        for (int i = (deg_lambda < SDLP_RS_PARITY ? deg_lambda : SDLP_RS_PARITY - 1) & ~1; i >= 0;
+             i -= 2) {
+            if (lambda[i + 1] != SDLP_RS_A0) {
+                den ^= sdlp_rs_alpha_to[rs_modnn(lambda[i + 1] + (unsigned)i * root[j])];
+            }
+        }
+        if (den == 0) {
+            return -1;
+        }
+        value[j] = num1 == 0 ? 0
+                             : sdlp_rs_alpha_to[rs_modnn((unsigned)sdlp_rs_index_of[num1] +
+                                                         sdlp_rs_index_of[num2] + SDLP_RS_N -
+                                                         sdlp_rs_index_of[den])];
+    }
+    return count;
+}
+
+static int rs_config_valid(const sdlp_rs_config_t *config) {
+    return config != NULL && config->interleave >= 1u &&
+           config->interleave <= SDLP_RS_MAX_INTERLEAVE && config->virtual_fill < SDLP_RS_K;
+}
+
+size_t sdlp_rs_data_length(const sdlp_rs_config_t *config) {
+    if (!rs_config_valid(config)) {
+        return 0;
+    }
+    return (size_t)config->interleave * (SDLP_RS_K - config->virtual_fill);
+}
+
+size_t sdlp_rs_codeblock_length(const sdlp_rs_config_t *config) {
+    if (!rs_config_valid(config)) {
+        return 0;
+    }
+    return (size_t)config->interleave * (SDLP_RS_N - config->virtual_fill);
+}
+
+int sdlp_rs_encode(const sdlp_rs_config_t *config, uint8_t *codeblock, size_t codeblock_size) {
+    if (!rs_config_valid(config) || !codeblock) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    if (codeblock_size < sdlp_rs_codeblock_length(config)) {
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    size_t depth = config->interleave;
+    size_t data_symbols = SDLP_RS_K - config->virtual_fill;
+    const uint8_t *basis = config->dual_basis ? sdlp_rs_from_dual : NULL;
+    uint8_t parity[SDLP_RS_PARITY];
+
+    for (size_t i = 0; i < depth; i++) {
+        uint8_t *out = &codeblock[data_symbols * depth + i];
+
+        rs_parity(&codeblock[i], depth, data_symbols, config->virtual_fill, basis, parity);
+        for (size_t k = 0; k < SDLP_RS_PARITY; k++) {
+            out[k * depth] = config->dual_basis ? sdlp_rs_to_dual[parity[k]] : parity[k];
+        }
+    }
+    return SDLP_SUCCESS;
+}
+
+int sdlp_rs_decode(const sdlp_rs_config_t *config, uint8_t *codeblock, size_t codeblock_size,
+                   int *corrected) {
+    if (corrected) {
+        *corrected = 0;
+    }
+    if (!rs_config_valid(config) || !codeblock) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+    if (codeblock_size < sdlp_rs_codeblock_length(config)) {
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    size_t depth = config->interleave;
+    size_t fill = config->virtual_fill;
+    size_t symbols = SDLP_RS_N - fill;
+    const uint8_t *basis = config->dual_basis ? sdlp_rs_from_dual : NULL;
+    int total = 0;
+    int status = SDLP_SUCCESS;
+
+    for (size_t i = 0; i < depth; i++) {
+        uint8_t syndromes[SDLP_RS_PARITY];
+        unsigned loc[SDLP_RS_PARITY];
+        uint8_t value[SDLP_RS_PARITY];
+        uint8_t any = 0;
+
+        rs_syndromes(&codeblock[i], depth, symbols, fill, basis, syndromes);
+        for (size_t k = 0; k < SDLP_RS_PARITY; k++) {
+            any |= syndromes[k];
+        }
+        if (any == 0) {
+            continue;
+        }
+
+        int count = rs_locate(syndromes, loc, value);
+
+        /* An error inside the virtual fill means the decoder miscorrected. */
+        for (int j = 0; j < count; j++) {
+            if (loc[j] < fill) {
+                count = -1;
+            }
+        }
+        if (count < 0) {
+            status = SDLP_ERROR_UNCORRECTABLE;
+            continue;
+        }
+
+        for (int j = 0; j < count; j++) {
+            uint8_t *symbol = &codeblock[(loc[j] - fill) * depth + i];
+
+            if (config->dual_basis) {
+                *symbol = sdlp_rs_to_dual[sdlp_rs_from_dual[*symbol] ^ value[j]];
+            } else {
+                *symbol ^= value[j];
+            }
+        }
+        total += count;
+    }
+
+    if (corrected) {
+        *corrected = total;
+    }
+    return status;
+}
@@ -0,0 +1,66 @@
+#include "sdlp_rs.h"
+#include "sdlp_internal.h"
+
+#if defined(SDLP_RS_SSSE3)
+
+#define SDLP_RS_TABLES_SIMD 1
+#include "sdlp_rs_tables.h"
+#include <cpuid.h>
+#include <immintrin.h>
+
+/* Parity and syndromes are both linear in the codeword symbols: each output
+ * byte is a GF(2^8) dot product of the symbols with a constant column per
+ * position. v * c splits into v * (c & 15) ^ v * (c & 240), and PSHUFB looks
+ * both halves up in the 16-entry product rows of v for all 32 outputs at once. */
+
+#define RS_TARGET __attribute__((target("ssse3")))
+
+int sdlp_rs_ssse3_supported(void) {
+    unsigned int eax, ebx, ecx, edx;
+
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        return 0;
+    }
+    return (ecx & bit_SSSE3) != 0;
+}
+
+RS_TARGET static inline void rs_dot(const uint8_t *symbols, size_t stride, size_t count,
+                                    const uint8_t (*columns)[SDLP_RS_PARITY],
+                                    const uint8_t *basis, uint8_t *out) {
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+
+    for (size_t j = 0; j < count; j++) {
+        uint8_t v = symbols[j * stride];
+
+        if (basis != NULL) {
+            v = basis[v];
+        }
+
+        const __m128i lo = _mm_loadu_si128((const __m128i *)&sdlp_rs_nibble_mul[v][0]);
+        const __m128i hi = _mm_loadu_si128((const __m128i *)&sdlp_rs_nibble_mul[v][16]);
+        const __m128i c0 = _mm_loadu_si128((const __m128i *)&columns[j][0]);
+        const __m128i c1 = _mm_loadu_si128((const __m128i *)&columns[j][16]);
+
+        acc0 = _mm_xor_si128(acc0, _mm_shuffle_epi8(lo, _mm_and_si128(c0, nibble)));
+        acc0 = _mm_xor_si128(acc0, _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(c0, 4), nibble)));
+        acc1 = _mm_xor_si128(acc1, _mm_shuffle_epi8(lo, _mm_and_si128(c1, nibble)));
+        acc1 = _mm_xor_si128(acc1, _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(c1, 4), nibble)));
+    }
+
+    _mm_storeu_si128((__m128i *)&out[0], acc0);
+    _mm_storeu_si128((__m128i *)&out[16], acc1);
+}
+
+RS_TARGET void sdlp_rs_parity_ssse3(const uint8_t *symbols, size_t stride, size_t count,
+                                    size_t first, const uint8_t *basis, uint8_t *parity) {
+    rs_dot(symbols, stride, count, &sdlp_rs_parity_col[first], basis, parity);
+}
+
+RS_TARGET void sdlp_rs_syndromes_ssse3(const uint8_t *symbols, size_t stride, size_t count,
+                                       size_t first, const uint8_t *basis, uint8_t *syndromes) {
+    rs_dot(symbols, stride, count, &sdlp_rs_syndrome_col[first], basis, syndromes);
+}
+
+#endif
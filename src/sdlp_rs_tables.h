@@ -0,0 +1,849 @@
+/* Generated by scripts/gen_rs_tables.py - do not edit.
+ * CCSDS RS(255,223): GF(2^8) over x^8+x^7+x^2+x+1, generator roots
+ * alpha^(11*j) for j = 112..143, dual basis per CCSDS 131.0-B Annex F. */
+#ifndef SDLP_RS_TABLES_H
+#define SDLP_RS_TABLES_H
+
+#include <stdint.h>
+
+#define SDLP_RS_GF_POLY 0x187
+#define SDLP_RS_FCR 112
+#define SDLP_RS_PRIM 11
+#define SDLP_RS_IPRIM 116
+#define SDLP_RS_A0 255
+
+static const uint8_t sdlp_rs_alpha_to[256] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x87, 0x89, 0x95, 0xAD, 0xDD, 0x3D, 0x7A, 0xF4,
+    0x6F, 0xDE, 0x3B, 0x76, 0xEC, 0x5F, 0xBE, 0xFB, 0x71, 0xE2, 0x43, 0x86, 0x8B, 0x91, 0xA5, 0xCD,
+    0x1D, 0x3A, 0x74, 0xE8, 0x57, 0xAE, 0xDB, 0x31, 0x62, 0xC4, 0x0F, 0x1E, 0x3C, 0x78, 0xF0, 0x67,
+    0xCE, 0x1B, 0x36, 0x6C, 0xD8, 0x37, 0x6E, 0xDC, 0x3F, 0x7E, 0xFC, 0x7F, 0xFE, 0x7B, 0xF6, 0x6B,
+    0xD6, 0x2B, 0x56, 0xAC, 0xDF, 0x39, 0x72, 0xE4, 0x4F, 0x9E, 0xBB, 0xF1, 0x65, 0xCA, 0x13, 0x26,
+    0x4C, 0x98, 0xB7, 0xE9, 0x55, 0xAA, 0xD3, 0x21, 0x42, 0x84, 0x8F, 0x99, 0xB5, 0xED, 0x5D, 0xBA,
+    0xF3, 0x61, 0xC2, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0,
+    0x47, 0x8E, 0x9B, 0xB1, 0xE5, 0x4D, 0x9A, 0xB3, 0xE1, 0x45, 0x8A, 0x93, 0xA1, 0xC5, 0x0D, 0x1A,
+    0x34, 0x68, 0xD0, 0x27, 0x4E, 0x9C, 0xBF, 0xF9, 0x75, 0xEA, 0x53, 0xA6, 0xCB, 0x11, 0x22, 0x44,
+    0x88, 0x97, 0xA9, 0xD5, 0x2D, 0x5A, 0xB4, 0xEF, 0x59, 0xB2, 0xE3, 0x41, 0x82, 0x83, 0x81, 0x85,
+    0x8D, 0x9D, 0xBD, 0xFD, 0x7D, 0xFA, 0x73, 0xE6, 0x4B, 0x96, 0xAB, 0xD1, 0x25, 0x4A, 0x94, 0xAF,
+    0xD9, 0x35, 0x6A, 0xD4, 0x2F, 0x5E, 0xBC, 0xFF, 0x79, 0xF2, 0x63, 0xC6, 0x0B, 0x16, 0x2C, 0x58,
+    0xB0, 0xE7, 0x49, 0x92, 0xA3, 0xC1, 0x05, 0x0A, 0x14, 0x28, 0x50, 0xA0, 0xC7, 0x09, 0x12, 0x24,
+    0x48, 0x90, 0xA7, 0xC9, 0x15, 0x2A, 0x54, 0xA8, 0xD7, 0x29, 0x52, 0xA4, 0xCF, 0x19, 0x32, 0x64,
+    0xC8, 0x17, 0x2E, 0x5C, 0xB8, 0xF7, 0x69, 0xD2, 0x23, 0x46, 0x8C, 0x9F, 0xB9, 0xF5, 0x6D, 0xDA,
+    0x33, 0x66, 0xCC, 0x1F, 0x3E, 0x7C, 0xF8, 0x77, 0xEE, 0x5B, 0xB6, 0xEB, 0x51, 0xA2, 0xC3, 0x00,
+};
+
+static const uint8_t sdlp_rs_index_of[256] = {
+    0xFF, 0x00, 0x01, 0x63, 0x02, 0xC6, 0x64, 0x6A, 0x03, 0xCD, 0xC7, 0xBC, 0x65, 0x7E, 0x6B, 0x2A,
+    0x04, 0x8D, 0xCE, 0x4E, 0xC8, 0xD4, 0xBD, 0xE1, 0x66, 0xDD, 0x7F, 0x31, 0x6C, 0x20, 0x2B, 0xF3,
+    0x05, 0x57, 0x8E, 0xE8, 0xCF, 0xAC, 0x4F, 0x83, 0xC9, 0xD9, 0xD5, 0x41, 0xBE, 0x94, 0xE2, 0xB4,
+    0x67, 0x27, 0xDE, 0xF0, 0x80, 0xB1, 0x32, 0x35, 0x6D, 0x45, 0x21, 0x12, 0x2C, 0x0D, 0xF4, 0x38,
+    0x06, 0x9B, 0x58, 0x1A, 0x8F, 0x79, 0xE9, 0x70, 0xD0, 0xC2, 0xAD, 0xA8, 0x50, 0x75, 0x84, 0x48,
+    0xCA, 0xFC, 0xDA, 0x8A, 0xD6, 0x54, 0x42, 0x24, 0xBF, 0x98, 0x95, 0xF9, 0xE3, 0x5E, 0xB5, 0x15,
+    0x68, 0x61, 0x28, 0xBA, 0xDF, 0x4C, 0xF1, 0x2F, 0x81, 0xE6, 0xB2, 0x3F, 0x33, 0xEE, 0x36, 0x10,
+    0x6E, 0x18, 0x46, 0xA6, 0x22, 0x88, 0x13, 0xF7, 0x2D, 0xB8, 0x0E, 0x3D, 0xF5, 0xA4, 0x39, 0x3B,
+    0x07, 0x9E, 0x9C, 0x9D, 0x59, 0x9F, 0x1B, 0x08, 0x90, 0x09, 0x7A, 0x1C, 0xEA, 0xA0, 0x71, 0x5A,
+    0xD1, 0x1D, 0xC3, 0x7B, 0xAE, 0x0A, 0xA9, 0x91, 0x51, 0x5B, 0x76, 0x72, 0x85, 0xA1, 0x49, 0xEB,
+    0xCB, 0x7C, 0xFD, 0xC4, 0xDB, 0x1E, 0x8B, 0xD2, 0xD7, 0x92, 0x55, 0xAA, 0x43, 0x0B, 0x25, 0xAF,
+    0xC0, 0x73, 0x99, 0x77, 0x96, 0x5C, 0xFA, 0x52, 0xE4, 0xEC, 0x5F, 0x4A, 0xB6, 0xA2, 0x16, 0x86,
+    0x69, 0xC5, 0x62, 0xFE, 0x29, 0x7D, 0xBB, 0xCC, 0xE0, 0xD3, 0x4D, 0x8C, 0xF2, 0x1F, 0x30, 0xDC,
+    0x82, 0xAB, 0xE7, 0x56, 0xB3, 0x93, 0x40, 0xD8, 0x34, 0xB0, 0xEF, 0x26, 0x37, 0x0C, 0x11, 0x44,
+    0x6F, 0x78, 0x19, 0x9A, 0x47, 0x74, 0xA7, 0xC1, 0x23, 0x53, 0x89, 0xFB, 0x14, 0x5D, 0xF8, 0x97,
+    0x2E, 0x4B, 0xB9, 0x60, 0x0F, 0xED, 0x3E, 0xE5, 0xF6, 0x87, 0xA5, 0x17, 0x3A, 0xA3, 0x3C, 0xB7,
+};
+
+/* Generator polynomial, index form, g[0] = constant term. */
+static const uint8_t sdlp_rs_genpoly[33] = {
+    0x00, 0xF9, 0x3B, 0x42, 0x04, 0x2B, 0x7E, 0xFB, 0x61, 0x1E, 0x03, 0xD5, 0x32, 0x42, 0xAA, 0x05,
+    0x18, 0x05, 0xAA, 0x42, 0x32, 0xD5, 0x03, 0x1E, 0x61, 0xFB, 0x7E, 0x2B, 0x04, 0x42, 0x3B, 0xF9,
+    0x00,
+};
+
+/* Conventional -> dual basis, and back. */
+static const uint8_t sdlp_rs_to_dual[256] = {
+    0x00, 0x7B, 0xAF, 0xD4, 0x99, 0xE2, 0x36, 0x4D, 0xFA, 0x81, 0x55, 0x2E, 0x63, 0x18, 0xCC, 0xB7,
+    0x86, 0xFD, 0x29, 0x52, 0x1F, 0x64, 0xB0, 0xCB, 0x7C, 0x07, 0xD3, 0xA8, 0xE5, 0x9E, 0x4A, 0x31,
+    0xEC, 0x97, 0x43, 0x38, 0x75, 0x0E, 0xDA, 0xA1, 0x16, 0x6D, 0xB9, 0xC2, 0x8F, 0xF4, 0x20, 0x5B,
+    0x6A, 0x11, 0xC5, 0xBE, 0xF3, 0x88, 0x5C, 0x27, 0x90, 0xEB, 0x3F, 0x44, 0x09, 0x72, 0xA6, 0xDD,
+    0xEF, 0x94, 0x40, 0x3B, 0x76, 0x0D, 0xD9, 0xA2, 0x15, 0x6E, 0xBA, 0xC1, 0x8C, 0xF7, 0x23, 0x58,
+    0x69, 0x12, 0xC6, 0xBD, 0xF0, 0x8B, 0x5F, 0x24, 0x93, 0xE8, 0x3C, 0x47, 0x0A, 0x71, 0xA5, 0xDE,
+    0x03, 0x78, 0xAC, 0xD7, 0x9A, 0xE1, 0x35, 0x4E, 0xF9, 0x82, 0x56, 0x2D, 0x60, 0x1B, 0xCF, 0xB4,
+    0x85, 0xFE, 0x2A, 0x51, 0x1C, 0x67, 0xB3, 0xC8, 0x7F, 0x04, 0xD0, 0xAB, 0xE6, 0x9D, 0x49, 0x32,
+    0x8D, 0xF6, 0x22, 0x59, 0x14, 0x6F, 0xBB, 0xC0, 0x77, 0x0C, 0xD8, 0xA3, 0xEE, 0x95, 0x41, 0x3A,
+    0x0B, 0x70, 0xA4, 0xDF, 0x92, 0xE9, 0x3D, 0x46, 0xF1, 0x8A, 0x5E, 0x25, 0x68, 0x13, 0xC7, 0xBC,
+    0x61, 0x1A, 0xCE, 0xB5, 0xF8, 0x83, 0x57, 0x2C, 0x9B, 0xE0, 0x34, 0x4F, 0x02, 0x79, 0xAD, 0xD6,
+    0xE7, 0x9C, 0x48, 0x33, 0x7E, 0x05, 0xD1, 0xAA, 0x1D, 0x66, 0xB2, 0xC9, 0x84, 0xFF, 0x2B, 0x50,
+    0x62, 0x19, 0xCD, 0xB6, 0xFB, 0x80, 0x54, 0x2F, 0x98, 0xE3, 0x37, 0x4C, 0x01, 0x7A, 0xAE, 0xD5,
+    0xE4, 0x9F, 0x4B, 0x30, 0x7D, 0x06, 0xD2, 0xA9, 0x1E, 0x65, 0xB1, 0xCA, 0x87, 0xFC, 0x28, 0x53,
+    0x8E, 0xF5, 0x21, 0x5A, 0x17, 0x6C, 0xB8, 0xC3, 0x74, 0x0F, 0xDB, 0xA0, 0xED, 0x96, 0x42, 0x39,
+    0x08, 0x73, 0xA7, 0xDC, 0x91, 0xEA, 0x3E, 0x45, 0xF2, 0x89, 0x5D, 0x26, 0x6B, 0x10, 0xC4, 0xBF,
+};
+
+static const uint8_t sdlp_rs_from_dual[256] = {
+    0x00, 0xCC, 0xAC, 0x60, 0x79, 0xB5, 0xD5, 0x19, 0xF0, 0x3C, 0x5C, 0x90, 0x89, 0x45, 0x25, 0xE9,
+    0xFD, 0x31, 0x51, 0x9D, 0x84, 0x48, 0x28, 0xE4, 0x0D, 0xC1, 0xA1, 0x6D, 0x74, 0xB8, 0xD8, 0x14,
+    0x2E, 0xE2, 0x82, 0x4E, 0x57, 0x9B, 0xFB, 0x37, 0xDE, 0x12, 0x72, 0xBE, 0xA7, 0x6B, 0x0B, 0xC7,
+    0xD3, 0x1F, 0x7F, 0xB3, 0xAA, 0x66, 0x06, 0xCA, 0x23, 0xEF, 0x8F, 0x43, 0x5A, 0x96, 0xF6, 0x3A,
+    0x42, 0x8E, 0xEE, 0x22, 0x3B, 0xF7, 0x97, 0x5B, 0xB2, 0x7E, 0x1E, 0xD2, 0xCB, 0x07, 0x67, 0xAB,
+    0xBF, 0x73, 0x13, 0xDF, 0xC6, 0x0A, 0x6A, 0xA6, 0x4F, 0x83, 0xE3, 0x2F, 0x36, 0xFA, 0x9A, 0x56,
+    0x6C, 0xA0, 0xC0, 0x0C, 0x15, 0xD9, 0xB9, 0x75, 0x9C, 0x50, 0x30, 0xFC, 0xE5, 0x29, 0x49, 0x85,
+    0x91, 0x5D, 0x3D, 0xF1, 0xE8, 0x24, 0x44, 0x88, 0x61, 0xAD, 0xCD, 0x01, 0x18, 0xD4, 0xB4, 0x78,
+    0xC5, 0x09, 0x69, 0xA5, 0xBC, 0x70, 0x10, 0xDC, 0x35, 0xF9, 0x99, 0x55, 0x4C, 0x80, 0xE0, 0x2C,
+    0x38, 0xF4, 0x94, 0x58, 0x41, 0x8D, 0xED, 0x21, 0xC8, 0x04, 0x64, 0xA8, 0xB1, 0x7D, 0x1D, 0xD1,
+    0xEB, 0x27, 0x47, 0x8B, 0x92, 0x5E, 0x3E, 0xF2, 0x1B, 0xD7, 0xB7, 0x7B, 0x62, 0xAE, 0xCE, 0x02,
+    0x16, 0xDA, 0xBA, 0x76, 0x6F, 0xA3, 0xC3, 0x0F, 0xE6, 0x2A, 0x4A, 0x86, 0x9F, 0x53, 0x33, 0xFF,
+    0x87, 0x4B, 0x2B, 0xE7, 0xFE, 0x32, 0x52, 0x9E, 0x77, 0xBB, 0xDB, 0x17, 0x0E, 0xC2, 0xA2, 0x6E,
+    0x7A, 0xB6, 0xD6, 0x1A, 0x03, 0xCF, 0xAF, 0x63, 0x8A, 0x46, 0x26, 0xEA, 0xF3, 0x3F, 0x5F, 0x93,
+    0xA9, 0x65, 0x05, 0xC9, 0xD0, 0x1C, 0x7C, 0xB0, 0x59, 0x95, 0xF5, 0x39, 0x20, 0xEC, 0x8C, 0x40,
+    0x54, 0x98, 0xF8, 0x34, 0x2D, 0xE1, 0x81, 0x4D, 0xA4, 0x68, 0x08, 0xC4, 0xDD, 0x11, 0x71, 0xBD,
+};
+
+#endif
+
+/* Guarded apart, so a translation unit may include this again with
+ * SDLP_RS_TABLES_SIMD defined. */
+#if defined(SDLP_RS_TABLES_SIMD) && !defined(SDLP_RS_TABLES_SIMD_H)
+#define SDLP_RS_TABLES_SIMD_H
+
+static const uint8_t sdlp_rs_nibble_mul[256][32] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0},
+    {0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E, 0x00, 0x20, 0x40, 0x60, 0x80, 0xA0, 0xC0, 0xE0, 0x87, 0xA7, 0xC7, 0xE7, 0x07, 0x27, 0x47, 0x67},
+    {0x00, 0x03, 0x06, 0x05, 0x0C, 0x0F, 0x0A, 0x09, 0x18, 0x1B, 0x1E, 0x1D, 0x14, 0x17, 0x12, 0x11, 0x00, 0x30, 0x60, 0x50, 0xC0, 0xF0, 0xA0, 0x90, 0x07, 0x37, 0x67, 0x57, 0xC7, 0xF7, 0xA7, 0x97},
+    {0x00, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C, 0x00, 0x40, 0x80, 0xC0, 0x87, 0xC7, 0x07, 0x47, 0x89, 0xC9, 0x09, 0x49, 0x0E, 0x4E, 0x8E, 0xCE},
+    {0x00, 0x05, 0x0A, 0x0F, 0x14, 0x11, 0x1E, 0x1B, 0x28, 0x2D, 0x22, 0x27, 0x3C, 0x39, 0x36, 0x33, 0x00, 0x50, 0xA0, 0xF0, 0xC7, 0x97, 0x67, 0x37, 0x09, 0x59, 0xA9, 0xF9, 0xCE, 0x9E, 0x6E, 0x3E},
+    {0x00, 0x06, 0x0C, 0x0A, 0x18, 0x1E, 0x14, 0x12, 0x30, 0x36, 0x3C, 0x3A, 0x28, 0x2E, 0x24, 0x22, 0x00, 0x60, 0xC0, 0xA0, 0x07, 0x67, 0xC7, 0xA7, 0x0E, 0x6E, 0xCE, 0xAE, 0x09, 0x69, 0xC9, 0xA9},
+    {0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D, 0x00, 0x70, 0xE0, 0x90, 0x47, 0x37, 0xA7, 0xD7, 0x8E, 0xFE, 0x6E, 0x1E, 0xC9, 0xB9, 0x29, 0x59},
+    {0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78, 0x00, 0x80, 0x87, 0x07, 0x89, 0x09, 0x0E, 0x8E, 0x95, 0x15, 0x12, 0x92, 0x1C, 0x9C, 0x9B, 0x1B},
+    {0x00, 0x09, 0x12, 0x1B, 0x24, 0x2D, 0x36, 0x3F, 0x48, 0x41, 0x5A, 0x53, 0x6C, 0x65, 0x7E, 0x77, 0x00, 0x90, 0xA7, 0x37, 0xC9, 0x59, 0x6E, 0xFE, 0x15, 0x85, 0xB2, 0x22, 0xDC, 0x4C, 0x7B, 0xEB},
+    {0x00, 0x0A, 0x14, 0x1E, 0x28, 0x22, 0x3C, 0x36, 0x50, 0x5A, 0x44, 0x4E, 0x78, 0x72, 0x6C, 0x66, 0x00, 0xA0, 0xC7, 0x67, 0x09, 0xA9, 0xCE, 0x6E, 0x12, 0xB2, 0xD5, 0x75, 0x1B, 0xBB, 0xDC, 0x7C},
+    {0x00, 0x0B, 0x16, 0x1D, 0x2C, 0x27, 0x3A, 0x31, 0x58, 0x53, 0x4E, 0x45, 0x74, 0x7F, 0x62, 0x69, 0x00, 0xB0, 0xE7, 0x57, 0x49, 0xF9, 0xAE, 0x1E, 0x92, 0x22, 0x75, 0xC5, 0xDB, 0x6B, 0x3C, 0x8C},
+    {0x00, 0x0C, 0x18, 0x14, 0x30, 0x3C, 0x28, 0x24, 0x60, 0x6C, 0x78, 0x74, 0x50, 0x5C, 0x48, 0x44, 0x00, 0xC0, 0x07, 0xC7, 0x0E, 0xCE, 0x09, 0xC9, 0x1C, 0xDC, 0x1B, 0xDB, 0x12, 0xD2, 0x15, 0xD5},
+    {0x00, 0x0D, 0x1A, 0x17, 0x34, 0x39, 0x2E, 0x23, 0x68, 0x65, 0x72, 0x7F, 0x5C, 0x51, 0x46, 0x4B, 0x00, 0xD0, 0x27, 0xF7, 0x4E, 0x9E, 0x69, 0xB9, 0x9C, 0x4C, 0xBB, 0x6B, 0xD2, 0x02, 0xF5, 0x25},
+    {0x00, 0x0E, 0x1C, 0x12, 0x38, 0x36, 0x24, 0x2A, 0x70, 0x7E, 0x6C, 0x62, 0x48, 0x46, 0x54, 0x5A, 0x00, 0xE0, 0x47, 0xA7, 0x8E, 0x6E, 0xC9, 0x29, 0x9B, 0x7B, 0xDC, 0x3C, 0x15, 0xF5, 0x52, 0xB2},
+    {0x00, 0x0F, 0x1E, 0x11, 0x3C, 0x33, 0x22, 0x2D, 0x78, 0x77, 0x66, 0x69, 0x44, 0x4B, 0x5A, 0x55, 0x00, 0xF0, 0x67, 0x97, 0xCE, 0x3E, 0xA9, 0x59, 0x1B, 0xEB, 0x7C, 0x8C, 0xD5, 0x25, 0xB2, 0x42},
+    {0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0, 0x00, 0x87, 0x89, 0x0E, 0x95, 0x12, 0x1C, 0x9B, 0xAD, 0x2A, 0x24, 0xA3, 0x38, 0xBF, 0xB1, 0x36},
+    {0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF, 0x00, 0x97, 0xA9, 0x3E, 0xD5, 0x42, 0x7C, 0xEB, 0x2D, 0xBA, 0x84, 0x13, 0xF8, 0x6F, 0x51, 0xC6},
+    {0x00, 0x12, 0x24, 0x36, 0x48, 0x5A, 0x6C, 0x7E, 0x90, 0x82, 0xB4, 0xA6, 0xD8, 0xCA, 0xFC, 0xEE, 0x00, 0xA7, 0xC9, 0x6E, 0x15, 0xB2, 0xDC, 0x7B, 0x2A, 0x8D, 0xE3, 0x44, 0x3F, 0x98, 0xF6, 0x51},
+    {0x00, 0x13, 0x26, 0x35, 0x4C, 0x5F, 0x6A, 0x79, 0x98, 0x8B, 0xBE, 0xAD, 0xD4, 0xC7, 0xF2, 0xE1, 0x00, 0xB7, 0xE9, 0x5E, 0x55, 0xE2, 0xBC, 0x0B, 0xAA, 0x1D, 0x43, 0xF4, 0xFF, 0x48, 0x16, 0xA1},
+    {0x00, 0x14, 0x28, 0x3C, 0x50, 0x44, 0x78, 0x6C, 0xA0, 0xB4, 0x88, 0x9C, 0xF0, 0xE4, 0xD8, 0xCC, 0x00, 0xC7, 0x09, 0xCE, 0x12, 0xD5, 0x1B, 0xDC, 0x24, 0xE3, 0x2D, 0xEA, 0x36, 0xF1, 0x3F, 0xF8},
+    {0x00, 0x15, 0x2A, 0x3F, 0x54, 0x41, 0x7E, 0x6B, 0xA8, 0xBD, 0x82, 0x97, 0xFC, 0xE9, 0xD6, 0xC3, 0x00, 0xD7, 0x29, 0xFE, 0x52, 0x85, 0x7B, 0xAC, 0xA4, 0x73, 0x8D, 0x5A, 0xF6, 0x21, 0xDF, 0x08},
+    {0x00, 0x16, 0x2C, 0x3A, 0x58, 0x4E, 0x74, 0x62, 0xB0, 0xA6, 0x9C, 0x8A, 0xE8, 0xFE, 0xC4, 0xD2, 0x00, 0xE7, 0x49, 0xAE, 0x92, 0x75, 0xDB, 0x3C, 0xA3, 0x44, 0xEA, 0x0D, 0x31, 0xD6, 0x78, 0x9F},
+    {0x00, 0x17, 0x2E, 0x39, 0x5C, 0x4B, 0x72, 0x65, 0xB8, 0xAF, 0x96, 0x81, 0xE4, 0xF3, 0xCA, 0xDD, 0x00, 0xF7, 0x69, 0x9E, 0xD2, 0x25, 0xBB, 0x4C, 0x23, 0xD4, 0x4A, 0xBD, 0xF1, 0x06, 0x98, 0x6F},
+    {0x00, 0x18, 0x30, 0x28, 0x60, 0x78, 0x50, 0x48, 0xC0, 0xD8, 0xF0, 0xE8, 0xA0, 0xB8, 0x90, 0x88, 0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D},
+    {0x00, 0x19, 0x32, 0x2B, 0x64, 0x7D, 0x56, 0x4F, 0xC8, 0xD1, 0xFA, 0xE3, 0xAC, 0xB5, 0x9E, 0x87, 0x00, 0x17, 0x2E, 0x39, 0x5C, 0x4B, 0x72, 0x65, 0xB8, 0xAF, 0x96, 0x81, 0xE4, 0xF3, 0xCA, 0xDD},
+    {0x00, 0x1A, 0x34, 0x2E, 0x68, 0x72, 0x5C, 0x46, 0xD0, 0xCA, 0xE4, 0xFE, 0xB8, 0xA2, 0x8C, 0x96, 0x00, 0x27, 0x4E, 0x69, 0x9C, 0xBB, 0xD2, 0xF5, 0xBF, 0x98, 0xF1, 0xD6, 0x23, 0x04, 0x6D, 0x4A},
+    {0x00, 0x1B, 0x36, 0x2D, 0x6C, 0x77, 0x5A, 0x41, 0xD8, 0xC3, 0xEE, 0xF5, 0xB4, 0xAF, 0x82, 0x99, 0x00, 0x37, 0x6E, 0x59, 0xDC, 0xEB, 0xB2, 0x85, 0x3F, 0x08, 0x51, 0x66, 0xE3, 0xD4, 0x8D, 0xBA},
+    {0x00, 0x1C, 0x38, 0x24, 0x70, 0x6C, 0x48, 0x54, 0xE0, 0xFC, 0xD8, 0xC4, 0x90, 0x8C, 0xA8, 0xB4, 0x00, 0x47, 0x8E, 0xC9, 0x9B, 0xDC, 0x15, 0x52, 0xB1, 0xF6, 0x3F, 0x78, 0x2A, 0x6D, 0xA4, 0xE3},
+    {0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB, 0x00, 0x57, 0xAE, 0xF9, 0xDB, 0x8C, 0x75, 0x22, 0x31, 0x66, 0x9F, 0xC8, 0xEA, 0xBD, 0x44, 0x13},
+    {0x00, 0x1E, 0x3C, 0x22, 0x78, 0x66, 0x44, 0x5A, 0xF0, 0xEE, 0xCC, 0xD2, 0x88, 0x96, 0xB4, 0xAA, 0x00, 0x67, 0xCE, 0xA9, 0x1B, 0x7C, 0xD5, 0xB2, 0x36, 0x51, 0xF8, 0x9F, 0x2D, 0x4A, 0xE3, 0x84},
+    {0x00, 0x1F, 0x3E, 0x21, 0x7C, 0x63, 0x42, 0x5D, 0xF8, 0xE7, 0xC6, 0xD9, 0x84, 0x9B, 0xBA, 0xA5, 0x00, 0x77, 0xEE, 0x99, 0x5B, 0x2C, 0xB5, 0xC2, 0xB6, 0xC1, 0x58, 0x2F, 0xED, 0x9A, 0x03, 0x74},
+    {0x00, 0x20, 0x40, 0x60, 0x80, 0xA0, 0xC0, 0xE0, 0x87, 0xA7, 0xC7, 0xE7, 0x07, 0x27, 0x47, 0x67, 0x00, 0x89, 0x95, 0x1C, 0xAD, 0x24, 0x38, 0xB1, 0xDD, 0x54, 0x48, 0xC1, 0x70, 0xF9, 0xE5, 0x6C},
+    {0x00, 0x21, 0x42, 0x63, 0x84, 0xA5, 0xC6, 0xE7, 0x8F, 0xAE, 0xCD, 0xEC, 0x0B, 0x2A, 0x49, 0x68, 0x00, 0x99, 0xB5, 0x2C, 0xED, 0x74, 0x58, 0xC1, 0x5D, 0xC4, 0xE8, 0x71, 0xB0, 0x29, 0x05, 0x9C},
+    {0x00, 0x22, 0x44, 0x66, 0x88, 0xAA, 0xCC, 0xEE, 0x97, 0xB5, 0xD3, 0xF1, 0x1F, 0x3D, 0x5B, 0x79, 0x00, 0xA9, 0xD5, 0x7C, 0x2D, 0x84, 0xF8, 0x51, 0x5A, 0xF3, 0x8F, 0x26, 0x77, 0xDE, 0xA2, 0x0B},
+    {0x00, 0x23, 0x46, 0x65, 0x8C, 0xAF, 0xCA, 0xE9, 0x9F, 0xBC, 0xD9, 0xFA, 0x13, 0x30, 0x55, 0x76, 0x00, 0xB9, 0xF5, 0x4C, 0x6D, 0xD4, 0x98, 0x21, 0xDA, 0x63, 0x2F, 0x96, 0xB7, 0x0E, 0x42, 0xFB},
+    {0x00, 0x24, 0x48, 0x6C, 0x90, 0xB4, 0xD8, 0xFC, 0xA7, 0x83, 0xEF, 0xCB, 0x37, 0x13, 0x7F, 0x5B, 0x00, 0xC9, 0x15, 0xDC, 0x2A, 0xE3, 0x3F, 0xF6, 0x54, 0x9D, 0x41, 0x88, 0x7E, 0xB7, 0x6B, 0xA2},
+    {0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB1, 0xDE, 0xFB, 0xAF, 0x8A, 0xE5, 0xC0, 0x3B, 0x1E, 0x71, 0x54, 0x00, 0xD9, 0x35, 0xEC, 0x6A, 0xB3, 0x5F, 0x86, 0xD4, 0x0D, 0xE1, 0x38, 0xBE, 0x67, 0x8B, 0x52},
+    {0x00, 0x26, 0x4C, 0x6A, 0x98, 0xBE, 0xD4, 0xF2, 0xB7, 0x91, 0xFB, 0xDD, 0x2F, 0x09, 0x63, 0x45, 0x00, 0xE9, 0x55, 0xBC, 0xAA, 0x43, 0xFF, 0x16, 0xD3, 0x3A, 0x86, 0x6F, 0x79, 0x90, 0x2C, 0xC5},
+    {0x00, 0x27, 0x4E, 0x69, 0x9C, 0xBB, 0xD2, 0xF5, 0xBF, 0x98, 0xF1, 0xD6, 0x23, 0x04, 0x6D, 0x4A, 0x00, 0xF9, 0x75, 0x8C, 0xEA, 0x13, 0x9F, 0x66, 0x53, 0xAA, 0x26, 0xDF, 0xB9, 0x40, 0xCC, 0x35},
+    {0x00, 0x28, 0x50, 0x78, 0xA0, 0x88, 0xF0, 0xD8, 0xC7, 0xEF, 0x97, 0xBF, 0x67, 0x4F, 0x37, 0x1F, 0x00, 0x09, 0x12, 0x1B, 0x24, 0x2D, 0x36, 0x3F, 0x48, 0x41, 0x5A, 0x53, 0x6C, 0x65, 0x7E, 0x77},
+    {0x00, 0x29, 0x52, 0x7B, 0xA4, 0x8D, 0xF6, 0xDF, 0xCF, 0xE6, 0x9D, 0xB4, 0x6B, 0x42, 0x39, 0x10, 0x00, 0x19, 0x32, 0x2B, 0x64, 0x7D, 0x56, 0x4F, 0xC8, 0xD1, 0xFA, 0xE3, 0xAC, 0xB5, 0x9E, 0x87},
+    {0x00, 0x2A, 0x54, 0x7E, 0xA8, 0x82, 0xFC, 0xD6, 0xD7, 0xFD, 0x83, 0xA9, 0x7F, 0x55, 0x2B, 0x01, 0x00, 0x29, 0x52, 0x7B, 0xA4, 0x8D, 0xF6, 0xDF, 0xCF, 0xE6, 0x9D, 0xB4, 0x6B, 0x42, 0x39, 0x10},
+    {0x00, 0x2B, 0x56, 0x7D, 0xAC, 0x87, 0xFA, 0xD1, 0xDF, 0xF4, 0x89, 0xA2, 0x73, 0x58, 0x25, 0x0E, 0x00, 0x39, 0x72, 0x4B, 0xE4, 0xDD, 0x96, 0xAF, 0x4F, 0x76, 0x3D, 0x04, 0xAB, 0x92, 0xD9, 0xE0},
+    {0x00, 0x2C, 0x58, 0x74, 0xB0, 0x9C, 0xE8, 0xC4, 0xE7, 0xCB, 0xBF, 0x93, 0x57, 0x7B, 0x0F, 0x23, 0x00, 0x49, 0x92, 0xDB, 0xA3, 0xEA, 0x31, 0x78, 0xC1, 0x88, 0x53, 0x1A, 0x62, 0x2B, 0xF0, 0xB9},
+    {0x00, 0x2D, 0x5A, 0x77, 0xB4, 0x99, 0xEE, 0xC3, 0xEF, 0xC2, 0xB5, 0x98, 0x5B, 0x76, 0x01, 0x2C, 0x00, 0x59, 0xB2, 0xEB, 0xE3, 0xBA, 0x51, 0x08, 0x41, 0x18, 0xF3, 0xAA, 0xA2, 0xFB, 0x10, 0x49},
+    {0x00, 0x2E, 0x5C, 0x72, 0xB8, 0x96, 0xE4, 0xCA, 0xF7, 0xD9, 0xAB, 0x85, 0x4F, 0x61, 0x13, 0x3D, 0x00, 0x69, 0xD2, 0xBB, 0x23, 0x4A, 0xF1, 0x98, 0x46, 0x2F, 0x94, 0xFD, 0x65, 0x0C, 0xB7, 0xDE},
+    {0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0xFF, 0xD0, 0xA1, 0x8E, 0x43, 0x6C, 0x1D, 0x32, 0x00, 0x79, 0xF2, 0x8B, 0x63, 0x1A, 0x91, 0xE8, 0xC6, 0xBF, 0x34, 0x4D, 0xA5, 0xDC, 0x57, 0x2E},
+    {0x00, 0x30, 0x60, 0x50, 0xC0, 0xF0, 0xA0, 0x90, 0x07, 0x37, 0x67, 0x57, 0xC7, 0xF7, 0xA7, 0x97, 0x00, 0x0E, 0x1C, 0x12, 0x38, 0x36, 0x24, 0x2A, 0x70, 0x7E, 0x6C, 0x62, 0x48, 0x46, 0x54, 0x5A},
+    {0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0x0F, 0x3E, 0x6D, 0x5C, 0xCB, 0xFA, 0xA9, 0x98, 0x00, 0x1E, 0x3C, 0x22, 0x78, 0x66, 0x44, 0x5A, 0xF0, 0xEE, 0xCC, 0xD2, 0x88, 0x96, 0xB4, 0xAA},
+    {0x00, 0x32, 0x64, 0x56, 0xC8, 0xFA, 0xAC, 0x9E, 0x17, 0x25, 0x73, 0x41, 0xDF, 0xED, 0xBB, 0x89, 0x00, 0x2E, 0x5C, 0x72, 0xB8, 0x96, 0xE4, 0xCA, 0xF7, 0xD9, 0xAB, 0x85, 0x4F, 0x61, 0x13, 0x3D},
+    {0x00, 0x33, 0x66, 0x55, 0xCC, 0xFF, 0xAA, 0x99, 0x1F, 0x2C, 0x79, 0x4A, 0xD3, 0xE0, 0xB5, 0x86, 0x00, 0x3E, 0x7C, 0x42, 0xF8, 0xC6, 0x84, 0xBA, 0x77, 0x49, 0x0B, 0x35, 0x8F, 0xB1, 0xF3, 0xCD},
+    {0x00, 0x34, 0x68, 0x5C, 0xD0, 0xE4, 0xB8, 0x8C, 0x27, 0x13, 0x4F, 0x7B, 0xF7, 0xC3, 0x9F, 0xAB, 0x00, 0x4E, 0x9C, 0xD2, 0xBF, 0xF1, 0x23, 0x6D, 0xF9, 0xB7, 0x65, 0x2B, 0x46, 0x08, 0xDA, 0x94},
+    {0x00, 0x35, 0x6A, 0x5F, 0xD4, 0xE1, 0xBE, 0x8B, 0x2F, 0x1A, 0x45, 0x70, 0xFB, 0xCE, 0x91, 0xA4, 0x00, 0x5E, 0xBC, 0xE2, 0xFF, 0xA1, 0x43, 0x1D, 0x79, 0x27, 0xC5, 0x9B, 0x86, 0xD8, 0x3A, 0x64},
+    {0x00, 0x36, 0x6C, 0x5A, 0xD8, 0xEE, 0xB4, 0x82, 0x37, 0x01, 0x5B, 0x6D, 0xEF, 0xD9, 0x83, 0xB5, 0x00, 0x6E, 0xDC, 0xB2, 0x3F, 0x51, 0xE3, 0x8D, 0x7E, 0x10, 0xA2, 0xCC, 0x41, 0x2F, 0x9D, 0xF3},
+    {0x00, 0x37, 0x6E, 0x59, 0xDC, 0xEB, 0xB2, 0x85, 0x3F, 0x08, 0x51, 0x66, 0xE3, 0xD4, 0x8D, 0xBA, 0x00, 0x7E, 0xFC, 0x82, 0x7F, 0x01, 0x83, 0xFD, 0xFE, 0x80, 0x02, 0x7C, 0x81, 0xFF, 0x7D, 0x03},
+    {0x00, 0x38, 0x70, 0x48, 0xE0, 0xD8, 0x90, 0xA8, 0x47, 0x7F, 0x37, 0x0F, 0xA7, 0x9F, 0xD7, 0xEF, 0x00, 0x8E, 0x9B, 0x15, 0xB1, 0x3F, 0x2A, 0xA4, 0xE5, 0x6B, 0x7E, 0xF0, 0x54, 0xDA, 0xCF, 0x41},
+    {0x00, 0x39, 0x72, 0x4B, 0xE4, 0xDD, 0x96, 0xAF, 0x4F, 0x76, 0x3D, 0x04, 0xAB, 0x92, 0xD9, 0xE0, 0x00, 0x9E, 0xBB, 0x25, 0xF1, 0x6F, 0x4A, 0xD4, 0x65, 0xFB, 0xDE, 0x40, 0x94, 0x0A, 0x2F, 0xB1},
+    {0x00, 0x3A, 0x74, 0x4E, 0xE8, 0xD2, 0x9C, 0xA6, 0x57, 0x6D, 0x23, 0x19, 0xBF, 0x85, 0xCB, 0xF1, 0x00, 0xAE, 0xDB, 0x75, 0x31, 0x9F, 0xEA, 0x44, 0x62, 0xCC, 0xB9, 0x17, 0x53, 0xFD, 0x88, 0x26},
+    {0x00, 0x3B, 0x76, 0x4D, 0xEC, 0xD7, 0x9A, 0xA1, 0x5F, 0x64, 0x29, 0x12, 0xB3, 0x88, 0xC5, 0xFE, 0x00, 0xBE, 0xFB, 0x45, 0x71, 0xCF, 0x8A, 0x34, 0xE2, 0x5C, 0x19, 0xA7, 0x93, 0x2D, 0x68, 0xD6},
+    {0x00, 0x3C, 0x78, 0x44, 0xF0, 0xCC, 0x88, 0xB4, 0x67, 0x5B, 0x1F, 0x23, 0x97, 0xAB, 0xEF, 0xD3, 0x00, 0xCE, 0x1B, 0xD5, 0x36, 0xF8, 0x2D, 0xE3, 0x6C, 0xA2, 0x77, 0xB9, 0x5A, 0x94, 0x41, 0x8F},
+    {0x00, 0x3D, 0x7A, 0x47, 0xF4, 0xC9, 0x8E, 0xB3, 0x6F, 0x52, 0x15, 0x28, 0x9B, 0xA6, 0xE1, 0xDC, 0x00, 0xDE, 0x3B, 0xE5, 0x76, 0xA8, 0x4D, 0x93, 0xEC, 0x32, 0xD7, 0x09, 0x9A, 0x44, 0xA1, 0x7F},
+    {0x00, 0x3E, 0x7C, 0x42, 0xF8, 0xC6, 0x84, 0xBA, 0x77, 0x49, 0x0B, 0x35, 0x8F, 0xB1, 0xF3, 0xCD, 0x00, 0xEE, 0x5B, 0xB5, 0xB6, 0x58, 0xED, 0x03, 0xEB, 0x05, 0xB0, 0x5E, 0x5D, 0xB3, 0x06, 0xE8},
+    {0x00, 0x3F, 0x7E, 0x41, 0xFC, 0xC3, 0x82, 0xBD, 0x7F, 0x40, 0x01, 0x3E, 0x83, 0xBC, 0xFD, 0xC2, 0x00, 0xFE, 0x7B, 0x85, 0xF6, 0x08, 0x8D, 0x73, 0x6B, 0x95, 0x10, 0xEE, 0x9D, 0x63, 0xE6, 0x18},
+    {0x00, 0x40, 0x80, 0xC0, 0x87, 0xC7, 0x07, 0x47, 0x89, 0xC9, 0x09, 0x49, 0x0E, 0x4E, 0x8E, 0xCE, 0x00, 0x95, 0xAD, 0x38, 0xDD, 0x48, 0x70, 0xE5, 0x3D, 0xA8, 0x90, 0x05, 0xE0, 0x75, 0x4D, 0xD8},
+    {0x00, 0x41, 0x82, 0xC3, 0x83, 0xC2, 0x01, 0x40, 0x81, 0xC0, 0x03, 0x42, 0x02, 0x43, 0x80, 0xC1, 0x00, 0x85, 0x8D, 0x08, 0x9D, 0x18, 0x10, 0x95, 0xBD, 0x38, 0x30, 0xB5, 0x20, 0xA5, 0xAD, 0x28},
+    {0x00, 0x42, 0x84, 0xC6, 0x8F, 0xCD, 0x0B, 0x49, 0x99, 0xDB, 0x1D, 0x5F, 0x16, 0x54, 0x92, 0xD0, 0x00, 0xB5, 0xED, 0x58, 0x5D, 0xE8, 0xB0, 0x05, 0xBA, 0x0F, 0x57, 0xE2, 0xE7, 0x52, 0x0A, 0xBF},
+    {0x00, 0x43, 0x86, 0xC5, 0x8B, 0xC8, 0x0D, 0x4E, 0x91, 0xD2, 0x17, 0x54, 0x1A, 0x59, 0x9C, 0xDF, 0x00, 0xA5, 0xCD, 0x68, 0x1D, 0xB8, 0xD0, 0x75, 0x3A, 0x9F, 0xF7, 0x52, 0x27, 0x82, 0xEA, 0x4F},
+    {0x00, 0x44, 0x88, 0xCC, 0x97, 0xD3, 0x1F, 0x5B, 0xA9, 0xED, 0x21, 0x65, 0x3E, 0x7A, 0xB6, 0xF2, 0x00, 0xD5, 0x2D, 0xF8, 0x5A, 0x8F, 0x77, 0xA2, 0xB4, 0x61, 0x99, 0x4C, 0xEE, 0x3B, 0xC3, 0x16},
+    {0x00, 0x45, 0x8A, 0xCF, 0x93, 0xD6, 0x19, 0x5C, 0xA1, 0xE4, 0x2B, 0x6E, 0x32, 0x77, 0xB8, 0xFD, 0x00, 0xC5, 0x0D, 0xC8, 0x1A, 0xDF, 0x17, 0xD2, 0x34, 0xF1, 0x39, 0xFC, 0x2E, 0xEB, 0x23, 0xE6},
+    {0x00, 0x46, 0x8C, 0xCA, 0x9F, 0xD9, 0x13, 0x55, 0xB9, 0xFF, 0x35, 0x73, 0x26, 0x60, 0xAA, 0xEC, 0x00, 0xF5, 0x6D, 0x98, 0xDA, 0x2F, 0xB7, 0x42, 0x33, 0xC6, 0x5E, 0xAB, 0xE9, 0x1C, 0x84, 0x71},
+    {0x00, 0x47, 0x8E, 0xC9, 0x9B, 0xDC, 0x15, 0x52, 0xB1, 0xF6, 0x3F, 0x78, 0x2A, 0x6D, 0xA4, 0xE3, 0x00, 0xE5, 0x4D, 0xA8, 0x9A, 0x7F, 0xD7, 0x32, 0xB3, 0x56, 0xFE, 0x1B, 0x29, 0xCC, 0x64, 0x81},
+    {0x00, 0x48, 0x90, 0xD8, 0xA7, 0xEF, 0x37, 0x7F, 0xC9, 0x81, 0x59, 0x11, 0x6E, 0x26, 0xFE, 0xB6, 0x00, 0x15, 0x2A, 0x3F, 0x54, 0x41, 0x7E, 0x6B, 0xA8, 0xBD, 0x82, 0x97, 0xFC, 0xE9, 0xD6, 0xC3},
+    {0x00, 0x49, 0x92, 0xDB, 0xA3, 0xEA, 0x31, 0x78, 0xC1, 0x88, 0x53, 0x1A, 0x62, 0x2B, 0xF0, 0xB9, 0x00, 0x05, 0x0A, 0x0F, 0x14, 0x11, 0x1E, 0x1B, 0x28, 0x2D, 0x22, 0x27, 0x3C, 0x39, 0x36, 0x33},
+    {0x00, 0x4A, 0x94, 0xDE, 0xAF, 0xE5, 0x3B, 0x71, 0xD9, 0x93, 0x4D, 0x07, 0x76, 0x3C, 0xE2, 0xA8, 0x00, 0x35, 0x6A, 0x5F, 0xD4, 0xE1, 0xBE, 0x8B, 0x2F, 0x1A, 0x45, 0x70, 0xFB, 0xCE, 0x91, 0xA4},
+    {0x00, 0x4B, 0x96, 0xDD, 0xAB, 0xE0, 0x3D, 0x76, 0xD1, 0x9A, 0x47, 0x0C, 0x7A, 0x31, 0xEC, 0xA7, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB1, 0xDE, 0xFB, 0xAF, 0x8A, 0xE5, 0xC0, 0x3B, 0x1E, 0x71, 0x54},
+    {0x00, 0x4C, 0x98, 0xD4, 0xB7, 0xFB, 0x2F, 0x63, 0xE9, 0xA5, 0x71, 0x3D, 0x5E, 0x12, 0xC6, 0x8A, 0x00, 0x55, 0xAA, 0xFF, 0xD3, 0x86, 0x79, 0x2C, 0x21, 0x74, 0x8B, 0xDE, 0xF2, 0xA7, 0x58, 0x0D},
+    {0x00, 0x4D, 0x9A, 0xD7, 0xB3, 0xFE, 0x29, 0x64, 0xE1, 0xAC, 0x7B, 0x36, 0x52, 0x1F, 0xC8, 0x85, 0x00, 0x45, 0x8A, 0xCF, 0x93, 0xD6, 0x19, 0x5C, 0xA1, 0xE4, 0x2B, 0x6E, 0x32, 0x77, 0xB8, 0xFD},
+    {0x00, 0x4E, 0x9C, 0xD2, 0xBF, 0xF1, 0x23, 0x6D, 0xF9, 0xB7, 0x65, 0x2B, 0x46, 0x08, 0xDA, 0x94, 0x00, 0x75, 0xEA, 0x9F, 0x53, 0x26, 0xB9, 0xCC, 0xA6, 0xD3, 0x4C, 0x39, 0xF5, 0x80, 0x1F, 0x6A},
+    {0x00, 0x4F, 0x9E, 0xD1, 0xBB, 0xF4, 0x25, 0x6A, 0xF1, 0xBE, 0x6F, 0x20, 0x4A, 0x05, 0xD4, 0x9B, 0x00, 0x65, 0xCA, 0xAF, 0x13, 0x76, 0xD9, 0xBC, 0x26, 0x43, 0xEC, 0x89, 0x35, 0x50, 0xFF, 0x9A},
+    {0x00, 0x50, 0xA0, 0xF0, 0xC7, 0x97, 0x67, 0x37, 0x09, 0x59, 0xA9, 0xF9, 0xCE, 0x9E, 0x6E, 0x3E, 0x00, 0x12, 0x24, 0x36, 0x48, 0x5A, 0x6C, 0x7E, 0x90, 0x82, 0xB4, 0xA6, 0xD8, 0xCA, 0xFC, 0xEE},
+    {0x00, 0x51, 0xA2, 0xF3, 0xC3, 0x92, 0x61, 0x30, 0x01, 0x50, 0xA3, 0xF2, 0xC2, 0x93, 0x60, 0x31, 0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E},
+    {0x00, 0x52, 0xA4, 0xF6, 0xCF, 0x9D, 0x6B, 0x39, 0x19, 0x4B, 0xBD, 0xEF, 0xD6, 0x84, 0x72, 0x20, 0x00, 0x32, 0x64, 0x56, 0xC8, 0xFA, 0xAC, 0x9E, 0x17, 0x25, 0x73, 0x41, 0xDF, 0xED, 0xBB, 0x89},
+    {0x00, 0x53, 0xA6, 0xF5, 0xCB, 0x98, 0x6D, 0x3E, 0x11, 0x42, 0xB7, 0xE4, 0xDA, 0x89, 0x7C, 0x2F, 0x00, 0x22, 0x44, 0x66, 0x88, 0xAA, 0xCC, 0xEE, 0x97, 0xB5, 0xD3, 0xF1, 0x1F, 0x3D, 0x5B, 0x79},
+    {0x00, 0x54, 0xA8, 0xFC, 0xD7, 0x83, 0x7F, 0x2B, 0x29, 0x7D, 0x81, 0xD5, 0xFE, 0xAA, 0x56, 0x02, 0x00, 0x52, 0xA4, 0xF6, 0xCF, 0x9D, 0x6B, 0x39, 0x19, 0x4B, 0xBD, 0xEF, 0xD6, 0x84, 0x72, 0x20},
+    {0x00, 0x55, 0xAA, 0xFF, 0xD3, 0x86, 0x79, 0x2C, 0x21, 0x74, 0x8B, 0xDE, 0xF2, 0xA7, 0x58, 0x0D, 0x00, 0x42, 0x84, 0xC6, 0x8F, 0xCD, 0x0B, 0x49, 0x99, 0xDB, 0x1D, 0x5F, 0x16, 0x54, 0x92, 0xD0},
+    {0x00, 0x56, 0xAC, 0xFA, 0xDF, 0x89, 0x73, 0x25, 0x39, 0x6F, 0x95, 0xC3, 0xE6, 0xB0, 0x4A, 0x1C, 0x00, 0x72, 0xE4, 0x96, 0x4F, 0x3D, 0xAB, 0xD9, 0x9E, 0xEC, 0x7A, 0x08, 0xD1, 0xA3, 0x35, 0x47},
+    {0x00, 0x57, 0xAE, 0xF9, 0xDB, 0x8C, 0x75, 0x22, 0x31, 0x66, 0x9F, 0xC8, 0xEA, 0xBD, 0x44, 0x13, 0x00, 0x62, 0xC4, 0xA6, 0x0F, 0x6D, 0xCB, 0xA9, 0x1E, 0x7C, 0xDA, 0xB8, 0x11, 0x73, 0xD5, 0xB7},
+    {0x00, 0x58, 0xB0, 0xE8, 0xE7, 0xBF, 0x57, 0x0F, 0x49, 0x11, 0xF9, 0xA1, 0xAE, 0xF6, 0x1E, 0x46, 0x00, 0x92, 0xA3, 0x31, 0xC1, 0x53, 0x62, 0xF0, 0x05, 0x97, 0xA6, 0x34, 0xC4, 0x56, 0x67, 0xF5},
+    {0x00, 0x59, 0xB2, 0xEB, 0xE3, 0xBA, 0x51, 0x08, 0x41, 0x18, 0xF3, 0xAA, 0xA2, 0xFB, 0x10, 0x49, 0x00, 0x82, 0x83, 0x01, 0x81, 0x03, 0x02, 0x80, 0x85, 0x07, 0x06, 0x84, 0x04, 0x86, 0x87, 0x05},
+    {0x00, 0x5A, 0xB4, 0xEE, 0xEF, 0xB5, 0x5B, 0x01, 0x59, 0x03, 0xED, 0xB7, 0xB6, 0xEC, 0x02, 0x58, 0x00, 0xB2, 0xE3, 0x51, 0x41, 0xF3, 0xA2, 0x10, 0x82, 0x30, 0x61, 0xD3, 0xC3, 0x71, 0x20, 0x92},
+    {0x00, 0x5B, 0xB6, 0xED, 0xEB, 0xB0, 0x5D, 0x06, 0x51, 0x0A, 0xE7, 0xBC, 0xBA, 0xE1, 0x0C, 0x57, 0x00, 0xA2, 0xC3, 0x61, 0x01, 0xA3, 0xC2, 0x60, 0x02, 0xA0, 0xC1, 0x63, 0x03, 0xA1, 0xC0, 0x62},
+    {0x00, 0x5C, 0xB8, 0xE4, 0xF7, 0xAB, 0x4F, 0x13, 0x69, 0x35, 0xD1, 0x8D, 0x9E, 0xC2, 0x26, 0x7A, 0x00, 0xD2, 0x23, 0xF1, 0x46, 0x94, 0x65, 0xB7, 0x8C, 0x5E, 0xAF, 0x7D, 0xCA, 0x18, 0xE9, 0x3B},
+    {0x00, 0x5D, 0xBA, 0xE7, 0xF3, 0xAE, 0x49, 0x14, 0x61, 0x3C, 0xDB, 0x86, 0x92, 0xCF, 0x28, 0x75, 0x00, 0xC2, 0x03, 0xC1, 0x06, 0xC4, 0x05, 0xC7, 0x0C, 0xCE, 0x0F, 0xCD, 0x0A, 0xC8, 0x09, 0xCB},
+    {0x00, 0x5E, 0xBC, 0xE2, 0xFF, 0xA1, 0x43, 0x1D, 0x79, 0x27, 0xC5, 0x9B, 0x86, 0xD8, 0x3A, 0x64, 0x00, 0xF2, 0x63, 0x91, 0xC6, 0x34, 0xA5, 0x57, 0x0B, 0xF9, 0x68, 0x9A, 0xCD, 0x3F, 0xAE, 0x5C},
+    {0x00, 0x5F, 0xBE, 0xE1, 0xFB, 0xA4, 0x45, 0x1A, 0x71, 0x2E, 0xCF, 0x90, 0x8A, 0xD5, 0x34, 0x6B, 0x00, 0xE2, 0x43, 0xA1, 0x86, 0x64, 0xC5, 0x27, 0x8B, 0x69, 0xC8, 0x2A, 0x0D, 0xEF, 0x4E, 0xAC},
+    {0x00, 0x60, 0xC0, 0xA0, 0x07, 0x67, 0xC7, 0xA7, 0x0E, 0x6E, 0xCE, 0xAE, 0x09, 0x69, 0xC9, 0xA9, 0x00, 0x1C, 0x38, 0x24, 0x70, 0x6C, 0x48, 0x54, 0xE0, 0xFC, 0xD8, 0xC4, 0x90, 0x8C, 0xA8, 0xB4},
+    {0x00, 0x61, 0xC2, 0xA3, 0x03, 0x62, 0xC1, 0xA0, 0x06, 0x67, 0xC4, 0xA5, 0x05, 0x64, 0xC7, 0xA6, 0x00, 0x0C, 0x18, 0x14, 0x30, 0x3C, 0x28, 0x24, 0x60, 0x6C, 0x78, 0x74, 0x50, 0x5C, 0x48, 0x44},
+    {0x00, 0x62, 0xC4, 0xA6, 0x0F, 0x6D, 0xCB, 0xA9, 0x1E, 0x7C, 0xDA, 0xB8, 0x11, 0x73, 0xD5, 0xB7, 0x00, 0x3C, 0x78, 0x44, 0xF0, 0xCC, 0x88, 0xB4, 0x67, 0x5B, 0x1F, 0x23, 0x97, 0xAB, 0xEF, 0xD3},
+    {0x00, 0x63, 0xC6, 0xA5, 0x0B, 0x68, 0xCD, 0xAE, 0x16, 0x75, 0xD0, 0xB3, 0x1D, 0x7E, 0xDB, 0xB8, 0x00, 0x2C, 0x58, 0x74, 0xB0, 0x9C, 0xE8, 0xC4, 0xE7, 0xCB, 0xBF, 0x93, 0x57, 0x7B, 0x0F, 0x23},
+    {0x00, 0x64, 0xC8, 0xAC, 0x17, 0x73, 0xDF, 0xBB, 0x2E, 0x4A, 0xE6, 0x82, 0x39, 0x5D, 0xF1, 0x95, 0x00, 0x5C, 0xB8, 0xE4, 0xF7, 0xAB, 0x4F, 0x13, 0x69, 0x35, 0xD1, 0x8D, 0x9E, 0xC2, 0x26, 0x7A},
+    {0x00, 0x65, 0xCA, 0xAF, 0x13, 0x76, 0xD9, 0xBC, 0x26, 0x43, 0xEC, 0x89, 0x35, 0x50, 0xFF, 0x9A, 0x00, 0x4C, 0x98, 0xD4, 0xB7, 0xFB, 0x2F, 0x63, 0xE9, 0xA5, 0x71, 0x3D, 0x5E, 0x12, 0xC6, 0x8A},
+    {0x00, 0x66, 0xCC, 0xAA, 0x1F, 0x79, 0xD3, 0xB5, 0x3E, 0x58, 0xF2, 0x94, 0x21, 0x47, 0xED, 0x8B, 0x00, 0x7C, 0xF8, 0x84, 0x77, 0x0B, 0x8F, 0xF3, 0xEE, 0x92, 0x16, 0x6A, 0x99, 0xE5, 0x61, 0x1D},
+    {0x00, 0x67, 0xCE, 0xA9, 0x1B, 0x7C, 0xD5, 0xB2, 0x36, 0x51, 0xF8, 0x9F, 0x2D, 0x4A, 0xE3, 0x84, 0x00, 0x6C, 0xD8, 0xB4, 0x37, 0x5B, 0xEF, 0x83, 0x6E, 0x02, 0xB6, 0xDA, 0x59, 0x35, 0x81, 0xED},
+    {0x00, 0x68, 0xD0, 0xB8, 0x27, 0x4F, 0xF7, 0x9F, 0x4E, 0x26, 0x9E, 0xF6, 0x69, 0x01, 0xB9, 0xD1, 0x00, 0x9C, 0xBF, 0x23, 0xF9, 0x65, 0x46, 0xDA, 0x75, 0xE9, 0xCA, 0x56, 0x8C, 0x10, 0x33, 0xAF},
+    {0x00, 0x69, 0xD2, 0xBB, 0x23, 0x4A, 0xF1, 0x98, 0x46, 0x2F, 0x94, 0xFD, 0x65, 0x0C, 0xB7, 0xDE, 0x00, 0x8C, 0x9F, 0x13, 0xB9, 0x35, 0x26, 0xAA, 0xF5, 0x79, 0x6A, 0xE6, 0x4C, 0xC0, 0xD3, 0x5F},
+    {0x00, 0x6A, 0xD4, 0xBE, 0x2F, 0x45, 0xFB, 0x91, 0x5E, 0x34, 0x8A, 0xE0, 0x71, 0x1B, 0xA5, 0xCF, 0x00, 0xBC, 0xFF, 0x43, 0x79, 0xC5, 0x86, 0x3A, 0xF2, 0x4E, 0x0D, 0xB1, 0x8B, 0x37, 0x74, 0xC8},
+    {0x00, 0x6B, 0xD6, 0xBD, 0x2B, 0x40, 0xFD, 0x96, 0x56, 0x3D, 0x80, 0xEB, 0x7D, 0x16, 0xAB, 0xC0, 0x00, 0xAC, 0xDF, 0x73, 0x39, 0x95, 0xE6, 0x4A, 0x72, 0xDE, 0xAD, 0x01, 0x4B, 0xE7, 0x94, 0x38},
+    {0x00, 0x6C, 0xD8, 0xB4, 0x37, 0x5B, 0xEF, 0x83, 0x6E, 0x02, 0xB6, 0xDA, 0x59, 0x35, 0x81, 0xED, 0x00, 0xDC, 0x3F, 0xE3, 0x7E, 0xA2, 0x41, 0x9D, 0xFC, 0x20, 0xC3, 0x1F, 0x82, 0x5E, 0xBD, 0x61},
+    {0x00, 0x6D, 0xDA, 0xB7, 0x33, 0x5E, 0xE9, 0x84, 0x66, 0x0B, 0xBC, 0xD1, 0x55, 0x38, 0x8F, 0xE2, 0x00, 0xCC, 0x1F, 0xD3, 0x3E, 0xF2, 0x21, 0xED, 0x7C, 0xB0, 0x63, 0xAF, 0x42, 0x8E, 0x5D, 0x91},
+    {0x00, 0x6E, 0xDC, 0xB2, 0x3F, 0x51, 0xE3, 0x8D, 0x7E, 0x10, 0xA2, 0xCC, 0x41, 0x2F, 0x9D, 0xF3, 0x00, 0xFC, 0x7F, 0x83, 0xFE, 0x02, 0x81, 0x7D, 0x7B, 0x87, 0x04, 0xF8, 0x85, 0x79, 0xFA, 0x06},
+    {0x00, 0x6F, 0xDE, 0xB1, 0x3B, 0x54, 0xE5, 0x8A, 0x76, 0x19, 0xA8, 0xC7, 0x4D, 0x22, 0x93, 0xFC, 0x00, 0xEC, 0x5F, 0xB3, 0xBE, 0x52, 0xE1, 0x0D, 0xFB, 0x17, 0xA4, 0x48, 0x45, 0xA9, 0x1A, 0xF6},
+    {0x00, 0x70, 0xE0, 0x90, 0x47, 0x37, 0xA7, 0xD7, 0x8E, 0xFE, 0x6E, 0x1E, 0xC9, 0xB9, 0x29, 0x59, 0x00, 0x9B, 0xB1, 0x2A, 0xE5, 0x7E, 0x54, 0xCF, 0x4D, 0xD6, 0xFC, 0x67, 0xA8, 0x33, 0x19, 0x82},
+    {0x00, 0x71, 0xE2, 0x93, 0x43, 0x32, 0xA1, 0xD0, 0x86, 0xF7, 0x64, 0x15, 0xC5, 0xB4, 0x27, 0x56, 0x00, 0x8B, 0x91, 0x1A, 0xA5, 0x2E, 0x34, 0xBF, 0xCD, 0x46, 0x5C, 0xD7, 0x68, 0xE3, 0xF9, 0x72},
+    {0x00, 0x72, 0xE4, 0x96, 0x4F, 0x3D, 0xAB, 0xD9, 0x9E, 0xEC, 0x7A, 0x08, 0xD1, 0xA3, 0x35, 0x47, 0x00, 0xBB, 0xF1, 0x4A, 0x65, 0xDE, 0x94, 0x2F, 0xCA, 0x71, 0x3B, 0x80, 0xAF, 0x14, 0x5E, 0xE5},
+    {0x00, 0x73, 0xE6, 0x95, 0x4B, 0x38, 0xAD, 0xDE, 0x96, 0xE5, 0x70, 0x03, 0xDD, 0xAE, 0x3B, 0x48, 0x00, 0xAB, 0xD1, 0x7A, 0x25, 0x8E, 0xF4, 0x5F, 0x4A, 0xE1, 0x9B, 0x30, 0x6F, 0xC4, 0xBE, 0x15},
+    {0x00, 0x74, 0xE8, 0x9C, 0x57, 0x23, 0xBF, 0xCB, 0xAE, 0xDA, 0x46, 0x32, 0xF9, 0x8D, 0x11, 0x65, 0x00, 0xDB, 0x31, 0xEA, 0x62, 0xB9, 0x53, 0x88, 0xC4, 0x1F, 0xF5, 0x2E, 0xA6, 0x7D, 0x97, 0x4C},
+    {0x00, 0x75, 0xEA, 0x9F, 0x53, 0x26, 0xB9, 0xCC, 0xA6, 0xD3, 0x4C, 0x39, 0xF5, 0x80, 0x1F, 0x6A, 0x00, 0xCB, 0x11, 0xDA, 0x22, 0xE9, 0x33, 0xF8, 0x44, 0x8F, 0x55, 0x9E, 0x66, 0xAD, 0x77, 0xBC},
+    {0x00, 0x76, 0xEC, 0x9A, 0x5F, 0x29, 0xB3, 0xC5, 0xBE, 0xC8, 0x52, 0x24, 0xE1, 0x97, 0x0D, 0x7B, 0x00, 0xFB, 0x71, 0x8A, 0xE2, 0x19, 0x93, 0x68, 0x43, 0xB8, 0x32, 0xC9, 0xA1, 0x5A, 0xD0, 0x2B},
+    {0x00, 0x77, 0xEE, 0x99, 0x5B, 0x2C, 0xB5, 0xC2, 0xB6, 0xC1, 0x58, 0x2F, 0xED, 0x9A, 0x03, 0x74, 0x00, 0xEB, 0x51, 0xBA, 0xA2, 0x49, 0xF3, 0x18, 0xC3, 0x28, 0x92, 0x79, 0x61, 0x8A, 0x30, 0xDB},
+    {0x00, 0x78, 0xF0, 0x88, 0x67, 0x1F, 0x97, 0xEF, 0xCE, 0xB6, 0x3E, 0x46, 0xA9, 0xD1, 0x59, 0x21, 0x00, 0x1B, 0x36, 0x2D, 0x6C, 0x77, 0x5A, 0x41, 0xD8, 0xC3, 0xEE, 0xF5, 0xB4, 0xAF, 0x82, 0x99},
+    {0x00, 0x79, 0xF2, 0x8B, 0x63, 0x1A, 0x91, 0xE8, 0xC6, 0xBF, 0x34, 0x4D, 0xA5, 0xDC, 0x57, 0x2E, 0x00, 0x0B, 0x16, 0x1D, 0x2C, 0x27, 0x3A, 0x31, 0x58, 0x53, 0x4E, 0x45, 0x74, 0x7F, 0x62, 0x69},
+    {0x00, 0x7A, 0xF4, 0x8E, 0x6F, 0x15, 0x9B, 0xE1, 0xDE, 0xA4, 0x2A, 0x50, 0xB1, 0xCB, 0x45, 0x3F, 0x00, 0x3B, 0x76, 0x4D, 0xEC, 0xD7, 0x9A, 0xA1, 0x5F, 0x64, 0x29, 0x12, 0xB3, 0x88, 0xC5, 0xFE},
+    {0x00, 0x7B, 0xF6, 0x8D, 0x6B, 0x10, 0x9D, 0xE6, 0xD6, 0xAD, 0x20, 0x5B, 0xBD, 0xC6, 0x4B, 0x30, 0x00, 0x2B, 0x56, 0x7D, 0xAC, 0x87, 0xFA, 0xD1, 0xDF, 0xF4, 0x89, 0xA2, 0x73, 0x58, 0x25, 0x0E},
+    {0x00, 0x7C, 0xF8, 0x84, 0x77, 0x0B, 0x8F, 0xF3, 0xEE, 0x92, 0x16, 0x6A, 0x99, 0xE5, 0x61, 0x1D, 0x00, 0x5B, 0xB6, 0xED, 0xEB, 0xB0, 0x5D, 0x06, 0x51, 0x0A, 0xE7, 0xBC, 0xBA, 0xE1, 0x0C, 0x57},
+    {0x00, 0x7D, 0xFA, 0x87, 0x73, 0x0E, 0x89, 0xF4, 0xE6, 0x9B, 0x1C, 0x61, 0x95, 0xE8, 0x6F, 0x12, 0x00, 0x4B, 0x96, 0xDD, 0xAB, 0xE0, 0x3D, 0x76, 0xD1, 0x9A, 0x47, 0x0C, 0x7A, 0x31, 0xEC, 0xA7},
+    {0x00, 0x7E, 0xFC, 0x82, 0x7F, 0x01, 0x83, 0xFD, 0xFE, 0x80, 0x02, 0x7C, 0x81, 0xFF, 0x7D, 0x03, 0x00, 0x7B, 0xF6, 0x8D, 0x6B, 0x10, 0x9D, 0xE6, 0xD6, 0xAD, 0x20, 0x5B, 0xBD, 0xC6, 0x4B, 0x30},
+    {0x00, 0x7F, 0xFE, 0x81, 0x7B, 0x04, 0x85, 0xFA, 0xF6, 0x89, 0x08, 0x77, 0x8D, 0xF2, 0x73, 0x0C, 0x00, 0x6B, 0xD6, 0xBD, 0x2B, 0x40, 0xFD, 0x96, 0x56, 0x3D, 0x80, 0xEB, 0x7D, 0x16, 0xAB, 0xC0},
+    {0x00, 0x80, 0x87, 0x07, 0x89, 0x09, 0x0E, 0x8E, 0x95, 0x15, 0x12, 0x92, 0x1C, 0x9C, 0x9B, 0x1B, 0x00, 0xAD, 0xDD, 0x70, 0x3D, 0x90, 0xE0, 0x4D, 0x7A, 0xD7, 0xA7, 0x0A, 0x47, 0xEA, 0x9A, 0x37},
+    {0x00, 0x81, 0x85, 0x04, 0x8D, 0x0C, 0x08, 0x89, 0x9D, 0x1C, 0x18, 0x99, 0x10, 0x91, 0x95, 0x14, 0x00, 0xBD, 0xFD, 0x40, 0x7D, 0xC0, 0x80, 0x3D, 0xFA, 0x47, 0x07, 0xBA, 0x87, 0x3A, 0x7A, 0xC7},
+    {0x00, 0x82, 0x83, 0x01, 0x81, 0x03, 0x02, 0x80, 0x85, 0x07, 0x06, 0x84, 0x04, 0x86, 0x87, 0x05, 0x00, 0x8D, 0x9D, 0x10, 0xBD, 0x30, 0x20, 0xAD, 0xFD, 0x70, 0x60, 0xED, 0x40, 0xCD, 0xDD, 0x50},
+    {0x00, 0x83, 0x81, 0x02, 0x85, 0x06, 0x04, 0x87, 0x8D, 0x0E, 0x0C, 0x8F, 0x08, 0x8B, 0x89, 0x0A, 0x00, 0x9D, 0xBD, 0x20, 0xFD, 0x60, 0x40, 0xDD, 0x7D, 0xE0, 0xC0, 0x5D, 0x80, 0x1D, 0x3D, 0xA0},
+    {0x00, 0x84, 0x8F, 0x0B, 0x99, 0x1D, 0x16, 0x92, 0xB5, 0x31, 0x3A, 0xBE, 0x2C, 0xA8, 0xA3, 0x27, 0x00, 0xED, 0x5D, 0xB0, 0xBA, 0x57, 0xE7, 0x0A, 0xF3, 0x1E, 0xAE, 0x43, 0x49, 0xA4, 0x14, 0xF9},
+    {0x00, 0x85, 0x8D, 0x08, 0x9D, 0x18, 0x10, 0x95, 0xBD, 0x38, 0x30, 0xB5, 0x20, 0xA5, 0xAD, 0x28, 0x00, 0xFD, 0x7D, 0x80, 0xFA, 0x07, 0x87, 0x7A, 0x73, 0x8E, 0x0E, 0xF3, 0x89, 0x74, 0xF4, 0x09},
+    {0x00, 0x86, 0x8B, 0x0D, 0x91, 0x17, 0x1A, 0x9C, 0xA5, 0x23, 0x2E, 0xA8, 0x34, 0xB2, 0xBF, 0x39, 0x00, 0xCD, 0x1D, 0xD0, 0x3A, 0xF7, 0x27, 0xEA, 0x74, 0xB9, 0x69, 0xA4, 0x4E, 0x83, 0x53, 0x9E},
+    {0x00, 0x87, 0x89, 0x0E, 0x95, 0x12, 0x1C, 0x9B, 0xAD, 0x2A, 0x24, 0xA3, 0x38, 0xBF, 0xB1, 0x36, 0x00, 0xDD, 0x3D, 0xE0, 0x7A, 0xA7, 0x47, 0x9A, 0xF4, 0x29, 0xC9, 0x14, 0x8E, 0x53, 0xB3, 0x6E},
+    {0x00, 0x88, 0x97, 0x1F, 0xA9, 0x21, 0x3E, 0xB6, 0xD5, 0x5D, 0x42, 0xCA, 0x7C, 0xF4, 0xEB, 0x63, 0x00, 0x2D, 0x5A, 0x77, 0xB4, 0x99, 0xEE, 0xC3, 0xEF, 0xC2, 0xB5, 0x98, 0x5B, 0x76, 0x01, 0x2C},
+    {0x00, 0x89, 0x95, 0x1C, 0xAD, 0x24, 0x38, 0xB1, 0xDD, 0x54, 0x48, 0xC1, 0x70, 0xF9, 0xE5, 0x6C, 0x00, 0x3D, 0x7A, 0x47, 0xF4, 0xC9, 0x8E, 0xB3, 0x6F, 0x52, 0x15, 0x28, 0x9B, 0xA6, 0xE1, 0xDC},
+    {0x00, 0x8A, 0x93, 0x19, 0xA1, 0x2B, 0x32, 0xB8, 0xC5, 0x4F, 0x56, 0xDC, 0x64, 0xEE, 0xF7, 0x7D, 0x00, 0x0D, 0x1A, 0x17, 0x34, 0x39, 0x2E, 0x23, 0x68, 0x65, 0x72, 0x7F, 0x5C, 0x51, 0x46, 0x4B},
+    {0x00, 0x8B, 0x91, 0x1A, 0xA5, 0x2E, 0x34, 0xBF, 0xCD, 0x46, 0x5C, 0xD7, 0x68, 0xE3, 0xF9, 0x72, 0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB},
+    {0x00, 0x8C, 0x9F, 0x13, 0xB9, 0x35, 0x26, 0xAA, 0xF5, 0x79, 0x6A, 0xE6, 0x4C, 0xC0, 0xD3, 0x5F, 0x00, 0x6D, 0xDA, 0xB7, 0x33, 0x5E, 0xE9, 0x84, 0x66, 0x0B, 0xBC, 0xD1, 0x55, 0x38, 0x8F, 0xE2},
+    {0x00, 0x8D, 0x9D, 0x10, 0xBD, 0x30, 0x20, 0xAD, 0xFD, 0x70, 0x60, 0xED, 0x40, 0xCD, 0xDD, 0x50, 0x00, 0x7D, 0xFA, 0x87, 0x73, 0x0E, 0x89, 0xF4, 0xE6, 0x9B, 0x1C, 0x61, 0x95, 0xE8, 0x6F, 0x12},
+    {0x00, 0x8E, 0x9B, 0x15, 0xB1, 0x3F, 0x2A, 0xA4, 0xE5, 0x6B, 0x7E, 0xF0, 0x54, 0xDA, 0xCF, 0x41, 0x00, 0x4D, 0x9A, 0xD7, 0xB3, 0xFE, 0x29, 0x64, 0xE1, 0xAC, 0x7B, 0x36, 0x52, 0x1F, 0xC8, 0x85},
+    {0x00, 0x8F, 0x99, 0x16, 0xB5, 0x3A, 0x2C, 0xA3, 0xED, 0x62, 0x74, 0xFB, 0x58, 0xD7, 0xC1, 0x4E, 0x00, 0x5D, 0xBA, 0xE7, 0xF3, 0xAE, 0x49, 0x14, 0x61, 0x3C, 0xDB, 0x86, 0x92, 0xCF, 0x28, 0x75},
+    {0x00, 0x90, 0xA7, 0x37, 0xC9, 0x59, 0x6E, 0xFE, 0x15, 0x85, 0xB2, 0x22, 0xDC, 0x4C, 0x7B, 0xEB, 0x00, 0x2A, 0x54, 0x7E, 0xA8, 0x82, 0xFC, 0xD6, 0xD7, 0xFD, 0x83, 0xA9, 0x7F, 0x55, 0x2B, 0x01},
+    {0x00, 0x91, 0xA5, 0x34, 0xCD, 0x5C, 0x68, 0xF9, 0x1D, 0x8C, 0xB8, 0x29, 0xD0, 0x41, 0x75, 0xE4, 0x00, 0x3A, 0x74, 0x4E, 0xE8, 0xD2, 0x9C, 0xA6, 0x57, 0x6D, 0x23, 0x19, 0xBF, 0x85, 0xCB, 0xF1},
+    {0x00, 0x92, 0xA3, 0x31, 0xC1, 0x53, 0x62, 0xF0, 0x05, 0x97, 0xA6, 0x34, 0xC4, 0x56, 0x67, 0xF5, 0x00, 0x0A, 0x14, 0x1E, 0x28, 0x22, 0x3C, 0x36, 0x50, 0x5A, 0x44, 0x4E, 0x78, 0x72, 0x6C, 0x66},
+    {0x00, 0x93, 0xA1, 0x32, 0xC5, 0x56, 0x64, 0xF7, 0x0D, 0x9E, 0xAC, 0x3F, 0xC8, 0x5B, 0x69, 0xFA, 0x00, 0x1A, 0x34, 0x2E, 0x68, 0x72, 0x5C, 0x46, 0xD0, 0xCA, 0xE4, 0xFE, 0xB8, 0xA2, 0x8C, 0x96},
+    {0x00, 0x94, 0xAF, 0x3B, 0xD9, 0x4D, 0x76, 0xE2, 0x35, 0xA1, 0x9A, 0x0E, 0xEC, 0x78, 0x43, 0xD7, 0x00, 0x6A, 0xD4, 0xBE, 0x2F, 0x45, 0xFB, 0x91, 0x5E, 0x34, 0x8A, 0xE0, 0x71, 0x1B, 0xA5, 0xCF},
+    {0x00, 0x95, 0xAD, 0x38, 0xDD, 0x48, 0x70, 0xE5, 0x3D, 0xA8, 0x90, 0x05, 0xE0, 0x75, 0x4D, 0xD8, 0x00, 0x7A, 0xF4, 0x8E, 0x6F, 0x15, 0x9B, 0xE1, 0xDE, 0xA4, 0x2A, 0x50, 0xB1, 0xCB, 0x45, 0x3F},
+    {0x00, 0x96, 0xAB, 0x3D, 0xD1, 0x47, 0x7A, 0xEC, 0x25, 0xB3, 0x8E, 0x18, 0xF4, 0x62, 0x5F, 0xC9, 0x00, 0x4A, 0x94, 0xDE, 0xAF, 0xE5, 0x3B, 0x71, 0xD9, 0x93, 0x4D, 0x07, 0x76, 0x3C, 0xE2, 0xA8},
+    {0x00, 0x97, 0xA9, 0x3E, 0xD5, 0x42, 0x7C, 0xEB, 0x2D, 0xBA, 0x84, 0x13, 0xF8, 0x6F, 0x51, 0xC6, 0x00, 0x5A, 0xB4, 0xEE, 0xEF, 0xB5, 0x5B, 0x01, 0x59, 0x03, 0xED, 0xB7, 0xB6, 0xEC, 0x02, 0x58},
+    {0x00, 0x98, 0xB7, 0x2F, 0xE9, 0x71, 0x5E, 0xC6, 0x55, 0xCD, 0xE2, 0x7A, 0xBC, 0x24, 0x0B, 0x93, 0x00, 0xAA, 0xD3, 0x79, 0x21, 0x8B, 0xF2, 0x58, 0x42, 0xE8, 0x91, 0x3B, 0x63, 0xC9, 0xB0, 0x1A},
+    {0x00, 0x99, 0xB5, 0x2C, 0xED, 0x74, 0x58, 0xC1, 0x5D, 0xC4, 0xE8, 0x71, 0xB0, 0x29, 0x05, 0x9C, 0x00, 0xBA, 0xF3, 0x49, 0x61, 0xDB, 0x92, 0x28, 0xC2, 0x78, 0x31, 0x8B, 0xA3, 0x19, 0x50, 0xEA},
+    {0x00, 0x9A, 0xB3, 0x29, 0xE1, 0x7B, 0x52, 0xC8, 0x45, 0xDF, 0xF6, 0x6C, 0xA4, 0x3E, 0x17, 0x8D, 0x00, 0x8A, 0x93, 0x19, 0xA1, 0x2B, 0x32, 0xB8, 0xC5, 0x4F, 0x56, 0xDC, 0x64, 0xEE, 0xF7, 0x7D},
+    {0x00, 0x9B, 0xB1, 0x2A, 0xE5, 0x7E, 0x54, 0xCF, 0x4D, 0xD6, 0xFC, 0x67, 0xA8, 0x33, 0x19, 0x82, 0x00, 0x9A, 0xB3, 0x29, 0xE1, 0x7B, 0x52, 0xC8, 0x45, 0xDF, 0xF6, 0x6C, 0xA4, 0x3E, 0x17, 0x8D},
+    {0x00, 0x9C, 0xBF, 0x23, 0xF9, 0x65, 0x46, 0xDA, 0x75, 0xE9, 0xCA, 0x56, 0x8C, 0x10, 0x33, 0xAF, 0x00, 0xEA, 0x53, 0xB9, 0xA6, 0x4C, 0xF5, 0x1F, 0xCB, 0x21, 0x98, 0x72, 0x6D, 0x87, 0x3E, 0xD4},
+    {0x00, 0x9D, 0xBD, 0x20, 0xFD, 0x60, 0x40, 0xDD, 0x7D, 0xE0, 0xC0, 0x5D, 0x80, 0x1D, 0x3D, 0xA0, 0x00, 0xFA, 0x73, 0x89, 0xE6, 0x1C, 0x95, 0x6F, 0x4B, 0xB1, 0x38, 0xC2, 0xAD, 0x57, 0xDE, 0x24},
+    {0x00, 0x9E, 0xBB, 0x25, 0xF1, 0x6F, 0x4A, 0xD4, 0x65, 0xFB, 0xDE, 0x40, 0x94, 0x0A, 0x2F, 0xB1, 0x00, 0xCA, 0x13, 0xD9, 0x26, 0xEC, 0x35, 0xFF, 0x4C, 0x86, 0x5F, 0x95, 0x6A, 0xA0, 0x79, 0xB3},
+    {0x00, 0x9F, 0xB9, 0x26, 0xF5, 0x6A, 0x4C, 0xD3, 0x6D, 0xF2, 0xD4, 0x4B, 0x98, 0x07, 0x21, 0xBE, 0x00, 0xDA, 0x33, 0xE9, 0x66, 0xBC, 0x55, 0x8F, 0xCC, 0x16, 0xFF, 0x25, 0xAA, 0x70, 0x99, 0x43},
+    {0x00, 0xA0, 0xC7, 0x67, 0x09, 0xA9, 0xCE, 0x6E, 0x12, 0xB2, 0xD5, 0x75, 0x1B, 0xBB, 0xDC, 0x7C, 0x00, 0x24, 0x48, 0x6C, 0x90, 0xB4, 0xD8, 0xFC, 0xA7, 0x83, 0xEF, 0xCB, 0x37, 0x13, 0x7F, 0x5B},
+    {0x00, 0xA1, 0xC5, 0x64, 0x0D, 0xAC, 0xC8, 0x69, 0x1A, 0xBB, 0xDF, 0x7E, 0x17, 0xB6, 0xD2, 0x73, 0x00, 0x34, 0x68, 0x5C, 0xD0, 0xE4, 0xB8, 0x8C, 0x27, 0x13, 0x4F, 0x7B, 0xF7, 0xC3, 0x9F, 0xAB},
+    {0x00, 0xA2, 0xC3, 0x61, 0x01, 0xA3, 0xC2, 0x60, 0x02, 0xA0, 0xC1, 0x63, 0x03, 0xA1, 0xC0, 0x62, 0x00, 0x04, 0x08, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20, 0x24, 0x28, 0x2C, 0x30, 0x34, 0x38, 0x3C},
+    {0x00, 0xA3, 0xC1, 0x62, 0x05, 0xA6, 0xC4, 0x67, 0x0A, 0xA9, 0xCB, 0x68, 0x0F, 0xAC, 0xCE, 0x6D, 0x00, 0x14, 0x28, 0x3C, 0x50, 0x44, 0x78, 0x6C, 0xA0, 0xB4, 0x88, 0x9C, 0xF0, 0xE4, 0xD8, 0xCC},
+    {0x00, 0xA4, 0xCF, 0x6B, 0x19, 0xBD, 0xD6, 0x72, 0x32, 0x96, 0xFD, 0x59, 0x2B, 0x8F, 0xE4, 0x40, 0x00, 0x64, 0xC8, 0xAC, 0x17, 0x73, 0xDF, 0xBB, 0x2E, 0x4A, 0xE6, 0x82, 0x39, 0x5D, 0xF1, 0x95},
+    {0x00, 0xA5, 0xCD, 0x68, 0x1D, 0xB8, 0xD0, 0x75, 0x3A, 0x9F, 0xF7, 0x52, 0x27, 0x82, 0xEA, 0x4F, 0x00, 0x74, 0xE8, 0x9C, 0x57, 0x23, 0xBF, 0xCB, 0xAE, 0xDA, 0x46, 0x32, 0xF9, 0x8D, 0x11, 0x65},
+    {0x00, 0xA6, 0xCB, 0x6D, 0x11, 0xB7, 0xDA, 0x7C, 0x22, 0x84, 0xE9, 0x4F, 0x33, 0x95, 0xF8, 0x5E, 0x00, 0x44, 0x88, 0xCC, 0x97, 0xD3, 0x1F, 0x5B, 0xA9, 0xED, 0x21, 0x65, 0x3E, 0x7A, 0xB6, 0xF2},
+    {0x00, 0xA7, 0xC9, 0x6E, 0x15, 0xB2, 0xDC, 0x7B, 0x2A, 0x8D, 0xE3, 0x44, 0x3F, 0x98, 0xF6, 0x51, 0x00, 0x54, 0xA8, 0xFC, 0xD7, 0x83, 0x7F, 0x2B, 0x29, 0x7D, 0x81, 0xD5, 0xFE, 0xAA, 0x56, 0x02},
+    {0x00, 0xA8, 0xD7, 0x7F, 0x29, 0x81, 0xFE, 0x56, 0x52, 0xFA, 0x85, 0x2D, 0x7B, 0xD3, 0xAC, 0x04, 0x00, 0xA4, 0xCF, 0x6B, 0x19, 0xBD, 0xD6, 0x72, 0x32, 0x96, 0xFD, 0x59, 0x2B, 0x8F, 0xE4, 0x40},
+    {0x00, 0xA9, 0xD5, 0x7C, 0x2D, 0x84, 0xF8, 0x51, 0x5A, 0xF3, 0x8F, 0x26, 0x77, 0xDE, 0xA2, 0x0B, 0x00, 0xB4, 0xEF, 0x5B, 0x59, 0xED, 0xB6, 0x02, 0xB2, 0x06, 0x5D, 0xE9, 0xEB, 0x5F, 0x04, 0xB0},
+    {0x00, 0xAA, 0xD3, 0x79, 0x21, 0x8B, 0xF2, 0x58, 0x42, 0xE8, 0x91, 0x3B, 0x63, 0xC9, 0xB0, 0x1A, 0x00, 0x84, 0x8F, 0x0B, 0x99, 0x1D, 0x16, 0x92, 0xB5, 0x31, 0x3A, 0xBE, 0x2C, 0xA8, 0xA3, 0x27},
+    {0x00, 0xAB, 0xD1, 0x7A, 0x25, 0x8E, 0xF4, 0x5F, 0x4A, 0xE1, 0x9B, 0x30, 0x6F, 0xC4, 0xBE, 0x15, 0x00, 0x94, 0xAF, 0x3B, 0xD9, 0x4D, 0x76, 0xE2, 0x35, 0xA1, 0x9A, 0x0E, 0xEC, 0x78, 0x43, 0xD7},
+    {0x00, 0xAC, 0xDF, 0x73, 0x39, 0x95, 0xE6, 0x4A, 0x72, 0xDE, 0xAD, 0x01, 0x4B, 0xE7, 0x94, 0x38, 0x00, 0xE4, 0x4F, 0xAB, 0x9E, 0x7A, 0xD1, 0x35, 0xBB, 0x5F, 0xF4, 0x10, 0x25, 0xC1, 0x6A, 0x8E},
+    {0x00, 0xAD, 0xDD, 0x70, 0x3D, 0x90, 0xE0, 0x4D, 0x7A, 0xD7, 0xA7, 0x0A, 0x47, 0xEA, 0x9A, 0x37, 0x00, 0xF4, 0x6F, 0x9B, 0xDE, 0x2A, 0xB1, 0x45, 0x3B, 0xCF, 0x54, 0xA0, 0xE5, 0x11, 0x8A, 0x7E},
+    {0x00, 0xAE, 0xDB, 0x75, 0x31, 0x9F, 0xEA, 0x44, 0x62, 0xCC, 0xB9, 0x17, 0x53, 0xFD, 0x88, 0x26, 0x00, 0xC4, 0x0F, 0xCB, 0x1E, 0xDA, 0x11, 0xD5, 0x3C, 0xF8, 0x33, 0xF7, 0x22, 0xE6, 0x2D, 0xE9},
+    {0x00, 0xAF, 0xD9, 0x76, 0x35, 0x9A, 0xEC, 0x43, 0x6A, 0xC5, 0xB3, 0x1C, 0x5F, 0xF0, 0x86, 0x29, 0x00, 0xD4, 0x2F, 0xFB, 0x5E, 0x8A, 0x71, 0xA5, 0xBC, 0x68, 0x93, 0x47, 0xE2, 0x36, 0xCD, 0x19},
+    {0x00, 0xB0, 0xE7, 0x57, 0x49, 0xF9, 0xAE, 0x1E, 0x92, 0x22, 0x75, 0xC5, 0xDB, 0x6B, 0x3C, 0x8C, 0x00, 0xA3, 0xC1, 0x62, 0x05, 0xA6, 0xC4, 0x67, 0x0A, 0xA9, 0xCB, 0x68, 0x0F, 0xAC, 0xCE, 0x6D},
+    {0x00, 0xB1, 0xE5, 0x54, 0x4D, 0xFC, 0xA8, 0x19, 0x9A, 0x2B, 0x7F, 0xCE, 0xD7, 0x66, 0x32, 0x83, 0x00, 0xB3, 0xE1, 0x52, 0x45, 0xF6, 0xA4, 0x17, 0x8A, 0x39, 0x6B, 0xD8, 0xCF, 0x7C, 0x2E, 0x9D},
+    {0x00, 0xB2, 0xE3, 0x51, 0x41, 0xF3, 0xA2, 0x10, 0x82, 0x30, 0x61, 0xD3, 0xC3, 0x71, 0x20, 0x92, 0x00, 0x83, 0x81, 0x02, 0x85, 0x06, 0x04, 0x87, 0x8D, 0x0E, 0x0C, 0x8F, 0x08, 0x8B, 0x89, 0x0A},
+    {0x00, 0xB3, 0xE1, 0x52, 0x45, 0xF6, 0xA4, 0x17, 0x8A, 0x39, 0x6B, 0xD8, 0xCF, 0x7C, 0x2E, 0x9D, 0x00, 0x93, 0xA1, 0x32, 0xC5, 0x56, 0x64, 0xF7, 0x0D, 0x9E, 0xAC, 0x3F, 0xC8, 0x5B, 0x69, 0xFA},
+    {0x00, 0xB4, 0xEF, 0x5B, 0x59, 0xED, 0xB6, 0x02, 0xB2, 0x06, 0x5D, 0xE9, 0xEB, 0x5F, 0x04, 0xB0, 0x00, 0xE3, 0x41, 0xA2, 0x82, 0x61, 0xC3, 0x20, 0x83, 0x60, 0xC2, 0x21, 0x01, 0xE2, 0x40, 0xA3},
+    {0x00, 0xB5, 0xED, 0x58, 0x5D, 0xE8, 0xB0, 0x05, 0xBA, 0x0F, 0x57, 0xE2, 0xE7, 0x52, 0x0A, 0xBF, 0x00, 0xF3, 0x61, 0x92, 0xC2, 0x31, 0xA3, 0x50, 0x03, 0xF0, 0x62, 0x91, 0xC1, 0x32, 0xA0, 0x53},
+    {0x00, 0xB6, 0xEB, 0x5D, 0x51, 0xE7, 0xBA, 0x0C, 0xA2, 0x14, 0x49, 0xFF, 0xF3, 0x45, 0x18, 0xAE, 0x00, 0xC3, 0x01, 0xC2, 0x02, 0xC1, 0x03, 0xC0, 0x04, 0xC7, 0x05, 0xC6, 0x06, 0xC5, 0x07, 0xC4},
+    {0x00, 0xB7, 0xE9, 0x5E, 0x55, 0xE2, 0xBC, 0x0B, 0xAA, 0x1D, 0x43, 0xF4, 0xFF, 0x48, 0x16, 0xA1, 0x00, 0xD3, 0x21, 0xF2, 0x42, 0x91, 0x63, 0xB0, 0x84, 0x57, 0xA5, 0x76, 0xC6, 0x15, 0xE7, 0x34},
+    {0x00, 0xB8, 0xF7, 0x4F, 0x69, 0xD1, 0x9E, 0x26, 0xD2, 0x6A, 0x25, 0x9D, 0xBB, 0x03, 0x4C, 0xF4, 0x00, 0x23, 0x46, 0x65, 0x8C, 0xAF, 0xCA, 0xE9, 0x9F, 0xBC, 0xD9, 0xFA, 0x13, 0x30, 0x55, 0x76},
+    {0x00, 0xB9, 0xF5, 0x4C, 0x6D, 0xD4, 0x98, 0x21, 0xDA, 0x63, 0x2F, 0x96, 0xB7, 0x0E, 0x42, 0xFB, 0x00, 0x33, 0x66, 0x55, 0xCC, 0xFF, 0xAA, 0x99, 0x1F, 0x2C, 0x79, 0x4A, 0xD3, 0xE0, 0xB5, 0x86},
+    {0x00, 0xBA, 0xF3, 0x49, 0x61, 0xDB, 0x92, 0x28, 0xC2, 0x78, 0x31, 0x8B, 0xA3, 0x19, 0x50, 0xEA, 0x00, 0x03, 0x06, 0x05, 0x0C, 0x0F, 0x0A, 0x09, 0x18, 0x1B, 0x1E, 0x1D, 0x14, 0x17, 0x12, 0x11},
+    {0x00, 0xBB, 0xF1, 0x4A, 0x65, 0xDE, 0x94, 0x2F, 0xCA, 0x71, 0x3B, 0x80, 0xAF, 0x14, 0x5E, 0xE5, 0x00, 0x13, 0x26, 0x35, 0x4C, 0x5F, 0x6A, 0x79, 0x98, 0x8B, 0xBE, 0xAD, 0xD4, 0xC7, 0xF2, 0xE1},
+    {0x00, 0xBC, 0xFF, 0x43, 0x79, 0xC5, 0x86, 0x3A, 0xF2, 0x4E, 0x0D, 0xB1, 0x8B, 0x37, 0x74, 0xC8, 0x00, 0x63, 0xC6, 0xA5, 0x0B, 0x68, 0xCD, 0xAE, 0x16, 0x75, 0xD0, 0xB3, 0x1D, 0x7E, 0xDB, 0xB8},
+    {0x00, 0xBD, 0xFD, 0x40, 0x7D, 0xC0, 0x80, 0x3D, 0xFA, 0x47, 0x07, 0xBA, 0x87, 0x3A, 0x7A, 0xC7, 0x00, 0x73, 0xE6, 0x95, 0x4B, 0x38, 0xAD, 0xDE, 0x96, 0xE5, 0x70, 0x03, 0xDD, 0xAE, 0x3B, 0x48},
+    {0x00, 0xBE, 0xFB, 0x45, 0x71, 0xCF, 0x8A, 0x34, 0xE2, 0x5C, 0x19, 0xA7, 0x93, 0x2D, 0x68, 0xD6, 0x00, 0x43, 0x86, 0xC5, 0x8B, 0xC8, 0x0D, 0x4E, 0x91, 0xD2, 0x17, 0x54, 0x1A, 0x59, 0x9C, 0xDF},
+    {0x00, 0xBF, 0xF9, 0x46, 0x75, 0xCA, 0x8C, 0x33, 0xEA, 0x55, 0x13, 0xAC, 0x9F, 0x20, 0x66, 0xD9, 0x00, 0x53, 0xA6, 0xF5, 0xCB, 0x98, 0x6D, 0x3E, 0x11, 0x42, 0xB7, 0xE4, 0xDA, 0x89, 0x7C, 0x2F},
+    {0x00, 0xC0, 0x07, 0xC7, 0x0E, 0xCE, 0x09, 0xC9, 0x1C, 0xDC, 0x1B, 0xDB, 0x12, 0xD2, 0x15, 0xD5, 0x00, 0x38, 0x70, 0x48, 0xE0, 0xD8, 0x90, 0xA8, 0x47, 0x7F, 0x37, 0x0F, 0xA7, 0x9F, 0xD7, 0xEF},
+    {0x00, 0xC1, 0x05, 0xC4, 0x0A, 0xCB, 0x0F, 0xCE, 0x14, 0xD5, 0x11, 0xD0, 0x1E, 0xDF, 0x1B, 0xDA, 0x00, 0x28, 0x50, 0x78, 0xA0, 0x88, 0xF0, 0xD8, 0xC7, 0xEF, 0x97, 0xBF, 0x67, 0x4F, 0x37, 0x1F},
+    {0x00, 0xC2, 0x03, 0xC1, 0x06, 0xC4, 0x05, 0xC7, 0x0C, 0xCE, 0x0F, 0xCD, 0x0A, 0xC8, 0x09, 0xCB, 0x00, 0x18, 0x30, 0x28, 0x60, 0x78, 0x50, 0x48, 0xC0, 0xD8, 0xF0, 0xE8, 0xA0, 0xB8, 0x90, 0x88},
+    {0x00, 0xC3, 0x01, 0xC2, 0x02, 0xC1, 0x03, 0xC0, 0x04, 0xC7, 0x05, 0xC6, 0x06, 0xC5, 0x07, 0xC4, 0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78},
+    {0x00, 0xC4, 0x0F, 0xCB, 0x1E, 0xDA, 0x11, 0xD5, 0x3C, 0xF8, 0x33, 0xF7, 0x22, 0xE6, 0x2D, 0xE9, 0x00, 0x78, 0xF0, 0x88, 0x67, 0x1F, 0x97, 0xEF, 0xCE, 0xB6, 0x3E, 0x46, 0xA9, 0xD1, 0x59, 0x21},
+    {0x00, 0xC5, 0x0D, 0xC8, 0x1A, 0xDF, 0x17, 0xD2, 0x34, 0xF1, 0x39, 0xFC, 0x2E, 0xEB, 0x23, 0xE6, 0x00, 0x68, 0xD0, 0xB8, 0x27, 0x4F, 0xF7, 0x9F, 0x4E, 0x26, 0x9E, 0xF6, 0x69, 0x01, 0xB9, 0xD1},
+    {0x00, 0xC6, 0x0B, 0xCD, 0x16, 0xD0, 0x1D, 0xDB, 0x2C, 0xEA, 0x27, 0xE1, 0x3A, 0xFC, 0x31, 0xF7, 0x00, 0x58, 0xB0, 0xE8, 0xE7, 0xBF, 0x57, 0x0F, 0x49, 0x11, 0xF9, 0xA1, 0xAE, 0xF6, 0x1E, 0x46},
+    {0x00, 0xC7, 0x09, 0xCE, 0x12, 0xD5, 0x1B, 0xDC, 0x24, 0xE3, 0x2D, 0xEA, 0x36, 0xF1, 0x3F, 0xF8, 0x00, 0x48, 0x90, 0xD8, 0xA7, 0xEF, 0x37, 0x7F, 0xC9, 0x81, 0x59, 0x11, 0x6E, 0x26, 0xFE, 0xB6},
+    {0x00, 0xC8, 0x17, 0xDF, 0x2E, 0xE6, 0x39, 0xF1, 0x5C, 0x94, 0x4B, 0x83, 0x72, 0xBA, 0x65, 0xAD, 0x00, 0xB8, 0xF7, 0x4F, 0x69, 0xD1, 0x9E, 0x26, 0xD2, 0x6A, 0x25, 0x9D, 0xBB, 0x03, 0x4C, 0xF4},
+    {0x00, 0xC9, 0x15, 0xDC, 0x2A, 0xE3, 0x3F, 0xF6, 0x54, 0x9D, 0x41, 0x88, 0x7E, 0xB7, 0x6B, 0xA2, 0x00, 0xA8, 0xD7, 0x7F, 0x29, 0x81, 0xFE, 0x56, 0x52, 0xFA, 0x85, 0x2D, 0x7B, 0xD3, 0xAC, 0x04},
+    {0x00, 0xCA, 0x13, 0xD9, 0x26, 0xEC, 0x35, 0xFF, 0x4C, 0x86, 0x5F, 0x95, 0x6A, 0xA0, 0x79, 0xB3, 0x00, 0x98, 0xB7, 0x2F, 0xE9, 0x71, 0x5E, 0xC6, 0x55, 0xCD, 0xE2, 0x7A, 0xBC, 0x24, 0x0B, 0x93},
+    {0x00, 0xCB, 0x11, 0xDA, 0x22, 0xE9, 0x33, 0xF8, 0x44, 0x8F, 0x55, 0x9E, 0x66, 0xAD, 0x77, 0xBC, 0x00, 0x88, 0x97, 0x1F, 0xA9, 0x21, 0x3E, 0xB6, 0xD5, 0x5D, 0x42, 0xCA, 0x7C, 0xF4, 0xEB, 0x63},
+    {0x00, 0xCC, 0x1F, 0xD3, 0x3E, 0xF2, 0x21, 0xED, 0x7C, 0xB0, 0x63, 0xAF, 0x42, 0x8E, 0x5D, 0x91, 0x00, 0xF8, 0x77, 0x8F, 0xEE, 0x16, 0x99, 0x61, 0x5B, 0xA3, 0x2C, 0xD4, 0xB5, 0x4D, 0xC2, 0x3A},
+    {0x00, 0xCD, 0x1D, 0xD0, 0x3A, 0xF7, 0x27, 0xEA, 0x74, 0xB9, 0x69, 0xA4, 0x4E, 0x83, 0x53, 0x9E, 0x00, 0xE8, 0x57, 0xBF, 0xAE, 0x46, 0xF9, 0x11, 0xDB, 0x33, 0x8C, 0x64, 0x75, 0x9D, 0x22, 0xCA},
+    {0x00, 0xCE, 0x1B, 0xD5, 0x36, 0xF8, 0x2D, 0xE3, 0x6C, 0xA2, 0x77, 0xB9, 0x5A, 0x94, 0x41, 0x8F, 0x00, 0xD8, 0x37, 0xEF, 0x6E, 0xB6, 0x59, 0x81, 0xDC, 0x04, 0xEB, 0x33, 0xB2, 0x6A, 0x85, 0x5D},
+    {0x00, 0xCF, 0x19, 0xD6, 0x32, 0xFD, 0x2B, 0xE4, 0x64, 0xAB, 0x7D, 0xB2, 0x56, 0x99, 0x4F, 0x80, 0x00, 0xC8, 0x17, 0xDF, 0x2E, 0xE6, 0x39, 0xF1, 0x5C, 0x94, 0x4B, 0x83, 0x72, 0xBA, 0x65, 0xAD},
+    {0x00, 0xD0, 0x27, 0xF7, 0x4E, 0x9E, 0x69, 0xB9, 0x9C, 0x4C, 0xBB, 0x6B, 0xD2, 0x02, 0xF5, 0x25, 0x00, 0xBF, 0xF9, 0x46, 0x75, 0xCA, 0x8C, 0x33, 0xEA, 0x55, 0x13, 0xAC, 0x9F, 0x20, 0x66, 0xD9},
+    {0x00, 0xD1, 0x25, 0xF4, 0x4A, 0x9B, 0x6F, 0xBE, 0x94, 0x45, 0xB1, 0x60, 0xDE, 0x0F, 0xFB, 0x2A, 0x00, 0xAF, 0xD9, 0x76, 0x35, 0x9A, 0xEC, 0x43, 0x6A, 0xC5, 0xB3, 0x1C, 0x5F, 0xF0, 0x86, 0x29},
+    {0x00, 0xD2, 0x23, 0xF1, 0x46, 0x94, 0x65, 0xB7, 0x8C, 0x5E, 0xAF, 0x7D, 0xCA, 0x18, 0xE9, 0x3B, 0x00, 0x9F, 0xB9, 0x26, 0xF5, 0x6A, 0x4C, 0xD3, 0x6D, 0xF2, 0xD4, 0x4B, 0x98, 0x07, 0x21, 0xBE},
+    {0x00, 0xD3, 0x21, 0xF2, 0x42, 0x91, 0x63, 0xB0, 0x84, 0x57, 0xA5, 0x76, 0xC6, 0x15, 0xE7, 0x34, 0x00, 0x8F, 0x99, 0x16, 0xB5, 0x3A, 0x2C, 0xA3, 0xED, 0x62, 0x74, 0xFB, 0x58, 0xD7, 0xC1, 0x4E},
+    {0x00, 0xD4, 0x2F, 0xFB, 0x5E, 0x8A, 0x71, 0xA5, 0xBC, 0x68, 0x93, 0x47, 0xE2, 0x36, 0xCD, 0x19, 0x00, 0xFF, 0x79, 0x86, 0xF2, 0x0D, 0x8B, 0x74, 0x63, 0x9C, 0x1A, 0xE5, 0x91, 0x6E, 0xE8, 0x17},
+    {0x00, 0xD5, 0x2D, 0xF8, 0x5A, 0x8F, 0x77, 0xA2, 0xB4, 0x61, 0x99, 0x4C, 0xEE, 0x3B, 0xC3, 0x16, 0x00, 0xEF, 0x59, 0xB6, 0xB2, 0x5D, 0xEB, 0x04, 0xE3, 0x0C, 0xBA, 0x55, 0x51, 0xBE, 0x08, 0xE7},
+    {0x00, 0xD6, 0x2B, 0xFD, 0x56, 0x80, 0x7D, 0xAB, 0xAC, 0x7A, 0x87, 0x51, 0xFA, 0x2C, 0xD1, 0x07, 0x00, 0xDF, 0x39, 0xE6, 0x72, 0xAD, 0x4B, 0x94, 0xE4, 0x3B, 0xDD, 0x02, 0x96, 0x49, 0xAF, 0x70},
+    {0x00, 0xD7, 0x29, 0xFE, 0x52, 0x85, 0x7B, 0xAC, 0xA4, 0x73, 0x8D, 0x5A, 0xF6, 0x21, 0xDF, 0x08, 0x00, 0xCF, 0x19, 0xD6, 0x32, 0xFD, 0x2B, 0xE4, 0x64, 0xAB, 0x7D, 0xB2, 0x56, 0x99, 0x4F, 0x80},
+    {0x00, 0xD8, 0x37, 0xEF, 0x6E, 0xB6, 0x59, 0x81, 0xDC, 0x04, 0xEB, 0x33, 0xB2, 0x6A, 0x85, 0x5D, 0x00, 0x3F, 0x7E, 0x41, 0xFC, 0xC3, 0x82, 0xBD, 0x7F, 0x40, 0x01, 0x3E, 0x83, 0xBC, 0xFD, 0xC2},
+    {0x00, 0xD9, 0x35, 0xEC, 0x6A, 0xB3, 0x5F, 0x86, 0xD4, 0x0D, 0xE1, 0x38, 0xBE, 0x67, 0x8B, 0x52, 0x00, 0x2F, 0x5E, 0x71, 0xBC, 0x93, 0xE2, 0xCD, 0xFF, 0xD0, 0xA1, 0x8E, 0x43, 0x6C, 0x1D, 0x32},
+    {0x00, 0xDA, 0x33, 0xE9, 0x66, 0xBC, 0x55, 0x8F, 0xCC, 0x16, 0xFF, 0x25, 0xAA, 0x70, 0x99, 0x43, 0x00, 0x1F, 0x3E, 0x21, 0x7C, 0x63, 0x42, 0x5D, 0xF8, 0xE7, 0xC6, 0xD9, 0x84, 0x9B, 0xBA, 0xA5},
+    {0x00, 0xDB, 0x31, 0xEA, 0x62, 0xB9, 0x53, 0x88, 0xC4, 0x1F, 0xF5, 0x2E, 0xA6, 0x7D, 0x97, 0x4C, 0x00, 0x0F, 0x1E, 0x11, 0x3C, 0x33, 0x22, 0x2D, 0x78, 0x77, 0x66, 0x69, 0x44, 0x4B, 0x5A, 0x55},
+    {0x00, 0xDC, 0x3F, 0xE3, 0x7E, 0xA2, 0x41, 0x9D, 0xFC, 0x20, 0xC3, 0x1F, 0x82, 0x5E, 0xBD, 0x61, 0x00, 0x7F, 0xFE, 0x81, 0x7B, 0x04, 0x85, 0xFA, 0xF6, 0x89, 0x08, 0x77, 0x8D, 0xF2, 0x73, 0x0C},
+    {0x00, 0xDD, 0x3D, 0xE0, 0x7A, 0xA7, 0x47, 0x9A, 0xF4, 0x29, 0xC9, 0x14, 0x8E, 0x53, 0xB3, 0x6E, 0x00, 0x6F, 0xDE, 0xB1, 0x3B, 0x54, 0xE5, 0x8A, 0x76, 0x19, 0xA8, 0xC7, 0x4D, 0x22, 0x93, 0xFC},
+    {0x00, 0xDE, 0x3B, 0xE5, 0x76, 0xA8, 0x4D, 0x93, 0xEC, 0x32, 0xD7, 0x09, 0x9A, 0x44, 0xA1, 0x7F, 0x00, 0x5F, 0xBE, 0xE1, 0xFB, 0xA4, 0x45, 0x1A, 0x71, 0x2E, 0xCF, 0x90, 0x8A, 0xD5, 0x34, 0x6B},
+    {0x00, 0xDF, 0x39, 0xE6, 0x72, 0xAD, 0x4B, 0x94, 0xE4, 0x3B, 0xDD, 0x02, 0x96, 0x49, 0xAF, 0x70, 0x00, 0x4F, 0x9E, 0xD1, 0xBB, 0xF4, 0x25, 0x6A, 0xF1, 0xBE, 0x6F, 0x20, 0x4A, 0x05, 0xD4, 0x9B},
+    {0x00, 0xE0, 0x47, 0xA7, 0x8E, 0x6E, 0xC9, 0x29, 0x9B, 0x7B, 0xDC, 0x3C, 0x15, 0xF5, 0x52, 0xB2, 0x00, 0xB1, 0xE5, 0x54, 0x4D, 0xFC, 0xA8, 0x19, 0x9A, 0x2B, 0x7F, 0xCE, 0xD7, 0x66, 0x32, 0x83},
+    {0x00, 0xE1, 0x45, 0xA4, 0x8A, 0x6B, 0xCF, 0x2E, 0x93, 0x72, 0xD6, 0x37, 0x19, 0xF8, 0x5C, 0xBD, 0x00, 0xA1, 0xC5, 0x64, 0x0D, 0xAC, 0xC8, 0x69, 0x1A, 0xBB, 0xDF, 0x7E, 0x17, 0xB6, 0xD2, 0x73},
+    {0x00, 0xE2, 0x43, 0xA1, 0x86, 0x64, 0xC5, 0x27, 0x8B, 0x69, 0xC8, 0x2A, 0x0D, 0xEF, 0x4E, 0xAC, 0x00, 0x91, 0xA5, 0x34, 0xCD, 0x5C, 0x68, 0xF9, 0x1D, 0x8C, 0xB8, 0x29, 0xD0, 0x41, 0x75, 0xE4},
+    {0x00, 0xE3, 0x41, 0xA2, 0x82, 0x61, 0xC3, 0x20, 0x83, 0x60, 0xC2, 0x21, 0x01, 0xE2, 0x40, 0xA3, 0x00, 0x81, 0x85, 0x04, 0x8D, 0x0C, 0x08, 0x89, 0x9D, 0x1C, 0x18, 0x99, 0x10, 0x91, 0x95, 0x14},
+    {0x00, 0xE4, 0x4F, 0xAB, 0x9E, 0x7A, 0xD1, 0x35, 0xBB, 0x5F, 0xF4, 0x10, 0x25, 0xC1, 0x6A, 0x8E, 0x00, 0xF1, 0x65, 0x94, 0xCA, 0x3B, 0xAF, 0x5E, 0x13, 0xE2, 0x76, 0x87, 0xD9, 0x28, 0xBC, 0x4D},
+    {0x00, 0xE5, 0x4D, 0xA8, 0x9A, 0x7F, 0xD7, 0x32, 0xB3, 0x56, 0xFE, 0x1B, 0x29, 0xCC, 0x64, 0x81, 0x00, 0xE1, 0x45, 0xA4, 0x8A, 0x6B, 0xCF, 0x2E, 0x93, 0x72, 0xD6, 0x37, 0x19, 0xF8, 0x5C, 0xBD},
+    {0x00, 0xE6, 0x4B, 0xAD, 0x96, 0x70, 0xDD, 0x3B, 0xAB, 0x4D, 0xE0, 0x06, 0x3D, 0xDB, 0x76, 0x90, 0x00, 0xD1, 0x25, 0xF4, 0x4A, 0x9B, 0x6F, 0xBE, 0x94, 0x45, 0xB1, 0x60, 0xDE, 0x0F, 0xFB, 0x2A},
+    {0x00, 0xE7, 0x49, 0xAE, 0x92, 0x75, 0xDB, 0x3C, 0xA3, 0x44, 0xEA, 0x0D, 0x31, 0xD6, 0x78, 0x9F, 0x00, 0xC1, 0x05, 0xC4, 0x0A, 0xCB, 0x0F, 0xCE, 0x14, 0xD5, 0x11, 0xD0, 0x1E, 0xDF, 0x1B, 0xDA},
+    {0x00, 0xE8, 0x57, 0xBF, 0xAE, 0x46, 0xF9, 0x11, 0xDB, 0x33, 0x8C, 0x64, 0x75, 0x9D, 0x22, 0xCA, 0x00, 0x31, 0x62, 0x53, 0xC4, 0xF5, 0xA6, 0x97, 0x0F, 0x3E, 0x6D, 0x5C, 0xCB, 0xFA, 0xA9, 0x98},
+    {0x00, 0xE9, 0x55, 0xBC, 0xAA, 0x43, 0xFF, 0x16, 0xD3, 0x3A, 0x86, 0x6F, 0x79, 0x90, 0x2C, 0xC5, 0x00, 0x21, 0x42, 0x63, 0x84, 0xA5, 0xC6, 0xE7, 0x8F, 0xAE, 0xCD, 0xEC, 0x0B, 0x2A, 0x49, 0x68},
+    {0x00, 0xEA, 0x53, 0xB9, 0xA6, 0x4C, 0xF5, 0x1F, 0xCB, 0x21, 0x98, 0x72, 0x6D, 0x87, 0x3E, 0xD4, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
+    {0x00, 0xEB, 0x51, 0xBA, 0xA2, 0x49, 0xF3, 0x18, 0xC3, 0x28, 0x92, 0x79, 0x61, 0x8A, 0x30, 0xDB, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F},
+    {0x00, 0xEC, 0x5F, 0xB3, 0xBE, 0x52, 0xE1, 0x0D, 0xFB, 0x17, 0xA4, 0x48, 0x45, 0xA9, 0x1A, 0xF6, 0x00, 0x71, 0xE2, 0x93, 0x43, 0x32, 0xA1, 0xD0, 0x86, 0xF7, 0x64, 0x15, 0xC5, 0xB4, 0x27, 0x56},
+    {0x00, 0xED, 0x5D, 0xB0, 0xBA, 0x57, 0xE7, 0x0A, 0xF3, 0x1E, 0xAE, 0x43, 0x49, 0xA4, 0x14, 0xF9, 0x00, 0x61, 0xC2, 0xA3, 0x03, 0x62, 0xC1, 0xA0, 0x06, 0x67, 0xC4, 0xA5, 0x05, 0x64, 0xC7, 0xA6},
+    {0x00, 0xEE, 0x5B, 0xB5, 0xB6, 0x58, 0xED, 0x03, 0xEB, 0x05, 0xB0, 0x5E, 0x5D, 0xB3, 0x06, 0xE8, 0x00, 0x51, 0xA2, 0xF3, 0xC3, 0x92, 0x61, 0x30, 0x01, 0x50, 0xA3, 0xF2, 0xC2, 0x93, 0x60, 0x31},
+    {0x00, 0xEF, 0x59, 0xB6, 0xB2, 0x5D, 0xEB, 0x04, 0xE3, 0x0C, 0xBA, 0x55, 0x51, 0xBE, 0x08, 0xE7, 0x00, 0x41, 0x82, 0xC3, 0x83, 0xC2, 0x01, 0x40, 0x81, 0xC0, 0x03, 0x42, 0x02, 0x43, 0x80, 0xC1},
+    {0x00, 0xF0, 0x67, 0x97, 0xCE, 0x3E, 0xA9, 0x59, 0x1B, 0xEB, 0x7C, 0x8C, 0xD5, 0x25, 0xB2, 0x42, 0x00, 0x36, 0x6C, 0x5A, 0xD8, 0xEE, 0xB4, 0x82, 0x37, 0x01, 0x5B, 0x6D, 0xEF, 0xD9, 0x83, 0xB5},
+    {0x00, 0xF1, 0x65, 0x94, 0xCA, 0x3B, 0xAF, 0x5E, 0x13, 0xE2, 0x76, 0x87, 0xD9, 0x28, 0xBC, 0x4D, 0x00, 0x26, 0x4C, 0x6A, 0x98, 0xBE, 0xD4, 0xF2, 0xB7, 0x91, 0xFB, 0xDD, 0x2F, 0x09, 0x63, 0x45},
+    {0x00, 0xF2, 0x63, 0x91, 0xC6, 0x34, 0xA5, 0x57, 0x0B, 0xF9, 0x68, 0x9A, 0xCD, 0x3F, 0xAE, 0x5C, 0x00, 0x16, 0x2C, 0x3A, 0x58, 0x4E, 0x74, 0x62, 0xB0, 0xA6, 0x9C, 0x8A, 0xE8, 0xFE, 0xC4, 0xD2},
+    {0x00, 0xF3, 0x61, 0x92, 0xC2, 0x31, 0xA3, 0x50, 0x03, 0xF0, 0x62, 0x91, 0xC1, 0x32, 0xA0, 0x53, 0x00, 0x06, 0x0C, 0x0A, 0x18, 0x1E, 0x14, 0x12, 0x30, 0x36, 0x3C, 0x3A, 0x28, 0x2E, 0x24, 0x22},
+    {0x00, 0xF4, 0x6F, 0x9B, 0xDE, 0x2A, 0xB1, 0x45, 0x3B, 0xCF, 0x54, 0xA0, 0xE5, 0x11, 0x8A, 0x7E, 0x00, 0x76, 0xEC, 0x9A, 0x5F, 0x29, 0xB3, 0xC5, 0xBE, 0xC8, 0x52, 0x24, 0xE1, 0x97, 0x0D, 0x7B},
+    {0x00, 0xF5, 0x6D, 0x98, 0xDA, 0x2F, 0xB7, 0x42, 0x33, 0xC6, 0x5E, 0xAB, 0xE9, 0x1C, 0x84, 0x71, 0x00, 0x66, 0xCC, 0xAA, 0x1F, 0x79, 0xD3, 0xB5, 0x3E, 0x58, 0xF2, 0x94, 0x21, 0x47, 0xED, 0x8B},
+    {0x00, 0xF6, 0x6B, 0x9D, 0xD6, 0x20, 0xBD, 0x4B, 0x2B, 0xDD, 0x40, 0xB6, 0xFD, 0x0B, 0x96, 0x60, 0x00, 0x56, 0xAC, 0xFA, 0xDF, 0x89, 0x73, 0x25, 0x39, 0x6F, 0x95, 0xC3, 0xE6, 0xB0, 0x4A, 0x1C},
+    {0x00, 0xF7, 0x69, 0x9E, 0xD2, 0x25, 0xBB, 0x4C, 0x23, 0xD4, 0x4A, 0xBD, 0xF1, 0x06, 0x98, 0x6F, 0x00, 0x46, 0x8C, 0xCA, 0x9F, 0xD9, 0x13, 0x55, 0xB9, 0xFF, 0x35, 0x73, 0x26, 0x60, 0xAA, 0xEC},
+    {0x00, 0xF8, 0x77, 0x8F, 0xEE, 0x16, 0x99, 0x61, 0x5B, 0xA3, 0x2C, 0xD4, 0xB5, 0x4D, 0xC2, 0x3A, 0x00, 0xB6, 0xEB, 0x5D, 0x51, 0xE7, 0xBA, 0x0C, 0xA2, 0x14, 0x49, 0xFF, 0xF3, 0x45, 0x18, 0xAE},
+    {0x00, 0xF9, 0x75, 0x8C, 0xEA, 0x13, 0x9F, 0x66, 0x53, 0xAA, 0x26, 0xDF, 0xB9, 0x40, 0xCC, 0x35, 0x00, 0xA6, 0xCB, 0x6D, 0x11, 0xB7, 0xDA, 0x7C, 0x22, 0x84, 0xE9, 0x4F, 0x33, 0x95, 0xF8, 0x5E},
+    {0x00, 0xFA, 0x73, 0x89, 0xE6, 0x1C, 0x95, 0x6F, 0x4B, 0xB1, 0x38, 0xC2, 0xAD, 0x57, 0xDE, 0x24, 0x00, 0x96, 0xAB, 0x3D, 0xD1, 0x47, 0x7A, 0xEC, 0x25, 0xB3, 0x8E, 0x18, 0xF4, 0x62, 0x5F, 0xC9},
+    {0x00, 0xFB, 0x71, 0x8A, 0xE2, 0x19, 0x93, 0x68, 0x43, 0xB8, 0x32, 0xC9, 0xA1, 0x5A, 0xD0, 0x2B, 0x00, 0x86, 0x8B, 0x0D, 0x91, 0x17, 0x1A, 0x9C, 0xA5, 0x23, 0x2E, 0xA8, 0x34, 0xB2, 0xBF, 0x39},
+    {0x00, 0xFC, 0x7F, 0x83, 0xFE, 0x02, 0x81, 0x7D, 0x7B, 0x87, 0x04, 0xF8, 0x85, 0x79, 0xFA, 0x06, 0x00, 0xF6, 0x6B, 0x9D, 0xD6, 0x20, 0xBD, 0x4B, 0x2B, 0xDD, 0x40, 0xB6, 0xFD, 0x0B, 0x96, 0x60},
+    {0x00, 0xFD, 0x7D, 0x80, 0xFA, 0x07, 0x87, 0x7A, 0x73, 0x8E, 0x0E, 0xF3, 0x89, 0x74, 0xF4, 0x09, 0x00, 0xE6, 0x4B, 0xAD, 0x96, 0x70, 0xDD, 0x3B, 0xAB, 0x4D, 0xE0, 0x06, 0x3D, 0xDB, 0x76, 0x90},
+    {0x00, 0xFE, 0x7B, 0x85, 0xF6, 0x08, 0x8D, 0x73, 0x6B, 0x95, 0x10, 0xEE, 0x9D, 0x63, 0xE6, 0x18, 0x00, 0xD6, 0x2B, 0xFD, 0x56, 0x80, 0x7D, 0xAB, 0xAC, 0x7A, 0x87, 0x51, 0xFA, 0x2C, 0xD1, 0x07},
+    {0x00, 0xFF, 0x79, 0x86, 0xF2, 0x0D, 0x8B, 0x74, 0x63, 0x9C, 0x1A, 0xE5, 0x91, 0x6E, 0xE8, 0x17, 0x00, 0xC6, 0x0B, 0xCD, 0x16, 0xD0, 0x1D, 0xDB, 0x2C, 0xEA, 0x27, 0xE1, 0x3A, 0xFC, 0x31, 0xF7},
+};
+
+static const uint8_t sdlp_rs_parity_col[223][32] = {
+    {0x01, 0x5B, 0x7F, 0x56, 0x10, 0x1E, 0x0D, 0xEB, 0x61, 0xA5, 0x08, 0x2A, 0x36, 0x56, 0xAB, 0x20, 0x71, 0x20, 0xAB, 0x56, 0x36, 0x2A, 0x08, 0xA5, 0x61, 0xEB, 0x0D, 0x1E, 0x10, 0x56, 0x7F, 0x5B},
+    {0x5B, 0x1E, 0x6C, 0x81, 0xF4, 0xBE, 0xFF, 0x71, 0x72, 0x10, 0xF4, 0x2C, 0x16, 0xC8, 0x2B, 0x68, 0x1B, 0xB2, 0x5D, 0x55, 0x6A, 0x12, 0x7B, 0x79, 0x3C, 0x1D, 0x0A, 0xA3, 0xBC, 0xEE, 0x61, 0x60},
+    {0x60, 0x99, 0xE3, 0xC7, 0x9D, 0x21, 0xD7, 0xF9, 0x59, 0xCD, 0x1E, 0x02, 0xCF, 0xBD, 0xBE, 0x13, 0x5C, 0x23, 0xC4, 0xF6, 0xB6, 0x9C, 0x1C, 0xC4, 0x51, 0x3A, 0x74, 0xDF, 0xBF, 0x17, 0x13, 0xA3},
+    {0xA3, 0x4C, 0x98, 0x63, 0xD3, 0x47, 0x8D, 0x67, 0x22, 0x77, 0xC7, 0xFD, 0xFA, 0x4F, 0x5D, 0x96, 0xDC, 0x74, 0xC3, 0x44, 0x0E, 0x55, 0x96, 0x32, 0x1F, 0xE1, 0x96, 0xAE, 0xCB, 0x3F, 0x16, 0x3F},
+    {0x3F, 0x95, 0xFD, 0x12, 0x9D, 0xD0, 0xFB, 0x55, 0xD5, 0xF1, 0x08, 0xBD, 0xFA, 0x70, 0x61, 0x26, 0xDA, 0xA7, 0x5A, 0x49, 0x43, 0x74, 0x2A, 0x45, 0x80, 0xC7, 0x5D, 0x95, 0x50, 0x41, 0x8E, 0x20},
+    {0x20, 0xFC, 0x43, 0x19, 0x9B, 0x53, 0xF7, 0xF9, 0x4D, 0x3D, 0x76, 0x5A, 0x61, 0x1E, 0xDF, 0xF4, 0xB7, 0x4F, 0x08, 0xBE, 0x95, 0x11, 0xF3, 0xC2, 0x5D, 0x82, 0xE0, 0x93, 0x1C, 0xB4, 0x97, 0x4D},
+    {0x4D, 0xC0, 0x25, 0xBC, 0x5C, 0x16, 0x4C, 0x79, 0xAD, 0x98, 0xDC, 0x87, 0xBC, 0x9E, 0x03, 0x55, 0xE5, 0x3D, 0x52, 0xF7, 0x58, 0x64, 0xF0, 0x26, 0x96, 0xD3, 0x9D, 0x6D, 0xD6, 0xE3, 0x6D, 0x77},
+    {0x77, 0x2B, 0xAC, 0xD9, 0x57, 0xB4, 0x8C, 0x53, 0xFD, 0x13, 0x2E, 0xD5, 0x88, 0x40, 0x23, 0x52, 0x3A, 0xB4, 0x80, 0xAE, 0xF8, 0x51, 0xD2, 0x4E, 0xA2, 0x89, 0x49, 0x75, 0x86, 0x2A, 0x8F, 0x0B},
+    {0x0B, 0xCB, 0x5C, 0x6F, 0x69, 0x85, 0xCB, 0xF5, 0xF6, 0xAF, 0x4B, 0x87, 0xB8, 0x4B, 0x70, 0xC4, 0x47, 0xDD, 0x84, 0x43, 0xC3, 0x51, 0x09, 0x80, 0xEB, 0xDB, 0xF6, 0x9B, 0xC5, 0x45, 0x5D, 0x33},
+    {0x33, 0x87, 0xF7, 0x30, 0x51, 0xE2, 0x65, 0x72, 0x42, 0x02, 0xB0, 0x4E, 0x6F, 0xD4, 0x0A, 0x0C, 0x4D, 0x3B, 0x9C, 0xE8, 0xAB, 0xC6, 0x4E, 0xFD, 0x37, 0x52, 0x3B, 0x7D, 0xA5, 0xA9, 0x79, 0xD1},
+    {0xD1, 0xC9, 0xEE, 0x02, 0x9F, 0x05, 0xED, 0x83, 0x4F, 0x6A, 0x96, 0xD8, 0x57, 0x9A, 0x07, 0xD3, 0x9E, 0x94, 0xE8, 0x69, 0xF1, 0xC3, 0x52, 0x66, 0xC0, 0xD1, 0x5D, 0x6F, 0xD2, 0x50, 0xC0, 0x83},
+    {0x83, 0x3E, 0x1E, 0x8A, 0x9F, 0x8B, 0x8E, 0x5F, 0x40, 0x89, 0xE7, 0x27, 0xFC, 0x33, 0xD5, 0xBA, 0x8D, 0x23, 0xDB, 0x8C, 0x4D, 0x40, 0x4E, 0x94, 0xA5, 0x72, 0x5A, 0x49, 0xF2, 0xB6, 0x87, 0x2F},
+    {0x2F, 0x17, 0xE4, 0xE6, 0xF3, 0xFB, 0xE7, 0x57, 0xE1, 0xE7, 0x76, 0xB4, 0x4E, 0x04, 0x89, 0x27, 0x7D, 0x7F, 0x99, 0x23, 0xE5, 0x1E, 0xBF, 0xE9, 0x2A, 0x7C, 0x1E, 0x3E, 0x30, 0x0A, 0x6C, 0x13},
+    {0x13, 0x60, 0xFD, 0x6C, 0x51, 0xB6, 0x3C, 0x5C, 0xF8, 0xFD, 0x7F, 0x21, 0x80, 0xC6, 0xEA, 0x60, 0x3F, 0x94, 0x91, 0x11, 0x17, 0xB2, 0x86, 0xA3, 0x46, 0x91, 0xBB, 0x5B, 0x89, 0xB8, 0xE0, 0x23},
+    {0x23, 0x3D, 0x37, 0xE3, 0xD5, 0xBD, 0x86, 0x84, 0xE7, 0x78, 0x62, 0x53, 0xA7, 0x9E, 0x13, 0x1F, 0x62, 0xCA, 0x41, 0x8F, 0x97, 0x3B, 0x2D, 0x06, 0x18, 0xFE, 0xA1, 0x57, 0xE2, 0x97, 0xEF, 0xCE},
+    {0xCE, 0x2C, 0x33, 0xAC, 0x3B, 0x4C, 0x29, 0xBA, 0x13, 0xF4, 0x14, 0x22, 0x91, 0x3C, 0xCC, 0x24, 0x50, 0x55, 0x98, 0xDA, 0x4D, 0xD7, 0x57, 0x3E, 0x91, 0x24, 0x6A, 0x38, 0x8F, 0x79, 0x99, 0xE0},
+    {0xE0, 0x0E, 0x87, 0x06, 0x1D, 0xD8, 0xB9, 0x27, 0xF2, 0x02, 0x6F, 0x2D, 0xBF, 0xA4, 0x7F, 0x29, 0xDD, 0xB5, 0x16, 0xAD, 0x47, 0x74, 0x4C, 0x46, 0x76, 0x9F, 0xD1, 0x89, 0x89, 0xBA, 0xD2, 0x59},
+    {0x59, 0x49, 0xC7, 0xD5, 0x84, 0x8F, 0x23, 0x94, 0x7C, 0x4E, 0x43, 0x1F, 0x7D, 0xED, 0x08, 0xFC, 0xF0, 0x5E, 0x19, 0x44, 0xFD, 0x37, 0x35, 0xF0, 0x1D, 0x5B, 0x64, 0x43, 0x0B, 0xDB, 0x73, 0x7B},
+    {0x7B, 0x85, 0xA8, 0xDD, 0xFE, 0xE4, 0x49, 0x5D, 0x15, 0xE5, 0x98, 0x35, 0xFF, 0x67, 0x3F, 0x5E, 0x56, 0xA6, 0x8C, 0x03, 0xA4, 0x8B, 0xE1, 0xAC, 0x71, 0x63, 0x9D, 0x04, 0x68, 0x11, 0x3A, 0xAF},
+    {0xAF, 0xED, 0x09, 0xCE, 0x09, 0xAC, 0x14, 0x98, 0x83, 0x1C, 0x8F, 0x04, 0x22, 0x99, 0xE8, 0x10, 0x54, 0x79, 0x29, 0xEA, 0x14, 0x38, 0xE1, 0xE8, 0x72, 0xA0, 0x93, 0xCF, 0xD0, 0x0E, 0x9D, 0xAC},
+    {0xAC, 0xD4, 0xE0, 0x95, 0x2A, 0x79, 0x4B, 0x7F, 0xE5, 0xE2, 0x6E, 0x6D, 0x49, 0xBE, 0x6C, 0xA7, 0x89, 0x1B, 0x8C, 0xB5, 0xA7, 0xF6, 0x4A, 0x80, 0x95, 0x19, 0x47, 0xE3, 0x2B, 0x4C, 0x03, 0xE6},
+    {0xE6, 0x31, 0xFA, 0xA6, 0x44, 0x8D, 0xA2, 0xB6, 0xF6, 0x24, 0x49, 0xAB, 0x44, 0x0F, 0x09, 0x49, 0xFF, 0xAC, 0xAC, 0xCA, 0x9C, 0x62, 0x5D, 0x8B, 0x09, 0x68, 0xC2, 0xE0, 0x32, 0x6D, 0x62, 0x9E},
+    {0x9E, 0x4A, 0x7F, 0x5C, 0x6C, 0xA1, 0x87, 0x9B, 0x1D, 0xC6, 0x41, 0x84, 0x38, 0xE2, 0x10, 0x1A, 0x28, 0xEC, 0xB3, 0x0A, 0x59, 0x51, 0x07, 0x6D, 0x20, 0x30, 0x62, 0x27, 0x2A, 0x94, 0x23, 0xCE},
+    {0xCE, 0x91, 0x44, 0xE4, 0x84, 0xF5, 0x35, 0xBB, 0x0C, 0x0E, 0xAA, 0x01, 0x46, 0xA3, 0xB0, 0x27, 0x55, 0x1F, 0xBE, 0x28, 0xC8, 0x19, 0x3D, 0x14, 0xFA, 0x1C, 0xA4, 0xFB, 0xFF, 0xB1, 0x9A, 0x2C},
+    {0x2C, 0xB7, 0xCA, 0x46, 0xAD, 0xC2, 0x8E, 0x56, 0xA6, 0xC3, 0xE9, 0x87, 0x32, 0x44, 0x63, 0x22, 0x73, 0xC7, 0xDF, 0xBC, 0x1B, 0xE5, 0xFE, 0xF2, 0x09, 0x99, 0x67, 0xE2, 0xB2, 0xFD, 0xEA, 0xE3},
+    {0xE3, 0x01, 0x9D, 0x05, 0xC7, 0x6C, 0x20, 0x3A, 0xBD, 0xDF, 0x40, 0xAE, 0x40, 0xFD, 0x7D, 0xE6, 0x48, 0xF6, 0xFE, 0x10, 0x7B, 0x5C, 0x66, 0x87, 0x19, 0xBD, 0x7B, 0xA6, 0x63, 0x7D, 0xD7, 0xC7},
+    {0xC7, 0xE6, 0x86, 0x69, 0x4D, 0xB0, 0x9D, 0x34, 0xCA, 0x31, 0xFB, 0xFD, 0x6D, 0xB4, 0x4E, 0xED, 0x5E, 0xD8, 0x45, 0x0A, 0xD3, 0xC6, 0x78, 0xEA, 0x77, 0x0D, 0x4C, 0x0C, 0xEE, 0x97, 0xFA, 0xD2},
+    {0xD2, 0xD0, 0x0E, 0x89, 0xF6, 0x3B, 0xA8, 0xC1, 0xAA, 0x8A, 0xBD, 0xED, 0xBE, 0x62, 0x1D, 0xF7, 0xEC, 0xE7, 0x71, 0x4A, 0x49, 0xC5, 0x4A, 0x38, 0x74, 0x2B, 0x15, 0x3A, 0x93, 0xE1, 0x7F, 0xED},
+    {0xED, 0xF3, 0x89, 0x8B, 0xE8, 0x83, 0x9F, 0x2C, 0xED, 0x39, 0x79, 0xD1, 0xA9, 0x3B, 0xE5, 0xDF, 0xBA, 0x2E, 0x60, 0xF4, 0x0E, 0x25, 0x36, 0xD9, 0x14, 0xF0, 0x8F, 0x60, 0x5B, 0x16, 0xB8, 0x5E},
+    {0x5E, 0x42, 0xC0, 0xFE, 0x79, 0x20, 0x5B, 0xAA, 0xD7, 0x24, 0x40, 0xDF, 0x03, 0xDE, 0xC8, 0x86, 0xD6, 0xD9, 0xDD, 0x17, 0x26, 0xA8, 0x5C, 0xFF, 0x22, 0x21, 0x28, 0x47, 0x92, 0x2C, 0x25, 0x17},
+    {0x17, 0xFA, 0xD3, 0x97, 0x09, 0x44, 0xD3, 0x42, 0x06, 0xD6, 0x9C, 0xBF, 0x33, 0x54, 0x15, 0xA1, 0xDD, 0xBF, 0x12, 0x8A, 0xFB, 0xD9, 0x10, 0x5D, 0x53, 0x3B, 0xD2, 0x15, 0xB0, 0xC5, 0xBD, 0x81},
+    {0x81, 0x4E, 0xD3, 0x1B, 0x2A, 0x21, 0xD5, 0x30, 0x43, 0x0D, 0x4B, 0x79, 0xF7, 0xFB, 0xCA, 0xE8, 0x1D, 0x20, 0x21, 0xDA, 0xC2, 0x1E, 0x44, 0x1B, 0x5C, 0xB0, 0xAA, 0xFA, 0xA8, 0x78, 0xEC, 0xE4},
+    {0xE4, 0xAA, 0x9E, 0x39, 0xEA, 0xB1, 0xE0, 0x79, 0x7B, 0x4F, 0xB6, 0xDA, 0x3C, 0x1D, 0x9D, 0xAF, 0x52, 0x78, 0x46, 0xCB, 0x9F, 0x53, 0xA5, 0x48, 0x50, 0xF0, 0x71, 0x31, 0x0B, 0x42, 0xA8, 0xC7},
+    {0xC7, 0xE1, 0x2D, 0x6A, 0x71, 0x9D, 0x40, 0xF4, 0x89, 0xF7, 0x6B, 0x0B, 0x19, 0xC8, 0xAE, 0x0D, 0x17, 0xC2, 0xCB, 0xB2, 0x08, 0x22, 0x77, 0x29, 0xB8, 0x44, 0x01, 0x06, 0x79, 0xFF, 0xC5, 0xAD},
+    {0xAD, 0xE7, 0x93, 0xE7, 0x9E, 0x1F, 0x77, 0xC0, 0xE8, 0x4D, 0x8D, 0xA3, 0x70, 0xD3, 0x96, 0xC1, 0xE5, 0x78, 0x9C, 0x01, 0xC9, 0xC0, 0x58, 0xB3, 0x35, 0x38, 0xAE, 0x6F, 0xF2, 0xB3, 0x8D, 0xE5},
+    {0xE5, 0xDD, 0x48, 0x2F, 0x06, 0x1B, 0xD3, 0x30, 0xEA, 0x41, 0xFE, 0x36, 0xD0, 0xCC, 0x1E, 0xD3, 0x0A, 0xA0, 0xB5, 0x20, 0x72, 0x72, 0x73, 0xF1, 0x99, 0x72, 0xF4, 0x2B, 0x8E, 0x4E, 0x1C, 0xFD},
+    {0xFD, 0x66, 0xEF, 0xBF, 0xC9, 0x14, 0x6F, 0x56, 0x10, 0x0D, 0x32, 0xBB, 0x1C, 0x27, 0xDF, 0x55, 0x15, 0x41, 0xB3, 0x42, 0x0A, 0x37, 0x01, 0x94, 0xD1, 0x1C, 0x06, 0xE6, 0xCD, 0x79, 0x7C, 0x9F},
+    {0x9F, 0x0A, 0x57, 0x1F, 0x65, 0x32, 0x13, 0xBD, 0x9C, 0x85, 0x60, 0xD5, 0x1E, 0xEC, 0x93, 0xEC, 0x45, 0x26, 0xF5, 0x43, 0xE7, 0xED, 0x5A, 0x94, 0x5E, 0x03, 0x1B, 0xFD, 0x3C, 0x3D, 0x48, 0x8B},
+    {0x8B, 0x21, 0x2B, 0x0A, 0x02, 0x81, 0xD1, 0x62, 0x78, 0x60, 0x48, 0x06, 0xC6, 0x43, 0xE9, 0xA9, 0x34, 0x7F, 0x23, 0xA8, 0x50, 0x81, 0x20, 0xA6, 0x51, 0x2F, 0xE0, 0xFF, 0xE0, 0x61, 0x1C, 0xF6},
+    {0xF6, 0xB4, 0x64, 0x1F, 0x5C, 0xC2, 0x8A, 0x2D, 0xE7, 0xCD, 0x4B, 0xA4, 0x41, 0xF2, 0x60, 0x45, 0x7A, 0x98, 0x5C, 0x17, 0xEF, 0xBC, 0xAA, 0x95, 0x23, 0xAD, 0x24, 0x20, 0xA9, 0xD4, 0x24, 0x23},
+    {0x23, 0xD8, 0xE3, 0x7A, 0xA6, 0xB0, 0xF2, 0x32, 0x96, 0x67, 0x52, 0x67, 0x22, 0x5F, 0x27, 0x95, 0x47, 0x8F, 0x4D, 0x42, 0x91, 0xC3, 0x23, 0x2A, 0x2E, 0x9B, 0x9D, 0xC8, 0x99, 0xB7, 0x83, 0x0A},
+    {0x0A, 0xC4, 0xD0, 0x76, 0xDA, 0x6A, 0xC2, 0x60, 0xF6, 0x61, 0x37, 0xD1, 0x3C, 0xB7, 0xC4, 0xE0, 0xF1, 0x80, 0x14, 0xD8, 0x19, 0x12, 0x93, 0xD4, 0xEE, 0xBC, 0xE9, 0x51, 0x68, 0x0C, 0xBF, 0x64},
+    {0x64, 0x23, 0x42, 0xA4, 0x2A, 0x77, 0x37, 0x66, 0x4B, 0x54, 0x4F, 0x69, 0xEA, 0x48, 0xE4, 0x7C, 0x97, 0x49, 0xD3, 0x60, 0xE3, 0x47, 0x3C, 0x31, 0xFF, 0x4A, 0xE1, 0x44, 0x0D, 0x1C, 0x8A, 0x96},
+    {0x96, 0x99, 0x9B, 0xDD, 0xEE, 0x3F, 0x15, 0xCD, 0xCB, 0x41, 0x71, 0x55, 0xCD, 0x75, 0x1D, 0x70, 0x9B, 0x03, 0x1C, 0x4C, 0xC4, 0xF9, 0x62, 0x36, 0x9C, 0x05, 0x28, 0xF4, 0x0E, 0x92, 0xA4, 0x77},
+    {0x77, 0xF0, 0xF5, 0x67, 0x36, 0x06, 0xA5, 0x0A, 0x49, 0x75, 0xF7, 0x78, 0x5A, 0x31, 0xC8, 0x4C, 0x1F, 0xCA, 0xBE, 0xE0, 0x43, 0xCD, 0x4F, 0xDC, 0xB2, 0x83, 0x9F, 0xC0, 0x1F, 0xF2, 0xFE, 0xC2},
+    {0xC2, 0xC2, 0x73, 0x88, 0x7F, 0x27, 0xCE, 0xF8, 0x98, 0x7D, 0x79, 0xC8, 0x55, 0x27, 0x0C, 0xF8, 0xC6, 0x2F, 0xF7, 0xC3, 0xCD, 0x7C, 0xC1, 0x7B, 0x4E, 0xEF, 0x4B, 0x8E, 0xD8, 0x62, 0x71, 0x4B},
+    {0x4B, 0x7F, 0x9E, 0xFF, 0xAD, 0xB6, 0x16, 0xB3, 0x6D, 0x9D, 0xAC, 0x74, 0x9A, 0xD9, 0xCE, 0x46, 0x48, 0x8C, 0xC6, 0x7B, 0x91, 0xC0, 0xAD, 0xC4, 0xEE, 0x33, 0xDE, 0x82, 0xAB, 0x54, 0x3E, 0xCC},
+    {0xCC, 0xF2, 0x8F, 0xA9, 0x07, 0x08, 0x38, 0x7B, 0xE6, 0xB3, 0xE1, 0xB8, 0xDA, 0xAD, 0x5A, 0xB9, 0xEB, 0x3F, 0x0F, 0xF1, 0xD5, 0x85, 0xBC, 0x73, 0x91, 0x83, 0xBD, 0x7B, 0x7A, 0x9C, 0xA4, 0x87},
+    {0x87, 0xC8, 0x5E, 0x34, 0x74, 0x6B, 0xB7, 0x28, 0xBB, 0x3D, 0x1E, 0xF8, 0x44, 0x61, 0xC7, 0x67, 0xA4, 0xD6, 0x55, 0xB4, 0x0D, 0xCC, 0x28, 0x67, 0xB3, 0x81, 0x3C, 0xD1, 0xA6, 0xC1, 0x30, 0xA0},
+    {0xA0, 0x46, 0x48, 0x24, 0x10, 0x8C, 0xD0, 0xBD, 0x50, 0xFD, 0x2F, 0x83, 0x5A, 0x3E, 0xFB, 0x8F, 0x3B, 0xEC, 0x4C, 0x2F, 0x16, 0x90, 0xDE, 0x6E, 0x1F, 0xB9, 0x3A, 0xC4, 0xF5, 0xDC, 0x41, 0xF1},
+    {0xF1, 0x99, 0xF9, 0x59, 0x02, 0x8A, 0xA4, 0x34, 0x98, 0x90, 0xEE, 0x15, 0x46, 0x4B, 0x42, 0xB7, 0x8C, 0x77, 0x90, 0x5D, 0xEA, 0x2C, 0x83, 0x1E, 0x4B, 0xFB, 0x91, 0xA0, 0xE2, 0xE4, 0x63, 0x78},
+    {0x78, 0xC0, 0xF9, 0x19, 0x42, 0x40, 0x5B, 0x60, 0x16, 0x69, 0x5E, 0xE6, 0xAF, 0xA6, 0xE3, 0x74, 0x8E, 0xBA, 0xDF, 0x70, 0xE7, 0xE2, 0xE2, 0x72, 0x3C, 0x8F, 0x2A, 0xD3, 0xBB, 0x02, 0x84, 0x52},
+    {0x52, 0x6D, 0x7E, 0x68, 0x2B, 0x02, 0xC4, 0x0F, 0x9E, 0xF8, 0x70, 0x87, 0xDB, 0x3E, 0x3A, 0x87, 0xB8, 0xEA, 0x26, 0x4E, 0x4D, 0x3E, 0xFB, 0x0C, 0x8C, 0x68, 0x0B, 0x6A, 0xE1, 0x2A, 0xBC, 0x91},
+    {0x91, 0xA9, 0x2F, 0xC4, 0x52, 0x64, 0x43, 0x26, 0x02, 0xE1, 0xE5, 0xBC, 0xA1, 0x61, 0x34, 0x4E, 0xB0, 0xCC, 0xE0, 0x9C, 0x68, 0x81, 0x23, 0x84, 0x01, 0x6E, 0x29, 0x44, 0x50, 0x5B, 0x68, 0x47},
+    {0x47, 0x96, 0x78, 0x45, 0x21, 0x13, 0x09, 0x5F, 0xB6, 0x20, 0x50, 0x97, 0x01, 0xCB, 0xE7, 0x79, 0x3B, 0xFD, 0x4A, 0x8A, 0x21, 0x1A, 0x30, 0x01, 0x14, 0x1D, 0x03, 0x68, 0xA1, 0x3A, 0x8A, 0x6F},
+    {0x6F, 0xD2, 0x67, 0xCF, 0xA9, 0x5E, 0x31, 0xD4, 0xD1, 0x46, 0x56, 0xA7, 0xC1, 0xB6, 0xA8, 0xB8, 0x1B, 0x64, 0x9E, 0xFD, 0xDC, 0xD6, 0x6C, 0xC0, 0x8F, 0xC9, 0x3F, 0x7C, 0x84, 0x16, 0xCB, 0x1F},
+    {0x1F, 0x9A, 0xB5, 0x09, 0xB8, 0x64, 0xC5, 0xEB, 0x7E, 0xEA, 0xBE, 0x7E, 0x7C, 0xAF, 0x37, 0x46, 0x65, 0xF5, 0xE5, 0xF0, 0x26, 0xF4, 0x2E, 0x57, 0x6A, 0x55, 0x52, 0xF2, 0x0B, 0xEA, 0x71, 0x3E},
+    {0x3E, 0x72, 0x54, 0x69, 0xE7, 0xA5, 0xD5, 0xF6, 0x38, 0x08, 0x9D, 0xEE, 0x4F, 0xA0, 0x2A, 0x6C, 0x7B, 0x3E, 0x70, 0x39, 0xC1, 0x76, 0x83, 0x58, 0x84, 0x59, 0xE4, 0x4F, 0x1C, 0xD7, 0x24, 0x1C},
+    {0x1C, 0x26, 0x94, 0xC0, 0x2E, 0x08, 0x29, 0xB5, 0xFF, 0x6B, 0xE8, 0xCB, 0x6F, 0xDB, 0x5B, 0xA4, 0x22, 0xF5, 0xC5, 0xE4, 0xB8, 0x97, 0x96, 0xD0, 0x51, 0xE4, 0xD5, 0x0B, 0x08, 0x88, 0x31, 0x3C},
+    {0x3C, 0xC7, 0x16, 0xE4, 0x0E, 0x0F, 0xA3, 0x4B, 0xA4, 0x44, 0x0C, 0xEC, 0x96, 0x1F, 0x8F, 0x40, 0x7B, 0x39, 0xA1, 0xB5, 0xB9, 0xBC, 0xF0, 0x2D, 0xC1, 0x33, 0x4F, 0xF4, 0xC5, 0x78, 0xB8, 0xEA},
+    {0xEA, 0x1B, 0x64, 0xB6, 0xF5, 0x21, 0x88, 0x3F, 0xC7, 0x42, 0x8F, 0xB6, 0x2A, 0x36, 0xC7, 0xAD, 0xDD, 0x59, 0xE1, 0x01, 0x73, 0x03, 0x77, 0x16, 0xA1, 0x5D, 0xB4, 0x60, 0xE5, 0x65, 0xDB, 0x9F},
+    {0x9F, 0x1D, 0x2A, 0x94, 0x6C, 0x0E, 0x26, 0x5A, 0xF5, 0x52, 0x2F, 0x68, 0x13, 0xDA, 0x82, 0xF4, 0xBD, 0xEE, 0xED, 0x11, 0xA4, 0x94, 0x6E, 0xE2, 0xDC, 0x73, 0x5A, 0x4F, 0xBA, 0x15, 0x54, 0x2C},
+    {0x2C, 0xE6, 0x46, 0x28, 0xDD, 0x2A, 0x75, 0x45, 0x47, 0x3A, 0xB5, 0x02, 0x5B, 0x11, 0x1A, 0x10, 0xA0, 0x2F, 0x2E, 0xEF, 0x22, 0x89, 0x73, 0xA1, 0xFF, 0xBF, 0x08, 0x1C, 0x06, 0xB8, 0x4E, 0x2D},
+    {0x2D, 0x0E, 0xC2, 0x12, 0x71, 0x85, 0x5C, 0xFD, 0x39, 0x2D, 0xD5, 0xB2, 0x07, 0x0F, 0x7A, 0xA8, 0x35, 0x12, 0x44, 0x7A, 0xEA, 0x25, 0x66, 0x19, 0xDD, 0x77, 0xC9, 0x50, 0x45, 0x52, 0x9C, 0x6C},
+    {0x6C, 0x55, 0x7E, 0x8F, 0xCE, 0x2C, 0xB0, 0x3B, 0xD0, 0xA1, 0x43, 0x5C, 0xBE, 0x4A, 0x16, 0x45, 0x59, 0x0A, 0x0B, 0x09, 0x76, 0x63, 0x4B, 0xFE, 0x34, 0xBA, 0x42, 0x94, 0x8C, 0x08, 0x22, 0xE4},
+    {0xE4, 0x47, 0x85, 0x94, 0x7E, 0x55, 0xED, 0x1C, 0x70, 0xDC, 0x1A, 0xD2, 0x19, 0x54, 0x2C, 0x73, 0xFF, 0x3C, 0x6C, 0xE1, 0x4C, 0xE7, 0xD8, 0x47, 0xB5, 0x98, 0x7B, 0xD9, 0x65, 0x66, 0xD8, 0x09},
+    {0x09, 0xEE, 0xCE, 0xEA, 0x04, 0x90, 0x30, 0xC5, 0x7B, 0xEF, 0x94, 0xE7, 0xD3, 0x76, 0xB5, 0x8B, 0x84, 0x58, 0xDD, 0x03, 0xE0, 0xB1, 0xAF, 0x47, 0x20, 0x9D, 0xFD, 0x95, 0x49, 0x0A, 0xEF, 0xD2},
+    {0xD2, 0x1E, 0x06, 0xC1, 0x75, 0x72, 0x88, 0x6C, 0x5B, 0x3B, 0x63, 0x82, 0xA4, 0xDC, 0xDF, 0x0C, 0x8A, 0x3D, 0xF1, 0xD2, 0x40, 0xF6, 0x3D, 0xEF, 0xD9, 0x7C, 0x85, 0x8B, 0x0A, 0x46, 0xE2, 0xF8},
+    {0xF8, 0xE1, 0x28, 0x78, 0x77, 0x01, 0x3F, 0x44, 0x2E, 0x04, 0x60, 0xA4, 0x46, 0xDA, 0x41, 0x34, 0xF8, 0x61, 0xA0, 0x8F, 0x16, 0x87, 0xAD, 0x62, 0xAD, 0x15, 0x31, 0xF1, 0x3D, 0x74, 0x70, 0xD1},
+    {0xD1, 0x02, 0x88, 0xDD, 0xD7, 0x23, 0x0E, 0xD9, 0x79, 0x06, 0x90, 0x08, 0xBD, 0xB3, 0x09, 0x98, 0xA6, 0x21, 0xB2, 0x55, 0x96, 0x7E, 0x13, 0x85, 0x5F, 0x4B, 0x1A, 0x65, 0x5E, 0xC8, 0x1D, 0x8A},
+    {0x8A, 0x34, 0x5C, 0x83, 0xD0, 0x2D, 0xCD, 0x94, 0x7D, 0x20, 0xC3, 0xDC, 0x2D, 0xB6, 0x1D, 0x13, 0x31, 0xBC, 0x8F, 0xB9, 0x70, 0xDA, 0xBB, 0x4A, 0x21, 0xC5, 0xA5, 0xE0, 0x68, 0x55, 0x96, 0xF8},
+    {0xF8, 0xB9, 0x02, 0x22, 0x35, 0xA4, 0x60, 0x01, 0xD6, 0x22, 0x7B, 0x04, 0x18, 0x53, 0x2B, 0xF6, 0xE7, 0xDA, 0x21, 0xF1, 0x7D, 0xB7, 0x81, 0xE4, 0x08, 0xED, 0x88, 0xD1, 0x56, 0x16, 0x63, 0xA5},
+    {0xA5, 0x89, 0x3D, 0xF1, 0x56, 0xAB, 0x26, 0x23, 0x1B, 0x28, 0x18, 0x64, 0x48, 0xEB, 0x47, 0xC3, 0x98, 0x0F, 0xCE, 0xD2, 0xBD, 0x62, 0x8D, 0x7F, 0xFE, 0x4B, 0x6F, 0x16, 0xA5, 0xA5, 0x92, 0x12},
+    {0x12, 0xB1, 0x1C, 0xE3, 0x56, 0x0D, 0x61, 0x76, 0xED, 0xA2, 0xB8, 0x65, 0x66, 0x96, 0xAE, 0x8E, 0xAA, 0x51, 0x4A, 0x10, 0xD0, 0xC0, 0xF2, 0x34, 0xB1, 0xAE, 0x81, 0x34, 0xB1, 0x7B, 0x30, 0x86},
+    {0x86, 0x4D, 0x62, 0xF1, 0x2E, 0x24, 0xBF, 0x9A, 0xD7, 0x93, 0x07, 0x8B, 0xAF, 0x8B, 0x57, 0xB3, 0xE2, 0xB7, 0x90, 0xA7, 0xDA, 0xE3, 0x65, 0x8C, 0x95, 0x4A, 0x1C, 0xF3, 0xF9, 0x5C, 0xA8, 0x6F},
+    {0x6F, 0x13, 0xBC, 0xD5, 0x1D, 0x51, 0x06, 0x62, 0x14, 0x27, 0xE5, 0xF0, 0xDD, 0x18, 0xE8, 0x08, 0xD1, 0xBD, 0xD4, 0x27, 0xF1, 0x2D, 0x95, 0x95, 0x02, 0x48, 0x68, 0x63, 0x1F, 0x4E, 0xAD, 0x3D},
+    {0x3D, 0xEF, 0x5C, 0x9A, 0x0B, 0x22, 0xF7, 0x8F, 0x12, 0x0A, 0x48, 0xCB, 0x9B, 0xFB, 0xE7, 0xD3, 0xA6, 0xEA, 0x42, 0xF2, 0x4C, 0xDF, 0x42, 0x8B, 0xE5, 0x8B, 0xEE, 0x57, 0xBD, 0x39, 0x01, 0x2D},
+    {0x2D, 0x1F, 0xCB, 0x08, 0xC3, 0x53, 0x54, 0x7F, 0xF3, 0x78, 0xE5, 0x4F, 0xCE, 0xCF, 0x90, 0x55, 0xF6, 0x14, 0x81, 0x16, 0xF7, 0x4B, 0x30, 0x28, 0xF7, 0x6D, 0xFD, 0xB6, 0x0E, 0xE9, 0x1D, 0x23},
+    {0x23, 0x03, 0x48, 0xD5, 0xB1, 0x2F, 0x63, 0xEC, 0xC4, 0x73, 0xE7, 0xC9, 0xC9, 0xD0, 0x1A, 0x65, 0x57, 0x03, 0xC1, 0x9F, 0x90, 0xDB, 0xD4, 0xB0, 0x93, 0x4F, 0x5D, 0x11, 0x0F, 0x10, 0xBE, 0x33},
+    {0x33, 0xAF, 0x3F, 0x24, 0xEB, 0x3A, 0xCF, 0xDA, 0x5B, 0x30, 0x6C, 0xE2, 0x21, 0xA5, 0x91, 0x66, 0xEC, 0x2B, 0x42, 0xAD, 0x77, 0x95, 0xC4, 0x20, 0x07, 0x2A, 0xAF, 0xD6, 0x2F, 0x63, 0x2C, 0x32},
+    {0x32, 0xE4, 0xEC, 0x05, 0x0A, 0x7E, 0xD7, 0x9D, 0x0C, 0x0A, 0x27, 0x43, 0x3C, 0x1B, 0x4F, 0xCD, 0x9E, 0xB0, 0xC1, 0x78, 0x73, 0x58, 0x82, 0x95, 0xF6, 0x55, 0xC7, 0x3A, 0xF8, 0x15, 0x20, 0xFB},
+    {0xFB, 0xEC, 0x53, 0x68, 0x83, 0x5C, 0x24, 0xA1, 0x7C, 0x3B, 0x49, 0x9E, 0xDD, 0xB8, 0xFC, 0xC4, 0xAA, 0x15, 0x57, 0x45, 0xE6, 0xCA, 0x1B, 0xB5, 0x74, 0x80, 0x0F, 0x91, 0xBC, 0x7C, 0xA2, 0xFE},
+    {0xFE, 0x95, 0x5F, 0x5E, 0xBE, 0xB3, 0x3F, 0x1B, 0x22, 0xF3, 0x50, 0x72, 0xEE, 0xD0, 0xD1, 0xD7, 0x91, 0x81, 0x7C, 0x5A, 0x35, 0xDD, 0xA1, 0x94, 0x36, 0x4B, 0xE3, 0x3F, 0x47, 0xB1, 0xCF, 0xCC},
+    {0xCC, 0x47, 0x65, 0x68, 0xA6, 0x1B, 0x3D, 0x52, 0x4E, 0xFC, 0x8F, 0x44, 0xDC, 0xD9, 0x53, 0xA6, 0x7A, 0xE6, 0x02, 0x4B, 0xF4, 0x21, 0xA1, 0x7F, 0xC1, 0x5B, 0xC5, 0x46, 0xC7, 0x70, 0x41, 0x76},
+    {0x76, 0xF1, 0x54, 0xCF, 0x93, 0x50, 0x8C, 0xC9, 0xB7, 0x55, 0x42, 0xAC, 0x7D, 0x76, 0xCF, 0x22, 0xB8, 0x0B, 0xF0, 0xA8, 0x72, 0xD7, 0x9F, 0xBA, 0x9A, 0x35, 0xCC, 0x33, 0xBD, 0x6D, 0x63, 0x7C},
+    {0x7C, 0xAC, 0xEA, 0x6B, 0x94, 0xA9, 0xB5, 0xEA, 0xE8, 0x5B, 0xBB, 0xE2, 0xCE, 0x42, 0xFB, 0x79, 0x58, 0x0E, 0x86, 0xCF, 0xCA, 0xD2, 0x39, 0x73, 0x9B, 0xFC, 0xD0, 0xF6, 0x68, 0x82, 0x76, 0xB9},
+    {0xB9, 0x15, 0xCE, 0x8D, 0x58, 0xE5, 0xA7, 0x96, 0xF9, 0x45, 0x81, 0xF2, 0x2F, 0xA9, 0xAD, 0x9D, 0x59, 0x3E, 0xE1, 0xE1, 0x02, 0x83, 0x08, 0x94, 0x60, 0xB8, 0xF2, 0xA1, 0xC5, 0x0F, 0xE0, 0x1F},
+    {0x1F, 0x4C, 0x72, 0xA0, 0xFA, 0x95, 0x7E, 0x7D, 0x3C, 0xC2, 0xBD, 0xA9, 0x29, 0x41, 0x28, 0x43, 0x40, 0xB7, 0xBF, 0x8F, 0x3A, 0x2A, 0x7B, 0x33, 0x3E, 0xBA, 0x23, 0x3F, 0xD6, 0xAB, 0x68, 0x15},
+    {0x15, 0x0D, 0x23, 0x89, 0x77, 0xFB, 0x7C, 0x36, 0x13, 0xF0, 0x6A, 0x16, 0x29, 0xD2, 0x5B, 0x01, 0xFA, 0x69, 0xAD, 0x44, 0x0F, 0x91, 0x82, 0xB7, 0x5D, 0x76, 0x53, 0x22, 0xE8, 0x2D, 0xC4, 0x7A},
+    {0x7A, 0x92, 0x93, 0x6F, 0xB2, 0x09, 0x30, 0xE9, 0xD6, 0x2F, 0x2E, 0x36, 0xC0, 0x65, 0xAB, 0x2D, 0xDA, 0x8C, 0x10, 0xE1, 0x92, 0x53, 0x4F, 0xBE, 0x57, 0xC8, 0xBD, 0x2D, 0x19, 0xA4, 0xB3, 0x43},
+    {0x43, 0x96, 0x38, 0x26, 0xCA, 0x8B, 0x50, 0x8E, 0x7A, 0xE9, 0xBE, 0xF4, 0x53, 0x75, 0xC6, 0x66, 0x1B, 0x17, 0x2F, 0xA5, 0x84, 0x48, 0xC2, 0x70, 0x2D, 0xE9, 0x91, 0x84, 0x88, 0xAC, 0x0E, 0x5F},
+    {0x5F, 0xB7, 0xDA, 0x19, 0xC4, 0x1C, 0x5E, 0x8E, 0x14, 0x16, 0x98, 0x32, 0x10, 0x72, 0x2D, 0x85, 0x1E, 0x58, 0x4F, 0x0E, 0x41, 0x08, 0x39, 0xAE, 0xEA, 0xF3, 0x3C, 0x47, 0x66, 0xA9, 0xE0, 0xFA},
+    {0xFA, 0xDA, 0x7F, 0x08, 0x8F, 0x8C, 0x4B, 0xC3, 0x0E, 0x86, 0x5D, 0x0B, 0x9A, 0xC2, 0x3E, 0x86, 0x93, 0xB5, 0x14, 0x9D, 0xA6, 0xD2, 0x43, 0xAB, 0x2E, 0x77, 0xA4, 0x74, 0xD1, 0xB4, 0x61, 0x65},
+    {0x65, 0x88, 0x23, 0x5D, 0x44, 0x3C, 0xDC, 0x04, 0x89, 0x09, 0xA0, 0x29, 0x06, 0xB8, 0x3A, 0xA6, 0x80, 0x0B, 0x4D, 0x36, 0x90, 0xD2, 0xF4, 0x44, 0xE1, 0x61, 0x27, 0x17, 0x38, 0xF3, 0x4D, 0x13},
+    {0x13, 0x2A, 0x62, 0xAB, 0xEA, 0x01, 0xFB, 0x67, 0xAB, 0x95, 0x91, 0xF7, 0x1D, 0x8E, 0x56, 0xD3, 0xBE, 0x69, 0xE5, 0xC5, 0x02, 0xC7, 0x4A, 0xE8, 0xEB, 0x5A, 0xA6, 0x62, 0xA0, 0xB0, 0x19, 0x02},
+    {0x02, 0xA5, 0xD4, 0xCE, 0x8B, 0xD6, 0x1B, 0xAA, 0xA5, 0x66, 0x85, 0xC5, 0x9B, 0xB1, 0x5F, 0x16, 0x31, 0xFE, 0xB8, 0x49, 0xA9, 0x56, 0xD7, 0x87, 0x2A, 0xBA, 0x40, 0x9A, 0x42, 0x0C, 0x4E, 0xAF},
+    {0xAF, 0x94, 0x29, 0xB2, 0x1A, 0xD9, 0x26, 0xCA, 0x74, 0xAC, 0x0C, 0x19, 0xD2, 0xFD, 0x3E, 0x70, 0x1C, 0x1E, 0x71, 0xDE, 0x5E, 0x35, 0x3C, 0xDE, 0x59, 0xFB, 0x4A, 0x12, 0x4E, 0x24, 0x80, 0xD8},
+    {0xD8, 0x5F, 0x74, 0xB3, 0x8D, 0xA0, 0xB3, 0xE8, 0x90, 0xC3, 0x70, 0x99, 0x01, 0x48, 0xCF, 0x40, 0x15, 0x62, 0x2C, 0xEB, 0xC6, 0xCB, 0xE9, 0x8B, 0x84, 0x97, 0x91, 0xF0, 0x2D, 0xD4, 0xC4, 0x70},
+    {0x70, 0xB8, 0xC9, 0xAD, 0x28, 0x3F, 0x19, 0xB4, 0xCC, 0x5B, 0x4D, 0xAF, 0x14, 0xD8, 0xAA, 0x7E, 0xFF, 0xA4, 0x80, 0xF5, 0x66, 0x19, 0x45, 0x22, 0xAF, 0x83, 0x2E, 0x23, 0x6B, 0xF4, 0x42, 0xA4},
+    {0xA4, 0x5A, 0x43, 0x6C, 0xC9, 0xA8, 0xB0, 0xB1, 0xCF, 0x97, 0x69, 0x78, 0xD5, 0xB1, 0x67, 0x62, 0x61, 0x37, 0x1B, 0x25, 0x8F, 0x53, 0x2B, 0x1E, 0x59, 0x07, 0x0C, 0xAE, 0x47, 0xCE, 0x0F, 0x68},
+    {0x68, 0x37, 0x51, 0xD1, 0xF0, 0xEC, 0xA9, 0x75, 0x9F, 0x4A, 0xD9, 0x48, 0xAC, 0x47, 0x8D, 0xD8, 0xD0, 0xDE, 0x0B, 0x89, 0xF1, 0xAE, 0x1D, 0xAE, 0x30, 0x9C, 0x06, 0x29, 0x32, 0xD5, 0xC5, 0x9C},
+    {0x9C, 0x72, 0x87, 0x5B, 0x3B, 0x29, 0xFC, 0xC1, 0x1C, 0x62, 0x3F, 0x40, 0xB7, 0xA6, 0x89, 0xDE, 0x5B, 0x83, 0x10, 0x01, 0x76, 0x68, 0xDB, 0xE0, 0xC7, 0x58, 0x8C, 0xDF, 0xC3, 0x38, 0x65, 0xDF},
+    {0xDF, 0x6A, 0x68, 0x38, 0x14, 0xDB, 0x60, 0x2A, 0x3B, 0xDE, 0x86, 0x7C, 0xDA, 0x08, 0xCB, 0x17, 0x6B, 0xC5, 0xEE, 0xAF, 0x9B, 0x35, 0x8C, 0x19, 0x1A, 0x11, 0x11, 0x6C, 0x90, 0x7C, 0x22, 0x93},
+    {0x93, 0x92, 0xD6, 0x7E, 0x22, 0x67, 0x80, 0xD3, 0xE5, 0x89, 0xD3, 0x1E, 0x36, 0xCC, 0xD3, 0xFF, 0xC2, 0x5F, 0x1E, 0xF8, 0xE5, 0x03, 0x38, 0x3E, 0xD6, 0xA9, 0x4A, 0x62, 0x76, 0x86, 0xC0, 0x6F},
+    {0x6F, 0x06, 0x63, 0x61, 0x92, 0x5D, 0x45, 0x5D, 0x5D, 0x15, 0xFF, 0x24, 0x48, 0x81, 0xAF, 0x8C, 0x9D, 0x9D, 0x3C, 0xA9, 0xAE, 0x12, 0x75, 0xC8, 0xB0, 0x0B, 0x8B, 0x35, 0x8E, 0xC1, 0x77, 0x55},
+    {0x55, 0x7C, 0x42, 0xD7, 0x23, 0x88, 0xFA, 0x09, 0x03, 0xC6, 0x34, 0xF0, 0x9B, 0xFC, 0x42, 0x2B, 0x90, 0x19, 0x5E, 0x88, 0x16, 0xA1, 0x33, 0xEE, 0x96, 0xFC, 0xAC, 0x91, 0x77, 0x3A, 0x85, 0x64},
+    {0x64, 0x7C, 0xFA, 0x36, 0x8B, 0x8E, 0xD5, 0x5E, 0x22, 0xA1, 0xE8, 0x6A, 0xCB, 0xEF, 0xAF, 0xFA, 0x5C, 0x28, 0x4A, 0x2A, 0xB3, 0x48, 0x8F, 0x91, 0xC5, 0x32, 0xA1, 0x01, 0xCD, 0x03, 0xBC, 0xAC},
+    {0xAC, 0x1F, 0x71, 0x66, 0xD2, 0xFB, 0x69, 0xBE, 0x23, 0x43, 0xD3, 0x0A, 0x27, 0x57, 0x1A, 0xE0, 0x63, 0x13, 0xDD, 0xD6, 0x67, 0x51, 0x3A, 0xEE, 0xEC, 0xAE, 0xD5, 0xD1, 0xE5, 0x51, 0x0E, 0xC7},
+    {0xC7, 0xA9, 0x98, 0x85, 0x2E, 0xA5, 0x0A, 0x7D, 0x4E, 0xAF, 0x67, 0x6E, 0xC9, 0xD3, 0xE4, 0x8A, 0x58, 0xF3, 0xA0, 0x29, 0x15, 0xDA, 0x75, 0xB6, 0x1E, 0xF8, 0x5F, 0xA2, 0x99, 0x11, 0xD6, 0x0B},
+    {0x0B, 0x7B, 0xDE, 0x5B, 0x35, 0xFC, 0xDA, 0x73, 0xD8, 0x1C, 0xF7, 0xCE, 0x03, 0x0A, 0xE3, 0x03, 0x9F, 0xBF, 0xC3, 0x63, 0x44, 0xBC, 0x82, 0x27, 0x13, 0x67, 0x87, 0x8D, 0x12, 0x5A, 0x66, 0x6A},
+    {0x6A, 0x2E, 0x8E, 0xE0, 0xE7, 0x2C, 0xE7, 0x4E, 0x9F, 0x90, 0x42, 0x82, 0x76, 0x3D, 0xE7, 0x1C, 0x53, 0x60, 0x52, 0xFD, 0xDB, 0x31, 0xE2, 0xCA, 0xCB, 0x87, 0x7C, 0x9E, 0x31, 0x2C, 0xAF, 0x43},
+    {0x43, 0x86, 0x84, 0x3B, 0x45, 0xDE, 0x75, 0x59, 0xDD, 0xA0, 0x01, 0x98, 0xE7, 0xC3, 0x9E, 0x2A, 0x2A, 0x9E, 0xC3, 0xE7, 0x98, 0x01, 0xA0, 0xDD, 0x59, 0x75, 0xDE, 0x45, 0x3B, 0x84, 0x86, 0x43},
+    {0x43, 0xAF, 0x2C, 0x31, 0x9E, 0x7C, 0x87, 0xCB, 0xCA, 0xE2, 0x31, 0xDB, 0xFD, 0x52, 0x60, 0x53, 0x1C, 0xE7, 0x3D, 0x76, 0x82, 0x42, 0x90, 0x9F, 0x4E, 0xE7, 0x2C, 0xE7, 0xE0, 0x8E, 0x2E, 0x6A},
+    {0x6A, 0x66, 0x5A, 0x12, 0x8D, 0x87, 0x67, 0x13, 0x27, 0x82, 0xBC, 0x44, 0x63, 0xC3, 0xBF, 0x9F, 0x03, 0xE3, 0x0A, 0x03, 0xCE, 0xF7, 0x1C, 0xD8, 0x73, 0xDA, 0xFC, 0x35, 0x5B, 0xDE, 0x7B, 0x0B},
+    {0x0B, 0xD6, 0x11, 0x99, 0xA2, 0x5F, 0xF8, 0x1E, 0xB6, 0x75, 0xDA, 0x15, 0x29, 0xA0, 0xF3, 0x58, 0x8A, 0xE4, 0xD3, 0xC9, 0x6E, 0x67, 0xAF, 0x4E, 0x7D, 0x0A, 0xA5, 0x2E, 0x85, 0x98, 0xA9, 0xC7},
+    {0xC7, 0x0E, 0x51, 0xE5, 0xD1, 0xD5, 0xAE, 0xEC, 0xEE, 0x3A, 0x51, 0x67, 0xD6, 0xDD, 0x13, 0x63, 0xE0, 0x1A, 0x57, 0x27, 0x0A, 0xD3, 0x43, 0x23, 0xBE, 0x69, 0xFB, 0xD2, 0x66, 0x71, 0x1F, 0xAC},
+    {0xAC, 0xBC, 0x03, 0xCD, 0x01, 0xA1, 0x32, 0xC5, 0x91, 0x8F, 0x48, 0xB3, 0x2A, 0x4A, 0x28, 0x5C, 0xFA, 0xAF, 0xEF, 0xCB, 0x6A, 0xE8, 0xA1, 0x22, 0x5E, 0xD5, 0x8E, 0x8B, 0x36, 0xFA, 0x7C, 0x64},
+    {0x64, 0x85, 0x3A, 0x77, 0x91, 0xAC, 0xFC, 0x96, 0xEE, 0x33, 0xA1, 0x16, 0x88, 0x5E, 0x19, 0x90, 0x2B, 0x42, 0xFC, 0x9B, 0xF0, 0x34, 0xC6, 0x03, 0x09, 0xFA, 0x88, 0x23, 0xD7, 0x42, 0x7C, 0x55},
+    {0x55, 0x77, 0xC1, 0x8E, 0x35, 0x8B, 0x0B, 0xB0, 0xC8, 0x75, 0x12, 0xAE, 0xA9, 0x3C, 0x9D, 0x9D, 0x8C, 0xAF, 0x81, 0x48, 0x24, 0xFF, 0x15, 0x5D, 0x5D, 0x45, 0x5D, 0x92, 0x61, 0x63, 0x06, 0x6F},
+    {0x6F, 0xC0, 0x86, 0x76, 0x62, 0x4A, 0xA9, 0xD6, 0x3E, 0x38, 0x03, 0xE5, 0xF8, 0x1E, 0x5F, 0xC2, 0xFF, 0xD3, 0xCC, 0x36, 0x1E, 0xD3, 0x89, 0xE5, 0xD3, 0x80, 0x67, 0x22, 0x7E, 0xD6, 0x92, 0x93},
+    {0x93, 0x22, 0x7C, 0x90, 0x6C, 0x11, 0x11, 0x1A, 0x19, 0x8C, 0x35, 0x9B, 0xAF, 0xEE, 0xC5, 0x6B, 0x17, 0xCB, 0x08, 0xDA, 0x7C, 0x86, 0xDE, 0x3B, 0x2A, 0x60, 0xDB, 0x14, 0x38, 0x68, 0x6A, 0xDF},
+    {0xDF, 0x65, 0x38, 0xC3, 0xDF, 0x8C, 0x58, 0xC7, 0xE0, 0xDB, 0x68, 0x76, 0x01, 0x10, 0x83, 0x5B, 0xDE, 0x89, 0xA6, 0xB7, 0x40, 0x3F, 0x62, 0x1C, 0xC1, 0xFC, 0x29, 0x3B, 0x5B, 0x87, 0x72, 0x9C},
+    {0x9C, 0xC5, 0xD5, 0x32, 0x29, 0x06, 0x9C, 0x30, 0xAE, 0x1D, 0xAE, 0xF1, 0x89, 0x0B, 0xDE, 0xD0, 0xD8, 0x8D, 0x47, 0xAC, 0x48, 0xD9, 0x4A, 0x9F, 0x75, 0xA9, 0xEC, 0xF0, 0xD1, 0x51, 0x37, 0x68},
+    {0x68, 0x0F, 0xCE, 0x47, 0xAE, 0x0C, 0x07, 0x59, 0x1E, 0x2B, 0x53, 0x8F, 0x25, 0x1B, 0x37, 0x61, 0x62, 0x67, 0xB1, 0xD5, 0x78, 0x69, 0x97, 0xCF, 0xB1, 0xB0, 0xA8, 0xC9, 0x6C, 0x43, 0x5A, 0xA4},
+    {0xA4, 0x42, 0xF4, 0x6B, 0x23, 0x2E, 0x83, 0xAF, 0x22, 0x45, 0x19, 0x66, 0xF5, 0x80, 0xA4, 0xFF, 0x7E, 0xAA, 0xD8, 0x14, 0xAF, 0x4D, 0x5B, 0xCC, 0xB4, 0x19, 0x3F, 0x28, 0xAD, 0xC9, 0xB8, 0x70},
+    {0x70, 0xC4, 0xD4, 0x2D, 0xF0, 0x91, 0x97, 0x84, 0x8B, 0xE9, 0xCB, 0xC6, 0xEB, 0x2C, 0x62, 0x15, 0x40, 0xCF, 0x48, 0x01, 0x99, 0x70, 0xC3, 0x90, 0xE8, 0xB3, 0xA0, 0x8D, 0xB3, 0x74, 0x5F, 0xD8},
+    {0xD8, 0x80, 0x24, 0x4E, 0x12, 0x4A, 0xFB, 0x59, 0xDE, 0x3C, 0x35, 0x5E, 0xDE, 0x71, 0x1E, 0x1C, 0x70, 0x3E, 0xFD, 0xD2, 0x19, 0x0C, 0xAC, 0x74, 0xCA, 0x26, 0xD9, 0x1A, 0xB2, 0x29, 0x94, 0xAF},
+    {0xAF, 0x4E, 0x0C, 0x42, 0x9A, 0x40, 0xBA, 0x2A, 0x87, 0xD7, 0x56, 0xA9, 0x49, 0xB8, 0xFE, 0x31, 0x16, 0x5F, 0xB1, 0x9B, 0xC5, 0x85, 0x66, 0xA5, 0xAA, 0x1B, 0xD6, 0x8B, 0xCE, 0xD4, 0xA5, 0x02},
+    {0x02, 0x19, 0xB0, 0xA0, 0x62, 0xA6, 0x5A, 0xEB, 0xE8, 0x4A, 0xC7, 0x02, 0xC5, 0xE5, 0x69, 0xBE, 0xD3, 0x56, 0x8E, 0x1D, 0xF7, 0x91, 0x95, 0xAB, 0x67, 0xFB, 0x01, 0xEA, 0xAB, 0x62, 0x2A, 0x13},
+    {0x13, 0x4D, 0xF3, 0x38, 0x17, 0x27, 0x61, 0xE1, 0x44, 0xF4, 0xD2, 0x90, 0x36, 0x4D, 0x0B, 0x80, 0xA6, 0x3A, 0xB8, 0x06, 0x29, 0xA0, 0x09, 0x89, 0x04, 0xDC, 0x3C, 0x44, 0x5D, 0x23, 0x88, 0x65},
+    {0x65, 0x61, 0xB4, 0xD1, 0x74, 0xA4, 0x77, 0x2E, 0xAB, 0x43, 0xD2, 0xA6, 0x9D, 0x14, 0xB5, 0x93, 0x86, 0x3E, 0xC2, 0x9A, 0x0B, 0x5D, 0x86, 0x0E, 0xC3, 0x4B, 0x8C, 0x8F, 0x08, 0x7F, 0xDA, 0xFA},
+    {0xFA, 0xE0, 0xA9, 0x66, 0x47, 0x3C, 0xF3, 0xEA, 0xAE, 0x39, 0x08, 0x41, 0x0E, 0x4F, 0x58, 0x1E, 0x85, 0x2D, 0x72, 0x10, 0x32, 0x98, 0x16, 0x14, 0x8E, 0x5E, 0x1C, 0xC4, 0x19, 0xDA, 0xB7, 0x5F},
+    {0x5F, 0x0E, 0xAC, 0x88, 0x84, 0x91, 0xE9, 0x2D, 0x70, 0xC2, 0x48, 0x84, 0xA5, 0x2F, 0x17, 0x1B, 0x66, 0xC6, 0x75, 0x53, 0xF4, 0xBE, 0xE9, 0x7A, 0x8E, 0x50, 0x8B, 0xCA, 0x26, 0x38, 0x96, 0x43},
+    {0x43, 0xB3, 0xA4, 0x19, 0x2D, 0xBD, 0xC8, 0x57, 0xBE, 0x4F, 0x53, 0x92, 0xE1, 0x10, 0x8C, 0xDA, 0x2D, 0xAB, 0x65, 0xC0, 0x36, 0x2E, 0x2F, 0xD6, 0xE9, 0x30, 0x09, 0xB2, 0x6F, 0x93, 0x92, 0x7A},
+    {0x7A, 0xC4, 0x2D, 0xE8, 0x22, 0x53, 0x76, 0x5D, 0xB7, 0x82, 0x91, 0x0F, 0x44, 0xAD, 0x69, 0xFA, 0x01, 0x5B, 0xD2, 0x29, 0x16, 0x6A, 0xF0, 0x13, 0x36, 0x7C, 0xFB, 0x77, 0x89, 0x23, 0x0D, 0x15},
+    {0x15, 0x68, 0xAB, 0xD6, 0x3F, 0x23, 0xBA, 0x3E, 0x33, 0x7B, 0x2A, 0x3A, 0x8F, 0xBF, 0xB7, 0x40, 0x43, 0x28, 0x41, 0x29, 0xA9, 0xBD, 0xC2, 0x3C, 0x7D, 0x7E, 0x95, 0xFA, 0xA0, 0x72, 0x4C, 0x1F},
+    {0x1F, 0xE0, 0x0F, 0xC5, 0xA1, 0xF2, 0xB8, 0x60, 0x94, 0x08, 0x83, 0x02, 0xE1, 0xE1, 0x3E, 0x59, 0x9D, 0xAD, 0xA9, 0x2F, 0xF2, 0x81, 0x45, 0xF9, 0x96, 0xA7, 0xE5, 0x58, 0x8D, 0xCE, 0x15, 0xB9},
+    {0xB9, 0x76, 0x82, 0x68, 0xF6, 0xD0, 0xFC, 0x9B, 0x73, 0x39, 0xD2, 0xCA, 0xCF, 0x86, 0x0E, 0x58, 0x79, 0xFB, 0x42, 0xCE, 0xE2, 0xBB, 0x5B, 0xE8, 0xEA, 0xB5, 0xA9, 0x94, 0x6B, 0xEA, 0xAC, 0x7C},
+    {0x7C, 0x63, 0x6D, 0xBD, 0x33, 0xCC, 0x35, 0x9A, 0xBA, 0x9F, 0xD7, 0x72, 0xA8, 0xF0, 0x0B, 0xB8, 0x22, 0xCF, 0x76, 0x7D, 0xAC, 0x42, 0x55, 0xB7, 0xC9, 0x8C, 0x50, 0x93, 0xCF, 0x54, 0xF1, 0x76},
+    {0x76, 0x41, 0x70, 0xC7, 0x46, 0xC5, 0x5B, 0xC1, 0x7F, 0xA1, 0x21, 0xF4, 0x4B, 0x02, 0xE6, 0x7A, 0xA6, 0x53, 0xD9, 0xDC, 0x44, 0x8F, 0xFC, 0x4E, 0x52, 0x3D, 0x1B, 0xA6, 0x68, 0x65, 0x47, 0xCC},
+    {0xCC, 0xCF, 0xB1, 0x47, 0x3F, 0xE3, 0x4B, 0x36, 0x94, 0xA1, 0xDD, 0x35, 0x5A, 0x7C, 0x81, 0x91, 0xD7, 0xD1, 0xD0, 0xEE, 0x72, 0x50, 0xF3, 0x22, 0x1B, 0x3F, 0xB3, 0xBE, 0x5E, 0x5F, 0x95, 0xFE},
+    {0xFE, 0xA2, 0x7C, 0xBC, 0x91, 0x0F, 0x80, 0x74, 0xB5, 0x1B, 0xCA, 0xE6, 0x45, 0x57, 0x15, 0xAA, 0xC4, 0xFC, 0xB8, 0xDD, 0x9E, 0x49, 0x3B, 0x7C, 0xA1, 0x24, 0x5C, 0x83, 0x68, 0x53, 0xEC, 0xFB},
+    {0xFB, 0x20, 0x15, 0xF8, 0x3A, 0xC7, 0x55, 0xF6, 0x95, 0x82, 0x58, 0x73, 0x78, 0xC1, 0xB0, 0x9E, 0xCD, 0x4F, 0x1B, 0x3C, 0x43, 0x27, 0x0A, 0x0C, 0x9D, 0xD7, 0x7E, 0x0A, 0x05, 0xEC, 0xE4, 0x32},
+    {0x32, 0x2C, 0x63, 0x2F, 0xD6, 0xAF, 0x2A, 0x07, 0x20, 0xC4, 0x95, 0x77, 0xAD, 0x42, 0x2B, 0xEC, 0x66, 0x91, 0xA5, 0x21, 0xE2, 0x6C, 0x30, 0x5B, 0xDA, 0xCF, 0x3A, 0xEB, 0x24, 0x3F, 0xAF, 0x33},
+    {0x33, 0xBE, 0x10, 0x0F, 0x11, 0x5D, 0x4F, 0x93, 0xB0, 0xD4, 0xDB, 0x90, 0x9F, 0xC1, 0x03, 0x57, 0x65, 0x1A, 0xD0, 0xC9, 0xC9, 0xE7, 0x73, 0xC4, 0xEC, 0x63, 0x2F, 0xB1, 0xD5, 0x48, 0x03, 0x23},
+    {0x23, 0x1D, 0xE9, 0x0E, 0xB6, 0xFD, 0x6D, 0xF7, 0x28, 0x30, 0x4B, 0xF7, 0x16, 0x81, 0x14, 0xF6, 0x55, 0x90, 0xCF, 0xCE, 0x4F, 0xE5, 0x78, 0xF3, 0x7F, 0x54, 0x53, 0xC3, 0x08, 0xCB, 0x1F, 0x2D},
+    {0x2D, 0x01, 0x39, 0xBD, 0x57, 0xEE, 0x8B, 0xE5, 0x8B, 0x42, 0xDF, 0x4C, 0xF2, 0x42, 0xEA, 0xA6, 0xD3, 0xE7, 0xFB, 0x9B, 0xCB, 0x48, 0x0A, 0x12, 0x8F, 0xF7, 0x22, 0x0B, 0x9A, 0x5C, 0xEF, 0x3D},
+    {0x3D, 0xAD, 0x4E, 0x1F, 0x63, 0x68, 0x48, 0x02, 0x95, 0x95, 0x2D, 0xF1, 0x27, 0xD4, 0xBD, 0xD1, 0x08, 0xE8, 0x18, 0xDD, 0xF0, 0xE5, 0x27, 0x14, 0x62, 0x06, 0x51, 0x1D, 0xD5, 0xBC, 0x13, 0x6F},
+    {0x6F, 0xA8, 0x5C, 0xF9, 0xF3, 0x1C, 0x4A, 0x95, 0x8C, 0x65, 0xE3, 0xDA, 0xA7, 0x90, 0xB7, 0xE2, 0xB3, 0x57, 0x8B, 0xAF, 0x8B, 0x07, 0x93, 0xD7, 0x9A, 0xBF, 0x24, 0x2E, 0xF1, 0x62, 0x4D, 0x86},
+    {0x86, 0x30, 0x7B, 0xB1, 0x34, 0x81, 0xAE, 0xB1, 0x34, 0xF2, 0xC0, 0xD0, 0x10, 0x4A, 0x51, 0xAA, 0x8E, 0xAE, 0x96, 0x66, 0x65, 0xB8, 0xA2, 0xED, 0x76, 0x61, 0x0D, 0x56, 0xE3, 0x1C, 0xB1, 0x12},
+    {0x12, 0x92, 0xA5, 0xA5, 0x16, 0x6F, 0x4B, 0xFE, 0x7F, 0x8D, 0x62, 0xBD, 0xD2, 0xCE, 0x0F, 0x98, 0xC3, 0x47, 0xEB, 0x48, 0x64, 0x18, 0x28, 0x1B, 0x23, 0x26, 0xAB, 0x56, 0xF1, 0x3D, 0x89, 0xA5},
+    {0xA5, 0x63, 0x16, 0x56, 0xD1, 0x88, 0xED, 0x08, 0xE4, 0x81, 0xB7, 0x7D, 0xF1, 0x21, 0xDA, 0xE7, 0xF6, 0x2B, 0x53, 0x18, 0x04, 0x7B, 0x22, 0xD6, 0x01, 0x60, 0xA4, 0x35, 0x22, 0x02, 0xB9, 0xF8},
+    {0xF8, 0x96, 0x55, 0x68, 0xE0, 0xA5, 0xC5, 0x21, 0x4A, 0xBB, 0xDA, 0x70, 0xB9, 0x8F, 0xBC, 0x31, 0x13, 0x1D, 0xB6, 0x2D, 0xDC, 0xC3, 0x20, 0x7D, 0x94, 0xCD, 0x2D, 0xD0, 0x83, 0x5C, 0x34, 0x8A},
+    {0x8A, 0x1D, 0xC8, 0x5E, 0x65, 0x1A, 0x4B, 0x5F, 0x85, 0x13, 0x7E, 0x96, 0x55, 0xB2, 0x21, 0xA6, 0x98, 0x09, 0xB3, 0xBD, 0x08, 0x90, 0x06, 0x79, 0xD9, 0x0E, 0x23, 0xD7, 0xDD, 0x88, 0x02, 0xD1},
+    {0xD1, 0x70, 0x74, 0x3D, 0xF1, 0x31, 0x15, 0xAD, 0x62, 0xAD, 0x87, 0x16, 0x8F, 0xA0, 0x61, 0xF8, 0x34, 0x41, 0xDA, 0x46, 0xA4, 0x60, 0x04, 0x2E, 0x44, 0x3F, 0x01, 0x77, 0x78, 0x28, 0xE1, 0xF8},
+    {0xF8, 0xE2, 0x46, 0x0A, 0x8B, 0x85, 0x7C, 0xD9, 0xEF, 0x3D, 0xF6, 0x40, 0xD2, 0xF1, 0x3D, 0x8A, 0x0C, 0xDF, 0xDC, 0xA4, 0x82, 0x63, 0x3B, 0x5B, 0x6C, 0x88, 0x72, 0x75, 0xC1, 0x06, 0x1E, 0xD2},
+    {0xD2, 0xEF, 0x0A, 0x49, 0x95, 0xFD, 0x9D, 0x20, 0x47, 0xAF, 0xB1, 0xE0, 0x03, 0xDD, 0x58, 0x84, 0x8B, 0xB5, 0x76, 0xD3, 0xE7, 0x94, 0xEF, 0x7B, 0xC5, 0x30, 0x90, 0x04, 0xEA, 0xCE, 0xEE, 0x09},
+    {0x09, 0xD8, 0x66, 0x65, 0xD9, 0x7B, 0x98, 0xB5, 0x47, 0xD8, 0xE7, 0x4C, 0xE1, 0x6C, 0x3C, 0xFF, 0x73, 0x2C, 0x54, 0x19, 0xD2, 0x1A, 0xDC, 0x70, 0x1C, 0xED, 0x55, 0x7E, 0x94, 0x85, 0x47, 0xE4},
+    {0xE4, 0x22, 0x08, 0x8C, 0x94, 0x42, 0xBA, 0x34, 0xFE, 0x4B, 0x63, 0x76, 0x09, 0x0B, 0x0A, 0x59, 0x45, 0x16, 0x4A, 0xBE, 0x5C, 0x43, 0xA1, 0xD0, 0x3B, 0xB0, 0x2C, 0xCE, 0x8F, 0x7E, 0x55, 0x6C},
+    {0x6C, 0x9C, 0x52, 0x45, 0x50, 0xC9, 0x77, 0xDD, 0x19, 0x66, 0x25, 0xEA, 0x7A, 0x44, 0x12, 0x35, 0xA8, 0x7A, 0x0F, 0x07, 0xB2, 0xD5, 0x2D, 0x39, 0xFD, 0x5C, 0x85, 0x71, 0x12, 0xC2, 0x0E, 0x2D},
+    {0x2D, 0x4E, 0xB8, 0x06, 0x1C, 0x08, 0xBF, 0xFF, 0xA1, 0x73, 0x89, 0x22, 0xEF, 0x2E, 0x2F, 0xA0, 0x10, 0x1A, 0x11, 0x5B, 0x02, 0xB5, 0x3A, 0x47, 0x45, 0x75, 0x2A, 0xDD, 0x28, 0x46, 0xE6, 0x2C},
+    {0x2C, 0x54, 0x15, 0xBA, 0x4F, 0x5A, 0x73, 0xDC, 0xE2, 0x6E, 0x94, 0xA4, 0x11, 0xED, 0xEE, 0xBD, 0xF4, 0x82, 0xDA, 0x13, 0x68, 0x2F, 0x52, 0xF5, 0x5A, 0x26, 0x0E, 0x6C, 0x94, 0x2A, 0x1D, 0x9F},
+    {0x9F, 0xDB, 0x65, 0xE5, 0x60, 0xB4, 0x5D, 0xA1, 0x16, 0x77, 0x03, 0x73, 0x01, 0xE1, 0x59, 0xDD, 0xAD, 0xC7, 0x36, 0x2A, 0xB6, 0x8F, 0x42, 0xC7, 0x3F, 0x88, 0x21, 0xF5, 0xB6, 0x64, 0x1B, 0xEA},
+    {0xEA, 0xB8, 0x78, 0xC5, 0xF4, 0x4F, 0x33, 0xC1, 0x2D, 0xF0, 0xBC, 0xB9, 0xB5, 0xA1, 0x39, 0x7B, 0x40, 0x8F, 0x1F, 0x96, 0xEC, 0x0C, 0x44, 0xA4, 0x4B, 0xA3, 0x0F, 0x0E, 0xE4, 0x16, 0xC7, 0x3C},
+    {0x3C, 0x31, 0x88, 0x08, 0x0B, 0xD5, 0xE4, 0x51, 0xD0, 0x96, 0x97, 0xB8, 0xE4, 0xC5, 0xF5, 0x22, 0xA4, 0x5B, 0xDB, 0x6F, 0xCB, 0xE8, 0x6B, 0xFF, 0xB5, 0x29, 0x08, 0x2E, 0xC0, 0x94, 0x26, 0x1C},
+    {0x1C, 0x24, 0xD7, 0x1C, 0x4F, 0xE4, 0x59, 0x84, 0x58, 0x83, 0x76, 0xC1, 0x39, 0x70, 0x3E, 0x7B, 0x6C, 0x2A, 0xA0, 0x4F, 0xEE, 0x9D, 0x08, 0x38, 0xF6, 0xD5, 0xA5, 0xE7, 0x69, 0x54, 0x72, 0x3E},
+    {0x3E, 0x71, 0xEA, 0x0B, 0xF2, 0x52, 0x55, 0x6A, 0x57, 0x2E, 0xF4, 0x26, 0xF0, 0xE5, 0xF5, 0x65, 0x46, 0x37, 0xAF, 0x7C, 0x7E, 0xBE, 0xEA, 0x7E, 0xEB, 0xC5, 0x64, 0xB8, 0x09, 0xB5, 0x9A, 0x1F},
+    {0x1F, 0xCB, 0x16, 0x84, 0x7C, 0x3F, 0xC9, 0x8F, 0xC0, 0x6C, 0xD6, 0xDC, 0xFD, 0x9E, 0x64, 0x1B, 0xB8, 0xA8, 0xB6, 0xC1, 0xA7, 0x56, 0x46, 0xD1, 0xD4, 0x31, 0x5E, 0xA9, 0xCF, 0x67, 0xD2, 0x6F},
+    {0x6F, 0x8A, 0x3A, 0xA1, 0x68, 0x03, 0x1D, 0x14, 0x01, 0x30, 0x1A, 0x21, 0x8A, 0x4A, 0xFD, 0x3B, 0x79, 0xE7, 0xCB, 0x01, 0x97, 0x50, 0x20, 0xB6, 0x5F, 0x09, 0x13, 0x21, 0x45, 0x78, 0x96, 0x47},
+    {0x47, 0x68, 0x5B, 0x50, 0x44, 0x29, 0x6E, 0x01, 0x84, 0x23, 0x81, 0x68, 0x9C, 0xE0, 0xCC, 0xB0, 0x4E, 0x34, 0x61, 0xA1, 0xBC, 0xE5, 0xE1, 0x02, 0x26, 0x43, 0x64, 0x52, 0xC4, 0x2F, 0xA9, 0x91},
+    {0x91, 0xBC, 0x2A, 0xE1, 0x6A, 0x0B, 0x68, 0x8C, 0x0C, 0xFB, 0x3E, 0x4D, 0x4E, 0x26, 0xEA, 0xB8, 0x87, 0x3A, 0x3E, 0xDB, 0x87, 0x70, 0xF8, 0x9E, 0x0F, 0xC4, 0x02, 0x2B, 0x68, 0x7E, 0x6D, 0x52},
+    {0x52, 0x84, 0x02, 0xBB, 0xD3, 0x2A, 0x8F, 0x3C, 0x72, 0xE2, 0xE2, 0xE7, 0x70, 0xDF, 0xBA, 0x8E, 0x74, 0xE3, 0xA6, 0xAF, 0xE6, 0x5E, 0x69, 0x16, 0x60, 0x5B, 0x40, 0x42, 0x19, 0xF9, 0xC0, 0x78},
+    {0x78, 0x63, 0xE4, 0xE2, 0xA0, 0x91, 0xFB, 0x4B, 0x1E, 0x83, 0x2C, 0xEA, 0x5D, 0x90, 0x77, 0x8C, 0xB7, 0x42, 0x4B, 0x46, 0x15, 0xEE, 0x90, 0x98, 0x34, 0xA4, 0x8A, 0x02, 0x59, 0xF9, 0x99, 0xF1},
+    {0xF1, 0x41, 0xDC, 0xF5, 0xC4, 0x3A, 0xB9, 0x1F, 0x6E, 0xDE, 0x90, 0x16, 0x2F, 0x4C, 0xEC, 0x3B, 0x8F, 0xFB, 0x3E, 0x5A, 0x83, 0x2F, 0xFD, 0x50, 0xBD, 0xD0, 0x8C, 0x10, 0x24, 0x48, 0x46, 0xA0},
+    {0xA0, 0x30, 0xC1, 0xA6, 0xD1, 0x3C, 0x81, 0xB3, 0x67, 0x28, 0xCC, 0x0D, 0xB4, 0x55, 0xD6, 0xA4, 0x67, 0xC7, 0x61, 0x44, 0xF8, 0x1E, 0x3D, 0xBB, 0x28, 0xB7, 0x6B, 0x74, 0x34, 0x5E, 0xC8, 0x87},
+    {0x87, 0xA4, 0x9C, 0x7A, 0x7B, 0xBD, 0x83, 0x91, 0x73, 0xBC, 0x85, 0xD5, 0xF1, 0x0F, 0x3F, 0xEB, 0xB9, 0x5A, 0xAD, 0xDA, 0xB8, 0xE1, 0xB3, 0xE6, 0x7B, 0x38, 0x08, 0x07, 0xA9, 0x8F, 0xF2, 0xCC},
+    {0xCC, 0x3E, 0x54, 0xAB, 0x82, 0xDE, 0x33, 0xEE, 0xC4, 0xAD, 0xC0, 0x91, 0x7B, 0xC6, 0x8C, 0x48, 0x46, 0xCE, 0xD9, 0x9A, 0x74, 0xAC, 0x9D, 0x6D, 0xB3, 0x16, 0xB6, 0xAD, 0xFF, 0x9E, 0x7F, 0x4B},
+    {0x4B, 0x71, 0x62, 0xD8, 0x8E, 0x4B, 0xEF, 0x4E, 0x7B, 0xC1, 0x7C, 0xCD, 0xC3, 0xF7, 0x2F, 0xC6, 0xF8, 0x0C, 0x27, 0x55, 0xC8, 0x79, 0x7D, 0x98, 0xF8, 0xCE, 0x27, 0x7F, 0x88, 0x73, 0xC2, 0xC2},
+    {0xC2, 0xFE, 0xF2, 0x1F, 0xC0, 0x9F, 0x83, 0xB2, 0xDC, 0x4F, 0xCD, 0x43, 0xE0, 0xBE, 0xCA, 0x1F, 0x4C, 0xC8, 0x31, 0x5A, 0x78, 0xF7, 0x75, 0x49, 0x0A, 0xA5, 0x06, 0x36, 0x67, 0xF5, 0xF0, 0x77},
+    {0x77, 0xA4, 0x92, 0x0E, 0xF4, 0x28, 0x05, 0x9C, 0x36, 0x62, 0xF9, 0xC4, 0x4C, 0x1C, 0x03, 0x9B, 0x70, 0x1D, 0x75, 0xCD, 0x55, 0x71, 0x41, 0xCB, 0xCD, 0x15, 0x3F, 0xEE, 0xDD, 0x9B, 0x99, 0x96},
+    {0x96, 0x8A, 0x1C, 0x0D, 0x44, 0xE1, 0x4A, 0xFF, 0x31, 0x3C, 0x47, 0xE3, 0x60, 0xD3, 0x49, 0x97, 0x7C, 0xE4, 0x48, 0xEA, 0x69, 0x4F, 0x54, 0x4B, 0x66, 0x37, 0x77, 0x2A, 0xA4, 0x42, 0x23, 0x64},
+    {0x64, 0xBF, 0x0C, 0x68, 0x51, 0xE9, 0xBC, 0xEE, 0xD4, 0x93, 0x12, 0x19, 0xD8, 0x14, 0x80, 0xF1, 0xE0, 0xC4, 0xB7, 0x3C, 0xD1, 0x37, 0x61, 0xF6, 0x60, 0xC2, 0x6A, 0xDA, 0x76, 0xD0, 0xC4, 0x0A},
+    {0x0A, 0x83, 0xB7, 0x99, 0xC8, 0x9D, 0x9B, 0x2E, 0x2A, 0x23, 0xC3, 0x91, 0x42, 0x4D, 0x8F, 0x47, 0x95, 0x27, 0x5F, 0x22, 0x67, 0x52, 0x67, 0x96, 0x32, 0xF2, 0xB0, 0xA6, 0x7A, 0xE3, 0xD8, 0x23},
+    {0x23, 0x24, 0xD4, 0xA9, 0x20, 0x24, 0xAD, 0x23, 0x95, 0xAA, 0xBC, 0xEF, 0x17, 0x5C, 0x98, 0x7A, 0x45, 0x60, 0xF2, 0x41, 0xA4, 0x4B, 0xCD, 0xE7, 0x2D, 0x8A, 0xC2, 0x5C, 0x1F, 0x64, 0xB4, 0xF6},
+    {0xF6, 0x1C, 0x61, 0xE0, 0xFF, 0xE0, 0x2F, 0x51, 0xA6, 0x20, 0x81, 0x50, 0xA8, 0x23, 0x7F, 0x34, 0xA9, 0xE9, 0x43, 0xC6, 0x06, 0x48, 0x60, 0x78, 0x62, 0xD1, 0x81, 0x02, 0x0A, 0x2B, 0x21, 0x8B},
+    {0x8B, 0x48, 0x3D, 0x3C, 0xFD, 0x1B, 0x03, 0x5E, 0x94, 0x5A, 0xED, 0xE7, 0x43, 0xF5, 0x26, 0x45, 0xEC, 0x93, 0xEC, 0x1E, 0xD5, 0x60, 0x85, 0x9C, 0xBD, 0x13, 0x32, 0x65, 0x1F, 0x57, 0x0A, 0x9F},
+    {0x9F, 0x7C, 0x79, 0xCD, 0xE6, 0x06, 0x1C, 0xD1, 0x94, 0x01, 0x37, 0x0A, 0x42, 0xB3, 0x41, 0x15, 0x55, 0xDF, 0x27, 0x1C, 0xBB, 0x32, 0x0D, 0x10, 0x56, 0x6F, 0x14, 0xC9, 0xBF, 0xEF, 0x66, 0xFD},
+    {0xFD, 0x1C, 0x4E, 0x8E, 0x2B, 0xF4, 0x72, 0x99, 0xF1, 0x73, 0x72, 0x72, 0x20, 0xB5, 0xA0, 0x0A, 0xD3, 0x1E, 0xCC, 0xD0, 0x36, 0xFE, 0x41, 0xEA, 0x30, 0xD3, 0x1B, 0x06, 0x2F, 0x48, 0xDD, 0xE5},
+    {0xE5, 0x8D, 0xB3, 0xF2, 0x6F, 0xAE, 0x38, 0x35, 0xB3, 0x58, 0xC0, 0xC9, 0x01, 0x9C, 0x78, 0xE5, 0xC1, 0x96, 0xD3, 0x70, 0xA3, 0x8D, 0x4D, 0xE8, 0xC0, 0x77, 0x1F, 0x9E, 0xE7, 0x93, 0xE7, 0xAD},
+    {0xAD, 0xC5, 0xFF, 0x79, 0x06, 0x01, 0x44, 0xB8, 0x29, 0x77, 0x22, 0x08, 0xB2, 0xCB, 0xC2, 0x17, 0x0D, 0xAE, 0xC8, 0x19, 0x0B, 0x6B, 0xF7, 0x89, 0xF4, 0x40, 0x9D, 0x71, 0x6A, 0x2D, 0xE1, 0xC7},
+    {0xC7, 0xA8, 0x42, 0x0B, 0x31, 0x71, 0xF0, 0x50, 0x48, 0xA5, 0x53, 0x9F, 0xCB, 0x46, 0x78, 0x52, 0xAF, 0x9D, 0x1D, 0x3C, 0xDA, 0xB6, 0x4F, 0x7B, 0x79, 0xE0, 0xB1, 0xEA, 0x39, 0x9E, 0xAA, 0xE4},
+    {0xE4, 0xEC, 0x78, 0xA8, 0xFA, 0xAA, 0xB0, 0x5C, 0x1B, 0x44, 0x1E, 0xC2, 0xDA, 0x21, 0x20, 0x1D, 0xE8, 0xCA, 0xFB, 0xF7, 0x79, 0x4B, 0x0D, 0x43, 0x30, 0xD5, 0x21, 0x2A, 0x1B, 0xD3, 0x4E, 0x81},
+    {0x81, 0xBD, 0xC5, 0xB0, 0x15, 0xD2, 0x3B, 0x53, 0x5D, 0x10, 0xD9, 0xFB, 0x8A, 0x12, 0xBF, 0xDD, 0xA1, 0x15, 0x54, 0x33, 0xBF, 0x9C, 0xD6, 0x06, 0x42, 0xD3, 0x44, 0x09, 0x97, 0xD3, 0xFA, 0x17},
+    {0x17, 0x25, 0x2C, 0x92, 0x47, 0x28, 0x21, 0x22, 0xFF, 0x5C, 0xA8, 0x26, 0x17, 0xDD, 0xD9, 0xD6, 0x86, 0xC8, 0xDE, 0x03, 0xDF, 0x40, 0x24, 0xD7, 0xAA, 0x5B, 0x20, 0x79, 0xFE, 0xC0, 0x42, 0x5E},
+    {0x5E, 0xB8, 0x16, 0x5B, 0x60, 0x8F, 0xF0, 0x14, 0xD9, 0x36, 0x25, 0x0E, 0xF4, 0x60, 0x2E, 0xBA, 0xDF, 0xE5, 0x3B, 0xA9, 0xD1, 0x79, 0x39, 0xED, 0x2C, 0x9F, 0x83, 0xE8, 0x8B, 0x89, 0xF3, 0xED},
+    {0xED, 0x7F, 0xE1, 0x93, 0x3A, 0x15, 0x2B, 0x74, 0x38, 0x4A, 0xC5, 0x49, 0x4A, 0x71, 0xE7, 0xEC, 0xF7, 0x1D, 0x62, 0xBE, 0xED, 0xBD, 0x8A, 0xAA, 0xC1, 0xA8, 0x3B, 0xF6, 0x89, 0x0E, 0xD0, 0xD2},
+    {0xD2, 0xFA, 0x97, 0xEE, 0x0C, 0x4C, 0x0D, 0x77, 0xEA, 0x78, 0xC6, 0xD3, 0x0A, 0x45, 0xD8, 0x5E, 0xED, 0x4E, 0xB4, 0x6D, 0xFD, 0xFB, 0x31, 0xCA, 0x34, 0x9D, 0xB0, 0x4D, 0x69, 0x86, 0xE6, 0xC7},
+    {0xC7, 0xD7, 0x7D, 0x63, 0xA6, 0x7B, 0xBD, 0x19, 0x87, 0x66, 0x5C, 0x7B, 0x10, 0xFE, 0xF6, 0x48, 0xE6, 0x7D, 0xFD, 0x40, 0xAE, 0x40, 0xDF, 0xBD, 0x3A, 0x20, 0x6C, 0xC7, 0x05, 0x9D, 0x01, 0xE3},
+    {0xE3, 0xEA, 0xFD, 0xB2, 0xE2, 0x67, 0x99, 0x09, 0xF2, 0xFE, 0xE5, 0x1B, 0xBC, 0xDF, 0xC7, 0x73, 0x22, 0x63, 0x44, 0x32, 0x87, 0xE9, 0xC3, 0xA6, 0x56, 0x8E, 0xC2, 0xAD, 0x46, 0xCA, 0xB7, 0x2C},
+    {0x2C, 0x9A, 0xB1, 0xFF, 0xFB, 0xA4, 0x1C, 0xFA, 0x14, 0x3D, 0x19, 0xC8, 0x28, 0xBE, 0x1F, 0x55, 0x27, 0xB0, 0xA3, 0x46, 0x01, 0xAA, 0x0E, 0x0C, 0xBB, 0x35, 0xF5, 0x84, 0xE4, 0x44, 0x91, 0xCE},
+    {0xCE, 0x23, 0x94, 0x2A, 0x27, 0x62, 0x30, 0x20, 0x6D, 0x07, 0x51, 0x59, 0x0A, 0xB3, 0xEC, 0x28, 0x1A, 0x10, 0xE2, 0x38, 0x84, 0x41, 0xC6, 0x1D, 0x9B, 0x87, 0xA1, 0x6C, 0x5C, 0x7F, 0x4A, 0x9E},
+    {0x9E, 0x62, 0x6D, 0x32, 0xE0, 0xC2, 0x68, 0x09, 0x8B, 0x5D, 0x62, 0x9C, 0xCA, 0xAC, 0xAC, 0xFF, 0x49, 0x09, 0x0F, 0x44, 0xAB, 0x49, 0x24, 0xF6, 0xB6, 0xA2, 0x8D, 0x44, 0xA6, 0xFA, 0x31, 0xE6},
+    {0xE6, 0x03, 0x4C, 0x2B, 0xE3, 0x47, 0x19, 0x95, 0x80, 0x4A, 0xF6, 0xA7, 0xB5, 0x8C, 0x1B, 0x89, 0xA7, 0x6C, 0xBE, 0x49, 0x6D, 0x6E, 0xE2, 0xE5, 0x7F, 0x4B, 0x79, 0x2A, 0x95, 0xE0, 0xD4, 0xAC},
+    {0xAC, 0x9D, 0x0E, 0xD0, 0xCF, 0x93, 0xA0, 0x72, 0xE8, 0xE1, 0x38, 0x14, 0xEA, 0x29, 0x79, 0x54, 0x10, 0xE8, 0x99, 0x22, 0x04, 0x8F, 0x1C, 0x83, 0x98, 0x14, 0xAC, 0x09, 0xCE, 0x09, 0xED, 0xAF},
+    {0xAF, 0x3A, 0x11, 0x68, 0x04, 0x9D, 0x63, 0x71, 0xAC, 0xE1, 0x8B, 0xA4, 0x03, 0x8C, 0xA6, 0x56, 0x5E, 0x3F, 0x67, 0xFF, 0x35, 0x98, 0xE5, 0x15, 0x5D, 0x49, 0xE4, 0xFE, 0xDD, 0xA8, 0x85, 0x7B},
+    {0x7B, 0x73, 0xDB, 0x0B, 0x43, 0x64, 0x5B, 0x1D, 0xF0, 0x35, 0x37, 0xFD, 0x44, 0x19, 0x5E, 0xF0, 0xFC, 0x08, 0xED, 0x7D, 0x1F, 0x43, 0x4E, 0x7C, 0x94, 0x23, 0x8F, 0x84, 0xD5, 0xC7, 0x49, 0x59},
+    {0x59, 0xD2, 0xBA, 0x89, 0x89, 0xD1, 0x9F, 0x76, 0x46, 0x4C, 0x74, 0x47, 0xAD, 0x16, 0xB5, 0xDD, 0x29, 0x7F, 0xA4, 0xBF, 0x2D, 0x6F, 0x02, 0xF2, 0x27, 0xB9, 0xD8, 0x1D, 0x06, 0x87, 0x0E, 0xE0},
+    {0xE0, 0x99, 0x79, 0x8F, 0x38, 0x6A, 0x24, 0x91, 0x3E, 0x57, 0xD7, 0x4D, 0xDA, 0x98, 0x55, 0x50, 0x24, 0xCC, 0x3C, 0x91, 0x22, 0x14, 0xF4, 0x13, 0xBA, 0x29, 0x4C, 0x3B, 0xAC, 0x33, 0x2C, 0xCE},
+    {0xCE, 0xEF, 0x97, 0xE2, 0x57, 0xA1, 0xFE, 0x18, 0x06, 0x2D, 0x3B, 0x97, 0x8F, 0x41, 0xCA, 0x62, 0x1F, 0x13, 0x9E, 0xA7, 0x53, 0x62, 0x78, 0xE7, 0x84, 0x86, 0xBD, 0xD5, 0xE3, 0x37, 0x3D, 0x23},
+    {0x23, 0xE0, 0xB8, 0x89, 0x5B, 0xBB, 0x91, 0x46, 0xA3, 0x86, 0xB2, 0x17, 0x11, 0x91, 0x94, 0x3F, 0x60, 0xEA, 0xC6, 0x80, 0x21, 0x7F, 0xFD, 0xF8, 0x5C, 0x3C, 0xB6, 0x51, 0x6C, 0xFD, 0x60, 0x13},
+    {0x13, 0x6C, 0x0A, 0x30, 0x3E, 0x1E, 0x7C, 0x2A, 0xE9, 0xBF, 0x1E, 0xE5, 0x23, 0x99, 0x7F, 0x7D, 0x27, 0x89, 0x04, 0x4E, 0xB4, 0x76, 0xE7, 0xE1, 0x57, 0xE7, 0xFB, 0xF3, 0xE6, 0xE4, 0x17, 0x2F},
+    {0x2F, 0x87, 0xB6, 0xF2, 0x49, 0x5A, 0x72, 0xA5, 0x94, 0x4E, 0x40, 0x4D, 0x8C, 0xDB, 0x23, 0x8D, 0xBA, 0xD5, 0x33, 0xFC, 0x27, 0xE7, 0x89, 0x40, 0x5F, 0x8E, 0x8B, 0x9F, 0x8A, 0x1E, 0x3E, 0x83},
+    {0x83, 0xC0, 0x50, 0xD2, 0x6F, 0x5D, 0xD1, 0xC0, 0x66, 0x52, 0xC3, 0xF1, 0x69, 0xE8, 0x94, 0x9E, 0xD3, 0x07, 0x9A, 0x57, 0xD8, 0x96, 0x6A, 0x4F, 0x83, 0xED, 0x05, 0x9F, 0x02, 0xEE, 0xC9, 0xD1},
+    {0xD1, 0x79, 0xA9, 0xA5, 0x7D, 0x3B, 0x52, 0x37, 0xFD, 0x4E, 0xC6, 0xAB, 0xE8, 0x9C, 0x3B, 0x4D, 0x0C, 0x0A, 0xD4, 0x6F, 0x4E, 0xB0, 0x02, 0x42, 0x72, 0x65, 0xE2, 0x51, 0x30, 0xF7, 0x87, 0x33},
+    {0x33, 0x5D, 0x45, 0xC5, 0x9B, 0xF6, 0xDB, 0xEB, 0x80, 0x09, 0x51, 0xC3, 0x43, 0x84, 0xDD, 0x47, 0xC4, 0x70, 0x4B, 0xB8, 0x87, 0x4B, 0xAF, 0xF6, 0xF5, 0xCB, 0x85, 0x69, 0x6F, 0x5C, 0xCB, 0x0B},
+    {0x0B, 0x8F, 0x2A, 0x86, 0x75, 0x49, 0x89, 0xA2, 0x4E, 0xD2, 0x51, 0xF8, 0xAE, 0x80, 0xB4, 0x3A, 0x52, 0x23, 0x40, 0x88, 0xD5, 0x2E, 0x13, 0xFD, 0x53, 0x8C, 0xB4, 0x57, 0xD9, 0xAC, 0x2B, 0x77},
+    {0x77, 0x6D, 0xE3, 0xD6, 0x6D, 0x9D, 0xD3, 0x96, 0x26, 0xF0, 0x64, 0x58, 0xF7, 0x52, 0x3D, 0xE5, 0x55, 0x03, 0x9E, 0xBC, 0x87, 0xDC, 0x98, 0xAD, 0x79, 0x4C, 0x16, 0x5C, 0xBC, 0x25, 0xC0, 0x4D},
+    {0x4D, 0x97, 0xB4, 0x1C, 0x93, 0xE0, 0x82, 0x5D, 0xC2, 0xF3, 0x11, 0x95, 0xBE, 0x08, 0x4F, 0xB7, 0xF4, 0xDF, 0x1E, 0x61, 0x5A, 0x76, 0x3D, 0x4D, 0xF9, 0xF7, 0x53, 0x9B, 0x19, 0x43, 0xFC, 0x20},
+    {0x20, 0x8E, 0x41, 0x50, 0x95, 0x5D, 0xC7, 0x80, 0x45, 0x2A, 0x74, 0x43, 0x49, 0x5A, 0xA7, 0xDA, 0x26, 0x61, 0x70, 0xFA, 0xBD, 0x08, 0xF1, 0xD5, 0x55, 0xFB, 0xD0, 0x9D, 0x12, 0xFD, 0x95, 0x3F},
+    {0x3F, 0x16, 0x3F, 0xCB, 0xAE, 0x96, 0xE1, 0x1F, 0x32, 0x96, 0x55, 0x0E, 0x44, 0xC3, 0x74, 0xDC, 0x96, 0x5D, 0x4F, 0xFA, 0xFD, 0xC7, 0x77, 0x22, 0x67, 0x8D, 0x47, 0xD3, 0x63, 0x98, 0x4C, 0xA3},
+    {0xA3, 0x13, 0x17, 0xBF, 0xDF, 0x74, 0x3A, 0x51, 0xC4, 0x1C, 0x9C, 0xB6, 0xF6, 0xC4, 0x23, 0x5C, 0x13, 0xBE, 0xBD, 0xCF, 0x02, 0x1E, 0xCD, 0x59, 0xF9, 0xD7, 0x21, 0x9D, 0xC7, 0xE3, 0x99, 0x60},
+    {0x60, 0x61, 0xEE, 0xBC, 0xA3, 0x0A, 0x1D, 0x3C, 0x79, 0x7B, 0x12, 0x6A, 0x55, 0x5D, 0xB2, 0x1B, 0x68, 0x2B, 0xC8, 0x16, 0x2C, 0xF4, 0x10, 0x72, 0x71, 0xFF, 0xBE, 0xF4, 0x81, 0x6C, 0x1E, 0x5B},
+    {0x5B, 0x7F, 0x56, 0x10, 0x1E, 0x0D, 0xEB, 0x61, 0xA5, 0x08, 0x2A, 0x36, 0x56, 0xAB, 0x20, 0x71, 0x20, 0xAB, 0x56, 0x36, 0x2A, 0x08, 0xA5, 0x61, 0xEB, 0x0D, 0x1E, 0x10, 0x56, 0x7F, 0x5B, 0x01},
+};
+
+static const uint8_t sdlp_rs_syndrome_col[255][32] = {
+    {0x1E, 0x1D, 0x5F, 0x95, 0xC3, 0x1F, 0x23, 0x19, 0xA7, 0x0A, 0x0B, 0x35, 0x73, 0x41, 0x88, 0x9C, 0x8A, 0xE0, 0x06, 0x84, 0x13, 0xAC, 0x3F, 0x78, 0x74, 0xFB, 0xDD, 0x02, 0x7C, 0x8C, 0x64, 0x15},
+    {0xD3, 0xD6, 0x0F, 0xEC, 0xA2, 0xD2, 0x90, 0xC6, 0xFA, 0x44, 0x45, 0x03, 0xCA, 0xDC, 0x3A, 0xAD, 0x3E, 0x32, 0x14, 0x6A, 0x82, 0xBF, 0x47, 0x8F, 0xDF, 0xF0, 0x71, 0x04, 0x9F, 0x2A, 0x58, 0x96},
+    {0x68, 0xF3, 0x6B, 0xA5, 0x51, 0xA4, 0x63, 0xB2, 0xE1, 0x21, 0x6E, 0x5F, 0x1F, 0xA7, 0x35, 0x88, 0xE0, 0x13, 0x78, 0xDD, 0x8C, 0x28, 0x4B, 0xF9, 0x18, 0x39, 0x57, 0x08, 0x17, 0xB0, 0x85, 0x0D},
+    {0x25, 0x34, 0x55, 0x62, 0xEB, 0x24, 0xFD, 0xB3, 0xF1, 0xCD, 0xCC, 0x05, 0xE3, 0x70, 0x56, 0xBE, 0x46, 0x16, 0x97, 0x0C, 0x7E, 0x3D, 0xC8, 0x2F, 0x75, 0xB5, 0xCE, 0x10, 0xA8, 0xD1, 0x1A, 0xE9},
+    {0xA8, 0x8D, 0xC0, 0x36, 0xB6, 0x92, 0xCB, 0xAA, 0xA5, 0x69, 0xAF, 0xE1, 0x2B, 0x95, 0xA7, 0x41, 0x06, 0x78, 0x7C, 0x2C, 0xF9, 0x4C, 0xE2, 0x17, 0xAB, 0xB1, 0xFE, 0x20, 0x09, 0xB4, 0xBA, 0x62},
+    {0x08, 0xB0, 0x0D, 0xFE, 0x5B, 0xFF, 0x4D, 0x6C, 0x33, 0x94, 0x1C, 0x0F, 0xD2, 0xFA, 0x03, 0x3A, 0x32, 0x82, 0x8F, 0x71, 0x2A, 0xD5, 0x98, 0xF4, 0xC7, 0x53, 0x4F, 0x40, 0x92, 0x68, 0x6B, 0x51},
+    {0xF0, 0xC8, 0xD5, 0x72, 0xEE, 0xD1, 0x5D, 0xDE, 0x92, 0x9A, 0xC4, 0xA4, 0x22, 0x2B, 0x1F, 0x73, 0x84, 0xDD, 0x2C, 0x8E, 0x57, 0x54, 0xEA, 0xFE, 0x6D, 0x9D, 0x55, 0x80, 0xF2, 0x1C, 0xCD, 0x90},
+    {0x84, 0x02, 0x4B, 0x4C, 0x77, 0x85, 0xE4, 0x6D, 0xB4, 0xF6, 0xF7, 0x11, 0x37, 0xCF, 0x4E, 0x3C, 0xC9, 0x93, 0xE8, 0x50, 0x9B, 0x43, 0xE7, 0xC0, 0xDE, 0x79, 0xF3, 0x87, 0xAF, 0x21, 0xC3, 0x73},
+    {0x4E, 0x3A, 0x16, 0x8F, 0xF8, 0xD5, 0xCE, 0xC7, 0xC0, 0x40, 0xBD, 0x6B, 0xA4, 0xE1, 0x5F, 0x35, 0x13, 0x8C, 0xF9, 0x57, 0xB0, 0xED, 0x5B, 0xB4, 0x6C, 0x24, 0x1C, 0x89, 0xFA, 0x56, 0x32, 0x93},
+    {0xAF, 0x2B, 0xA7, 0x06, 0x7C, 0xF9, 0xE2, 0xAB, 0xFE, 0x09, 0xBA, 0x33, 0xD0, 0xEC, 0xFA, 0xDC, 0x14, 0x8F, 0x9F, 0xC5, 0xF4, 0x8D, 0x36, 0x92, 0xAA, 0x69, 0xE1, 0x95, 0x41, 0x78, 0x2C, 0x4C},
+    {0x52, 0x61, 0xD2, 0x70, 0x3E, 0x93, 0x04, 0x75, 0xF4, 0x5A, 0x8B, 0xBD, 0xC4, 0xAF, 0x6E, 0x0B, 0xAC, 0x28, 0x4C, 0x54, 0xED, 0x5C, 0x07, 0x33, 0xB3, 0xA2, 0x4E, 0xAD, 0x97, 0x71, 0x81, 0xAE},
+    {0x40, 0x68, 0x51, 0xE1, 0x1F, 0xE0, 0x8C, 0x18, 0x17, 0xED, 0xD7, 0x55, 0x24, 0xF1, 0x05, 0x56, 0x16, 0x7E, 0x2F, 0xCE, 0xD1, 0x31, 0xBD, 0xA5, 0xB2, 0x5F, 0x88, 0xDD, 0xF9, 0x08, 0x0D, 0x5B},
+    {0x1B, 0x9D, 0x3B, 0xD0, 0xCC, 0x03, 0xC9, 0xDF, 0x2F, 0xAE, 0x5A, 0x40, 0x9A, 0x69, 0x21, 0x0A, 0x3F, 0x4B, 0xE2, 0xEA, 0x5B, 0x07, 0x52, 0xF1, 0xC6, 0x3C, 0x82, 0x3D, 0xC5, 0xF5, 0x5D, 0x12},
+    {0xB5, 0xE7, 0x31, 0xCB, 0x66, 0x21, 0x0B, 0x74, 0xF9, 0xB9, 0xB7, 0xFF, 0x91, 0xD0, 0xD2, 0xCA, 0x6A, 0x71, 0xC5, 0x2E, 0x4F, 0x4A, 0x76, 0xE1, 0x19, 0xAC, 0x4B, 0x7A, 0xB1, 0xD7, 0xF6, 0xFD},
+    {0xF9, 0x17, 0xFE, 0xB4, 0x33, 0xF1, 0xFA, 0x01, 0x8F, 0x2F, 0xF4, 0xC0, 0x92, 0xA5, 0xE1, 0xA7, 0x78, 0xF9, 0x17, 0xFE, 0xB4, 0x33, 0xF1, 0xFA, 0x01, 0x8F, 0x2F, 0xF4, 0xC0, 0x92, 0xA5, 0xE1},
+    {0x6A, 0x04, 0x98, 0x8D, 0xDA, 0x6B, 0x22, 0x19, 0x78, 0xA1, 0xA0, 0x86, 0x07, 0xF2, 0x89, 0x42, 0xE6, 0xF8, 0x72, 0x5A, 0xB8, 0xD8, 0x27, 0xA7, 0x74, 0x8E, 0xB0, 0x6F, 0xBA, 0x94, 0xA2, 0xCA},
+    {0x19, 0x74, 0x18, 0xAB, 0x6D, 0x6C, 0xB3, 0xC6, 0x01, 0xDF, 0x75, 0xC7, 0xDE, 0xAA, 0xB2, 0x19, 0x74, 0x18, 0xAB, 0x6D, 0x6C, 0xB3, 0xC6, 0x01, 0xDF, 0x75, 0xC7, 0xDE, 0xAA, 0xB2, 0x19, 0x74},
+    {0x89, 0x56, 0x93, 0x2F, 0xF5, 0x31, 0xF3, 0xB2, 0xA7, 0xDD, 0x39, 0x0D, 0xFF, 0x33, 0x0F, 0x03, 0x82, 0x2A, 0xF4, 0x4F, 0x68, 0x63, 0x1F, 0x78, 0x18, 0x85, 0xD7, 0x3B, 0xF1, 0x4E, 0x16, 0xF8},
+    {0xD8, 0xC2, 0x88, 0x2C, 0xB9, 0x86, 0x9E, 0xB3, 0xFA, 0xC9, 0x04, 0xCE, 0x5D, 0xCB, 0x63, 0x23, 0xFB, 0x39, 0xB1, 0x9D, 0x24, 0xA2, 0x3C, 0x8F, 0x75, 0xBC, 0xB8, 0x76, 0x2B, 0xE0, 0x83, 0xA0},
+    {0xBA, 0xD0, 0xFA, 0x14, 0x9F, 0xF4, 0x36, 0xAA, 0xE1, 0x41, 0x2C, 0x17, 0x20, 0x62, 0xF1, 0x70, 0x97, 0x2F, 0xA8, 0xB6, 0xA5, 0x2B, 0x06, 0xF9, 0xAB, 0x09, 0x33, 0xEC, 0xDC, 0x8F, 0xC5, 0x8D},
+    {0x53, 0xBD, 0x63, 0xA7, 0x8C, 0x08, 0x86, 0x6C, 0xF1, 0x03, 0x93, 0xD5, 0xD1, 0x92, 0xA4, 0x1F, 0xDD, 0x57, 0xFE, 0x55, 0x1C, 0x4E, 0x82, 0x2F, 0xC7, 0xB8, 0x51, 0x5F, 0x78, 0x39, 0xED, 0x4D},
+    {0x5E, 0x49, 0x24, 0xCF, 0x46, 0xF8, 0x10, 0xDE, 0xA5, 0x1E, 0x3F, 0x39, 0xB7, 0xBA, 0x1C, 0x45, 0xBF, 0xD5, 0x8D, 0x4A, 0x63, 0x0A, 0x15, 0x17, 0x6D, 0xEB, 0x89, 0xBE, 0xE8, 0xCE, 0x7B, 0xBB},
+    {0xC8, 0x2E, 0xB8, 0x69, 0x23, 0x8C, 0xB9, 0x6D, 0x33, 0xCC, 0x3E, 0xF8, 0xEE, 0xB6, 0x51, 0xC3, 0x02, 0x08, 0x20, 0x80, 0x89, 0xAD, 0x3D, 0xF4, 0xDE, 0x76, 0x5F, 0xFB, 0xE2, 0x86, 0x91, 0xCD},
+    {0xDD, 0x08, 0x5B, 0x33, 0xD2, 0x32, 0x2A, 0xC7, 0x92, 0x63, 0x35, 0x4B, 0x85, 0xB4, 0x11, 0x4E, 0x93, 0x9B, 0xC0, 0xF3, 0x21, 0x13, 0x39, 0xFE, 0x6C, 0x0F, 0x3A, 0x71, 0xF4, 0x40, 0x51, 0x1F},
+    {0xDC, 0xE8, 0xF4, 0xB6, 0x69, 0xA7, 0x2C, 0xAB, 0xB4, 0xD0, 0x70, 0x8F, 0x72, 0x36, 0xA5, 0x95, 0x7C, 0x17, 0x09, 0xF2, 0xFA, 0x97, 0xC5, 0xC0, 0xAA, 0x2B, 0x78, 0xE2, 0x20, 0x33, 0xCF, 0x14},
+    {0xC2, 0xAC, 0x57, 0x20, 0xF7, 0x05, 0xE6, 0x75, 0xC0, 0xBB, 0x1E, 0xDD, 0xB9, 0x09, 0x94, 0x44, 0x47, 0x98, 0x36, 0x76, 0x1F, 0x15, 0x5E, 0xB4, 0xB3, 0x42, 0x7E, 0x43, 0xB6, 0xA4, 0x0B, 0x83},
+    {0x11, 0x03, 0x7E, 0xF4, 0xB8, 0x63, 0x88, 0x18, 0xFE, 0x3B, 0xD2, 0x16, 0xD5, 0xC0, 0x6B, 0x5F, 0x8C, 0xB0, 0xB4, 0x1C, 0x56, 0x71, 0xF5, 0x92, 0xB2, 0xE0, 0x39, 0x86, 0x33, 0x05, 0x82, 0x9B},
+    {0x79, 0x27, 0x13, 0xE2, 0x5C, 0x94, 0x45, 0xDF, 0xF4, 0x29, 0x7D, 0xE0, 0xFC, 0x20, 0x24, 0xE3, 0x0C, 0xCE, 0xB6, 0xC1, 0x88, 0x99, 0xDB, 0x33, 0xC6, 0xBF, 0x98, 0x8B, 0x69, 0x35, 0xA1, 0xE4},
+    {0x5C, 0xFD, 0x03, 0xE8, 0x2E, 0xBD, 0xC2, 0x74, 0x17, 0x9D, 0x61, 0x3A, 0xC8, 0x8D, 0xF3, 0x1D, 0x64, 0x85, 0xBA, 0xCD, 0x32, 0x81, 0x5D, 0xA5, 0x19, 0x83, 0xED, 0x91, 0xCF, 0x82, 0xB5, 0x8B},
+    {0xF4, 0x92, 0xE1, 0x78, 0x17, 0xB4, 0xF1, 0x01, 0x2F, 0xC0, 0xA5, 0xA7, 0xF9, 0xFE, 0x33, 0xFA, 0x8F, 0xF4, 0x92, 0xE1, 0x78, 0x17, 0xB4, 0xF1, 0x01, 0x2F, 0xC0, 0xA5, 0xA7, 0xF9, 0xFE, 0x33},
+    {0xFC, 0x5C, 0x11, 0xDC, 0xC8, 0x53, 0xD8, 0x19, 0xF9, 0x1B, 0x52, 0x4E, 0xF0, 0xA8, 0x68, 0x1E, 0x15, 0x0D, 0x62, 0x90, 0x93, 0xAE, 0x12, 0xE1, 0x74, 0xA0, 0x4D, 0xCD, 0x14, 0x9B, 0x8B, 0xC1},
+    {0x0C, 0x10, 0xBD, 0x2B, 0x64, 0x0D, 0x91, 0xC6, 0x8F, 0xEE, 0xEF, 0x6E, 0x15, 0xB1, 0x3B, 0xD9, 0x26, 0xF5, 0xCB, 0x1E, 0x28, 0x60, 0x80, 0xFA, 0xDF, 0x2E, 0x68, 0x1D, 0x2C, 0xED, 0xEB, 0xE3},
+    {0x88, 0x57, 0xFF, 0xF1, 0x32, 0x9B, 0x40, 0xB2, 0x78, 0xB0, 0x55, 0xD2, 0x93, 0xF4, 0xBD, 0x6E, 0x28, 0xED, 0x33, 0x4E, 0x71, 0xD1, 0x6B, 0xA7, 0x18, 0x5B, 0x11, 0x3A, 0x2F, 0x4F, 0xA4, 0xE0},
+    {0xC6, 0xDF, 0xC7, 0xAA, 0x19, 0x18, 0x6D, 0xB3, 0x01, 0x75, 0xDE, 0xB2, 0x74, 0xAB, 0x6C, 0xC6, 0xDF, 0xC7, 0xAA, 0x19, 0x18, 0x6D, 0xB3, 0x01, 0x75, 0xDE, 0xB2, 0x74, 0xAB, 0x6C, 0xC6, 0xDF},
+    {0x69, 0x06, 0x17, 0xBA, 0xCF, 0x8F, 0xA8, 0xAA, 0xA7, 0x4C, 0x09, 0xF1, 0x14, 0x72, 0x92, 0x2B, 0x2C, 0xFE, 0xF2, 0xDC, 0x2F, 0x36, 0xAF, 0x78, 0xAB, 0x62, 0xFA, 0xE8, 0x8D, 0xA5, 0x41, 0xE2},
+    {0x3B, 0x4E, 0xF8, 0xC0, 0xA4, 0x13, 0xB0, 0x6C, 0xFA, 0x71, 0x53, 0x51, 0xE0, 0x17, 0x55, 0x05, 0x7E, 0xD1, 0xA5, 0x88, 0x08, 0x4D, 0xD2, 0x8F, 0xC7, 0x6B, 0x35, 0x57, 0xB4, 0x89, 0x93, 0xF5},
+    {0x7B, 0x7D, 0xDD, 0xB1, 0x52, 0x56, 0x96, 0xDE, 0xE1, 0x64, 0xE4, 0x94, 0xBE, 0xC5, 0xB8, 0x65, 0xD4, 0x86, 0xD0, 0x46, 0x98, 0x79, 0x1D, 0xF9, 0x6D, 0xD3, 0x16, 0xAE, 0xCB, 0x1F, 0x99, 0x49},
+    {0x60, 0xA3, 0x3A, 0xC5, 0x29, 0x6E, 0xA9, 0x6D, 0xF1, 0xE6, 0x10, 0xF3, 0x0B, 0xE2, 0x4D, 0x90, 0xF0, 0x53, 0x69, 0xAC, 0x85, 0xEB, 0x42, 0x2F, 0xDE, 0x38, 0x28, 0xDB, 0xD0, 0x32, 0x7F, 0xEF},
+    {0xD5, 0xB8, 0x6E, 0xF9, 0xD7, 0x0F, 0x93, 0xC7, 0xA5, 0xE0, 0xB0, 0x3B, 0x03, 0x2F, 0x40, 0x21, 0x4B, 0x5B, 0xF1, 0x82, 0xF5, 0x6B, 0x88, 0x17, 0x6C, 0x4E, 0x2A, 0x31, 0xE1, 0x28, 0x86, 0x1C},
+    {0x2C, 0x20, 0xF1, 0x97, 0xA8, 0xA5, 0x06, 0xAB, 0x33, 0xDC, 0xC5, 0x92, 0x95, 0x4C, 0xB4, 0xCF, 0xE8, 0xC0, 0xAF, 0x7C, 0xFE, 0xD0, 0x14, 0xF4, 0xAA, 0x41, 0x17, 0x62, 0x70, 0x2F, 0xB6, 0x2B},
+    {0x46, 0xAE, 0xF3, 0x41, 0x54, 0x3B, 0xCA, 0x75, 0x92, 0xC3, 0xFC, 0x4D, 0xD9, 0x9F, 0x31, 0xC2, 0x83, 0xD7, 0xEC, 0x26, 0x53, 0xC1, 0x02, 0xFE, 0xB3, 0x6A, 0xF5, 0xC4, 0x06, 0x85, 0x52, 0xBE},
+    {0x5F, 0x39, 0x4D, 0xFA, 0x2A, 0x40, 0x6E, 0x18, 0xB4, 0x05, 0xF8, 0x31, 0x21, 0xF9, 0xFF, 0xD2, 0x71, 0x4F, 0xE1, 0x4B, 0xD7, 0x89, 0x7E, 0xC0, 0xB2, 0x28, 0x5B, 0x0F, 0x8F, 0x53, 0x63, 0x8C},
+    {0xD6, 0x0C, 0x53, 0xAF, 0x15, 0x5B, 0xCD, 0xDF, 0xC0, 0x22, 0xD4, 0xD7, 0xA2, 0xE8, 0x4F, 0x38, 0xA9, 0xFF, 0xCF, 0x04, 0x31, 0x65, 0x8E, 0xB4, 0xC6, 0xC8, 0x40, 0x1E, 0x4C, 0x4D, 0xE3, 0x58},
+    {0x0E, 0x9C, 0x85, 0xF2, 0xC9, 0xF5, 0x87, 0x74, 0xFE, 0xD3, 0x47, 0x53, 0x7D, 0x2C, 0xD7, 0xCC, 0x3D, 0x31, 0x2B, 0x99, 0x4D, 0x44, 0x96, 0x92, 0x19, 0x77, 0x3B, 0x3C, 0x72, 0xF3, 0x8A, 0x2D},
+    {0xB4, 0xFA, 0x2F, 0x92, 0xA7, 0x17, 0x33, 0x01, 0xF4, 0xA5, 0x78, 0xFE, 0xF1, 0x8F, 0xC0, 0xE1, 0xF9, 0xB4, 0xFA, 0x2F, 0x92, 0xA7, 0x17, 0x33, 0x01, 0xF4, 0xA5, 0x78, 0xFE, 0xF1, 0x8F, 0xC0},
+    {0xE7, 0xC1, 0x28, 0x09, 0x90, 0x2A, 0x29, 0x19, 0x17, 0xF7, 0x46, 0xF5, 0x66, 0x7C, 0x5B, 0xA2, 0x04, 0x40, 0x95, 0x7A, 0x3B, 0xBE, 0x43, 0xA5, 0x74, 0xDB, 0x0F, 0xF0, 0x36, 0x6E, 0xFC, 0xF6},
+    {0xB9, 0xF7, 0x32, 0xA8, 0x48, 0x28, 0x49, 0xC6, 0x2F, 0x4A, 0x73, 0x85, 0x59, 0x97, 0x53, 0x27, 0xA1, 0x4D, 0x70, 0x30, 0xF3, 0x84, 0xB7, 0xF1, 0xDF, 0x7B, 0x6E, 0x67, 0x62, 0x3A, 0x43, 0x76},
+    {0x71, 0x40, 0x1F, 0x17, 0x24, 0x16, 0xD1, 0xB2, 0xF9, 0x4D, 0x03, 0x98, 0x6B, 0x78, 0x86, 0x89, 0xF8, 0xB8, 0xA7, 0xB0, 0x94, 0x82, 0x53, 0xE1, 0x18, 0x55, 0x56, 0xCE, 0xA5, 0xDD, 0x5B, 0xD2},
+    {0xAC, 0xDB, 0x89, 0x9F, 0x12, 0x35, 0x2D, 0xB3, 0x8F, 0x7B, 0x1D, 0x08, 0xF7, 0x14, 0xD1, 0x22, 0x8E, 0x55, 0xDC, 0x43, 0x51, 0x64, 0x49, 0xFA, 0x75, 0x0E, 0x13, 0x1B, 0xEC, 0xF8, 0x29, 0x0B},
+    {0x70, 0x72, 0xA5, 0x7C, 0x09, 0xFA, 0xC5, 0xAA, 0x78, 0x20, 0xCF, 0x2F, 0xCB, 0x06, 0xFE, 0xEC, 0x9F, 0x92, 0x41, 0xB1, 0xF1, 0xE8, 0xB6, 0xA7, 0xAB, 0xD0, 0x8F, 0x36, 0x95, 0x17, 0xF2, 0x97},
+    {0xB2, 0x18, 0x6C, 0x01, 0xC7, 0xB2, 0x18, 0x6C, 0x01, 0xC7, 0xB2, 0x18, 0x6C, 0x01, 0xC7, 0xB2, 0x18, 0x6C, 0x01, 0xC7, 0xB2, 0x18, 0x6C, 0x01, 0xC7, 0xB2, 0x18, 0x6C, 0x01, 0xC7, 0xB2, 0x18},
+    {0xA3, 0xBF, 0x4F, 0x95, 0xA0, 0x11, 0x26, 0xDE, 0xA7, 0x2D, 0xD3, 0x71, 0x29, 0x41, 0xED, 0xCD, 0xC8, 0xBD, 0x06, 0xDB, 0xD2, 0x96, 0x0E, 0x78, 0x6D, 0xD9, 0x9B, 0xD8, 0x7C, 0xFF, 0x45, 0x7F},
+    {0xDA, 0x73, 0xED, 0xEC, 0x50, 0x68, 0x3F, 0x6D, 0xFA, 0xB5, 0x76, 0x28, 0x34, 0xDC, 0xF5, 0x7D, 0x99, 0x3B, 0x14, 0x1A, 0x6E, 0xB9, 0xFD, 0x8F, 0xDE, 0x0A, 0x0D, 0x37, 0x9F, 0xBD, 0x84, 0x6F},
+    {0x86, 0x05, 0x9B, 0xA5, 0x28, 0x4D, 0x3A, 0xC7, 0xE1, 0x57, 0x24, 0x93, 0x31, 0xA7, 0x0D, 0x0F, 0x2A, 0x68, 0x78, 0xD7, 0x4E, 0xCE, 0xA4, 0xF9, 0x6C, 0x32, 0x53, 0x6E, 0x17, 0x11, 0x7E, 0xB8},
+    {0x72, 0x69, 0xF9, 0x62, 0x14, 0xC0, 0x95, 0xAB, 0xF1, 0x9F, 0xCB, 0x78, 0x09, 0x70, 0xF4, 0xAF, 0x4C, 0x33, 0x97, 0x36, 0xA7, 0xB1, 0xEC, 0x2F, 0xAA, 0x7C, 0xB4, 0xDC, 0xA8, 0xE1, 0xE2, 0xF2},
+    {0x8E, 0x80, 0x82, 0x36, 0x0A, 0xED, 0xCC, 0x75, 0xA5, 0xD4, 0x9E, 0x32, 0xE5, 0x95, 0x85, 0x37, 0x50, 0xF3, 0x7C, 0xA6, 0x3A, 0xBC, 0x65, 0x17, 0xB3, 0x3D, 0xBD, 0x3F, 0x09, 0x03, 0xEE, 0x22},
+    {0x82, 0x31, 0x35, 0xFE, 0x05, 0x98, 0xA4, 0x18, 0x33, 0x93, 0x40, 0x88, 0x86, 0xFA, 0xCE, 0x63, 0x39, 0x24, 0x8F, 0xB8, 0xE0, 0x5B, 0x4E, 0xF4, 0xB2, 0x57, 0x94, 0x7E, 0x92, 0x13, 0xD7, 0x03},
+    {0x0A, 0xE4, 0x05, 0x72, 0xC1, 0x39, 0xA3, 0xDF, 0x92, 0xAC, 0x49, 0x56, 0xE7, 0x2B, 0xB0, 0xD6, 0x58, 0x6B, 0x2C, 0xF6, 0x16, 0x7B, 0x0B, 0xFE, 0xC6, 0x7F, 0x63, 0xFC, 0xF2, 0x7E, 0x79, 0x3F},
+    {0xCC, 0x30, 0xA4, 0x4C, 0xA3, 0x7E, 0x4A, 0x74, 0xB4, 0xAD, 0x1A, 0x1F, 0x60, 0xCF, 0x98, 0xC1, 0xFC, 0x94, 0xE8, 0xEF, 0xDD, 0x34, 0x3E, 0xC0, 0x19, 0xB7, 0x05, 0x7F, 0xAF, 0x57, 0x59, 0x3D},
+    {0xA5, 0xF9, 0x33, 0x8F, 0x92, 0x78, 0xB4, 0x01, 0xC0, 0xA7, 0xFE, 0xFA, 0xF4, 0xE1, 0x17, 0xF1, 0x2F, 0xA5, 0xF9, 0x33, 0x8F, 0x92, 0x78, 0xB4, 0x01, 0xC0, 0xA7, 0xFE, 0xFA, 0xF4, 0xE1, 0x17},
+    {0x9E, 0xE6, 0x40, 0x06, 0x49, 0x3A, 0x1A, 0x19, 0xFE, 0xE3, 0xEE, 0x21, 0x5E, 0xEC, 0x9B, 0x48, 0x67, 0x11, 0x9F, 0xBB, 0x4B, 0x80, 0x0C, 0x92, 0x74, 0x34, 0x32, 0x7B, 0x41, 0x5B, 0x42, 0xBC},
+    {0xE5, 0x0A, 0x86, 0x70, 0xE7, 0x5F, 0x60, 0xC6, 0xF4, 0xC2, 0x5E, 0x89, 0xB5, 0xAF, 0x08, 0xD3, 0x96, 0x51, 0x4C, 0xFD, 0xF8, 0xBB, 0x83, 0x33, 0xDF, 0xEF, 0x8C, 0xF6, 0x97, 0xB8, 0x3F, 0xA6},
+    {0x85, 0xD2, 0xCE, 0xE1, 0xB0, 0x89, 0x98, 0xB2, 0x17, 0x0F, 0x9B, 0x63, 0x08, 0xF1, 0xD5, 0xA4, 0x57, 0x1C, 0x2F, 0x51, 0x39, 0x11, 0x2A, 0xA5, 0x18, 0x94, 0xF8, 0x6B, 0xF9, 0x24, 0x71, 0xF3},
+    {0x50, 0x87, 0x39, 0xD0, 0x58, 0x51, 0xFC, 0xB3, 0x2F, 0x66, 0x67, 0x1C, 0x96, 0x69, 0x57, 0x61, 0x81, 0xA4, 0xE2, 0xD3, 0xD5, 0x48, 0x7A, 0xF1, 0x75, 0xC1, 0x08, 0xD6, 0xC5, 0x63, 0x77, 0x37},
+    {0x7C, 0x62, 0x8F, 0xCB, 0x2C, 0x33, 0xE8, 0xAA, 0xF9, 0xF2, 0x9F, 0xA5, 0x4C, 0xD0, 0x2F, 0x69, 0xE2, 0xF1, 0xC5, 0xAF, 0x17, 0xEC, 0x72, 0xE1, 0xAB, 0xCF, 0xF4, 0x2B, 0xB1, 0xFA, 0xA8, 0x95},
+    {0x3A, 0x4F, 0xE0, 0xB4, 0x16, 0xB8, 0xDD, 0x6C, 0x8F, 0x68, 0x4B, 0x24, 0xF8, 0xA5, 0x39, 0x1C, 0xD5, 0x63, 0x17, 0x89, 0xCE, 0x21, 0x0D, 0xFA, 0xC7, 0x1F, 0x86, 0x56, 0xC0, 0x88, 0xFF, 0x32},
+    {0x65, 0x60, 0x4E, 0x8D, 0x0B, 0xD7, 0x3E, 0xDE, 0x78, 0x9E, 0x0C, 0x68, 0x83, 0xF2, 0x2A, 0x66, 0x7A, 0x0F, 0x72, 0xC2, 0x0D, 0xE3, 0xBC, 0xA7, 0x6D, 0xAD, 0x31, 0xAC, 0xBA, 0x93, 0xEF, 0xD4},
+    {0xB3, 0x75, 0xB2, 0xAB, 0xC6, 0xC7, 0x19, 0x6D, 0x01, 0xDE, 0x74, 0x6C, 0xDF, 0xAA, 0x18, 0xB3, 0x75, 0xB2, 0xAB, 0xC6, 0xC7, 0x19, 0x6D, 0x01, 0xDE, 0x74, 0x6C, 0xDF, 0xAA, 0x18, 0xB3, 0x75},
+    {0xBD, 0x4B, 0x94, 0x2F, 0x63, 0xB0, 0x05, 0xC7, 0xA7, 0xD7, 0x32, 0xB8, 0x8C, 0x33, 0xF8, 0x51, 0x08, 0x89, 0xF4, 0x5F, 0x86, 0x3A, 0x31, 0x78, 0x6C, 0x7E, 0x6B, 0x39, 0xF1, 0x98, 0x21, 0xED},
+    {0x09, 0x14, 0x92, 0x2C, 0xF2, 0x2F, 0xAF, 0xAB, 0xFA, 0x8D, 0x41, 0xB4, 0x97, 0xCB, 0xF9, 0xD0, 0xC5, 0xE1, 0xB1, 0x70, 0xC0, 0x06, 0xBA, 0x8F, 0xAA, 0x4C, 0xF1, 0x72, 0x2B, 0xFE, 0xDC, 0x36},
+    {0xEE, 0x23, 0xD7, 0x14, 0x79, 0x4B, 0x59, 0x75, 0xE1, 0x60, 0x42, 0x4F, 0x3F, 0x62, 0x71, 0x87, 0x77, 0xD2, 0xA8, 0x0A, 0xFF, 0xE6, 0xEF, 0xF9, 0xB3, 0x30, 0x21, 0xE4, 0xDC, 0x31, 0xFB, 0x80},
+    {0x57, 0x89, 0xF5, 0xA7, 0xFF, 0x82, 0x68, 0x18, 0xF1, 0xCE, 0x5F, 0x5B, 0x32, 0x92, 0x4B, 0x11, 0x9B, 0x21, 0xFE, 0x3A, 0x40, 0x8C, 0x24, 0x2F, 0xB2, 0x0D, 0x03, 0x4F, 0x78, 0x3B, 0xF8, 0xA4},
+    {0x26, 0xC4, 0x08, 0xCF, 0xBC, 0x88, 0x07, 0xDF, 0xA5, 0x77, 0x90, 0xD1, 0x9C, 0xBA, 0x7E, 0x76, 0xB9, 0x05, 0x8D, 0x8A, 0x55, 0xF0, 0x87, 0x17, 0xC6, 0x5A, 0xE0, 0x9E, 0xE8, 0x51, 0x54, 0xD9},
+    {0x8A, 0x9E, 0x71, 0x69, 0x5E, 0x4E, 0xE9, 0x74, 0x33, 0x58, 0x22, 0xED, 0x3C, 0xB6, 0x28, 0x59, 0x30, 0x6E, 0x20, 0xC9, 0xBD, 0x8E, 0xD6, 0xF4, 0x19, 0x25, 0x93, 0xBB, 0xE2, 0xD2, 0xBC, 0x9C},
+    {0xFA, 0xC0, 0x78, 0x33, 0x2F, 0xE1, 0xFE, 0x01, 0x92, 0xF9, 0xF1, 0xF4, 0xA7, 0xB4, 0x8F, 0xA5, 0x17, 0xFA, 0xC0, 0x78, 0x33, 0x2F, 0xE1, 0xFE, 0x01, 0x92, 0xF9, 0xF1, 0xF4, 0xA7, 0xB4, 0x8F},
+    {0x48, 0xEA, 0x56, 0xB6, 0xD4, 0x1C, 0xAE, 0x19, 0xB4, 0x26, 0x87, 0xB0, 0x45, 0x36, 0x8C, 0xFD, 0xB5, 0x5F, 0x09, 0xBF, 0x6B, 0x77, 0xD9, 0xC0, 0x74, 0x52, 0xD5, 0x65, 0x20, 0x16, 0x9A, 0x67},
+    {0xEB, 0x96, 0x21, 0x20, 0x6A, 0xF3, 0x7A, 0xC6, 0xC0, 0xFB, 0xA3, 0x9B, 0x1D, 0x09, 0x93, 0xC4, 0x54, 0x4E, 0x36, 0x64, 0x11, 0x7F, 0x23, 0xB4, 0xDF, 0x66, 0x85, 0xCA, 0xB6, 0x4B, 0xD3, 0x10},
+    {0x31, 0x28, 0x1C, 0xF4, 0x35, 0x55, 0xF8, 0xB2, 0xFE, 0x32, 0x68, 0x57, 0x05, 0xC0, 0xDD, 0x94, 0x98, 0x1F, 0xB4, 0x7E, 0xA4, 0x0D, 0x3A, 0x92, 0x18, 0x89, 0xD1, 0x13, 0x33, 0xD5, 0x6E, 0xD7},
+    {0xB7, 0x46, 0x68, 0xE2, 0xD9, 0x4F, 0x64, 0xB3, 0xF4, 0x73, 0xF6, 0x2A, 0x38, 0x20, 0x82, 0xD8, 0xA0, 0x03, 0xB6, 0xA9, 0x0F, 0xE7, 0x84, 0x33, 0x75, 0x1D, 0xFF, 0x26, 0x69, 0x0D, 0xBE, 0x4A},
+    {0xC5, 0x95, 0xB4, 0xE8, 0xAF, 0xFE, 0x14, 0xAA, 0x17, 0x70, 0xB6, 0xF9, 0xEC, 0x8D, 0x78, 0xF2, 0x72, 0xA7, 0xBA, 0x9F, 0xE1, 0x20, 0x97, 0xA5, 0xAB, 0xDC, 0x92, 0x4C, 0xCF, 0xC0, 0x7C, 0xD0},
+    {0x4B, 0x0F, 0xD1, 0x78, 0x94, 0xCE, 0x35, 0x6C, 0x2F, 0x6E, 0xFF, 0x7E, 0x63, 0xFE, 0x16, 0x6B, 0xB0, 0x56, 0x92, 0x39, 0x05, 0x4F, 0x28, 0xF1, 0xC7, 0x13, 0x24, 0x98, 0xA7, 0x55, 0x2A, 0x21},
+    {0xC9, 0xBB, 0xB0, 0xDC, 0x4A, 0x57, 0xE3, 0xDE, 0xF9, 0xA2, 0xE5, 0x8C, 0x61, 0xA8, 0x13, 0xA3, 0x7F, 0x35, 0x62, 0x81, 0x5F, 0xA6, 0x04, 0xE1, 0x6D, 0x0C, 0xA4, 0xB7, 0x14, 0x6B, 0x5E, 0x3C},
+    {0xC3, 0x07, 0x2A, 0x2B, 0x25, 0x71, 0x27, 0x6D, 0x8F, 0xC1, 0x1B, 0x82, 0x87, 0xB1, 0x32, 0xBB, 0x5E, 0x3A, 0xCB, 0x77, 0x03, 0x12, 0xFC, 0xFA, 0xDE, 0xA1, 0xD2, 0xE9, 0x2C, 0x0F, 0x5A, 0x02},
+    {0x0F, 0x53, 0x8C, 0xF1, 0xD1, 0xDD, 0x1C, 0xC7, 0x78, 0x11, 0xF5, 0x13, 0x94, 0xF4, 0xE0, 0x24, 0xCE, 0x88, 0x33, 0x98, 0x35, 0x3B, 0x9B, 0xA7, 0x6C, 0xD5, 0x1F, 0x55, 0x2F, 0x5F, 0x4D, 0x2A},
+    {0xAA, 0xAB, 0x01, 0xAA, 0xAB, 0x01, 0xAA, 0xAB, 0x01, 0xAA, 0xAB, 0x01, 0xAA, 0xAB, 0x01, 0xAA, 0xAB, 0x01, 0xAA, 0xAB, 0x01, 0xAA, 0xAB, 0x01, 0xAA, 0xAB, 0x01, 0xAA, 0xAB, 0x01, 0xAA, 0xAB},
+    {0x34, 0x50, 0x5F, 0xBA, 0x96, 0x1F, 0xF6, 0x75, 0xA7, 0x91, 0x30, 0x35, 0xEB, 0x72, 0x88, 0x52, 0xAE, 0xE0, 0xF2, 0x10, 0x13, 0x59, 0x2E, 0x78, 0xB3, 0xE7, 0xDD, 0xD3, 0x8D, 0x8C, 0x37, 0x1A},
+    {0xD1, 0x8C, 0x0F, 0xC0, 0x4B, 0xD2, 0x31, 0x18, 0xFA, 0xB8, 0x57, 0x03, 0xBD, 0x17, 0x3A, 0xF3, 0x85, 0x32, 0xA5, 0xED, 0x82, 0xA4, 0x86, 0x8F, 0xB2, 0xD7, 0x71, 0x21, 0xB4, 0x2A, 0x5F, 0x55},
+    {0x54, 0xAD, 0x6B, 0xB1, 0xE6, 0xA4, 0x6F, 0xDF, 0xE1, 0x25, 0xC8, 0x5F, 0x9E, 0xC5, 0x35, 0xF7, 0x43, 0x13, 0xD0, 0xBC, 0x8C, 0xCD, 0xE9, 0xF9, 0xC6, 0xDA, 0x57, 0x42, 0xCB, 0xB0, 0x3E, 0xC4},
+    {0x04, 0x1E, 0x55, 0xC5, 0x73, 0x24, 0xEE, 0x74, 0xF1, 0xE5, 0x83, 0x05, 0xDA, 0xE2, 0x56, 0x0E, 0x2D, 0x16, 0x69, 0x6F, 0x7E, 0xC2, 0xA6, 0x2F, 0x19, 0x80, 0xCE, 0x84, 0xD0, 0xD1, 0x15, 0xA2},
+    {0x78, 0xF1, 0xC0, 0xF9, 0xFA, 0x92, 0x17, 0x01, 0xA5, 0xFE, 0x8F, 0xE1, 0xB4, 0x2F, 0xA7, 0x33, 0xF4, 0x78, 0xF1, 0xC0, 0xF9, 0xFA, 0x92, 0x17, 0x01, 0xA5, 0xFE, 0x8F, 0xE1, 0xB4, 0x2F, 0xA7},
+    {0x42, 0x0E, 0x0D, 0x97, 0x7D, 0xFF, 0x50, 0x19, 0x33, 0x10, 0xFB, 0x0F, 0x7B, 0x4C, 0x03, 0x9A, 0xEA, 0x82, 0xAF, 0x49, 0x2A, 0x23, 0xEB, 0xF4, 0x74, 0x37, 0x4F, 0x99, 0x70, 0x68, 0x2D, 0xE6},
+    {0x27, 0xA6, 0xD5, 0x41, 0xFD, 0xD1, 0xD4, 0xC6, 0x92, 0xA0, 0xC9, 0xA4, 0x5C, 0x9F, 0x1F, 0xEB, 0x10, 0xDD, 0xEC, 0x8B, 0x57, 0x3C, 0xD8, 0xFE, 0xDF, 0x65, 0x55, 0xB5, 0x06, 0x1C, 0xE5, 0xA1},
+    {0x94, 0xD1, 0x4B, 0xFA, 0xBD, 0x85, 0x82, 0xB2, 0xB4, 0xD5, 0x88, 0x11, 0x53, 0xF9, 0x4E, 0x68, 0x0D, 0x93, 0xE1, 0x4D, 0x9B, 0xE0, 0x1C, 0xC0, 0x18, 0x03, 0xF3, 0xED, 0x8F, 0x21, 0x55, 0x98},
+    {0x29, 0xA0, 0x16, 0xAF, 0x9D, 0xD5, 0x9C, 0xB3, 0xC0, 0x99, 0xCA, 0x6B, 0x1B, 0xE8, 0x5F, 0x80, 0xEE, 0x8C, 0xCF, 0x12, 0xB0, 0x6A, 0x7D, 0xB4, 0x75, 0x8A, 0x1C, 0x5D, 0x4C, 0x56, 0xD8, 0xDB},
+    {0x20, 0x9F, 0xA7, 0xF2, 0x8D, 0xF9, 0x70, 0xAA, 0xFE, 0xE8, 0x95, 0x33, 0xA8, 0x2C, 0xFA, 0xCB, 0xB1, 0x8F, 0x2B, 0x62, 0xF4, 0x7C, 0xCF, 0x92, 0xAB, 0x97, 0xE1, 0xBA, 0x72, 0x78, 0xEC, 0xB6},
+    {0xCE, 0xDD, 0xD2, 0x92, 0x85, 0x93, 0x21, 0x6C, 0xF4, 0x8C, 0x05, 0xBD, 0x0D, 0x8F, 0x6E, 0x3B, 0xF5, 0x28, 0xFA, 0x68, 0xED, 0x7E, 0x5F, 0x33, 0xC7, 0x4B, 0x4E, 0xF3, 0xFE, 0x71, 0x1F, 0x24},
+    {0x99, 0x3C, 0x51, 0x09, 0x81, 0xE0, 0xD6, 0xDE, 0x17, 0x6A, 0x27, 0x55, 0xAE, 0x7C, 0x05, 0xEF, 0x60, 0x7E, 0x95, 0x52, 0xD1, 0xA1, 0xCA, 0xA5, 0x6D, 0x58, 0x88, 0x61, 0x36, 0x08, 0xC9, 0x7D},
+    {0xBF, 0x65, 0x3B, 0xA8, 0x83, 0x03, 0xC4, 0x6D, 0x2F, 0x8A, 0xD6, 0x40, 0xA0, 0x97, 0x21, 0x91, 0x2E, 0x4B, 0x70, 0xD8, 0x5B, 0x58, 0x9C, 0xF1, 0xDE, 0x54, 0x82, 0xC2, 0x62, 0xF5, 0xD4, 0x45},
+    {0x35, 0x1C, 0x31, 0x17, 0x82, 0x21, 0x3B, 0xC7, 0xF9, 0x56, 0x51, 0xFF, 0x9B, 0x78, 0xD2, 0xBD, 0xED, 0x71, 0xA7, 0x11, 0x4F, 0x08, 0x16, 0xE1, 0x6C, 0xF5, 0x4B, 0x03, 0xA5, 0xD7, 0xD5, 0x13},
+    {0xCF, 0xCB, 0xFE, 0x9F, 0x41, 0xF1, 0xB6, 0xAB, 0x8F, 0x95, 0xF2, 0xC0, 0xE2, 0x14, 0xE1, 0x62, 0xA8, 0xF9, 0xDC, 0x69, 0xB4, 0x72, 0x7C, 0xFA, 0xAA, 0x20, 0x2F, 0x06, 0xEC, 0x92, 0xB1, 0xE8},
+    {0x87, 0x25, 0x98, 0x7C, 0xE3, 0x6B, 0x5C, 0x75, 0x78, 0x90, 0x9A, 0x86, 0x58, 0x06, 0x89, 0x4A, 0xB7, 0xF8, 0x41, 0xD6, 0xB8, 0xEA, 0xF0, 0xA7, 0xB3, 0x8B, 0xB0, 0x0C, 0x95, 0x94, 0xE9, 0x77},
+    {0x6C, 0xC7, 0x18, 0x01, 0xB2, 0x6C, 0xC7, 0x18, 0x01, 0xB2, 0x6C, 0xC7, 0x18, 0x01, 0xB2, 0x6C, 0xC7, 0x18, 0x01, 0xB2, 0x6C, 0xC7, 0x18, 0x01, 0xB2, 0x6C, 0xC7, 0x18, 0x01, 0xB2, 0x6C, 0xC7},
+    {0x5D, 0xB9, 0x93, 0x95, 0x59, 0x31, 0x5E, 0xDF, 0xA7, 0x61, 0xDA, 0x0D, 0x3D, 0x41, 0x0F, 0x79, 0xE4, 0x2A, 0x06, 0xCC, 0x68, 0x6F, 0x81, 0x78, 0xC6, 0xBB, 0xD7, 0x30, 0x7C, 0x4E, 0x76, 0x9D},
+    {0xEA, 0x3D, 0x88, 0xEC, 0xEF, 0x86, 0x81, 0x74, 0xFA, 0xC4, 0x25, 0xCE, 0xD4, 0xDC, 0x63, 0xF6, 0xE7, 0x39, 0x14, 0x65, 0x24, 0xE9, 0x54, 0x8F, 0x19, 0x61, 0xB8, 0x60, 0x9F, 0xE0, 0xCC, 0x9A},
+    {0x2F, 0x78, 0xFA, 0xA5, 0xB4, 0xF4, 0xF9, 0x01, 0xE1, 0x33, 0xC0, 0x17, 0x8F, 0xA7, 0xF1, 0x92, 0xFE, 0x2F, 0x78, 0xFA, 0xA5, 0xB4, 0xF4, 0xF9, 0x01, 0xE1, 0x33, 0xC0, 0x17, 0x8F, 0xA7, 0xF1},
+    {0x64, 0xCA, 0x63, 0x62, 0x5A, 0x08, 0x47, 0x19, 0xF1, 0x79, 0xDB, 0xD5, 0x02, 0x70, 0xA4, 0x9E, 0xBC, 0x57, 0x97, 0xC3, 0x1C, 0x29, 0xE4, 0x2F, 0x74, 0x44, 0x51, 0x07, 0xA8, 0x39, 0x6A, 0x1D},
+    {0xAD, 0x38, 0x24, 0x36, 0x2D, 0xF8, 0x84, 0xC6, 0xA5, 0x34, 0x2E, 0x39, 0xE6, 0x95, 0x1C, 0x12, 0x1B, 0xD5, 0x7C, 0x42, 0x63, 0x91, 0x1A, 0x17, 0xDF, 0x73, 0x89, 0x0E, 0x09, 0xCE, 0xA9, 0x3E},
+    {0x6E, 0x11, 0xB8, 0xFE, 0xD5, 0x8C, 0x56, 0xB2, 0x33, 0x4F, 0x85, 0xF8, 0x13, 0xFA, 0x51, 0x55, 0xD1, 0x08, 0x8F, 0x35, 0x89, 0xF3, 0xFF, 0xF4, 0x18, 0x16, 0x5F, 0x1C, 0x92, 0x86, 0x9B, 0x28},
+    {0x61, 0x4A, 0x5B, 0x72, 0xA9, 0x32, 0x1E, 0xB3, 0x92, 0x6F, 0xB5, 0x4B, 0x3E, 0x2B, 0x11, 0x29, 0xDB, 0x9B, 0x2C, 0xAD, 0x21, 0xFD, 0xDA, 0xFE, 0x75, 0x15, 0x3A, 0x38, 0xF2, 0x40, 0xB7, 0x81},
+    {0xCB, 0x09, 0xF4, 0x4C, 0x97, 0xA7, 0xEC, 0xAA, 0xB4, 0xA8, 0xE2, 0x8F, 0x41, 0xCF, 0xA5, 0xBA, 0x8D, 0x17, 0xE8, 0x06, 0xFA, 0x69, 0x62, 0xC0, 0xAB, 0x9F, 0x78, 0x70, 0xAF, 0x33, 0x36, 0xB1},
+    {0xFF, 0xF5, 0x57, 0x8F, 0x88, 0x05, 0x51, 0x6C, 0xC0, 0x85, 0x2A, 0xDD, 0x56, 0xE1, 0x94, 0xB8, 0x86, 0x98, 0xF9, 0x16, 0x1F, 0x0F, 0xF3, 0xB4, 0xC7, 0x08, 0x7E, 0xE0, 0xFA, 0xA4, 0x3B, 0x4F},
+    {0x2E, 0x7A, 0x7E, 0x06, 0x44, 0x63, 0xF7, 0xDE, 0xFE, 0x30, 0xA9, 0x16, 0x23, 0xEC, 0x6B, 0x07, 0x5A, 0xB0, 0x9F, 0xFB, 0x56, 0x38, 0x59, 0x92, 0x6D, 0x43, 0x39, 0x47, 0x41, 0x05, 0x66, 0x91},
+    {0x7A, 0xF0, 0x13, 0x70, 0x22, 0x94, 0x12, 0x6D, 0xF4, 0x67, 0x26, 0xE0, 0x44, 0xAF, 0x24, 0xDA, 0x6F, 0xCE, 0x4C, 0x47, 0x88, 0xD9, 0x48, 0x33, 0xDE, 0x1B, 0x98, 0x8E, 0x97, 0x35, 0x90, 0x66},
+    {0x7E, 0x13, 0x03, 0xE1, 0x11, 0xBD, 0xFF, 0xC7, 0x17, 0xF8, 0xDD, 0x3A, 0x6E, 0xF1, 0xF3, 0x4D, 0x53, 0x85, 0x2F, 0x28, 0x32, 0x1F, 0x89, 0xA5, 0x6C, 0x4F, 0xED, 0x9B, 0xF9, 0x82, 0x35, 0x05},
+    {0x06, 0x70, 0xE1, 0xD0, 0xCB, 0xB4, 0x8D, 0xAB, 0x2F, 0x2C, 0x14, 0xA7, 0xCF, 0x69, 0x33, 0xB6, 0x20, 0xF4, 0xE2, 0xE8, 0x78, 0xDC, 0x2B, 0xF1, 0xAA, 0xBA, 0xC0, 0xB1, 0xC5, 0xF9, 0x97, 0x41},
+    {0x44, 0x22, 0x11, 0xCB, 0xA6, 0x53, 0xEA, 0x75, 0xF9, 0xBF, 0x9C, 0x4E, 0x27, 0xD0, 0x68, 0x34, 0x1A, 0x0D, 0xC5, 0xA1, 0x93, 0x8A, 0x45, 0xE1, 0xB3, 0x9A, 0x4D, 0xE5, 0xB1, 0x9B, 0x8E, 0x47},
+    {0x63, 0x94, 0xBD, 0xB4, 0x53, 0x0D, 0x9B, 0x18, 0x8F, 0x13, 0x56, 0x6E, 0x0F, 0xA5, 0x3B, 0x40, 0x5B, 0xF5, 0x17, 0x2A, 0x28, 0x16, 0x35, 0xFA, 0xB2, 0x11, 0x68, 0x4D, 0xC0, 0xED, 0x98, 0x39},
+    {0xF7, 0x12, 0xFF, 0x8D, 0xEA, 0x9B, 0x99, 0xDF, 0x78, 0xBE, 0xC3, 0xD2, 0x48, 0xF2, 0xBD, 0xA6, 0xE5, 0xED, 0x72, 0x67, 0x71, 0x02, 0x46, 0xA7, 0xC6, 0x7D, 0x11, 0x9A, 0xBA, 0x4F, 0x1B, 0x43},
+    {0xDE, 0x6D, 0xC7, 0xAB, 0x75, 0x18, 0xDF, 0x74, 0x01, 0x19, 0xC6, 0xB2, 0xB3, 0xAA, 0x6C, 0xDE, 0x6D, 0xC7, 0xAB, 0x75, 0x18, 0xDF, 0x74, 0x01, 0x19, 0xC6, 0xB2, 0xB3, 0xAA, 0x6C, 0xDE, 0x6D},
+    {0xFE, 0xF4, 0x17, 0x2F, 0xF9, 0x8F, 0x78, 0x01, 0xA7, 0xFA, 0xE1, 0xF1, 0xA5, 0x33, 0x92, 0xB4, 0xC0, 0xFE, 0xF4, 0x17, 0x2F, 0xF9, 0x8F, 0x78, 0x01, 0xA7, 0xFA, 0xE1, 0xF1, 0xA5, 0x33, 0x92},
+    {0x30, 0x67, 0xF8, 0x2C, 0xBF, 0x13, 0xBE, 0x19, 0xFA, 0x38, 0x37, 0x51, 0xA3, 0xCB, 0x55, 0x8B, 0x5C, 0xD1, 0xB1, 0x7F, 0x08, 0x50, 0xA9, 0x8F, 0x74, 0x46, 0x35, 0x45, 0x2B, 0x89, 0x48, 0x59},
+    {0xA9, 0x26, 0xDD, 0x14, 0x9C, 0x56, 0xC3, 0xC6, 0xE1, 0x37, 0x66, 0x94, 0x0E, 0x62, 0xB8, 0x9D, 0x5D, 0x86, 0xA8, 0x2D, 0x98, 0x7A, 0x50, 0xF9, 0xDF, 0x02, 0x16, 0x8A, 0xDC, 0x1F, 0xD9, 0x38},
+    {0x16, 0xE0, 0x3A, 0xA7, 0x4E, 0x6E, 0xD2, 0xB2, 0xF1, 0x51, 0x94, 0xF3, 0x3B, 0x92, 0x4D, 0x31, 0xD7, 0x53, 0xFE, 0xF5, 0x85, 0x98, 0x08, 0x2F, 0x18, 0x71, 0x28, 0x93, 0x78, 0x32, 0x88, 0x56},
+    {0x23, 0x44, 0x6E, 0xCF, 0x27, 0x0F, 0x48, 0xB3, 0xA5, 0xA3, 0x0E, 0x3B, 0x79, 0xBA, 0x40, 0x25, 0xE9, 0x5B, 0x8D, 0xE4, 0xF5, 0x2D, 0x7F, 0x17, 0x75, 0x67, 0x2A, 0xA1, 0xE8, 0x28, 0x47, 0xFB},
+    {0xEC, 0xAF, 0xF1, 0x69, 0xD0, 0xA5, 0xF2, 0xAA, 0x33, 0xCB, 0x62, 0x92, 0xBA, 0xB6, 0xB4, 0x36, 0x09, 0xC0, 0x20, 0x8D, 0xFE, 0xA8, 0xB1, 0xF4, 0xAB, 0x72, 0x17, 0xC5, 0xE2, 0x2F, 0x4C, 0x9F},
+    {0x6B, 0x24, 0xF3, 0x33, 0x68, 0x3B, 0xBD, 0x6C, 0x92, 0x55, 0xB8, 0x4D, 0x40, 0xB4, 0x31, 0xFF, 0x4F, 0xD7, 0xC0, 0x5B, 0x53, 0x86, 0xD1, 0xFE, 0xC7, 0xED, 0xF5, 0x0D, 0xF4, 0x85, 0xCE, 0xB0},
+    {0x07, 0xDA, 0x4D, 0xB6, 0x34, 0x40, 0xA6, 0xDE, 0xB4, 0x8B, 0x9D, 0x31, 0x25, 0x36, 0xFF, 0x7B, 0x49, 0x4F, 0x09, 0xE9, 0xD7, 0x5D, 0x5C, 0xC0, 0x6D, 0xE5, 0x5B, 0x1A, 0x20, 0x53, 0x6F, 0x5A},
+    {0x5A, 0x6F, 0x53, 0x20, 0x1A, 0x5B, 0xE5, 0x6D, 0xC0, 0x5C, 0x5D, 0xD7, 0xE9, 0x09, 0x4F, 0x49, 0x7B, 0xFF, 0x36, 0x25, 0x31, 0x9D, 0x8B, 0xB4, 0xDE, 0xA6, 0x40, 0x34, 0xB6, 0x4D, 0xDA, 0x07},
+    {0xB0, 0xCE, 0x85, 0xF4, 0x0D, 0xF5, 0xED, 0xC7, 0xFE, 0xD1, 0x86, 0x53, 0x5B, 0xC0, 0xD7, 0x4F, 0xFF, 0x31, 0xB4, 0x40, 0x4D, 0xB8, 0x55, 0x92, 0x6C, 0xBD, 0x3B, 0x68, 0x33, 0xF3, 0x24, 0x6B},
+    {0x9F, 0x4C, 0x2F, 0xE2, 0xC5, 0x17, 0x72, 0xAB, 0xF4, 0xB1, 0xA8, 0xFE, 0x8D, 0x20, 0xC0, 0x09, 0x36, 0xB4, 0xB6, 0xBA, 0x92, 0x62, 0xCB, 0x33, 0xAA, 0xF2, 0xA5, 0xD0, 0x69, 0xF1, 0xAF, 0xEC},
+    {0xFB, 0x47, 0x28, 0xE8, 0xA1, 0x2A, 0x67, 0x75, 0x17, 0x7F, 0x2D, 0xF5, 0xE4, 0x8D, 0x5B, 0xE9, 0x25, 0x40, 0xBA, 0x79, 0x3B, 0x0E, 0xA3, 0xA5, 0xB3, 0x48, 0x0F, 0x27, 0xCF, 0x6E, 0x44, 0x23},
+    {0x56, 0x88, 0x32, 0x78, 0x93, 0x28, 0x71, 0x18, 0x2F, 0x08, 0x98, 0x85, 0xF5, 0xFE, 0x53, 0xD7, 0x31, 0x4D, 0x92, 0x3B, 0xF3, 0x94, 0x51, 0xF1, 0xB2, 0xD2, 0x6E, 0x4E, 0xA7, 0x3A, 0xE0, 0x16},
+    {0x38, 0xD9, 0x1F, 0xDC, 0x8A, 0x16, 0x02, 0xDF, 0xF9, 0x50, 0x7A, 0x98, 0x2D, 0xA8, 0x86, 0x5D, 0x9D, 0xB8, 0x62, 0x0E, 0x94, 0x66, 0x37, 0xE1, 0xC6, 0xC3, 0x56, 0x9C, 0x14, 0xDD, 0x26, 0xA9},
+    {0x59, 0x48, 0x89, 0x2B, 0x45, 0x35, 0x46, 0x74, 0x8F, 0xA9, 0x50, 0x08, 0x7F, 0xB1, 0xD1, 0x5C, 0x8B, 0x55, 0xCB, 0xA3, 0x51, 0x37, 0x38, 0xFA, 0x19, 0xBE, 0x13, 0xBF, 0x2C, 0xF8, 0x67, 0x30},
+    {0x92, 0x33, 0xA5, 0xF1, 0xE1, 0xFA, 0xA7, 0x01, 0x78, 0x8F, 0xF9, 0x2F, 0x17, 0xF4, 0xFE, 0xC0, 0xB4, 0x92, 0x33, 0xA5, 0xF1, 0xE1, 0xFA, 0xA7, 0x01, 0x78, 0x8F, 0xF9, 0x2F, 0x17, 0xF4, 0xFE},
+    {0x6D, 0xDE, 0x6C, 0xAA, 0xB3, 0xB2, 0xC6, 0x19, 0x01, 0x74, 0xDF, 0x18, 0x75, 0xAB, 0xC7, 0x6D, 0xDE, 0x6C, 0xAA, 0xB3, 0xB2, 0xC6, 0x19, 0x01, 0x74, 0xDF, 0x18, 0x75, 0xAB, 0xC7, 0x6D, 0xDE},
+    {0x43, 0x1B, 0x4F, 0xBA, 0x9A, 0x11, 0x7D, 0xC6, 0xA7, 0x46, 0x02, 0x71, 0x67, 0x72, 0xED, 0xE5, 0xA6, 0xBD, 0xF2, 0x48, 0xD2, 0xC3, 0xBE, 0x78, 0xDF, 0x99, 0x9B, 0xEA, 0x8D, 0xFF, 0x12, 0xF7},
+    {0x39, 0x98, 0xED, 0xC0, 0x4D, 0x68, 0x11, 0xB2, 0xFA, 0x35, 0x16, 0x28, 0x2A, 0x17, 0xF5, 0x5B, 0x40, 0x3B, 0xA5, 0x0F, 0x6E, 0x56, 0x13, 0x8F, 0x18, 0x9B, 0x0D, 0x53, 0xB4, 0xBD, 0x94, 0x63},
+    {0x47, 0x8E, 0x9B, 0xB1, 0xE5, 0x4D, 0x9A, 0xB3, 0xE1, 0x45, 0x8A, 0x93, 0xA1, 0xC5, 0x0D, 0x1A, 0x34, 0x68, 0xD0, 0x27, 0x4E, 0x9C, 0xBF, 0xF9, 0x75, 0xEA, 0x53, 0xA6, 0xCB, 0x11, 0x22, 0x44},
+    {0x41, 0x97, 0xF9, 0xC5, 0xB1, 0xC0, 0xBA, 0xAA, 0xF1, 0x2B, 0xDC, 0x78, 0xE8, 0xE2, 0xF4, 0x20, 0xB6, 0x33, 0x69, 0xCF, 0xA7, 0x14, 0x2C, 0x2F, 0xAB, 0x8D, 0xB4, 0xCB, 0xD0, 0xE1, 0x70, 0x06},
+    {0x05, 0x35, 0x82, 0xF9, 0x9B, 0xED, 0x4F, 0x6C, 0xA5, 0x89, 0x1F, 0x32, 0x28, 0x2F, 0x85, 0x53, 0x4D, 0xF3, 0xF1, 0x6E, 0x3A, 0xDD, 0xF8, 0x17, 0xC7, 0xFF, 0xBD, 0x11, 0xE1, 0x03, 0x13, 0x7E},
+    {0x66, 0x90, 0x35, 0x97, 0x8E, 0x98, 0x1B, 0xDE, 0x33, 0x48, 0xD9, 0x88, 0x47, 0x4C, 0xCE, 0x6F, 0xDA, 0x24, 0xAF, 0x44, 0xE0, 0x26, 0x67, 0xF4, 0x6D, 0x12, 0x94, 0x22, 0x70, 0x13, 0xF0, 0x7A},
+    {0x91, 0x66, 0x05, 0x41, 0x47, 0x39, 0x43, 0x6D, 0x92, 0x59, 0x38, 0x56, 0xFB, 0x9F, 0xB0, 0x5A, 0x07, 0x6B, 0xEC, 0x23, 0x16, 0xA9, 0x30, 0xFE, 0xDE, 0xF7, 0x63, 0x44, 0x06, 0x7E, 0x7A, 0x2E},
+    {0x4F, 0x3B, 0xA4, 0xFA, 0xE0, 0x7E, 0x08, 0xC7, 0xB4, 0xF3, 0x0F, 0x1F, 0x16, 0xF9, 0x98, 0x86, 0xB8, 0x94, 0xE1, 0x56, 0xDD, 0x2A, 0x85, 0xC0, 0x6C, 0x51, 0x05, 0x88, 0x8F, 0x57, 0xF5, 0xFF},
+    {0xB1, 0x36, 0x33, 0xAF, 0x70, 0x78, 0x9F, 0xAB, 0xC0, 0x62, 0x69, 0xFA, 0x06, 0xE8, 0x17, 0x8D, 0xBA, 0xA5, 0xCF, 0x41, 0x8F, 0xE2, 0xA8, 0xB4, 0xAA, 0xEC, 0xA7, 0x97, 0x4C, 0xF4, 0x09, 0xCB},
+    {0x81, 0xB7, 0x40, 0xF2, 0x38, 0x3A, 0x15, 0x75, 0xFE, 0xDA, 0xFD, 0x21, 0xAD, 0x2C, 0x9B, 0xDB, 0x29, 0x11, 0x2B, 0x3E, 0x4B, 0xB5, 0x6F, 0x92, 0xB3, 0x1E, 0x32, 0xA9, 0x72, 0x5B, 0x4A, 0x61},
+    {0x28, 0x9B, 0x86, 0x92, 0x1C, 0x5F, 0x16, 0x18, 0xF4, 0xFF, 0xF3, 0x89, 0x35, 0x8F, 0x08, 0xD1, 0x55, 0x51, 0xFA, 0x13, 0xF8, 0x85, 0x4F, 0x33, 0xB2, 0x56, 0x8C, 0xD5, 0xFE, 0xB8, 0x11, 0x6E},
+    {0x3E, 0xA9, 0xCE, 0x09, 0x0E, 0x89, 0x73, 0xDF, 0x17, 0x1A, 0x91, 0x63, 0x42, 0x7C, 0xD5, 0x1B, 0x12, 0x1C, 0x95, 0xE6, 0x39, 0x2E, 0x34, 0xA5, 0xC6, 0x84, 0xF8, 0x2D, 0x36, 0x24, 0x38, 0xAD},
+    {0x1D, 0x6A, 0x39, 0xA8, 0x07, 0x51, 0x44, 0x74, 0x2F, 0xE4, 0x29, 0x1C, 0xC3, 0x97, 0x57, 0xBC, 0x9E, 0xA4, 0x70, 0x02, 0xD5, 0xDB, 0x79, 0xF1, 0x19, 0x47, 0x08, 0x5A, 0x62, 0x63, 0xCA, 0x64},
+    {0xF1, 0xA7, 0x8F, 0x17, 0xC0, 0x33, 0xE1, 0x01, 0xF9, 0xF4, 0xB4, 0xA5, 0xFA, 0x78, 0x2F, 0xFE, 0x92, 0xF1, 0xA7, 0x8F, 0x17, 0xC0, 0x33, 0xE1, 0x01, 0xF9, 0xF4, 0xB4, 0xA5, 0xFA, 0x78, 0x2F},
+    {0x9A, 0xCC, 0xE0, 0x9F, 0x60, 0xB8, 0x61, 0x19, 0x8F, 0x54, 0xE9, 0x24, 0x65, 0x14, 0x39, 0xE7, 0xF6, 0x63, 0xDC, 0xD4, 0xCE, 0x25, 0xC4, 0xFA, 0x74, 0x81, 0x86, 0xEF, 0xEC, 0x88, 0x3D, 0xEA},
+    {0x9D, 0x76, 0x4E, 0x7C, 0x30, 0xD7, 0xBB, 0xC6, 0x78, 0x81, 0x6F, 0x68, 0xCC, 0x06, 0x2A, 0xE4, 0x79, 0x0F, 0x41, 0x3D, 0x0D, 0xDA, 0x61, 0xA7, 0xDF, 0x5E, 0x31, 0x59, 0x95, 0x93, 0xB9, 0x5D},
+    {0xC7, 0x6C, 0xB2, 0x01, 0x18, 0xC7, 0x6C, 0xB2, 0x01, 0x18, 0xC7, 0x6C, 0xB2, 0x01, 0x18, 0xC7, 0x6C, 0xB2, 0x01, 0x18, 0xC7, 0x6C, 0xB2, 0x01, 0x18, 0xC7, 0x6C, 0xB2, 0x01, 0x18, 0xC7, 0x6C},
+    {0x77, 0xE9, 0x94, 0x95, 0x0C, 0xB0, 0x8B, 0xB3, 0xA7, 0xF0, 0xEA, 0xB8, 0xD6, 0x41, 0xF8, 0xB7, 0x4A, 0x89, 0x06, 0x58, 0x86, 0x9A, 0x90, 0x78, 0x75, 0x5C, 0x6B, 0xE3, 0x7C, 0x98, 0x25, 0x87},
+    {0xE8, 0xB1, 0x92, 0xEC, 0x06, 0x2F, 0x20, 0xAA, 0xFA, 0x7C, 0x72, 0xB4, 0x69, 0xDC, 0xF9, 0xA8, 0x62, 0xE1, 0x14, 0xE2, 0xC0, 0xF2, 0x95, 0x8F, 0xAB, 0xB6, 0xF1, 0x41, 0x9F, 0xFE, 0xCB, 0xCF},
+    {0x13, 0xD5, 0xD7, 0xA5, 0x03, 0x4B, 0xF5, 0x6C, 0xE1, 0x16, 0x08, 0x4F, 0x11, 0xA7, 0x71, 0xED, 0xBD, 0xD2, 0x78, 0x9B, 0xFF, 0x51, 0x56, 0xF9, 0xC7, 0x3B, 0x21, 0x82, 0x17, 0x31, 0x1C, 0x35},
+    {0x45, 0xD4, 0xF5, 0x62, 0xC2, 0x82, 0x54, 0xDE, 0xF1, 0x9C, 0x58, 0x5B, 0xD8, 0x70, 0x4B, 0x2E, 0x91, 0x21, 0x97, 0xA0, 0x40, 0xD6, 0x8A, 0x2F, 0x6D, 0xC4, 0x03, 0x83, 0xA8, 0x3B, 0x65, 0xBF},
+    {0x7D, 0xC9, 0x08, 0x36, 0x61, 0x88, 0x58, 0x6D, 0xA5, 0xCA, 0xA1, 0xD1, 0x52, 0x95, 0x7E, 0x60, 0xEF, 0x05, 0x7C, 0xAE, 0x55, 0x27, 0x6A, 0x17, 0xDE, 0xD6, 0xE0, 0x81, 0x09, 0x51, 0x3C, 0x99},
+    {0x24, 0x1F, 0x71, 0xFE, 0xF3, 0x4E, 0x4B, 0xC7, 0x33, 0x5F, 0x7E, 0xED, 0x68, 0xFA, 0x28, 0xF5, 0x3B, 0x6E, 0x8F, 0x0D, 0xBD, 0x05, 0x8C, 0xF4, 0x6C, 0x21, 0x93, 0x85, 0x92, 0xD2, 0xDD, 0xCE},
+    {0xB6, 0xEC, 0x78, 0x72, 0xBA, 0xE1, 0x97, 0xAB, 0x92, 0xCF, 0x7C, 0xF4, 0x62, 0x2B, 0x8F, 0xB1, 0xCB, 0xFA, 0x2C, 0xA8, 0x33, 0x95, 0xE8, 0xFE, 0xAA, 0x70, 0xF9, 0x8D, 0xF2, 0xA7, 0x9F, 0x20},
+    {0xDB, 0xD8, 0x56, 0x4C, 0x5D, 0x1C, 0x8A, 0x75, 0xB4, 0x7D, 0x6A, 0xB0, 0x12, 0xCF, 0x8C, 0xEE, 0x80, 0x5F, 0xE8, 0x1B, 0x6B, 0xCA, 0x99, 0xC0, 0xB3, 0x9C, 0xD5, 0x9D, 0xAF, 0x16, 0xA0, 0x29},
+    {0x98, 0x55, 0x21, 0x8F, 0xED, 0xF3, 0x03, 0x18, 0xC0, 0x1C, 0xE0, 0x9B, 0x4D, 0xE1, 0x93, 0x0D, 0x68, 0x4E, 0xF9, 0x53, 0x11, 0x88, 0xD5, 0xB4, 0xB2, 0x82, 0x85, 0xBD, 0xFA, 0x4B, 0xD1, 0x94},
+    {0xA1, 0xE5, 0x1C, 0x06, 0xB5, 0x55, 0x65, 0xDF, 0xFE, 0xD8, 0x3C, 0x57, 0x8B, 0xEC, 0xDD, 0x10, 0xEB, 0x1F, 0x9F, 0x5C, 0xA4, 0xC9, 0xA0, 0x92, 0xC6, 0xD4, 0xD1, 0xFD, 0x41, 0xD5, 0xA6, 0x27},
+    {0xE6, 0x2D, 0x68, 0x70, 0x99, 0x4F, 0x37, 0x74, 0xF4, 0xEB, 0x23, 0x2A, 0x49, 0xAF, 0x82, 0xEA, 0x9A, 0x03, 0x4C, 0x7B, 0x0F, 0xFB, 0x10, 0x33, 0x19, 0x50, 0xFF, 0x7D, 0x97, 0x0D, 0x0E, 0x42},
+    {0xA7, 0x2F, 0xB4, 0xE1, 0x8F, 0xFE, 0xA5, 0x01, 0x17, 0x92, 0xFA, 0xF9, 0xC0, 0xF1, 0x78, 0xF4, 0x33, 0xA7, 0x2F, 0xB4, 0xE1, 0x8F, 0xFE, 0xA5, 0x01, 0x17, 0x92, 0xFA, 0xF9, 0xC0, 0xF1, 0x78},
+    {0xA2, 0x15, 0xD1, 0xD0, 0x84, 0xCE, 0x80, 0x19, 0x2F, 0xA6, 0xC2, 0x7E, 0x6F, 0x69, 0x16, 0x2D, 0x0E, 0x56, 0xE2, 0xDA, 0x05, 0x83, 0xE5, 0xF1, 0x74, 0xEE, 0x24, 0x73, 0xC5, 0x55, 0x1E, 0x04},
+    {0xC4, 0x3E, 0xB0, 0xCB, 0x42, 0x57, 0xDA, 0xC6, 0xF9, 0xE9, 0xCD, 0x8C, 0xBC, 0xD0, 0x13, 0x43, 0xF7, 0x35, 0xC5, 0x9E, 0x5F, 0xC8, 0x25, 0xE1, 0xDF, 0x6F, 0xA4, 0xE6, 0xB1, 0x6B, 0xAD, 0x54},
+    {0x55, 0x5F, 0x2A, 0xB4, 0x21, 0x71, 0xD7, 0xB2, 0x8F, 0x86, 0xA4, 0x82, 0xED, 0xA5, 0x32, 0x85, 0xF3, 0x3A, 0x17, 0xBD, 0x03, 0x57, 0xB8, 0xFA, 0x18, 0x31, 0xD2, 0x4B, 0xC0, 0x0F, 0x8C, 0xD1},
+    {0x1A, 0x37, 0x8C, 0x8D, 0xD3, 0xDD, 0xE7, 0xB3, 0x78, 0x2E, 0x59, 0x13, 0x10, 0xF2, 0xE0, 0xAE, 0x52, 0x88, 0x72, 0xEB, 0x35, 0x30, 0x91, 0xA7, 0x75, 0xF6, 0x1F, 0x96, 0xBA, 0x5F, 0x50, 0x34},
+    {0xAB, 0xAA, 0x01, 0xAB, 0xAA, 0x01, 0xAB, 0xAA, 0x01, 0xAB, 0xAA, 0x01, 0xAB, 0xAA, 0x01, 0xAB, 0xAA, 0x01, 0xAB, 0xAA, 0x01, 0xAB, 0xAA, 0x01, 0xAB, 0xAA, 0x01, 0xAB, 0xAA, 0x01, 0xAB, 0xAA},
+    {0x2A, 0x4D, 0x5F, 0x2F, 0x55, 0x1F, 0xD5, 0x6C, 0xA7, 0x9B, 0x3B, 0x35, 0x98, 0x33, 0x88, 0xCE, 0x24, 0xE0, 0xF4, 0x94, 0x13, 0xF5, 0x11, 0x78, 0xC7, 0x1C, 0xDD, 0xD1, 0xF1, 0x8C, 0x53, 0x0F},
+    {0x02, 0x5A, 0x0F, 0x2C, 0xE9, 0xD2, 0xA1, 0xDE, 0xFA, 0xFC, 0x12, 0x03, 0x77, 0xCB, 0x3A, 0x5E, 0xBB, 0x32, 0xB1, 0x87, 0x82, 0x1B, 0xC1, 0x8F, 0x6D, 0x27, 0x71, 0x25, 0x2B, 0x2A, 0x07, 0xC3},
+    {0x3C, 0x5E, 0x6B, 0x14, 0xB7, 0xA4, 0x0C, 0x6D, 0xE1, 0x04, 0xA6, 0x5F, 0x81, 0x62, 0x35, 0x7F, 0xA3, 0x13, 0xA8, 0x61, 0x8C, 0xE5, 0xA2, 0xF9, 0xDE, 0xE3, 0x57, 0x4A, 0xDC, 0xB0, 0xBB, 0xC9},
+    {0x21, 0x2A, 0x55, 0xA7, 0x98, 0x24, 0x13, 0xC7, 0xF1, 0x28, 0x4F, 0x05, 0x39, 0x92, 0x56, 0xB0, 0x6B, 0x16, 0xFE, 0x63, 0x7E, 0xFF, 0x6E, 0x2F, 0x6C, 0x35, 0xCE, 0x94, 0x78, 0xD1, 0x0F, 0x4B},
+    {0xD0, 0x7C, 0xC0, 0xCF, 0x4C, 0x92, 0xDC, 0xAB, 0xA5, 0x97, 0x20, 0xE1, 0x9F, 0xBA, 0xA7, 0x72, 0xF2, 0x78, 0x8D, 0xEC, 0xF9, 0xB6, 0x70, 0x17, 0xAA, 0x14, 0xFE, 0xAF, 0xE8, 0xB4, 0x95, 0xC5},
+    {0x4A, 0xBE, 0x0D, 0x69, 0x26, 0xFF, 0x1D, 0x75, 0x33, 0x84, 0xE7, 0x0F, 0xA9, 0xB6, 0x03, 0xA0, 0xD8, 0x82, 0x20, 0x38, 0x2A, 0xF6, 0x73, 0xF4, 0xB3, 0x64, 0x4F, 0xD9, 0xE2, 0x68, 0x46, 0xB7},
+    {0xD7, 0x6E, 0xD5, 0x33, 0x13, 0xD1, 0x89, 0x18, 0x92, 0x3A, 0x0D, 0xA4, 0x7E, 0xB4, 0x1F, 0x98, 0x94, 0xDD, 0xC0, 0x05, 0x57, 0x68, 0x32, 0xFE, 0xB2, 0xF8, 0x55, 0x35, 0xF4, 0x1C, 0x28, 0x31},
+    {0x10, 0xD3, 0x4B, 0xB6, 0xCA, 0x85, 0x66, 0xDF, 0xB4, 0x23, 0x7F, 0x11, 0x64, 0x36, 0x4E, 0x54, 0xC4, 0x93, 0x09, 0x1D, 0x9B, 0xA3, 0xFB, 0xC0, 0xC6, 0x7A, 0xF3, 0x6A, 0x20, 0x21, 0x96, 0xEB},
+    {0x67, 0x9A, 0x16, 0x20, 0x65, 0xD5, 0x52, 0x74, 0xC0, 0xD9, 0x77, 0x6B, 0xBF, 0x09, 0x5F, 0xB5, 0xFD, 0x8C, 0x36, 0x45, 0xB0, 0x87, 0x26, 0xB4, 0x19, 0xAE, 0x1C, 0xD4, 0xB6, 0x56, 0xEA, 0x48},
+    {0x8F, 0xB4, 0xA7, 0xF4, 0xF1, 0xF9, 0x92, 0x01, 0xFE, 0xE1, 0x2F, 0x33, 0x78, 0xC0, 0xFA, 0x17, 0xA5, 0x8F, 0xB4, 0xA7, 0xF4, 0xF1, 0xF9, 0x92, 0x01, 0xFE, 0xE1, 0x2F, 0x33, 0x78, 0xC0, 0xFA},
+    {0x9C, 0xBC, 0xD2, 0xE2, 0xBB, 0x93, 0x25, 0x19, 0xF4, 0xD6, 0x8E, 0xBD, 0xC9, 0x20, 0x6E, 0x30, 0x59, 0x28, 0xB6, 0x3C, 0xED, 0x22, 0x58, 0x33, 0x74, 0xE9, 0x4E, 0x5E, 0x69, 0x71, 0x9E, 0x8A},
+    {0xD9, 0x54, 0x51, 0xE8, 0x9E, 0xE0, 0x5A, 0xC6, 0x17, 0x87, 0xF0, 0x55, 0x8A, 0x8D, 0x05, 0xB9, 0x76, 0x7E, 0xBA, 0x9C, 0xD1, 0x90, 0x77, 0xA5, 0xDF, 0x07, 0x88, 0xBC, 0xCF, 0x08, 0xC4, 0x26},
+    {0xA4, 0xF8, 0x3B, 0x78, 0x4F, 0x03, 0x0D, 0xB2, 0x2F, 0x24, 0x8C, 0x40, 0x3A, 0xFE, 0x21, 0x9B, 0x11, 0x4B, 0x92, 0x32, 0x5B, 0x5F, 0xCE, 0xF1, 0x18, 0x68, 0x82, 0xFF, 0xA7, 0xF5, 0x89, 0x57},
+    {0x80, 0xFB, 0x31, 0xDC, 0xE4, 0x21, 0x30, 0xB3, 0xF9, 0xEF, 0xE6, 0xFF, 0x0A, 0xA8, 0xD2, 0x77, 0x87, 0x71, 0x62, 0x3F, 0x4F, 0x42, 0x60, 0xE1, 0x75, 0x59, 0x4B, 0x79, 0x14, 0xD7, 0x23, 0xEE},
+    {0x36, 0xDC, 0xFE, 0x2B, 0x72, 0xF1, 0x4C, 0xAA, 0x8F, 0xBA, 0x06, 0xC0, 0x70, 0xB1, 0xE1, 0xC5, 0xD0, 0xF9, 0xCB, 0x97, 0xB4, 0x41, 0x8D, 0xFA, 0xAB, 0xAF, 0x2F, 0xF2, 0x2C, 0x92, 0x14, 0x09},
+    {0xED, 0x21, 0x98, 0xF1, 0x39, 0x6B, 0x7E, 0x6C, 0x78, 0x31, 0x3A, 0x86, 0x5F, 0xF4, 0x89, 0x08, 0x51, 0xF8, 0x33, 0x8C, 0xB8, 0x32, 0xD7, 0xA7, 0xC7, 0x05, 0xB0, 0x63, 0x2F, 0x94, 0x4B, 0xBD},
+    {0x75, 0xB3, 0x18, 0xAA, 0xDF, 0x6C, 0x74, 0xDE, 0x01, 0x6D, 0x19, 0xC7, 0xC6, 0xAB, 0xB2, 0x75, 0xB3, 0x18, 0xAA, 0xDF, 0x6C, 0x74, 0xDE, 0x01, 0x6D, 0x19, 0xC7, 0xC6, 0xAB, 0xB2, 0x75, 0xB3},
+    {0xD4, 0xEF, 0x93, 0xBA, 0xAC, 0x31, 0xAD, 0x6D, 0xA7, 0xBC, 0xE3, 0x0D, 0xC2, 0x72, 0x0F, 0x7A, 0x66, 0x2A, 0xF2, 0x83, 0x68, 0x0C, 0x9E, 0x78, 0xDE, 0x3E, 0xD7, 0x0B, 0x8D, 0x4E, 0x60, 0x65},
+    {0x32, 0xFF, 0x88, 0xC0, 0x56, 0x86, 0x1F, 0xC7, 0xFA, 0x0D, 0x21, 0xCE, 0x89, 0x17, 0x63, 0xD5, 0x1C, 0x39, 0xA5, 0xF8, 0x24, 0x4B, 0x68, 0x8F, 0x6C, 0xDD, 0xB8, 0x16, 0xB4, 0xE0, 0x4F, 0x3A},
+    {0x95, 0xA8, 0xFA, 0xB1, 0x2B, 0xF4, 0xCF, 0xAB, 0xE1, 0x72, 0xEC, 0x17, 0xAF, 0xC5, 0xF1, 0xE2, 0x69, 0x2F, 0xD0, 0x4C, 0xA5, 0x9F, 0xF2, 0xF9, 0xAA, 0xE8, 0x33, 0x2C, 0xCB, 0x8F, 0x62, 0x7C},
+    {0x37, 0x77, 0x63, 0xC5, 0xD6, 0x08, 0xC1, 0x75, 0xF1, 0x7A, 0x48, 0xD5, 0xD3, 0xE2, 0xA4, 0x81, 0x61, 0x57, 0x69, 0x96, 0x1C, 0x67, 0x66, 0x2F, 0xB3, 0xFC, 0x51, 0x58, 0xD0, 0x39, 0x87, 0x50},
+    {0xF3, 0x71, 0x24, 0xF9, 0x6B, 0xF8, 0x94, 0x18, 0xA5, 0x2A, 0x11, 0x39, 0x51, 0x2F, 0x1C, 0x57, 0xA4, 0xD5, 0xF1, 0x08, 0x63, 0x9B, 0x0F, 0x17, 0xB2, 0x98, 0x89, 0xB0, 0xE1, 0xCE, 0xD2, 0x85},
+    {0xA6, 0x3F, 0xB8, 0x97, 0xF6, 0x8C, 0xEF, 0xDF, 0x33, 0x83, 0xBB, 0xF8, 0xFD, 0x4C, 0x51, 0x96, 0xD3, 0x08, 0xAF, 0xB5, 0x89, 0x5E, 0xC2, 0xF4, 0xC6, 0x60, 0x5F, 0xE7, 0x70, 0x86, 0x0A, 0xE5},
+    {0xBC, 0x42, 0x5B, 0x41, 0x7B, 0x32, 0x34, 0x74, 0x92, 0x0C, 0x80, 0x4B, 0xBB, 0x9F, 0x11, 0x67, 0x48, 0x9B, 0xEC, 0x5E, 0x21, 0xEE, 0xE3, 0xFE, 0x19, 0x1A, 0x3A, 0x49, 0x06, 0x40, 0xE6, 0x9E},
+    {0x17, 0xE1, 0xF4, 0xFA, 0xFE, 0xA7, 0xC0, 0x01, 0xB4, 0x78, 0x92, 0x8F, 0x33, 0xF9, 0xA5, 0x2F, 0xF1, 0x17, 0xE1, 0xF4, 0xFA, 0xFE, 0xA7, 0xC0, 0x01, 0xB4, 0x78, 0x92, 0x8F, 0x33, 0xF9, 0xA5},
+    {0x3D, 0x59, 0x57, 0xAF, 0x7F, 0x05, 0xB7, 0x19, 0xC0, 0x3E, 0x34, 0xDD, 0xEF, 0xE8, 0x94, 0xFC, 0xC1, 0x98, 0xCF, 0x60, 0x1F, 0x1A, 0xAD, 0xB4, 0x74, 0x4A, 0x7E, 0xA3, 0x4C, 0xA4, 0x30, 0xCC},
+    {0x3F, 0x79, 0x7E, 0xF2, 0xFC, 0x63, 0x7F, 0xC6, 0xFE, 0x0B, 0x7B, 0x16, 0xF6, 0x2C, 0x6B, 0x58, 0xD6, 0xB0, 0x2B, 0xE7, 0x56, 0x49, 0xAC, 0x92, 0xDF, 0xA3, 0x39, 0xC1, 0x72, 0x05, 0xE4, 0x0A},
+    {0x03, 0xD7, 0x13, 0x92, 0x7E, 0x94, 0x57, 0xB2, 0xF4, 0x4E, 0x5B, 0xE0, 0xB8, 0x8F, 0x24, 0x39, 0x63, 0xCE, 0xFA, 0x86, 0x88, 0x40, 0x93, 0x33, 0x18, 0xA4, 0x98, 0x05, 0xFE, 0x35, 0x31, 0x82},
+    {0x22, 0xEE, 0x03, 0x09, 0x3F, 0xBD, 0x3D, 0xB3, 0x17, 0x65, 0xBC, 0x3A, 0xA6, 0x7C, 0xF3, 0x50, 0x37, 0x85, 0x95, 0xE5, 0x32, 0x9E, 0xD4, 0xA5, 0x75, 0xCC, 0xED, 0x0A, 0x36, 0x82, 0x80, 0x8E},
+    {0xF2, 0xE2, 0xE1, 0xA8, 0xDC, 0xB4, 0x7C, 0xAA, 0x2F, 0xEC, 0xB1, 0xA7, 0x36, 0x97, 0x33, 0x4C, 0xAF, 0xF4, 0x70, 0x09, 0x78, 0xCB, 0x9F, 0xF1, 0xAB, 0x95, 0xC0, 0x14, 0x62, 0xF9, 0x69, 0x72},
+    {0xB8, 0x7E, 0x11, 0x17, 0x6E, 0x53, 0x32, 0x6C, 0xF9, 0xA4, 0xCE, 0x4E, 0xD7, 0x78, 0x68, 0x2A, 0x0F, 0x0D, 0xA7, 0x31, 0x93, 0x24, 0x57, 0xE1, 0xC7, 0x3A, 0x4D, 0x28, 0xA5, 0x9B, 0x05, 0x86},
+    {0x6F, 0x84, 0xBD, 0x9F, 0x37, 0x0D, 0x0A, 0xDE, 0x8F, 0xFD, 0xB9, 0x6E, 0x1A, 0x14, 0x3B, 0x99, 0x7D, 0xF5, 0xDC, 0x34, 0x28, 0x76, 0xB5, 0xFA, 0x6D, 0x3F, 0x68, 0x50, 0xEC, 0xED, 0x73, 0xDA},
+    {0x7F, 0x45, 0xFF, 0x7C, 0xD8, 0x9B, 0xD9, 0x6D, 0x78, 0x0E, 0x96, 0xD2, 0xDB, 0x06, 0xBD, 0xC8, 0xCD, 0xED, 0x41, 0x29, 0x71, 0xD3, 0x2D, 0xA7, 0xDE, 0x26, 0x11, 0xA0, 0x95, 0x4F, 0xBF, 0xA3},
+    {0x18, 0xB2, 0xC7, 0x01, 0x6C, 0x18, 0xB2, 0xC7, 0x01, 0x6C, 0x18, 0xB2, 0xC7, 0x01, 0x6C, 0x18, 0xB2, 0xC7, 0x01, 0x6C, 0x18, 0xB2, 0xC7, 0x01, 0x6C, 0x18, 0xB2, 0xC7, 0x01, 0x6C, 0x18, 0xB2},
+    {0x97, 0xF2, 0x17, 0x95, 0x36, 0x8F, 0xD0, 0xAB, 0xA7, 0xB6, 0xE8, 0xF1, 0xB1, 0x41, 0x92, 0x9F, 0xEC, 0xFE, 0x06, 0xCB, 0x2F, 0xCF, 0x20, 0x78, 0xAA, 0xC5, 0xFA, 0x09, 0x7C, 0xA5, 0x72, 0x70},
+    {0x0B, 0x29, 0xF8, 0xEC, 0x1B, 0x13, 0x0E, 0x75, 0xFA, 0x49, 0x64, 0x51, 0x43, 0xDC, 0x55, 0x8E, 0x22, 0xD1, 0x14, 0xF7, 0x08, 0x1D, 0x7B, 0x8F, 0xB3, 0x2D, 0x35, 0x12, 0x9F, 0x89, 0xDB, 0xAC},
+    {0xD2, 0x5B, 0xDD, 0xA5, 0xCE, 0x56, 0x55, 0x18, 0xE1, 0x53, 0x82, 0x94, 0xB0, 0xA7, 0xB8, 0xF8, 0x89, 0x86, 0x78, 0x6B, 0x98, 0x03, 0x4D, 0xF9, 0xB2, 0xD1, 0x16, 0x24, 0x17, 0x1F, 0x40, 0x71},
+    {0x76, 0x43, 0x3A, 0x62, 0x67, 0x6E, 0x7B, 0xDF, 0xF1, 0xB7, 0x84, 0xF3, 0x30, 0x70, 0x4D, 0xA1, 0x27, 0x53, 0x97, 0x59, 0x85, 0x73, 0x4A, 0x2F, 0xC6, 0x49, 0x28, 0x48, 0xA8, 0x32, 0xF7, 0xB9},
+    {0xF6, 0xFC, 0x6E, 0x36, 0xF0, 0x0F, 0xDB, 0x74, 0xA5, 0x43, 0xBE, 0x3B, 0x7A, 0x95, 0x40, 0x04, 0xA2, 0x5B, 0x7C, 0x66, 0xF5, 0x46, 0xF7, 0x17, 0x19, 0x29, 0x2A, 0x90, 0x09, 0x28, 0xC1, 0xE7},
+    {0xC0, 0x8F, 0xF1, 0xFE, 0x78, 0xA5, 0xF4, 0x01, 0x33, 0x17, 0xA7, 0x92, 0x2F, 0xFA, 0xB4, 0xF9, 0xE1, 0xC0, 0x8F, 0xF1, 0xFE, 0x78, 0xA5, 0xF4, 0x01, 0x33, 0x17, 0xA7, 0x92, 0x2F, 0xFA, 0xB4},
+    {0x2D, 0x8A, 0xF3, 0x72, 0x3C, 0x3B, 0x77, 0x19, 0x92, 0x96, 0x44, 0x4D, 0x99, 0x2B, 0x31, 0x3D, 0xCC, 0xD7, 0x2C, 0x7D, 0x53, 0x47, 0xD3, 0xFE, 0x74, 0x87, 0xF5, 0xC9, 0xF2, 0x85, 0x9C, 0x0E},
+    {0x58, 0xE3, 0x4D, 0x4C, 0x1E, 0x40, 0xC8, 0xC6, 0xB4, 0x8E, 0x65, 0x31, 0x04, 0xCF, 0xFF, 0xA9, 0x38, 0x4F, 0xE8, 0xA2, 0xD7, 0xD4, 0x22, 0xC0, 0xDF, 0xCD, 0x5B, 0x15, 0xAF, 0x53, 0x0C, 0xD6},
+    {0x8C, 0x63, 0x53, 0x8F, 0x0F, 0x5B, 0x28, 0xB2, 0xC0, 0x7E, 0x89, 0xD7, 0x4B, 0xE1, 0x4F, 0x71, 0xD2, 0xFF, 0xF9, 0x21, 0x31, 0xF8, 0x05, 0xB4, 0x18, 0x6E, 0x40, 0x2A, 0xFA, 0x4D, 0x39, 0x5F},
+    {0xBE, 0x52, 0x85, 0x06, 0xC4, 0xF5, 0x6A, 0xB3, 0xFE, 0x02, 0xC1, 0x53, 0x26, 0xEC, 0xD7, 0x83, 0xC2, 0x31, 0x9F, 0xD9, 0x4D, 0xFC, 0xC3, 0x92, 0x75, 0xCA, 0x3B, 0x54, 0x41, 0xF3, 0xAE, 0x46},
+    {0x2B, 0xB6, 0x2F, 0x70, 0x62, 0x17, 0x41, 0xAA, 0xF4, 0x14, 0xD0, 0xFE, 0x7C, 0xAF, 0xC0, 0xE8, 0xCF, 0xB4, 0x4C, 0x95, 0x92, 0xC5, 0xDC, 0x33, 0xAB, 0x06, 0xA5, 0xA8, 0x97, 0xF1, 0x20, 0x2C},
+    {0x1C, 0x86, 0x28, 0xE1, 0x31, 0x2A, 0x4E, 0x6C, 0x17, 0x88, 0x6B, 0xF5, 0x82, 0xF1, 0x5B, 0x4B, 0x21, 0x40, 0x2F, 0x03, 0x3B, 0xB0, 0xE0, 0xA5, 0xC7, 0x93, 0x0F, 0xD7, 0xF9, 0x6E, 0xB8, 0xD5},
+    {0xEF, 0x7F, 0x32, 0xD0, 0xDB, 0x28, 0x38, 0xDE, 0x2F, 0x42, 0xEB, 0x85, 0xAC, 0x69, 0x53, 0xF0, 0x90, 0x4D, 0xE2, 0x0B, 0xF3, 0x10, 0xE6, 0xF1, 0x6D, 0xA9, 0x6E, 0x29, 0xC5, 0x3A, 0xA3, 0x60},
+    {0x49, 0x99, 0x1F, 0xCB, 0xAE, 0x16, 0xD3, 0x6D, 0xF9, 0x1D, 0x79, 0x98, 0x46, 0xD0, 0x86, 0xD4, 0x65, 0xB8, 0xC5, 0xBE, 0x94, 0xE4, 0x64, 0xE1, 0xDE, 0x96, 0x56, 0x52, 0xB1, 0xDD, 0x7D, 0x7B},
+    {0xF5, 0x93, 0x89, 0xB4, 0x57, 0x35, 0x6B, 0xC7, 0x8F, 0xD2, 0x4D, 0x08, 0x88, 0xA5, 0xD1, 0x7E, 0x05, 0x55, 0x17, 0xE0, 0x51, 0x53, 0x71, 0xFA, 0x6C, 0xB0, 0x13, 0xA4, 0xC0, 0xF8, 0x4E, 0x3B},
+    {0xE2, 0x41, 0xA5, 0x8D, 0xE8, 0xFA, 0x62, 0xAB, 0x78, 0xAF, 0x36, 0x2F, 0xDC, 0xF2, 0xFE, 0x2C, 0x2B, 0x92, 0x72, 0x14, 0xF1, 0x09, 0x4C, 0xA7, 0xAA, 0xA8, 0x8F, 0xCF, 0xBA, 0x17, 0x06, 0x69},
+    {0xDF, 0xC6, 0x6C, 0xAB, 0x74, 0xB2, 0xDE, 0x75, 0x01, 0xB3, 0x6D, 0x18, 0x19, 0xAA, 0xC7, 0xDF, 0xC6, 0x6C, 0xAB, 0x74, 0xB2, 0xDE, 0x75, 0x01, 0xB3, 0x6D, 0x18, 0x19, 0xAA, 0xC7, 0xDF, 0xC6},
+    {0xE0, 0xA4, 0x4F, 0x2F, 0x3A, 0x11, 0x5B, 0x18, 0xA7, 0x6B, 0xD1, 0x71, 0x4E, 0x33, 0xED, 0x28, 0x6E, 0xBD, 0xF4, 0x93, 0xD2, 0x55, 0xB0, 0x78, 0xB2, 0x40, 0x9B, 0x32, 0xF1, 0xFF, 0x57, 0x88},
+    {0xE3, 0xEB, 0xED, 0x2C, 0x1D, 0x68, 0x2E, 0xDF, 0xFA, 0x80, 0x60, 0x28, 0x1E, 0xCB, 0xF5, 0x26, 0xD9, 0x3B, 0xB1, 0x15, 0x6E, 0xEF, 0xEE, 0x8F, 0xC6, 0x91, 0x0D, 0x64, 0x2B, 0xBD, 0x10, 0x0C},
+    {0xC1, 0x8B, 0x9B, 0x14, 0xCD, 0x4D, 0xA0, 0x74, 0xE1, 0x12, 0xAE, 0x93, 0x90, 0x62, 0x0D, 0x15, 0x1E, 0x68, 0xA8, 0xF0, 0x4E, 0x52, 0x1B, 0xF9, 0x19, 0xD8, 0x53, 0xC8, 0xDC, 0x11, 0x5C, 0xFC},
+    {0x33, 0xFE, 0xF9, 0xA7, 0xA5, 0xC0, 0x2F, 0x01, 0xF1, 0xB4, 0x17, 0x78, 0xE1, 0x92, 0xF4, 0x8F, 0xFA, 0x33, 0xFE, 0xF9, 0xA7, 0xA5, 0xC0, 0x2F, 0x01, 0xF1, 0xB4, 0x17, 0x78, 0xE1, 0x92, 0xF4},
+    {0x8B, 0xB5, 0x82, 0xCF, 0x91, 0xED, 0x83, 0x19, 0xA5, 0x5D, 0x81, 0x32, 0xCD, 0xBA, 0x85, 0x64, 0x1D, 0xF3, 0x8D, 0xC8, 0x3A, 0x61, 0x9D, 0x17, 0x74, 0xC2, 0xBD, 0x2E, 0xE8, 0x03, 0xFD, 0x5C},
+    {0xE4, 0xA1, 0x35, 0x69, 0x8B, 0x98, 0xBF, 0xC6, 0x33, 0xDB, 0x99, 0x88, 0xC1, 0xB6, 0xCE, 0x0C, 0xE3, 0x24, 0x20, 0xFC, 0xE0, 0x7D, 0x29, 0xF4, 0xDF, 0x45, 0x94, 0x5C, 0xE2, 0x13, 0x27, 0x79},
+    {0x9B, 0x82, 0x05, 0x33, 0x86, 0x39, 0xE0, 0xB2, 0x92, 0xF5, 0x71, 0x56, 0x1C, 0xB4, 0xB0, 0x8C, 0x5F, 0x6B, 0xC0, 0xD5, 0x16, 0xD2, 0x3B, 0xFE, 0x18, 0x88, 0x63, 0xB8, 0xF4, 0x7E, 0x03, 0x11},
+    {0x83, 0x0B, 0xA4, 0xB6, 0x43, 0x7E, 0x42, 0xB3, 0xB4, 0x5E, 0x15, 0x1F, 0x76, 0x36, 0x98, 0x47, 0x44, 0x94, 0x09, 0xB9, 0xDD, 0x1E, 0xBB, 0xC0, 0x75, 0xE6, 0x05, 0xF7, 0x20, 0x57, 0xAC, 0xC2},
+    {0x14, 0xCF, 0x33, 0x20, 0xE2, 0x78, 0x2B, 0xAA, 0xC0, 0xC5, 0x97, 0xFA, 0xF2, 0x09, 0x17, 0x7C, 0x95, 0xA5, 0x36, 0x72, 0x8F, 0x70, 0xD0, 0xB4, 0xAB, 0x2C, 0xA7, 0x69, 0xB6, 0xF4, 0xE8, 0xDC},
+    {0x1F, 0x51, 0x40, 0xF4, 0x71, 0x3A, 0x0F, 0x6C, 0xFE, 0x39, 0x13, 0x21, 0xF3, 0xC0, 0x9B, 0x93, 0x4E, 0x11, 0xB4, 0x85, 0x4B, 0x35, 0x63, 0x92, 0xC7, 0x2A, 0x32, 0xD2, 0x33, 0x5B, 0x08, 0xDD},
+    {0xCD, 0x91, 0x86, 0xE2, 0xFB, 0x5F, 0x76, 0xDE, 0xF4, 0x3D, 0xAD, 0x89, 0x80, 0x20, 0x08, 0x02, 0xC3, 0x51, 0xB6, 0xEE, 0xF8, 0x3E, 0xCC, 0x33, 0x6D, 0xB9, 0x8C, 0x23, 0x69, 0xB8, 0x2E, 0xC8},
+    {0xBB, 0x7B, 0xCE, 0xE8, 0xBE, 0x89, 0xEB, 0x6D, 0x17, 0x15, 0x0A, 0x63, 0x4A, 0x8D, 0xD5, 0xBF, 0x45, 0x1C, 0xBA, 0xB7, 0x39, 0x3F, 0x1E, 0xA5, 0xDE, 0x10, 0xF8, 0x46, 0xCF, 0x24, 0x49, 0x5E},
+    {0x4D, 0xED, 0x39, 0x78, 0x5F, 0x51, 0xB8, 0xC7, 0x2F, 0x82, 0x4E, 0x1C, 0x55, 0xFE, 0x57, 0xDD, 0x1F, 0xA4, 0x92, 0xD1, 0xD5, 0x93, 0x03, 0xF1, 0x6C, 0x86, 0x08, 0x8C, 0xA7, 0x63, 0xBD, 0x53},
+    {0x8D, 0xC5, 0x8F, 0xDC, 0xEC, 0x33, 0x09, 0xAB, 0xF9, 0x06, 0x2B, 0xA5, 0xB6, 0xA8, 0x2F, 0x97, 0x70, 0xF1, 0x62, 0x20, 0x17, 0x2C, 0x41, 0xE1, 0xAA, 0x36, 0xF4, 0x9F, 0x14, 0xFA, 0xD0, 0xBA},
+    {0xA0, 0x83, 0xE0, 0x2B, 0x76, 0xB8, 0xBC, 0x75, 0x8F, 0x3C, 0xA2, 0x24, 0x9D, 0xB1, 0x39, 0xFB, 0x23, 0x63, 0xCB, 0x5D, 0xCE, 0x04, 0xC9, 0xFA, 0xB3, 0x9E, 0x86, 0xB9, 0x2C, 0x88, 0xC2, 0xD8},
+    {0xF8, 0x16, 0x4E, 0xF1, 0x3B, 0xD7, 0x85, 0x18, 0x78, 0x1F, 0x63, 0x68, 0x4F, 0xF4, 0x2A, 0x82, 0x03, 0x0F, 0x33, 0xFF, 0x0D, 0x39, 0xDD, 0xA7, 0xB2, 0xF3, 0x31, 0xF5, 0x2F, 0x93, 0x56, 0x89},
+    {0x74, 0x19, 0xB2, 0xAA, 0xDE, 0xC7, 0x75, 0xDF, 0x01, 0xC6, 0xB3, 0x6C, 0x6D, 0xAB, 0x18, 0x74, 0x19, 0xB2, 0xAA, 0xDE, 0xC7, 0x75, 0xDF, 0x01, 0xC6, 0xB3, 0x6C, 0x6D, 0xAB, 0x18, 0x74, 0x19},
+    {0xCA, 0xA2, 0x94, 0xBA, 0x6F, 0xB0, 0x8E, 0x74, 0xA7, 0x27, 0xD8, 0xB8, 0x5A, 0x72, 0xF8, 0xE6, 0x42, 0x89, 0xF2, 0x07, 0x86, 0xA0, 0xA1, 0x78, 0x19, 0x22, 0x6B, 0xDA, 0x8D, 0x98, 0x04, 0x6A},
+    {0xE1, 0xA5, 0x92, 0xC0, 0xF4, 0x2F, 0x8F, 0x01, 0xFA, 0xF1, 0x33, 0xB4, 0xFE, 0x17, 0xF9, 0x78, 0xA7, 0xE1, 0xA5, 0x92, 0xC0, 0xF4, 0x2F, 0x8F, 0x01, 0xFA, 0xF1, 0x33, 0xB4, 0xFE, 0x17, 0xF9},
+    {0xFD, 0xF6, 0xD7, 0xB1, 0x7A, 0x4B, 0xAC, 0x19, 0xE1, 0x76, 0x4A, 0x4F, 0x2E, 0xC5, 0x71, 0x6A, 0xCA, 0xD2, 0xD0, 0x91, 0xFF, 0xB7, 0xB9, 0xF9, 0x74, 0x0B, 0x21, 0x66, 0xCB, 0x31, 0xE7, 0xB5},
+    {0x12, 0x5D, 0xF5, 0xC5, 0x3D, 0x82, 0x3C, 0xC6, 0xF1, 0x52, 0x07, 0x5B, 0xEA, 0xE2, 0x4B, 0x3F, 0x0A, 0x21, 0x69, 0x9A, 0x40, 0x5A, 0xAE, 0x2F, 0xDF, 0xC9, 0x03, 0xCC, 0xD0, 0x3B, 0x9D, 0x1B},
+    {0x5B, 0x0D, 0x08, 0xF9, 0xDD, 0x88, 0x5F, 0xB2, 0xA5, 0xBD, 0x31, 0xD1, 0xCE, 0x2F, 0x7E, 0x16, 0x56, 0x05, 0xF1, 0x24, 0x55, 0xD7, 0xED, 0x17, 0x18, 0x8C, 0xE0, 0x1F, 0xE1, 0x51, 0x68, 0x40},
+    {0xAE, 0x81, 0x71, 0x97, 0xAD, 0x4E, 0xA2, 0xB3, 0x33, 0x07, 0x5C, 0xED, 0x54, 0x4C, 0x28, 0xAC, 0x0B, 0x6E, 0xAF, 0xC4, 0xBD, 0x8B, 0x5A, 0xF4, 0x75, 0x04, 0x93, 0x3E, 0x70, 0xD2, 0x61, 0x52},
+    {0x4C, 0x2C, 0x78, 0x41, 0x95, 0xE1, 0x69, 0xAA, 0x92, 0x36, 0x8D, 0xF4, 0xC5, 0x9F, 0x8F, 0x14, 0xDC, 0xFA, 0xEC, 0xD0, 0x33, 0xBA, 0x09, 0xFE, 0xAB, 0xE2, 0xF9, 0x7C, 0x06, 0xA7, 0x2B, 0xAF},
+    {0x93, 0x32, 0x56, 0xFA, 0x89, 0x1C, 0x24, 0x6C, 0xB4, 0x5B, 0xED, 0xB0, 0x57, 0xF9, 0x8C, 0x13, 0x35, 0x5F, 0xE1, 0xA4, 0x6B, 0xBD, 0x40, 0xC0, 0xC7, 0xCE, 0xD5, 0xF8, 0x8F, 0x16, 0x3A, 0x4E},
+    {0x73, 0xC3, 0x21, 0xAF, 0x87, 0xF3, 0x79, 0xDE, 0xC0, 0xE7, 0x43, 0x9B, 0x50, 0xE8, 0x93, 0xC9, 0x3C, 0x4E, 0xCF, 0x37, 0x11, 0xF7, 0xF6, 0xB4, 0x6D, 0xE4, 0x85, 0x77, 0x4C, 0x4B, 0x02, 0x84},
+    {0x90, 0xCD, 0x1C, 0xF2, 0x80, 0x55, 0x9D, 0x6D, 0xFE, 0xEA, 0x54, 0x57, 0x8E, 0x2C, 0xDD, 0x84, 0x73, 0x1F, 0x2B, 0x22, 0xA4, 0xC4, 0x9A, 0x92, 0xDE, 0x5D, 0xD1, 0xEE, 0x72, 0xD5, 0xC8, 0xF0},
+    {0x51, 0x6B, 0x68, 0x92, 0x40, 0x4F, 0x53, 0xC7, 0xF4, 0x98, 0xD5, 0x2A, 0x71, 0x8F, 0x82, 0x32, 0x3A, 0x03, 0xFA, 0xD2, 0x0F, 0x1C, 0x94, 0x33, 0x6C, 0x4D, 0xFF, 0x5B, 0xFE, 0x0D, 0xB0, 0x08},
+    {0x62, 0xBA, 0xB4, 0x09, 0x20, 0xFE, 0xB1, 0xAB, 0x17, 0xE2, 0x4C, 0xF9, 0x2C, 0x7C, 0x78, 0x06, 0x41, 0xA7, 0x95, 0x2B, 0xE1, 0xAF, 0x69, 0xA5, 0xAA, 0xCB, 0x92, 0xB6, 0x36, 0xC0, 0x8D, 0xA8},
+    {0xE9, 0x1A, 0xD1, 0xA8, 0x10, 0xCE, 0xB5, 0x75, 0x2F, 0xC8, 0x3D, 0x7E, 0x0C, 0x97, 0x16, 0x46, 0xBE, 0x56, 0x70, 0xE3, 0x05, 0xCC, 0xCD, 0xF1, 0xB3, 0xFD, 0x24, 0xEB, 0x62, 0x55, 0x34, 0x25},
+    {0x0D, 0x85, 0xB0, 0x17, 0x08, 0x57, 0x39, 0x18, 0xF9, 0x4B, 0x28, 0x8C, 0xDD, 0x78, 0x13, 0xE0, 0x88, 0x35, 0xA7, 0x1F, 0x5F, 0x6E, 0x21, 0xE1, 0xB2, 0x63, 0xA4, 0x51, 0xA5, 0x6B, 0xF3, 0x68},
+    {0x96, 0x58, 0x2A, 0x9F, 0x04, 0x71, 0xF0, 0xDF, 0x8F, 0x47, 0xBF, 0x82, 0x6A, 0x14, 0x32, 0x3E, 0xAD, 0x3A, 0xDC, 0xCA, 0x03, 0x45, 0x44, 0xFA, 0xC6, 0x90, 0xD2, 0xA2, 0xEC, 0x0F, 0xD6, 0xD3},
+    {0x15, 0x64, 0x8C, 0x7C, 0x02, 0xDD, 0xFB, 0x74, 0x78, 0x3F, 0xAC, 0x13, 0x84, 0x06, 0xE0, 0x8A, 0x9C, 0x88, 0x41, 0x73, 0x35, 0x0B, 0x0A, 0xA7, 0x19, 0x23, 0x1F, 0xC3, 0x95, 0x5F, 0x1D, 0x1E},
+    {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01},
+};
+
+#endif
@@ -0,0 +1,295 @@
+#include "sdlp_segment.h"
+#include <string.h>
+
+#define SEGMENT_OVERHEAD \
+    (TC_PRIMARY_HEADER_SIZE + TC_SEGMENT_HEADER_SIZE + TC_FRAME_ERROR_CONTROL_SIZE)
+
+/* Lay out the segment header on a begun builder; returns where the segment goes. */
+static uint8_t *segment_prepare(sdlp_tc_builder_t *builder, uint8_t sequence_flags, uint8_t map_id) {
+#ifdef TC_SEGMENT_HEADER_ENABLED
+    builder->segment_header.sequence_flags = (uint8_t)(sequence_flags & 0x03u);
+    builder->segment_header.map_id = (uint8_t)(map_id & 0x3fu);
+    return builder->data;
+#else
+    builder->data[0] = (uint8_t)(((sequence_flags & 0x03u) << 6) | (map_id & 0x3fu));
+    return &builder->data[TC_SEGMENT_HEADER_SIZE];
+#endif
+}
+
+static int segment_parse(const sdlp_tc_frame_view_t *view, uint8_t *sequence_flags,
+                         uint8_t *map_id, const uint8_t **data, size_t *length) {
+#ifdef TC_SEGMENT_HEADER_ENABLED
+    *sequence_flags = view->segment_header.sequence_flags;
+    *map_id = view->segment_header.map_id;
+    *data = view->data;
+    *length = view->data_length;
+#else
+    if (view->data_length < TC_SEGMENT_HEADER_SIZE) {
+        return SDLP_ERROR_INVALID_FRAME;
+    }
+    *sequence_flags = (uint8_t)((view->data[0] >> 6) & 0x03u);
+    *map_id = (uint8_t)(view->data[0] & 0x3fu);
+    *data = &view->data[TC_SEGMENT_HEADER_SIZE];
+    *length = (size_t)view->data_length - TC_SEGMENT_HEADER_SIZE;
+#endif
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tc_segmenter_init(sdlp_tc_segmenter_t *segmenter, uint16_t spacecraft_id,
+                           uint8_t virtual_channel_id, uint8_t map_id, uint16_t segment_size) {
+    if (!segmenter || map_id >= TC_MAX_MAP_IDS || segment_size == 0 ||
+        segment_size > TC_MAX_SEGMENT_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(segmenter, 0, sizeof(sdlp_tc_segmenter_t));
+    segmenter->spacecraft_id = spacecraft_id;
+    segmenter->virtual_channel_id = virtual_channel_id;
+    segmenter->map_id = map_id;
+    segmenter->segment_size = segment_size;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tc_segmenter_start(sdlp_tc_segmenter_t *segmenter, const uint8_t *sdu,
+                            size_t sdu_length) {
+    if (!segmenter || !sdu || sdu_length == 0 || sdlp_tc_segmenter_pending(segmenter)) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    segmenter->sdu = sdu;
+    segmenter->sdu_length = sdu_length;
+    segmenter->offset = 0;
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tc_segmenter_pending(const sdlp_tc_segmenter_t *segmenter) {
+    return segmenter && segmenter->sdu && segmenter->offset < segmenter->sdu_length;
+}
+
+int sdlp_tc_segmenter_next(sdlp_tc_segmenter_t *segmenter, uint8_t *buffer, size_t buffer_size,
+                           size_t *encoded_size) {
+    if (!buffer || !encoded_size || !sdlp_tc_segmenter_pending(segmenter)) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t remaining = segmenter->sdu_length - segmenter->offset;
+    size_t length = remaining < segmenter->segment_size ? remaining : segmenter->segment_size;
+    uint8_t sequence_flags;
+
+    if (segmenter->offset == 0) {
+        sequence_flags = length == remaining ? TC_SEQ_FLAG_NO_SEG : TC_SEQ_FLAG_FIRST;
+    } else {
+        sequence_flags = length == remaining ? TC_SEQ_FLAG_LAST : TC_SEQ_FLAG_CONTINUE;
+    }
+
+    if (buffer_size < length + SEGMENT_OVERHEAD) {
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    sdlp_tc_builder_t builder;
+    int result = sdlp_tc_builder_begin(&builder, buffer, buffer_size, segmenter->spacecraft_id,
+                                       segmenter->virtual_channel_id, segmenter->frame_seq_num);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    uint8_t *segment = segment_prepare(&builder, sequence_flags, segmenter->map_id);
+
+    memcpy(segment, &segmenter->sdu[segmenter->offset], length);
+    result = sdlp_tc_builder_commit(&builder, (uint16_t)(&segment[length] - builder.data),
+                                    encoded_size);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    segmenter->offset += length;
+    segmenter->frame_seq_num++;
+    segmenter->frames++;
+    if (segmenter->offset == segmenter->sdu_length) {
+        segmenter->sdus++;
+    }
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tc_segment_sdu(sdlp_tc_segmenter_t *segmenter, const uint8_t *sdu, size_t sdu_length,
+                        uint8_t *buffer, size_t buffer_size, size_t *encoded_size,
+                        size_t *frame_count) {
+    if (!segmenter || !buffer || !encoded_size || segmenter->segment_size == 0) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t frames = (sdu_length + segmenter->segment_size - 1u) / segmenter->segment_size;
+
+    if (buffer_size < sdu_length + frames * SEGMENT_OVERHEAD) {
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    int result = sdlp_tc_segmenter_start(segmenter, sdu, sdu_length);
+    size_t offset = 0;
+
+    while (result == SDLP_SUCCESS && sdlp_tc_segmenter_pending(segmenter)) {
+        size_t size = 0;
+
+        result = sdlp_tc_segmenter_next(segmenter, &buffer[offset], buffer_size - offset, &size);
+        offset += size;
+    }
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    *encoded_size = offset;
+    if (frame_count) {
+        *frame_count = frames;
+    }
+
+    return SDLP_SUCCESS;
+}
+
+static void reassembler_deliver(sdlp_tc_reassembler_t *reassembler, uint8_t map_id,
+                                const uint8_t *sdu, size_t length) {
+    reassembler->stats.sdus++;
+    if (reassembler->config.on_sdu) {
+        reassembler->config.on_sdu(reassembler->config.user, map_id, sdu, length);
+    }
+}
+
+static sdlp_tc_map_context_t *reassembler_acquire(sdlp_tc_reassembler_t *reassembler,
+                                                  uint8_t map_id) {
+    for (uint8_t i = 0; i < reassembler->config.context_count; i++) {
+        sdlp_tc_map_context_t *context = &reassembler->config.contexts[i];
+
+        if (!context->active) {
+            context->active = 1;
+            context->map_id = map_id;
+            context->fill = 0;
+            reassembler->map_context[map_id] = i;
+            return context;
+        }
+    }
+
+    return NULL;
+}
+
+static void reassembler_release(sdlp_tc_reassembler_t *reassembler,
+                                sdlp_tc_map_context_t *context) {
+    reassembler->map_context[context->map_id] = TC_MAP_NO_CONTEXT;
+    context->active = 0;
+    context->fill = 0;
+}
+
+int sdlp_tc_reassembler_init(sdlp_tc_reassembler_t *reassembler,
+                             const sdlp_tc_reassembler_config_t *config) {
+    if (!reassembler || !config || !config->pool || !config->contexts ||
+        config->context_count == 0 || config->max_sdu_length == 0) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(reassembler, 0, sizeof(sdlp_tc_reassembler_t));
+    reassembler->config = *config;
+
+    for (uint8_t i = 0; i < config->context_count; i++) {
+        config->contexts[i].buffer = &config->pool[(size_t)i * config->max_sdu_length];
+    }
+    sdlp_tc_reassembler_reset(reassembler);
+
+    return SDLP_SUCCESS;
+}
+
+void sdlp_tc_reassembler_reset(sdlp_tc_reassembler_t *reassembler) {
+    if (!reassembler) {
+        return;
+    }
+
+    memset(reassembler->map_context, TC_MAP_NO_CONTEXT, sizeof(reassembler->map_context));
+    for (uint8_t i = 0; i < reassembler->config.context_count; i++) {
+        reassembler->config.contexts[i].active = 0;
+        reassembler->config.contexts[i].fill = 0;
+    }
+}
+
+int sdlp_tc_reassembler_push_view(sdlp_tc_reassembler_t *reassembler,
+                                  const sdlp_tc_frame_view_t *view) {
+    if (!reassembler || !view || !view->data) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    reassembler->stats.frames++;
+
+    if (view->header.control_command_flag) {
+        reassembler->stats.control_frames++;
+        return SDLP_SUCCESS;
+    }
+
+    uint8_t sequence_flags;
+    uint8_t map_id;
+    const uint8_t *data;
+    size_t length;
+    int result = segment_parse(view, &sequence_flags, &map_id, &data, &length);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    uint8_t index = reassembler->map_context[map_id];
+    sdlp_tc_map_context_t *context =
+        index == TC_MAP_NO_CONTEXT ? NULL : &reassembler->config.contexts[index];
+
+    if (sequence_flags == TC_SEQ_FLAG_NO_SEG || sequence_flags == TC_SEQ_FLAG_FIRST) {
+        if (context) {
+            reassembler->stats.aborted_sdus++;
+            reassembler_release(reassembler, context);
+        }
+        if (sequence_flags == TC_SEQ_FLAG_NO_SEG) {
+            reassembler_deliver(reassembler, map_id, data, length);
+            return SDLP_SUCCESS;
+        }
+        context = reassembler_acquire(reassembler, map_id);
+        if (!context) {
+            reassembler->stats.no_context++;
+            return SDLP_SUCCESS;
+        }
+    } else if (!context) {
+        reassembler->stats.orphan_segments++;
+        return SDLP_SUCCESS;
+    }
+
+    reassembler->stats.segments++;
+
+    /* An oversize SDU keeps its context, so its remaining segments are not orphans. */
+    if (context->fill + length > reassembler->config.max_sdu_length) {
+        if (context->fill <= reassembler->config.max_sdu_length) {
+            reassembler->stats.oversize_sdus++;
+        }
+        context->fill = reassembler->config.max_sdu_length + 1u;
+    } else {
+        memcpy(&context->buffer[context->fill], data, length);
+        context->fill += length;
+    }
+
+    if (sequence_flags == TC_SEQ_FLAG_LAST) {
+        if (context->fill <= reassembler->config.max_sdu_length) {
+            reassembler_deliver(reassembler, map_id, context->buffer, context->fill);
+        }
+        reassembler_release(reassembler, context);
+    }
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tc_reassembler_push(sdlp_tc_reassembler_t *reassembler, const uint8_t *frame,
+                             size_t frame_length) {
+    sdlp_tc_frame_view_t view;
+    int result = sdlp_tc_decode_view(frame, frame_length, &view, 1);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    return sdlp_tc_reassembler_push_view(reassembler, &view);
+}
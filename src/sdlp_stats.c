@@ -0,0 +1,171 @@
+#include "sdlp_stats.h"
+#include "sdlp_internal.h"
+
+#include <string.h>
+
+#if defined(SDLP_STATS_ENABLED)
+
+#if SDLP_STATS_MAX_THREADS < 1
+#error "SDLP_STATS_MAX_THREADS must be at least 1"
+#endif
+#if SDLP_STATS_MASTER_CHANNELS < 1 || SDLP_STATS_MASTER_CHANNELS > 255
+#error "SDLP_STATS_MASTER_CHANNELS must be in 1..255"
+#endif
+
+#define STATS_SHARED_SLOT (SDLP_STATS_MAX_THREADS - 1)
+
+static sdlp_stats_slot_t stats_slots[SDLP_STATS_MAX_THREADS] = {
+    [STATS_SHARED_SLOT] = {.shared = 1},
+};
+
+#if defined(__STDC_NO_ATOMICS__)
+/* Callers serialise access to the library here (see sdlp_counter_t). */
+sdlp_stats_slot_t *sdlp_stats_claim(void) {
+    return &stats_slots[0];
+}
+#elif defined(SDLP_STATS_NO_TLS)
+sdlp_stats_slot_t *sdlp_stats_claim(void) {
+    return &stats_slots[STATS_SHARED_SLOT];
+}
+#else
+_Thread_local sdlp_stats_slot_t *sdlp_stats_current;
+
+static atomic_uint stats_slots_claimed;
+
+/* Slots are never returned: a thread that exits leaves its counts behind for
+ * later snapshots, and a new thread takes the next free slot or the shared one. */
+sdlp_stats_slot_t *sdlp_stats_claim(void) {
+    unsigned index = atomic_fetch_add_explicit(&stats_slots_claimed, 1u, memory_order_relaxed);
+
+    sdlp_stats_current = &stats_slots[index < STATS_SHARED_SLOT ? index : STATS_SHARED_SLOT];
+    return sdlp_stats_current;
+}
+#endif
+
+/* Tracking state of the frame's spacecraft. Links usually carry one, so the
+ * entry of the previous frame is tried first; an unknown SCID takes the
+ * entries in turn, so the one replaced is the longest tracked. */
+static sdlp_stats_mc_t *stats_master_channel(sdlp_stats_slot_t *slot, uint16_t spacecraft_id) {
+    sdlp_stats_mc_t *mc = &slot->master_channels[slot->mc_last];
+
+    if (mc->mc_valid && mc->spacecraft_id == spacecraft_id) {
+        return mc;
+    }
+    for (uint8_t i = 0; i < SDLP_STATS_MASTER_CHANNELS; i++) {
+        mc = &slot->master_channels[i];
+        if (mc->mc_valid && mc->spacecraft_id == spacecraft_id) {
+            slot->mc_last = i;
+            return mc;
+        }
+    }
+
+    slot->mc_last = slot->mc_next;
+    slot->mc_next = (uint8_t)((slot->mc_next + 1u) % SDLP_STATS_MASTER_CHANNELS);
+    mc = &slot->master_channels[slot->mc_last];
+    memset(mc, 0, sizeof(*mc));
+    mc->spacecraft_id = spacecraft_id;
+
+    return mc;
+}
+
+void sdlp_stats_tm_decoded(const sdlp_tm_header_t *header) {
+    sdlp_stats_slot_t *slot = sdlp_stats_slot();
+    uint8_t vc = (uint8_t)header->virtual_channel_id;
+    uint8_t vc_bit = (uint8_t)(1u << vc);
+
+    sdlp_stats_word_add(slot, &slot->counters[SDLP_STAT_TM_DECODED], 1);
+
+    if (slot->shared) {
+        return;
+    }
+
+    sdlp_stats_mc_t *mc = stats_master_channel(slot, (uint16_t)header->spacecraft_id);
+
+    if (mc->mc_valid && header->master_channel_frame_count != (uint8_t)(mc->mc_count + 1u)) {
+        sdlp_stats_word_add(slot, &slot->counters[SDLP_STAT_MC_GAP], 1);
+    }
+    if ((mc->vc_valid & vc_bit) &&
+        header->virtual_channel_frame_count != (uint8_t)(mc->vc_count[vc] + 1u)) {
+        sdlp_stats_word_add(slot, &slot->counters[SDLP_STAT_VC_GAP + vc], 1);
+    }
+
+    mc->mc_valid = 1;
+    mc->vc_valid |= vc_bit;
+    mc->mc_count = header->master_channel_frame_count;
+    mc->vc_count[vc] = header->virtual_channel_frame_count;
+}
+
+#if defined(SDLP_STATS_CYCLES)
+static unsigned stats_bin(uint64_t cycles) {
+    unsigned bin = 0;
+
+    while (cycles > 1 && bin < SDLP_STATS_HISTOGRAM_BINS - 1) {
+        cycles >>= 1;
+        bin++;
+    }
+    return bin;
+}
+
+void sdlp_stats_cycles(sdlp_stats_timer_t timer, uint64_t cycles, size_t count) {
+    sdlp_stats_slot_t *slot = sdlp_stats_slot();
+
+    if (count == 0) {
+        return;
+    }
+
+    sdlp_stats_word_add(slot, &slot->cycles[timer][stats_bin(cycles / count)],
+                        (unsigned long long)count);
+}
+#endif
+
+int sdlp_stats_snapshot(sdlp_stats_t *stats) {
+    if (!stats) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    uint64_t counters[SDLP_STAT_COUNTERS] = {0};
+
+    memset(stats, 0, sizeof(*stats));
+
+    for (size_t s = 0; s < SDLP_STATS_MAX_THREADS; s++) {
+        sdlp_stats_slot_t *slot = &stats_slots[s];
+
+        for (size_t i = 0; i < SDLP_STAT_COUNTERS; i++) {
+            counters[i] += SDLP_STATS_LOAD(&slot->counters[i]);
+        }
+#if defined(SDLP_STATS_CYCLES)
+        for (size_t t = 0; t < SDLP_STATS_TIMERS; t++) {
+            for (size_t b = 0; b < SDLP_STATS_HISTOGRAM_BINS; b++) {
+                stats->cycles[t][b] += SDLP_STATS_LOAD(&slot->cycles[t][b]);
+            }
+        }
+#endif
+    }
+
+    stats->tm_frames_encoded = counters[SDLP_STAT_TM_ENCODED];
+    stats->tm_frames_decoded = counters[SDLP_STAT_TM_DECODED];
+    stats->tc_frames_encoded = counters[SDLP_STAT_TC_ENCODED];
+    stats->tc_frames_decoded = counters[SDLP_STAT_TC_DECODED];
+    stats->crc_mismatches = counters[SDLP_STAT_CRC_MISMATCH];
+    stats->invalid_frames = counters[SDLP_STAT_INVALID_FRAME];
+    stats->buffer_too_small = counters[SDLP_STAT_BUFFER_TOO_SMALL];
+    stats->tm_mc_discontinuities = counters[SDLP_STAT_MC_GAP];
+    for (size_t vc = 0; vc < TM_MAX_VIRTUAL_CHANNELS; vc++) {
+        stats->tm_vc_discontinuities[vc] = counters[SDLP_STAT_VC_GAP + vc];
+    }
+
+    return SDLP_SUCCESS;
+}
+
+#else
+
+int sdlp_stats_snapshot(sdlp_stats_t *stats) {
+    if (!stats) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(stats, 0, sizeof(*stats));
+    return SDLP_SUCCESS;
+}
+
+#endif
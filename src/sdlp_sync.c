@@ -0,0 +1,297 @@
+#include "sdlp_sync.h"
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* A marker ending s bits before the end of input byte n occupies bits s..s+31 of
+ * the 40-bit window b[n-4]..b[n]. Bytes b[n-2] and b[n-1] are then fully
+ * determined by s and the polarity, so the search only tests windows whose
+ * b[n-2] and b[n-1] are both among these 16 key bytes. */
+static uint8_t sync_key(unsigned shift, unsigned byte_index) {
+    return (uint8_t)((((uint64_t)SDLP_ASM << shift) >> (8 * byte_index)) & 0xffu);
+}
+
+static int sync_in_map(const uint8_t *map, uint8_t byte) {
+    return (map[byte >> 3] >> (byte & 0x07u)) & 0x01u;
+}
+
+static void sync_add_key(uint8_t *keys, uint8_t *count, uint8_t *map, uint8_t key) {
+    if (!sync_in_map(map, key)) {
+        map[key >> 3] |= (uint8_t)(1u << (key & 0x07u));
+        keys[(*count)++] = key;
+    }
+}
+
+static int sync_is_candidate(const sdlp_sync_t *sync, const uint8_t *data, size_t p) {
+    return sync_in_map(sync->key_map, data[p]) && sync_in_map(sync->next_key_map, data[p + 1]);
+}
+
+static unsigned popcount32(uint32_t x) {
+    unsigned count = 0;
+
+    while (x) {
+        x &= x - 1u;
+        count++;
+    }
+
+    return count;
+}
+
+/* First index p in [from, to) that passes sync_is_candidate(), or to. data[to]
+ * must be readable. */
+static size_t sync_find_key(const sdlp_sync_t *sync, const uint8_t *data, size_t from, size_t to) {
+    size_t i = from;
+
+#if defined(__SSE2__)
+    for (; i + 16 <= to; i += 16) {
+        __m128i block = _mm_loadu_si128((const __m128i *)&data[i]);
+        __m128i next = _mm_loadu_si128((const __m128i *)&data[i + 1]);
+        __m128i hits = _mm_setzero_si128();
+        __m128i next_hits = _mm_setzero_si128();
+
+        for (uint8_t k = 0; k < sync->key_count; k++) {
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, _mm_set1_epi8((char)sync->keys[k])));
+        }
+        for (uint8_t k = 0; k < sync->next_key_count; k++) {
+            next_hits = _mm_or_si128(next_hits,
+                                     _mm_cmpeq_epi8(next, _mm_set1_epi8((char)sync->next_keys[k])));
+        }
+
+        unsigned mask = (unsigned)_mm_movemask_epi8(_mm_and_si128(hits, next_hits));
+        if (mask) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+#endif
+
+    for (; i < to; i++) {
+        if (sync_is_candidate(sync, data, i)) {
+            return i;
+        }
+    }
+
+    return to;
+}
+
+static uint8_t sync_byte_at(const sdlp_sync_t *sync, const uint8_t *data, ptrdiff_t index) {
+    if (index >= 0) {
+        return data[index];
+    }
+    return (uint8_t)((sync->history >> (8 * (-index - 1))) & 0xffu);
+}
+
+/* Test for a marker ending inside byte n at any bit offset. */
+static int sync_test_window(sdlp_sync_t *sync, const uint8_t *data, size_t n) {
+    uint64_t window = 0;
+
+    for (ptrdiff_t k = (ptrdiff_t)n - 4; k <= (ptrdiff_t)n; k++) {
+        window = (window << 8) | sync_byte_at(sync, data, k);
+    }
+
+    /* Highest shift first: that marker ends earliest in the stream. */
+    for (unsigned shift = 8; shift-- > 0;) {
+        uint32_t candidate = (uint32_t)(window >> shift);
+
+        if (candidate == SDLP_ASM || candidate == (uint32_t)~SDLP_ASM) {
+            sync->shift = (uint8_t)shift;
+            sync->invert = (candidate == SDLP_ASM) ? 0x00u : 0xffu;
+            sync->prev = data[n];
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void sync_enter_search(sdlp_sync_t *sync) {
+    sync->state = SDLP_SYNC_SEARCH;
+    sync->fill = 0;
+    sync->verified = 0;
+    sync->missed = 0;
+}
+
+static void sync_marker_found(sdlp_sync_t *sync) {
+    sync->stats.acquisitions++;
+    sync->fill = 0;
+    sync->verified = 0;
+    sync->missed = 0;
+
+    if (sync->config.check_threshold == 0) {
+        sync->state = SDLP_SYNC_LOCK;
+        sync->stats.locks++;
+    } else {
+        sync->state = SDLP_SYNC_CHECK;
+    }
+}
+
+/* Scan data[from..length) for a marker; returns the index after it, or length. */
+static size_t sync_search(sdlp_sync_t *sync, const uint8_t *data, size_t from, size_t length) {
+    /* Windows whose key byte lies before 'from' are tested directly. */
+    for (size_t n = from; n < from + 2 && n < length; n++) {
+        if (sync_test_window(sync, data, n)) {
+            sync_marker_found(sync);
+            return n + 1;
+        }
+    }
+
+    size_t p = from;
+
+    while (length >= 2 && p < length - 2) {
+        p = sync_find_key(sync, data, p, length - 2);
+
+        if (p >= length - 2) {
+            break;
+        }
+
+        if (sync_test_window(sync, data, p + 2)) {
+            sync_marker_found(sync);
+            return p + 3;
+        }
+        p++;
+    }
+
+    return length;
+}
+
+static void sync_check_marker(sdlp_sync_t *sync) {
+    uint32_t received = ((uint32_t)sync->marker[0] << 24) | ((uint32_t)sync->marker[1] << 16) |
+                        ((uint32_t)sync->marker[2] << 8) | (uint32_t)sync->marker[3];
+    unsigned errors = popcount32(received ^ SDLP_ASM);
+
+    sync->fill = 0;
+
+    if (sync->state == SDLP_SYNC_CHECK) {
+        if (errors != 0) {
+            sync_enter_search(sync);
+            return;
+        }
+        if (++sync->verified >= sync->config.check_threshold) {
+            sync->state = SDLP_SYNC_LOCK;
+            sync->stats.locks++;
+            sync->missed = 0;
+        }
+        return;
+    }
+
+    if (errors <= sync->config.max_marker_errors) {
+        sync->stats.marker_bit_errors += errors;
+        sync->missed = 0;
+        return;
+    }
+
+    if (++sync->missed > sync->config.flywheel) {
+        sync->stats.lock_losses++;
+        sync_enter_search(sync);
+    }
+}
+
+/* Collect frame and marker bytes at the locked bit offset; returns the index of
+ * the first unconsumed byte (earlier than length if the lock was lost). */
+static size_t sync_collect(sdlp_sync_t *sync, const uint8_t *data, size_t from, size_t length) {
+    const size_t frame_length = sync->config.frame_length;
+    size_t i = from;
+
+    while (i < length && sync->state != SDLP_SYNC_SEARCH) {
+        uint8_t *dst;
+        size_t need;
+
+        if (sync->fill < frame_length) {
+            dst = &sync->config.frame_buffer[sync->fill];
+            need = frame_length - sync->fill;
+        } else {
+            dst = &sync->marker[sync->fill - frame_length];
+            need = frame_length + SDLP_ASM_SIZE - sync->fill;
+        }
+
+        size_t n = length - i < need ? length - i : need;
+
+        if (sync->shift == 0) {
+            memcpy(dst, &data[i], n);
+            if (sync->invert) {
+                for (size_t k = 0; k < n; k++) {
+                    dst[k] = (uint8_t)~dst[k];
+                }
+            }
+            sync->prev = data[i + n - 1];
+        } else {
+            unsigned prev = sync->prev;
+            for (size_t k = 0; k < n; k++) {
+                unsigned cur = data[i + k];
+                dst[k] = (uint8_t)((((prev << 8) | cur) >> sync->shift) ^ sync->invert);
+                prev = cur;
+            }
+            sync->prev = (uint8_t)prev;
+        }
+
+        i += n;
+        sync->fill += n;
+
+        if (sync->fill == frame_length) {
+            sync->stats.frames++;
+            if (sync->missed) {
+                sync->stats.flywheel_frames++;
+            }
+            if (sync->config.on_frame) {
+                sync->config.on_frame(sync->config.user, sync->config.frame_buffer, frame_length,
+                                      sync->state);
+            }
+        } else if (sync->fill == frame_length + SDLP_ASM_SIZE) {
+            sync_check_marker(sync);
+        }
+    }
+
+    return i;
+}
+
+int sdlp_sync_init(sdlp_sync_t *sync, const sdlp_sync_config_t *config) {
+    if (!sync || !config || !config->frame_buffer || config->frame_length == 0) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(sync, 0, sizeof(sdlp_sync_t));
+    sync->config = *config;
+
+    for (unsigned shift = 0; shift < 8; shift++) {
+        uint8_t key = sync_key(shift, 2);
+        uint8_t next_key = sync_key(shift, 1);
+
+        sync_add_key(sync->keys, &sync->key_count, sync->key_map, key);
+        sync_add_key(sync->keys, &sync->key_count, sync->key_map, (uint8_t)~key);
+        sync_add_key(sync->next_keys, &sync->next_key_count, sync->next_key_map, next_key);
+        sync_add_key(sync->next_keys, &sync->next_key_count, sync->next_key_map, (uint8_t)~next_key);
+    }
+
+    sync_enter_search(sync);
+
+    return SDLP_SUCCESS;
+}
+
+void sdlp_sync_reset(sdlp_sync_t *sync) {
+    if (sync) {
+        sync_enter_search(sync);
+    }
+}
+
+int sdlp_sync_process(sdlp_sync_t *sync, const uint8_t *data, size_t length) {
+    if (!sync || (!data && length)) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t i = 0;
+
+    while (i < length) {
+        if (sync->state == SDLP_SYNC_SEARCH) {
+            i = sync_search(sync, data, i, length);
+        } else {
+            i = sync_collect(sync, data, i, length);
+        }
+    }
+
+    for (size_t k = length > 4 ? length - 4 : 0; k < length; k++) {
+        sync->history = (sync->history << 8) | data[k];
+    }
+
+    return SDLP_SUCCESS;
+}
@@ -1,6 +1,67 @@
 #include "sdlp_tc.h"
+#include "sdlp_internal.h"
 #include <string.h>
 
+static void tc_init_header(sdlp_tc_header_t *header, uint16_t spacecraft_id,
+                           uint8_t virtual_channel_id, uint8_t frame_seq_num) {
+    header->transfer_frame_version = SDLP_VERSION;
+    header->bypass_flag = 0;
+    header->control_command_flag = 0;
+    header->reserved = 0;
+    header->spacecraft_id = (uint16_t)(spacecraft_id & 0x3ffu);
+    header->virtual_channel_id = (uint8_t)(virtual_channel_id & 0x3fu);
+    header->frame_length = 0;
+    header->frame_sequence_number = frame_seq_num;
+}
+
+static size_t tc_data_offset(const sdlp_tc_header_t *header) {
+#ifdef TC_SEGMENT_HEADER_ENABLED
+    if (!header->control_command_flag) {
+        return TC_PRIMARY_HEADER_SIZE + TC_SEGMENT_HEADER_SIZE;
+    }
+#else
+    (void)header;
+#endif
+    return TC_PRIMARY_HEADER_SIZE;
+}
+
+static size_t tc_pack_primary_header(const sdlp_tc_header_t *header, uint8_t *buffer) {
+    size_t offset = 0;
+    
+    buffer[offset++] = (uint8_t)((header->transfer_frame_version << 6) | 
+                       ((header->bypass_flag & 0x01u) << 5) |
+                       ((header->control_command_flag & 0x01u) << 4) |
+                       ((header->reserved & 0x03u) << 2) |
+                       ((header->spacecraft_id >> 8) & 0x03u));
+    buffer[offset++] = (uint8_t)(header->spacecraft_id & 0xffu);
+    buffer[offset++] = (uint8_t)(((header->virtual_channel_id & 0x3fu) << 2) |
+                       ((header->frame_length >> 8) & 0x03u));
+    buffer[offset++] = (uint8_t)(header->frame_length & 0xffu);
+    buffer[offset++] = header->frame_sequence_number;
+
+    return offset;
+}
+
+#ifdef TC_SEGMENT_HEADER_ENABLED
+static size_t tc_pack_segment_header(const sdlp_tc_segment_header_t *segment_header, uint8_t *buffer) {
+    buffer[0] = (uint8_t)(((segment_header->sequence_flags & 0x03u) << 6) |
+                (segment_header->map_id & 0x3fu));
+
+    return TC_SEGMENT_HEADER_SIZE;
+}
+#endif
+
+static size_t tc_put_fecf(uint8_t *buffer, size_t offset, uint16_t crc) {
+    buffer[offset++] = (uint8_t)((crc >> 8) & 0xffu);
+    buffer[offset++] = (uint8_t)(crc & 0xffu);
+
+    return offset;
+}
+
+static size_t tc_append_fecf(uint8_t *buffer, size_t offset) {
+    return tc_put_fecf(buffer, offset, sdlp_crc16(buffer, offset));
+}
+
 int sdlp_tc_create_frame(sdlp_tc_frame_t *frame, uint16_t spacecraft_id, 
                           uint8_t virtual_channel_id, uint8_t frame_seq_num,
                           const uint8_t *data, uint16_t data_length) {
@@ -10,14 +71,8 @@ int sdlp_tc_create_frame(sdlp_tc_frame_t *frame, uint16_t spacecraft_id,
 
     memset(frame, 0, sizeof(sdlp_tc_frame_t));
     
-    frame->header.transfer_frame_version = SDLP_VERSION;
-    frame->header.bypass_flag = 0;
-    frame->header.control_command_flag = 0;
-    frame->header.reserved = 0;
-    frame->header.spacecraft_id = (uint16_t)(spacecraft_id & 0x3ffu);
-    frame->header.virtual_channel_id = (uint8_t)(virtual_channel_id & 0x3fu);
+    tc_init_header(&frame->header, spacecraft_id, virtual_channel_id, frame_seq_num);
     frame->header.frame_length = (uint16_t)(data_length - 1u);
-    frame->header.frame_sequence_number = frame_seq_num;
     
     memcpy(frame->data, data, data_length);
     frame->data_length = data_length;
@@ -27,6 +82,8 @@ int sdlp_tc_create_frame(sdlp_tc_frame_t *frame, uint16_t spacecraft_id,
 
 int sdlp_tc_encode_frame(const sdlp_tc_frame_t *frame, uint8_t *buffer, 
                           size_t buffer_size, size_t *encoded_size) {
+    SDLP_STATS_TIMER_START(start);
+
     if (!frame || !buffer || !encoded_size) {
         return SDLP_ERROR_INVALID_PARAM;
     }
@@ -41,99 +98,274 @@ int sdlp_tc_encode_frame(const sdlp_tc_frame_t *frame, uint8_t *buffer,
 #endif
     
     if (buffer_size < required_size) {
+        SDLP_STATS_COUNT(SDLP_STAT_BUFFER_TOO_SMALL);
         return SDLP_ERROR_BUFFER_TOO_SMALL;
     }
     
-    size_t offset = 0;
-    
-    buffer[offset++] = (uint8_t)((frame->header.transfer_frame_version << 6) | 
-                       ((frame->header.bypass_flag & 0x01u) << 5) |
-                       ((frame->header.control_command_flag & 0x01u) << 4) |
-                       ((frame->header.reserved & 0x03u) << 2) |
-                       ((frame->header.spacecraft_id >> 8) & 0x03u));
-    buffer[offset++] = (uint8_t)(frame->header.spacecraft_id & 0xffu);
-    buffer[offset++] = (uint8_t)(((frame->header.virtual_channel_id & 0x3fu) << 2) |
-                       ((frame->header.frame_length >> 8) & 0x03u));
-    buffer[offset++] = (uint8_t)(frame->header.frame_length & 0xffu);
-    buffer[offset++] = frame->header.frame_sequence_number;
+    size_t offset = tc_pack_primary_header(&frame->header, buffer);
 
 #ifdef TC_SEGMENT_HEADER_ENABLED
     if (!frame->header.control_command_flag) {
-        buffer[offset++] = (uint8_t)(((frame->segment_header.sequence_flags & 0x03u) << 6) |
-                           (frame->segment_header.map_id & 0x3fu));
+        offset += tc_pack_segment_header(&frame->segment_header, &buffer[offset]);
     }
 #endif
     
-    memcpy(&buffer[offset], frame->data, frame->data_length);
+    uint16_t crc = sdlp_crc16_update(sdlp_crc16_init(), buffer, offset);
+
+    crc = sdlp_crc16_copy(crc, &buffer[offset], frame->data, frame->data_length);
     offset += frame->data_length;
     
-    uint16_t crc = sdlp_crc16(buffer, offset);
-    buffer[offset++] = (uint8_t)((crc >> 8) & 0xffu);
-    buffer[offset++] = (uint8_t)(crc & 0xffu);
-    
-    *encoded_size = offset;
+    *encoded_size = tc_put_fecf(buffer, offset, sdlp_crc16_final(crc));
+
+    SDLP_STATS_COUNT(SDLP_STAT_TC_ENCODED);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_ENCODE, start, 1);
     
     return SDLP_SUCCESS;
 }
 
-int sdlp_tc_decode_frame(const uint8_t *buffer, size_t buffer_size, 
-                          sdlp_tc_frame_t *frame) {
-    if (!buffer || !frame || buffer_size < TC_PRIMARY_HEADER_SIZE + TC_FRAME_ERROR_CONTROL_SIZE) {
+int sdlp_tc_encode_iov(uint16_t spacecraft_id, uint8_t virtual_channel_id, uint8_t frame_seq_num,
+                       const sdlp_iovec_t *iov, size_t iov_count, uint8_t *buffer,
+                       size_t buffer_size, size_t *encoded_size) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!buffer || !encoded_size) {
         return SDLP_ERROR_INVALID_PARAM;
     }
-    
-    memset(frame, 0, sizeof(sdlp_tc_frame_t));
 
+    size_t data_length = sdlp_iov_length(iov, iov_count);
+
+    if (data_length > TC_MAX_DATA_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    sdlp_tc_header_t header;
+
+    tc_init_header(&header, spacecraft_id, virtual_channel_id, frame_seq_num);
+    header.frame_length = (uint16_t)((data_length - 1u) & 0x3ffu);
+
+    size_t offset = tc_data_offset(&header);
+
+    if (buffer_size < offset + data_length + TC_FRAME_ERROR_CONTROL_SIZE) {
+        SDLP_STATS_COUNT(SDLP_STAT_BUFFER_TOO_SMALL);
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    tc_pack_primary_header(&header, buffer);
+#ifdef TC_SEGMENT_HEADER_ENABLED
+    /* Same default segment header as sdlp_tc_create_frame(). */
+    sdlp_tc_segment_header_t segment_header = {0};
+
+    tc_pack_segment_header(&segment_header, &buffer[TC_PRIMARY_HEADER_SIZE]);
+#endif
+
+    uint16_t crc = sdlp_crc16_gather(buffer, offset, iov, iov_count);
+
+    *encoded_size = tc_put_fecf(buffer, offset + data_length, sdlp_crc16_final(crc));
+
+    SDLP_STATS_COUNT(SDLP_STAT_TC_ENCODED);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_ENCODE, start, 1);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tc_builder_begin(sdlp_tc_builder_t *builder, uint8_t *buffer, size_t buffer_size,
+                          uint16_t spacecraft_id, uint8_t virtual_channel_id,
+                          uint8_t frame_seq_num) {
+    if (!builder || !buffer) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(builder, 0, sizeof(sdlp_tc_builder_t));
+    tc_init_header(&builder->header, spacecraft_id, virtual_channel_id, frame_seq_num);
+
+    size_t data_offset = tc_data_offset(&builder->header);
+
+    if (buffer_size < data_offset + TC_FRAME_ERROR_CONTROL_SIZE) {
+        SDLP_STATS_COUNT(SDLP_STAT_BUFFER_TOO_SMALL);
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    size_t capacity = buffer_size - data_offset - TC_FRAME_ERROR_CONTROL_SIZE;
+
+    builder->buffer = buffer;
+    builder->buffer_size = buffer_size;
+    builder->data = &buffer[data_offset];
+    builder->data_capacity = (uint16_t)(capacity < TC_MAX_DATA_SIZE ? capacity : TC_MAX_DATA_SIZE);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tc_builder_commit(sdlp_tc_builder_t *builder, uint16_t data_length,
+                           size_t *encoded_size) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!builder || !builder->buffer || !encoded_size || data_length > builder->data_capacity) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    /* The data field was laid out at begin(); a header change that moves it is an error. */
+    if (builder->data != &builder->buffer[tc_data_offset(&builder->header)]) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    builder->header.frame_length = (uint16_t)((data_length - 1u) & 0x3ffu);
+
+    size_t offset = tc_pack_primary_header(&builder->header, builder->buffer);
+
+#ifdef TC_SEGMENT_HEADER_ENABLED
+    if (!builder->header.control_command_flag) {
+        offset += tc_pack_segment_header(&builder->segment_header, &builder->buffer[offset]);
+    }
+#endif
+
+    *encoded_size = tc_append_fecf(builder->buffer, offset + data_length);
+
+    SDLP_STATS_COUNT(SDLP_STAT_TC_ENCODED);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_ENCODE, start, 1);
+
+    return SDLP_SUCCESS;
+}
+
+static size_t tc_unpack_header(const uint8_t *buffer, sdlp_tc_header_t *header) {
     size_t offset = 0;
     
-    frame->header.transfer_frame_version = (uint8_t)((buffer[offset] >> 6) & 0x03u);
-    frame->header.bypass_flag = (uint8_t)((buffer[offset] >> 5) & 0x01u);
-    frame->header.control_command_flag = (uint8_t)((buffer[offset] >> 4) & 0x01u);
-    frame->header.reserved = (uint8_t)((buffer[offset] >> 2) & 0x03u);
-    frame->header.spacecraft_id = (uint16_t)(((uint16_t)(buffer[offset] & 0x03u) << 8) | buffer[offset + 1]);
+    header->transfer_frame_version = (uint8_t)((buffer[offset] >> 6) & 0x03u);
+    header->bypass_flag = (uint8_t)((buffer[offset] >> 5) & 0x01u);
+    header->control_command_flag = (uint8_t)((buffer[offset] >> 4) & 0x01u);
+    header->reserved = (uint8_t)((buffer[offset] >> 2) & 0x03u);
+    header->spacecraft_id = (uint16_t)(((uint16_t)(buffer[offset] & 0x03u) << 8) | buffer[offset + 1]);
     offset += 2;
     
-    frame->header.virtual_channel_id = (uint8_t)((buffer[offset] >> 2) & 0x3fu);
-    frame->header.frame_length = (uint16_t)((((uint16_t)buffer[offset] & 0x03u) << 8) |
-                                 (uint16_t)buffer[offset + 1]);
+    header->virtual_channel_id = (uint8_t)((buffer[offset] >> 2) & 0x3fu);
+    header->frame_length = (uint16_t)((((uint16_t)buffer[offset] & 0x03u) << 8) |
+                             (uint16_t)buffer[offset + 1]);
     offset += 2;
-    frame->header.frame_sequence_number = buffer[offset++];
+    header->frame_sequence_number = buffer[offset++];
+
+    return offset;
+}
+
+int sdlp_tc_peek_header(const uint8_t *buffer, size_t buffer_size, sdlp_tc_header_t *header) {
+    if (!buffer || !header || buffer_size < TC_PRIMARY_HEADER_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    tc_unpack_header(buffer, header);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tc_decode_view(const uint8_t *buffer, size_t buffer_size,
+                        sdlp_tc_frame_view_t *view, int verify_crc) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!buffer || !view) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (buffer_size < TC_PRIMARY_HEADER_SIZE + TC_FRAME_ERROR_CONTROL_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t offset = tc_unpack_header(buffer, &view->header);
+
+    size_t data_length = buffer_size - TC_PRIMARY_HEADER_SIZE - TC_FRAME_ERROR_CONTROL_SIZE;
 
 #ifdef TC_SEGMENT_HEADER_ENABLED
-    if (!frame->header.control_command_flag) {
+    if (!view->header.control_command_flag) {
         if (buffer_size < TC_PRIMARY_HEADER_SIZE + TC_SEGMENT_HEADER_SIZE + TC_FRAME_ERROR_CONTROL_SIZE) {
+            SDLP_STATS_COUNT(SDLP_STAT_INVALID_FRAME);
             return SDLP_ERROR_INVALID_FRAME;
         }
-        frame->segment_header.sequence_flags = (uint8_t)((buffer[offset] >> 6) & 0x03u);
-        frame->segment_header.map_id = (uint8_t)(buffer[offset] & 0x3fu);
+        view->segment_header.sequence_flags = (uint8_t)((buffer[offset] >> 6) & 0x03u);
+        view->segment_header.map_id = (uint8_t)(buffer[offset] & 0x3fu);
         offset++;
-        frame->data_length = (uint16_t)(buffer_size - TC_PRIMARY_HEADER_SIZE - TC_SEGMENT_HEADER_SIZE -
-                             TC_FRAME_ERROR_CONTROL_SIZE);
+        data_length -= TC_SEGMENT_HEADER_SIZE;
     } else {
-        frame->data_length = (uint16_t)(buffer_size - TC_PRIMARY_HEADER_SIZE - TC_FRAME_ERROR_CONTROL_SIZE);
+        view->segment_header.sequence_flags = 0;
+        view->segment_header.map_id = 0;
     }
-#else
-    frame->data_length = (uint16_t)(buffer_size - TC_PRIMARY_HEADER_SIZE - TC_FRAME_ERROR_CONTROL_SIZE);
 #endif
-    
-    if (frame->data_length > TC_MAX_DATA_SIZE) {
+
+    if (data_length > UINT16_MAX) {
+        SDLP_STATS_COUNT(SDLP_STAT_INVALID_FRAME);
         return SDLP_ERROR_INVALID_FRAME;
     }
+
+    view->frame = buffer;
+    view->frame_length = buffer_size;
+    view->data = &buffer[offset];
+    view->data_length = (uint16_t)data_length;
+    offset += data_length;
     
-    memcpy(frame->data, &buffer[offset], frame->data_length);
-    offset += frame->data_length;
-    
-    frame->fecf = (uint16_t)(((uint16_t)buffer[offset] << 8) | buffer[offset + 1]);
-    
-    uint16_t calculated_crc = sdlp_crc16(buffer, buffer_size - TC_FRAME_ERROR_CONTROL_SIZE);
+    view->fecf = (uint16_t)(((uint16_t)buffer[offset] << 8) | buffer[offset + 1]);
+
+    if (verify_crc) {
+        int result = sdlp_tc_view_verify_crc(view);
+
+        SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_DECODE, start, 1);
+        return result;
+    }
     
-    if (calculated_crc != frame->fecf) {
+    return SDLP_SUCCESS;
+}
+
+static int tc_check_fecf(const sdlp_tc_frame_view_t *view, uint16_t calculated_crc) {
+    if (calculated_crc != view->fecf) {
+        SDLP_STATS_COUNT(SDLP_STAT_CRC_MISMATCH);
         return SDLP_ERROR_CRC_MISMATCH;
     }
-    
+
+    SDLP_STATS_COUNT(SDLP_STAT_TC_DECODED);
     return SDLP_SUCCESS;
 }
 
+int sdlp_tc_view_verify_crc(const sdlp_tc_frame_view_t *view) {
+    if (!view || !view->frame) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    return tc_check_fecf(view, sdlp_crc16(view->frame, view->frame_length - TC_FRAME_ERROR_CONTROL_SIZE));
+}
+
+int sdlp_tc_decode_frame(const uint8_t *buffer, size_t buffer_size, 
+                          sdlp_tc_frame_t *frame) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!frame) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    sdlp_tc_frame_view_t view;
+    int result = sdlp_tc_decode_view(buffer, buffer_size, &view, 0);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    frame->header = view.header;
+#ifdef TC_SEGMENT_HEADER_ENABLED
+    frame->segment_header = view.segment_header;
+#endif
+    
+    if (view.data_length > TC_MAX_DATA_SIZE) {
+        SDLP_STATS_COUNT(SDLP_STAT_INVALID_FRAME);
+        return SDLP_ERROR_INVALID_FRAME;
+    }
+    
+    /* The data field is checked as it is copied out; the headers precede it. */
+    uint16_t crc = sdlp_crc16_update(sdlp_crc16_init(), view.frame, (size_t)(view.data - view.frame));
+
+    crc = sdlp_crc16_copy(crc, frame->data, view.data, view.data_length);
+    frame->data_length = view.data_length;
+    frame->fecf = view.fecf;
+
+    result = tc_check_fecf(&view, sdlp_crc16_final(crc));
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_DECODE, start, 1);
+    
+    return result;
+}
+
 #ifdef TC_SEGMENT_HEADER_ENABLED
 int sdlp_tc_set_segment_header(sdlp_tc_frame_t *frame, sdlp_tc_seq_flag_t sequence_flags, uint8_t map_id) {
     if (!frame) {
@@ -144,3 +376,61 @@ int sdlp_tc_set_segment_header(sdlp_tc_frame_t *frame, sdlp_tc_seq_flag_t sequen
     return SDLP_SUCCESS;
 }
 #endif
+
+static void tc_batch_verify(const sdlp_tc_frame_view_t *views, int *results,
+                            const size_t *index, size_t count) {
+    const uint8_t *data[SDLP_CRC16_STREAMS] = {NULL};
+    size_t length[SDLP_CRC16_STREAMS] = {0};
+    uint16_t crc[SDLP_CRC16_STREAMS];
+
+    for (size_t s = 0; s < count; s++) {
+        data[s] = views[index[s]].frame;
+        length[s] = views[index[s]].frame_length - TC_FRAME_ERROR_CONTROL_SIZE;
+    }
+
+    sdlp_crc16_multi(data, length, crc, count);
+
+    for (size_t s = 0; s < count; s++) {
+        if (crc[s] != views[index[s]].fecf) {
+            SDLP_STATS_COUNT(SDLP_STAT_CRC_MISMATCH);
+            results[index[s]] = SDLP_ERROR_CRC_MISMATCH;
+        } else {
+            SDLP_STATS_COUNT(SDLP_STAT_TC_DECODED);
+        }
+    }
+}
+
+int sdlp_tc_decode_batch(const sdlp_frame_desc_t *frames, size_t count,
+                         sdlp_tc_frame_view_t *views, int *results) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!frames || !views || !results) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t pending[SDLP_CRC16_STREAMS];
+    size_t pending_count = 0;
+
+    /* Headers first; the CRCs of every SDLP_CRC16_STREAMS parsed frames run together. */
+    for (size_t i = 0; i < count; i++) {
+        results[i] = sdlp_tc_decode_view(frames[i].buffer, frames[i].length, &views[i], 0);
+
+        if (results[i] != SDLP_SUCCESS) {
+            continue;
+        }
+
+        pending[pending_count++] = i;
+        if (pending_count == SDLP_CRC16_STREAMS) {
+            tc_batch_verify(views, results, pending, pending_count);
+            pending_count = 0;
+        }
+    }
+
+    if (pending_count) {
+        tc_batch_verify(views, results, pending, pending_count);
+    }
+
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_DECODE, start, count);
+
+    return SDLP_SUCCESS;
+}
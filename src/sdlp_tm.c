@@ -1,8 +1,92 @@
 #include "sdlp_tm.h"
+#include "sdlp_fixed.h"
+#include "sdlp_internal.h"
 #include <string.h>
 
-/* Note: not thread-safe, caller must ensure sequential access */
-static uint8_t tm_frame_counter = 0;
+/* Default context behind sdlp_tm_create_frame() and sdlp_tm_builder_begin(). */
+static sdlp_counter_t tm_default_master_count;
+static sdlp_counter_t tm_default_vc_count[TM_MAX_VIRTUAL_CHANNELS];
+
+static void tm_init_header(sdlp_tm_header_t *header, uint16_t spacecraft_id,
+                           uint8_t virtual_channel_id, sdlp_counter_t *master_count,
+                           sdlp_counter_t *vc_count) {
+    header->transfer_frame_version = SDLP_VERSION;
+    header->spacecraft_id = (uint16_t)(spacecraft_id & 0x3ffu);
+    header->virtual_channel_id = (uint8_t)(virtual_channel_id & 0x07u);
+    header->ocf_flag = 0;
+    header->master_channel_frame_count = (uint8_t)(SDLP_COUNTER_FETCH_ADD(master_count) & 0xffu);
+    header->virtual_channel_frame_count = (uint8_t)(SDLP_COUNTER_FETCH_ADD(vc_count) & 0xffu);
+    header->transfer_frame_data_field_status = 0;
+}
+
+static void tm_init_default_header(sdlp_tm_header_t *header, uint16_t spacecraft_id,
+                                   uint8_t virtual_channel_id) {
+    tm_init_header(header, spacecraft_id, virtual_channel_id, &tm_default_master_count,
+                   &tm_default_vc_count[virtual_channel_id & 0x07u]);
+}
+
+static void tm_init_vc_header(sdlp_tm_header_t *header, sdlp_tm_virtual_channel_t *channel) {
+    tm_init_header(header, channel->master->spacecraft_id, channel->virtual_channel_id,
+                   &channel->master->frame_count, &channel->frame_count);
+}
+
+size_t sdlp_tm_pack_header(const sdlp_tm_header_t *header, uint8_t *buffer) {
+    sdlp_tm_fixed_pack_header(header, buffer);
+
+    return TM_PRIMARY_HEADER_SIZE;
+}
+
+static size_t tm_put_fecf(uint8_t *buffer, size_t offset, uint16_t crc) {
+    buffer[offset++] = (uint8_t)((crc >> 8) & 0xffu);
+    buffer[offset++] = (uint8_t)(crc & 0xffu);
+
+    return offset;
+}
+
+static size_t tm_append_fecf(uint8_t *buffer, size_t offset) {
+    return tm_put_fecf(buffer, offset, sdlp_crc16(buffer, offset));
+}
+
+int sdlp_tm_master_channel_init(sdlp_tm_master_channel_t *master, uint16_t spacecraft_id) {
+    if (!master) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    master->spacecraft_id = (uint16_t)(spacecraft_id & 0x3ffu);
+    SDLP_COUNTER_INIT(&master->frame_count, 0u);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_virtual_channel_init(sdlp_tm_virtual_channel_t *channel,
+                                 sdlp_tm_master_channel_t *master,
+                                 uint8_t virtual_channel_id) {
+    if (!channel || !master || virtual_channel_id >= TM_MAX_VIRTUAL_CHANNELS) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    channel->master = master;
+    channel->virtual_channel_id = virtual_channel_id;
+    SDLP_COUNTER_INIT(&channel->frame_count, 0u);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_vc_create_frame(sdlp_tm_virtual_channel_t *channel, sdlp_tm_frame_t *frame,
+                            const uint8_t *data, uint16_t data_length) {
+    if (!channel || !channel->master || !frame || !data || data_length > TM_MAX_DATA_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    memset(frame, 0, sizeof(sdlp_tm_frame_t));
+
+    tm_init_vc_header(&frame->header, channel);
+
+    memcpy(frame->data, data, data_length);
+    frame->data_length = data_length;
+
+    return SDLP_SUCCESS;
+}
 
 int sdlp_tm_create_frame(sdlp_tm_frame_t *frame, uint16_t spacecraft_id, 
                           uint8_t virtual_channel_id, const uint8_t *data, 
@@ -13,13 +97,7 @@ int sdlp_tm_create_frame(sdlp_tm_frame_t *frame, uint16_t spacecraft_id,
 
     memset(frame, 0, sizeof(sdlp_tm_frame_t));
     
-    frame->header.transfer_frame_version = SDLP_VERSION;
-    frame->header.spacecraft_id = (uint16_t)(spacecraft_id & 0x3ffu);
-    frame->header.virtual_channel_id = (uint8_t)(virtual_channel_id & 0x07u);
-    frame->header.ocf_flag = 0;
-    frame->header.master_channel_frame_count = tm_frame_counter++;
-    frame->header.virtual_channel_frame_count = 0;
-    frame->header.transfer_frame_data_field_status = 0;
+    tm_init_default_header(&frame->header, spacecraft_id, virtual_channel_id);
     
     memcpy(frame->data, data, data_length);
     frame->data_length = data_length;
@@ -29,6 +107,8 @@ int sdlp_tm_create_frame(sdlp_tm_frame_t *frame, uint16_t spacecraft_id,
 
 int sdlp_tm_encode_frame(const sdlp_tm_frame_t *frame, uint8_t *buffer, 
                           size_t buffer_size, size_t *encoded_size) {
+    SDLP_STATS_TIMER_START(start);
+
     if (!frame || !buffer || !encoded_size) {
         return SDLP_ERROR_INVALID_PARAM;
     }
@@ -37,76 +117,399 @@ int sdlp_tm_encode_frame(const sdlp_tm_frame_t *frame, uint8_t *buffer,
                            TM_FRAME_ERROR_CONTROL_SIZE;
     
     if (buffer_size < required_size) {
+        SDLP_STATS_COUNT(SDLP_STAT_BUFFER_TOO_SMALL);
         return SDLP_ERROR_BUFFER_TOO_SMALL;
     }
     
-    size_t offset = 0;
-    
-    buffer[offset++] = (uint8_t)((frame->header.transfer_frame_version << 6) | 
-                       ((frame->header.spacecraft_id >> 4) & 0x3fu));
-    buffer[offset++] = (uint8_t)(((frame->header.spacecraft_id & 0x0fu) << 4) | 
-                       ((frame->header.virtual_channel_id & 0x07u) << 1) | 
-                       (frame->header.ocf_flag & 0x01u));
-    buffer[offset++] = frame->header.master_channel_frame_count;
-    buffer[offset++] = frame->header.virtual_channel_frame_count;
-    
-    uint16_t data_field_status = frame->header.transfer_frame_data_field_status;
-    buffer[offset++] = (uint8_t)((data_field_status >> 8) & 0xffu);
-    buffer[offset++] = (uint8_t)(data_field_status & 0xffu);
-    
-    memcpy(&buffer[offset], frame->data, frame->data_length);
+    size_t offset = sdlp_tm_pack_header(&frame->header, buffer);
+    uint16_t crc = sdlp_crc16_update(sdlp_crc16_init(), buffer, offset);
+
+    crc = sdlp_crc16_copy(crc, &buffer[offset], frame->data, frame->data_length);
     offset += frame->data_length;
     
-    uint16_t crc = sdlp_crc16(buffer, offset);
-    buffer[offset++] = (uint8_t)((crc >> 8) & 0xffu);
-    buffer[offset++] = (uint8_t)(crc & 0xffu);
+    *encoded_size = tm_put_fecf(buffer, offset, sdlp_crc16_final(crc));
+
+    SDLP_STATS_COUNT(SDLP_STAT_TM_ENCODED);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_ENCODE, start, 1);
+    
+    return SDLP_SUCCESS;
+}
+
+/* The header is initialised, taking the next frame counts, only once the frame
+ * is known to fit. channel NULL selects the default context. */
+static int tm_encode_iov(sdlp_tm_virtual_channel_t *channel, uint16_t spacecraft_id,
+                         uint8_t virtual_channel_id, const sdlp_iovec_t *iov, size_t iov_count,
+                         uint8_t *buffer, size_t buffer_size, size_t *encoded_size) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!buffer || !encoded_size) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t data_length = sdlp_iov_length(iov, iov_count);
+
+    if (data_length > TM_MAX_DATA_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (buffer_size < TM_PRIMARY_HEADER_SIZE + data_length + TM_FRAME_ERROR_CONTROL_SIZE) {
+        SDLP_STATS_COUNT(SDLP_STAT_BUFFER_TOO_SMALL);
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    sdlp_tm_header_t header;
+
+    if (channel) {
+        tm_init_vc_header(&header, channel);
+    } else {
+        tm_init_default_header(&header, spacecraft_id, virtual_channel_id);
+    }
+
+    size_t offset = sdlp_tm_pack_header(&header, buffer);
+    uint16_t crc = sdlp_crc16_gather(buffer, offset, iov, iov_count);
+
+    *encoded_size = tm_put_fecf(buffer, offset + data_length, sdlp_crc16_final(crc));
+
+    SDLP_STATS_COUNT(SDLP_STAT_TM_ENCODED);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_ENCODE, start, 1);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_encode_iov(uint16_t spacecraft_id, uint8_t virtual_channel_id, const sdlp_iovec_t *iov,
+                       size_t iov_count, uint8_t *buffer, size_t buffer_size,
+                       size_t *encoded_size) {
+    return tm_encode_iov(NULL, spacecraft_id, virtual_channel_id, iov, iov_count, buffer,
+                         buffer_size, encoded_size);
+}
+
+int sdlp_tm_vc_encode_iov(sdlp_tm_virtual_channel_t *channel, const sdlp_iovec_t *iov,
+                          size_t iov_count, uint8_t *buffer, size_t buffer_size,
+                          size_t *encoded_size) {
+    if (!channel || !channel->master) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    return tm_encode_iov(channel, 0, 0, iov, iov_count, buffer, buffer_size, encoded_size);
+}
+
+static int tm_builder_setup(sdlp_tm_builder_t *builder, uint8_t *buffer, size_t buffer_size) {
+    if (buffer_size < TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE) {
+        SDLP_STATS_COUNT(SDLP_STAT_BUFFER_TOO_SMALL);
+        return SDLP_ERROR_BUFFER_TOO_SMALL;
+    }
+
+    size_t capacity = buffer_size - TM_PRIMARY_HEADER_SIZE - TM_FRAME_ERROR_CONTROL_SIZE;
+
+    builder->buffer = buffer;
+    builder->buffer_size = buffer_size;
+    builder->data = &buffer[TM_PRIMARY_HEADER_SIZE];
+    builder->data_capacity = (uint16_t)(capacity < TM_MAX_DATA_SIZE ? capacity : TM_MAX_DATA_SIZE);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_builder_begin(sdlp_tm_builder_t *builder, uint8_t *buffer, size_t buffer_size,
+                          uint16_t spacecraft_id, uint8_t virtual_channel_id) {
+    if (!builder || !buffer) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    int result = tm_builder_setup(builder, buffer, buffer_size);
+
+    if (result == SDLP_SUCCESS) {
+        tm_init_default_header(&builder->header, spacecraft_id, virtual_channel_id);
+    }
+
+    return result;
+}
+
+int sdlp_tm_vc_builder_begin(sdlp_tm_virtual_channel_t *channel, sdlp_tm_builder_t *builder,
+                             uint8_t *buffer, size_t buffer_size) {
+    if (!channel || !channel->master || !builder || !buffer) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    int result = tm_builder_setup(builder, buffer, buffer_size);
+
+    if (result == SDLP_SUCCESS) {
+        tm_init_vc_header(&builder->header, channel);
+    }
+
+    return result;
+}
+
+int sdlp_tm_builder_commit(sdlp_tm_builder_t *builder, uint16_t data_length,
+                           size_t *encoded_size) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!builder || !builder->buffer || !encoded_size || data_length > builder->data_capacity) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t offset = sdlp_tm_pack_header(&builder->header, builder->buffer) + data_length;
+
+    *encoded_size = tm_append_fecf(builder->buffer, offset);
+
+    SDLP_STATS_COUNT(SDLP_STAT_TM_ENCODED);
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_ENCODE, start, 1);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_template_init(sdlp_tm_template_t *tmpl, const sdlp_tm_frame_t *frame,
+                          uint8_t *buffer, size_t buffer_size) {
+    if (!tmpl) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t encoded_size = 0;
+    int result = sdlp_tm_encode_frame(frame, buffer, buffer_size, &encoded_size);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    tmpl->buffer = buffer;
+    tmpl->frame_length = encoded_size;
+    tmpl->counts_shift = sdlp_crc16_shift(1u, encoded_size - TM_FRAME_ERROR_CONTROL_SIZE - 4u);
+
+    return SDLP_SUCCESS;
+}
+
+/* FECF ^= the CRC of the difference, moved to the end of the frame. */
+static void tm_template_patch_fecf(sdlp_tm_template_t *tmpl, uint16_t delta) {
+    uint8_t *fecf = &tmpl->buffer[tmpl->frame_length - TM_FRAME_ERROR_CONTROL_SIZE];
+
+    fecf[0] ^= (uint8_t)(delta >> 8);
+    fecf[1] ^= (uint8_t)(delta & 0xffu);
+}
+
+int sdlp_tm_template_patch(sdlp_tm_template_t *tmpl, size_t offset, const uint8_t *bytes,
+                           size_t length) {
+    if (!tmpl || !tmpl->buffer || (!bytes && length > 0)) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t covered = tmpl->frame_length - TM_FRAME_ERROR_CONTROL_SIZE;
+
+    if (offset > covered || length > covered - offset) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    uint8_t *target = &tmpl->buffer[offset];
+    uint16_t delta = 0;
+
+    for (size_t done = 0; done < length;) {
+        uint8_t diff[64];
+        size_t n = length - done < sizeof(diff) ? length - done : sizeof(diff);
+
+        for (size_t i = 0; i < n; i++) {
+            diff[i] = (uint8_t)(target[done + i] ^ bytes[done + i]);
+        }
+        memcpy(&target[done], &bytes[done], n);
+        delta = sdlp_crc16_update(delta, diff, n);
+        done += n;
+    }
+
+    tm_template_patch_fecf(tmpl, sdlp_crc16_shift(delta, covered - offset - length));
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_template_set_counts(sdlp_tm_template_t *tmpl, uint8_t master_channel_frame_count,
+                                uint8_t virtual_channel_frame_count) {
+    if (!tmpl || !tmpl->buffer) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    uint8_t diff[2] = {(uint8_t)(tmpl->buffer[2] ^ master_channel_frame_count),
+                       (uint8_t)(tmpl->buffer[3] ^ virtual_channel_frame_count)};
+
+    tmpl->buffer[2] = master_channel_frame_count;
+    tmpl->buffer[3] = virtual_channel_frame_count;
+
+    /* A two-byte difference at a fixed offset: one table step per byte and
+     * one multiply by the shift cached at init. */
+    tm_template_patch_fecf(tmpl, sdlp_crc16_mul(sdlp_crc16_update(0, diff, sizeof(diff)),
+                                                tmpl->counts_shift));
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_vc_template_next(sdlp_tm_virtual_channel_t *channel, sdlp_tm_template_t *tmpl) {
+    if (!channel || !channel->master || !tmpl || !tmpl->buffer) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    uint8_t master_count = (uint8_t)(SDLP_COUNTER_FETCH_ADD(&channel->master->frame_count) & 0xffu);
+    uint8_t vc_count = (uint8_t)(SDLP_COUNTER_FETCH_ADD(&channel->frame_count) & 0xffu);
+
+    return sdlp_tm_template_set_counts(tmpl, master_count, vc_count);
+}
+
+static size_t tm_unpack_header(const uint8_t *buffer, sdlp_tm_header_t *header) {
+    sdlp_tm_fixed_unpack_header(buffer, header);
+
+    return TM_PRIMARY_HEADER_SIZE;
+}
+
+int sdlp_tm_peek_header(const uint8_t *buffer, size_t buffer_size, sdlp_tm_header_t *header) {
+    if (!buffer || !header || buffer_size < TM_PRIMARY_HEADER_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    tm_unpack_header(buffer, header);
+
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_decode_view(const uint8_t *buffer, size_t buffer_size,
+                        sdlp_tm_frame_view_t *view, int verify_crc) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!buffer || !view) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    if (buffer_size < TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t data_length = buffer_size - TM_PRIMARY_HEADER_SIZE - TM_FRAME_ERROR_CONTROL_SIZE;
+
+    if (data_length > UINT16_MAX) {
+        SDLP_STATS_COUNT(SDLP_STAT_INVALID_FRAME);
+        return SDLP_ERROR_INVALID_FRAME;
+    }
+
+    size_t offset = tm_unpack_header(buffer, &view->header);
+
+    view->frame = buffer;
+    view->frame_length = buffer_size;
+    view->data = &buffer[offset];
+    view->data_length = (uint16_t)data_length;
+    offset += data_length;
     
-    *encoded_size = offset;
+    view->fecf = (uint16_t)(((uint16_t)buffer[offset] << 8) | buffer[offset + 1]);
+
+    if (verify_crc) {
+        int result = sdlp_tm_view_verify_crc(view);
+
+        SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_DECODE, start, 1);
+        return result;
+    }
     
     return SDLP_SUCCESS;
 }
 
+static int tm_check_fecf(const sdlp_tm_frame_view_t *view, uint16_t calculated_crc) {
+    if (calculated_crc != view->fecf) {
+        SDLP_STATS_COUNT(SDLP_STAT_CRC_MISMATCH);
+        return SDLP_ERROR_CRC_MISMATCH;
+    }
+
+    SDLP_STATS_TM_DECODED(&view->header);
+    return SDLP_SUCCESS;
+}
+
+int sdlp_tm_view_verify_crc(const sdlp_tm_frame_view_t *view) {
+    if (!view || !view->frame) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    return tm_check_fecf(view, sdlp_crc16(view->frame, view->frame_length - TM_FRAME_ERROR_CONTROL_SIZE));
+}
+
 int sdlp_tm_decode_frame(const uint8_t *buffer, size_t buffer_size, 
                           sdlp_tm_frame_t *frame) {
-    if (!buffer || !frame || buffer_size < TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!frame) {
         return SDLP_ERROR_INVALID_PARAM;
     }
+
+    sdlp_tm_frame_view_t view;
+    int result = sdlp_tm_decode_view(buffer, buffer_size, &view, 0);
+
+    if (result != SDLP_SUCCESS) {
+        return result;
+    }
+
+    frame->header = view.header;
     
-    memset(frame, 0, sizeof(sdlp_tm_frame_t));
-    
-    size_t offset = 0;
-    
-    frame->header.transfer_frame_version = (uint8_t)((buffer[offset] >> 6) & 0x03u);
-    frame->header.spacecraft_id = (uint16_t)(((buffer[offset] & 0x3fu) << 4) | ((buffer[offset + 1] >> 4) & 0x0fu));
-    offset++;
-    
-    frame->header.virtual_channel_id = (uint8_t)((buffer[offset] >> 1) & 0x07u);
-    frame->header.ocf_flag = (uint8_t)(buffer[offset] & 0x01u);
-    offset++;
-    
-    frame->header.master_channel_frame_count = buffer[offset++];
-    frame->header.virtual_channel_frame_count = buffer[offset++];
-    
-    uint16_t data_field_status = (uint16_t)(((uint16_t)buffer[offset] << 8) | buffer[offset + 1]);
-    frame->header.transfer_frame_data_field_status = data_field_status;
-    offset += 2;
-    
-    frame->data_length = (uint16_t)(buffer_size - TM_PRIMARY_HEADER_SIZE - TM_FRAME_ERROR_CONTROL_SIZE);
-    
-    if (frame->data_length > TM_MAX_DATA_SIZE) {
+    if (view.data_length > TM_MAX_DATA_SIZE) {
+        SDLP_STATS_COUNT(SDLP_STAT_INVALID_FRAME);
         return SDLP_ERROR_INVALID_FRAME;
     }
     
-    memcpy(frame->data, &buffer[offset], frame->data_length);
-    offset += frame->data_length;
-    
-    frame->fecf = (uint16_t)(((uint16_t)buffer[offset] << 8) | buffer[offset + 1]);
-    
-    uint16_t calculated_crc = sdlp_crc16(buffer, buffer_size - TM_FRAME_ERROR_CONTROL_SIZE);
+    /* The data field is checked as it is copied out. */
+    uint16_t crc = sdlp_crc16_update(sdlp_crc16_init(), view.frame, TM_PRIMARY_HEADER_SIZE);
+
+    crc = sdlp_crc16_copy(crc, frame->data, view.data, view.data_length);
+    frame->data_length = view.data_length;
+    frame->fecf = view.fecf;
+
+    result = tm_check_fecf(&view, sdlp_crc16_final(crc));
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_DECODE, start, 1);
     
-    if (calculated_crc != frame->fecf) {
-        return SDLP_ERROR_CRC_MISMATCH;
+    return result;
+}
+
+static void tm_batch_verify(const sdlp_tm_frame_view_t *views, int *results,
+                            const size_t *index, size_t count) {
+    const uint8_t *data[SDLP_CRC16_STREAMS] = {NULL};
+    size_t length[SDLP_CRC16_STREAMS] = {0};
+    uint16_t crc[SDLP_CRC16_STREAMS];
+
+    for (size_t s = 0; s < count; s++) {
+        data[s] = views[index[s]].frame;
+        length[s] = views[index[s]].frame_length - TM_FRAME_ERROR_CONTROL_SIZE;
     }
-    
+
+    sdlp_crc16_multi(data, length, crc, count);
+
+    for (size_t s = 0; s < count; s++) {
+        if (crc[s] != views[index[s]].fecf) {
+            SDLP_STATS_COUNT(SDLP_STAT_CRC_MISMATCH);
+            results[index[s]] = SDLP_ERROR_CRC_MISMATCH;
+        } else {
+            SDLP_STATS_TM_DECODED(&views[index[s]].header);
+        }
+    }
+}
+
+int sdlp_tm_decode_batch(const sdlp_frame_desc_t *frames, size_t count,
+                         sdlp_tm_frame_view_t *views, int *results) {
+    SDLP_STATS_TIMER_START(start);
+
+    if (!frames || !views || !results) {
+        return SDLP_ERROR_INVALID_PARAM;
+    }
+
+    size_t pending[SDLP_CRC16_STREAMS];
+    size_t pending_count = 0;
+
+    /* Headers first; the CRCs of every SDLP_CRC16_STREAMS parsed frames run together. */
+    for (size_t i = 0; i < count; i++) {
+        results[i] = sdlp_tm_decode_view(frames[i].buffer, frames[i].length, &views[i], 0);
+
+        if (results[i] != SDLP_SUCCESS) {
+            continue;
+        }
+
+        pending[pending_count++] = i;
+        if (pending_count == SDLP_CRC16_STREAMS) {
+            tm_batch_verify(views, results, pending, pending_count);
+            pending_count = 0;
+        }
+    }
+
+    if (pending_count) {
+        tm_batch_verify(views, results, pending, pending_count);
+    }
+
+    SDLP_STATS_TIMER_STOP(SDLP_STATS_TIMER_DECODE, start, count);
+
     return SDLP_SUCCESS;
 }
@@ -0,0 +1,552 @@
+#include "cunit.h"
+#include "sdlp_crc_parallel.h"
+#include "sdlp_frame_pool.h"
+#include "sdlp_mux.h"
+#include "sdlp_pipeline.h"
+#include "sdlp_randomizer.h"
+#include "sdlp_udp.h"
+
+#include <sched.h>
+#include <stdatomic.h>
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#define GT_FRAME_LENGTH 264
+#define GT_STREAM_FRAMES 640
+#define GT_VC_COUNT 4
+
+static const uint8_t gt_vcs[GT_VC_COUNT] = {0, 1, 2, 5};
+
+typedef struct {
+	uint16_t next_seq[TM_MAX_VIRTUAL_CHANNELS];
+	int errors[TM_MAX_VIRTUAL_CHANNELS];
+} gt_sink_t;
+
+static size_t gt_packet_length(uint8_t vc, uint16_t seq) {
+	return 7 + ((size_t)seq * 37 + (size_t)vc * 11) % 500;
+}
+
+static void gt_write_packet(uint8_t *p, uint8_t vc, uint16_t seq, size_t length) {
+	p[0] = 0x08;
+	p[1] = (uint8_t)(0x40 + vc);
+	p[2] = (uint8_t)(0xC0 | ((seq >> 8) & 0x3F));
+	p[3] = (uint8_t)(seq & 0xFF);
+	p[4] = (uint8_t)((length - 7) >> 8);
+	p[5] = (uint8_t)((length - 7) & 0xFF);
+	for (size_t i = SDLP_SPACE_PACKET_HEADER_SIZE; i < length; i++) {
+		p[i] = (uint8_t)((size_t)seq * 7 + vc + i);
+	}
+}
+
+/* Runs on the worker owning vc; every VC has its own slot in the sink. */
+static void gt_on_packet(void *user, uint8_t vc, const uint8_t *packet, size_t length) {
+	gt_sink_t *sink = (gt_sink_t *)user;
+	uint8_t expected[512];
+	uint16_t seq = sink->next_seq[vc];
+
+	if (length != gt_packet_length(vc, seq)) {
+		sink->errors[vc]++;
+		return;
+	}
+	gt_write_packet(expected, vc, seq, length);
+	if (memcmp(expected, packet, length) != 0) {
+		sink->errors[vc]++;
+	}
+	sink->next_seq[vc]++;
+}
+
+static int test_spsc_ring_wraparound(void) {
+	sdlp_spsc_ring_t ring;
+	sdlp_frame_ref_t entries[4];
+	sdlp_frame_ref_t out[8];
+	uint32_t next_in = 0;
+	uint32_t next_out = 0;
+
+	sdlp_spsc_init(&ring, entries, 4);
+	ASSERT_EQ_INT(0, (int)sdlp_spsc_pop_burst(&ring, out, 8));
+
+	for (int round = 0; round < 10; round++) {
+		while (sdlp_spsc_push(&ring, (sdlp_frame_ref_t){next_in, next_in * 3u})) {
+			next_in++;
+		}
+		ASSERT_EQ_INT(4, (int)(next_in - next_out));
+
+		size_t count = sdlp_spsc_pop_burst(&ring, out, (size_t)(round % 3) + 1);
+		ASSERT_EQ_INT(round % 3 + 1, (int)count);
+		for (size_t i = 0; i < count; i++) {
+			ASSERT_EQ_INT((int)next_out, (int)out[i].slot);
+			ASSERT_EQ_INT((int)(next_out * 3u), (int)out[i].length);
+			next_out++;
+		}
+	}
+
+	return 0;
+}
+
+/* Four VCs multiplexed into an ASM-framed stream, with one corrupted frame
+ * inserted, go through sync, check and two workers; every packet must come
+ * out once, in order, on its own VC, with and without randomization. */
+static int test_pipeline_end_to_end(void) {
+	static uint8_t stream[(GT_STREAM_FRAMES + 1) * (SDLP_ASM_SIZE + GT_FRAME_LENGTH)];
+	static uint8_t rings[GT_VC_COUNT][2048];
+	static gt_sink_t sink;
+	static sdlp_pipeline_t pipeline;
+	sdlp_mux_t mux;
+	sdlp_mux_vc_t vcs[GT_VC_COUNT];
+	uint16_t enqueued[GT_VC_COUNT] = {0};
+	uint8_t packet[512];
+	size_t stream_length = 0;
+	size_t frame_size = 0;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_init(&mux, 0x0C3, GT_FRAME_LENGTH, SDLP_MUX_WEIGHTED_RR));
+	for (int i = 0; i < GT_VC_COUNT; i++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_add_vc(&mux, &vcs[i], gt_vcs[i], rings[i], sizeof(rings[i]), 0,
+																								(uint8_t)(i + 1)));
+	}
+
+	for (int f = 0; f < GT_STREAM_FRAMES; f++) {
+		/* Stop feeding packets near the end so that every queue drains. */
+		for (int i = 0; f < GT_STREAM_FRAMES - 64 && i < GT_VC_COUNT; i++) {
+			size_t length = gt_packet_length(gt_vcs[i], enqueued[i]);
+
+			gt_write_packet(packet, gt_vcs[i], enqueued[i], length);
+			if (sdlp_mux_enqueue(&vcs[i], packet, length) == SDLP_SUCCESS) {
+				enqueued[i]++;
+			}
+		}
+
+		uint8_t *marker = &stream[stream_length];
+
+		marker[0] = 0x1A;
+		marker[1] = 0xCF;
+		marker[2] = 0xFC;
+		marker[3] = 0x1D;
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_next_frame(&mux, &marker[SDLP_ASM_SIZE], GT_FRAME_LENGTH, &frame_size));
+		stream_length += SDLP_ASM_SIZE + GT_FRAME_LENGTH;
+
+		if (f == 100) {
+			memcpy(&stream[stream_length], marker, SDLP_ASM_SIZE + GT_FRAME_LENGTH);
+			stream[stream_length + SDLP_ASM_SIZE + 40] ^= 0x01;
+			stream_length += SDLP_ASM_SIZE + GT_FRAME_LENGTH;
+		}
+	}
+	for (int i = 0; i < GT_VC_COUNT; i++) {
+		ASSERT_EQ_INT(0, (int)sdlp_mux_queued(&vcs[i]));
+		ASSERT_TRUE(enqueued[i] > 50);
+	}
+
+	sdlp_pipeline_config_t config = {GT_FRAME_LENGTH, 8, 2, 512, 1, 2, 2, 0, gt_on_packet, &sink, NULL,
+																			 SDLP_PIPELINE_WAIT_FOREVER};
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_pipeline_push(&pipeline, stream, 10));
+	config.frame_slots = 6;
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_pipeline_start(&pipeline, &config));
+	config.frame_slots = 8;
+
+	/* Second pass: the same link with every frame randomized. */
+	for (config.randomized = 0; config.randomized < 2; config.randomized++) {
+		if (config.randomized) {
+			for (size_t offset = 0; offset < stream_length; offset += SDLP_ASM_SIZE + GT_FRAME_LENGTH) {
+				ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_randomize(&stream[offset + SDLP_ASM_SIZE], GT_FRAME_LENGTH));
+			}
+		}
+
+		memset(&sink, 0, sizeof(sink));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_pipeline_start(&pipeline, &config));
+		for (size_t offset = 0; offset < stream_length; offset += 1000) {
+			size_t chunk = stream_length - offset < 1000 ? stream_length - offset : 1000;
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_pipeline_push(&pipeline, &stream[offset], chunk));
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_pipeline_stop(&pipeline));
+		ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_pipeline_stop(&pipeline));
+
+		ASSERT_EQ_INT(GT_STREAM_FRAMES + 1, (int)pipeline.stats.frames);
+		ASSERT_EQ_INT(1, (int)pipeline.stats.crc_errors);
+		ASSERT_EQ_INT(0, (int)pipeline.stats.invalid_frames);
+		ASSERT_EQ_INT(0, (int)pipeline.stats.dropped);
+		for (int i = 0; i < GT_VC_COUNT; i++) {
+			uint8_t vc = gt_vcs[i];
+
+			ASSERT_EQ_INT(0, sink.errors[vc]);
+			ASSERT_EQ_INT(enqueued[i], sink.next_seq[vc]);
+			ASSERT_EQ_INT(enqueued[i], (int)pipeline.vc_stats[vc].packets);
+			ASSERT_EQ_INT(0, (int)pipeline.vc_stats[vc].frame_gaps);
+			ASSERT_EQ_INT((int)vcs[i].frames, (int)pipeline.stats.vc_frames[vc]);
+		}
+	}
+
+	return 0;
+}
+
+/* Two spacecraft share the link with identical VC traffic; the filter keeps
+ * one of them, and the other's frames never reach the check stage. */
+static int test_pipeline_filter_drops_other_spacecraft(void) {
+	static uint8_t rings[2][2][2048];
+	static gt_sink_t sink;
+	static sdlp_pipeline_t pipeline;
+	static sdlp_tm_filter_t filter;
+	static const uint16_t scids[2] = {0x0C3, 0x0C4};
+	sdlp_mux_t mux[2];
+	sdlp_mux_vc_t vcs[2][2];
+	uint16_t enqueued[2][2] = {{0}};
+	uint8_t packet[512];
+	uint8_t frame[GT_FRAME_LENGTH];
+	size_t frame_size = 0;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_filter_init(&filter));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_filter_add(&filter, scids[0], SDLP_FILTER_ALL_VCS));
+
+	sdlp_pipeline_config_t config = {GT_FRAME_LENGTH, 8, 2, 512, 1, 2, 2, 1, gt_on_packet, &sink, &filter,
+																			 SDLP_PIPELINE_WAIT_FOREVER};
+
+	for (int m = 0; m < 2; m++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_init(&mux[m], scids[m], GT_FRAME_LENGTH, SDLP_MUX_WEIGHTED_RR));
+		for (int i = 0; i < 2; i++) {
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_add_vc(&mux[m], &vcs[m][i], gt_vcs[i], rings[m][i], sizeof(rings[m][i]), 0, 1));
+		}
+	}
+
+	memset(&sink, 0, sizeof(sink));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_pipeline_start(&pipeline, &config));
+	for (int f = 0; f < 200; f++) {
+		for (int m = 0; m < 2; m++) {
+			for (int i = 0; f < 150 && i < 2; i++) {
+				size_t length = gt_packet_length(gt_vcs[i], enqueued[m][i]);
+
+				gt_write_packet(packet, gt_vcs[i], enqueued[m][i], length);
+				if (sdlp_mux_enqueue(&vcs[m][i], packet, length) == SDLP_SUCCESS) {
+					enqueued[m][i]++;
+				}
+			}
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_next_frame(&mux[m], frame, sizeof(frame), &frame_size));
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_randomize(frame, sizeof(frame)));
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_pipeline_push_frame(&pipeline, frame, sizeof(frame)));
+		}
+	}
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_pipeline_stop(&pipeline));
+
+	ASSERT_EQ_INT(200, (int)pipeline.stats.frames);
+	ASSERT_EQ_INT(200, (int)pipeline.stats.filtered);
+	ASSERT_EQ_INT(0, (int)pipeline.stats.crc_errors);
+	for (int i = 0; i < 2; i++) {
+		ASSERT_EQ_INT(0, sink.errors[gt_vcs[i]]);
+		ASSERT_EQ_INT(enqueued[0][i], sink.next_seq[gt_vcs[i]]);
+	}
+
+	return 0;
+}
+
+/* VC 1 blocks in on_packet until released; VC 0 counts what it delivers. */
+static atomic_int gt_slow_release;
+static atomic_int gt_slow_delivered;
+
+static void gt_on_packet_slow(void *user, uint8_t vc, const uint8_t *packet, size_t length) {
+	while (vc == 1 && !atomic_load(&gt_slow_release)) {
+		sched_yield();
+	}
+	gt_on_packet(user, vc, packet, length);
+	if (vc == 0) {
+		atomic_fetch_add(&gt_slow_delivered, 1);
+	}
+}
+
+/* A stuck VC uses up its own worker's share of the slots and then has its
+ * frames dropped; VC 0, on another worker, is delivered in full meanwhile. */
+static int test_pipeline_slow_vc_does_not_block_others(void) {
+	static uint8_t rings[2][2048];
+	static gt_sink_t sink;
+	static sdlp_pipeline_t pipeline;
+	static const uint8_t vc_ids[2] = {0, 1};
+	sdlp_mux_t mux;
+	sdlp_mux_vc_t vcs[2];
+	uint16_t enqueued[2] = {0};
+	uint8_t packet[512];
+	uint8_t frame[GT_FRAME_LENGTH];
+	size_t frame_size = 0;
+
+	/* Four workers, so OID frames (VC 7) do not land on VC 1's worker. */
+	sdlp_pipeline_config_t config = {GT_FRAME_LENGTH, 16, 4, 512, 1, 2, 2, 0, gt_on_packet_slow, &sink, NULL,
+																	 50000};
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_init(&mux, 0x0C3, GT_FRAME_LENGTH, SDLP_MUX_WEIGHTED_RR));
+	for (int i = 0; i < 2; i++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_add_vc(&mux, &vcs[i], vc_ids[i], rings[i], sizeof(rings[i]), 0, 1));
+	}
+
+	memset(&sink, 0, sizeof(sink));
+	atomic_store(&gt_slow_release, 0);
+	atomic_store(&gt_slow_delivered, 0);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_pipeline_start(&pipeline, &config));
+	for (int f = 0; f < 300; f++) {
+		for (int i = 0; i < 2; i++) {
+			if (f >= (i == 0 ? 236 : 12)) {
+				continue;
+			}
+			size_t length = gt_packet_length(vc_ids[i], enqueued[i]);
+
+			gt_write_packet(packet, vc_ids[i], enqueued[i], length);
+			if (sdlp_mux_enqueue(&vcs[i], packet, length) == SDLP_SUCCESS) {
+				enqueued[i]++;
+			}
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_next_frame(&mux, frame, sizeof(frame), &frame_size));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_pipeline_push_frame(&pipeline, frame, sizeof(frame)));
+	}
+
+	/* Every VC 0 packet comes out while VC 1 is still stuck. */
+	for (int spins = 0; atomic_load(&gt_slow_delivered) < enqueued[0] && spins < 10000000; spins++) {
+		sched_yield();
+	}
+	ASSERT_EQ_INT(enqueued[0], atomic_load(&gt_slow_delivered));
+	atomic_store(&gt_slow_release, 1);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_pipeline_stop(&pipeline));
+
+	ASSERT_EQ_INT(0, sink.errors[0]);
+	ASSERT_EQ_INT(enqueued[0], sink.next_seq[0]);
+	ASSERT_EQ_INT(0, (int)pipeline.stats.vc_dropped[0]);
+	ASSERT_TRUE(pipeline.stats.vc_dropped[1] > 0);
+	ASSERT_EQ_INT((int)pipeline.stats.dropped, (int)pipeline.stats.vc_dropped[1]);
+	ASSERT_EQ_INT(300, (int)(pipeline.stats.frames + pipeline.stats.dropped));
+
+	return 0;
+}
+
+static int test_crc16_parallel_matches_sequential(void) {
+	static uint8_t data[3 * SDLP_CRC16_PARALLEL_MIN_CHUNK + 12345];
+	static const unsigned thread_counts[] = {1, 2, 3, 8, 1000};
+	uint32_t seed = 99;
+	uint16_t crc = 0;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		seed = seed * 1103515245u + 12345u;
+		data[i] = (uint8_t)(seed >> 16);
+	}
+
+	for (size_t t = 0; t < sizeof(thread_counts) / sizeof(thread_counts[0]); t++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_crc16_parallel(data, sizeof(data), thread_counts[t], &crc));
+		ASSERT_EQ_INT(sdlp_crc16(data, sizeof(data)), crc);
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_crc16_parallel(&data[1], 1000, thread_counts[t], &crc));
+		ASSERT_EQ_INT(sdlp_crc16(&data[1], 1000), crc);
+	}
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_crc16_parallel(NULL, 0, 4, &crc));
+	ASSERT_EQ_INT(sdlp_crc16_init(), crc);
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_crc16_parallel(data, sizeof(data), 0, &crc));
+
+	return 0;
+}
+
+#define GT_POOL_THREADS 4
+#define GT_POOL_BUFFERS 6
+#define GT_POOL_ROUNDS 200000
+
+SDLP_FRAME_POOL_STORAGE(gt_pool, GT_POOL_BUFFERS, GT_FRAME_LENGTH);
+
+typedef struct {
+	sdlp_frame_pool_t *pool;
+	uint8_t id;
+	int errors;
+} gt_pool_worker_t;
+
+/* Each thread stamps the buffers it holds; a buffer handed to two threads at
+ * once shows up as a stamp changing under its holder. */
+static void *gt_pool_worker(void *arg) {
+	gt_pool_worker_t *worker = (gt_pool_worker_t *)arg;
+	uint8_t *held[2];
+
+	for (int round = 0; round < GT_POOL_ROUNDS; round++) {
+		size_t count = 0;
+
+		while (count < 2 && sdlp_frame_pool_acquire(worker->pool, &held[count]) == SDLP_SUCCESS) {
+			memset(held[count], worker->id, GT_FRAME_LENGTH);
+			count++;
+		}
+		for (size_t i = 0; i < count; i++) {
+			if (held[i][0] != worker->id || held[i][GT_FRAME_LENGTH - 1] != worker->id) {
+				worker->errors++;
+			}
+			if (sdlp_frame_pool_release(worker->pool, held[i]) != SDLP_SUCCESS) {
+				worker->errors++;
+			}
+		}
+	}
+	return NULL;
+}
+
+static int test_frame_pool_concurrent(void) {
+	sdlp_frame_pool_t pool;
+	gt_pool_worker_t workers[GT_POOL_THREADS];
+	pthread_t threads[GT_POOL_THREADS];
+	uint8_t *buffers[GT_POOL_BUFFERS];
+	uint8_t *extra;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_frame_pool_init(&pool, gt_pool_buffers, gt_pool_links,
+													 GT_POOL_BUFFERS, GT_FRAME_LENGTH));
+	for (int t = 0; t < GT_POOL_THREADS; t++) {
+		workers[t] = (gt_pool_worker_t){&pool, (uint8_t)(t + 1), 0};
+		ASSERT_EQ_INT(0, pthread_create(&threads[t], NULL, gt_pool_worker, &workers[t]));
+	}
+	for (int t = 0; t < GT_POOL_THREADS; t++) {
+		pthread_join(threads[t], NULL);
+		ASSERT_EQ_INT(0, workers[t].errors);
+	}
+
+	/* Nothing lost or duplicated: exactly GT_POOL_BUFFERS distinct buffers remain. */
+	for (size_t i = 0; i < GT_POOL_BUFFERS; i++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_frame_pool_acquire(&pool, &buffers[i]));
+		for (size_t j = 0; j < i; j++) {
+			ASSERT_TRUE(buffers[i] != buffers[j]);
+		}
+	}
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_frame_pool_acquire(&pool, &extra));
+
+	return 0;
+}
+
+#if defined(__linux__)
+#define GT_UDP_FRAMES 40
+#define GT_UDP_SLOTS 16
+
+/* Bound receive socket and a send socket connected to it, on 127.0.0.1. */
+static int gt_udp_pair(int *rx_fd, int *tx_fd) {
+	struct sockaddr_in address;
+	socklen_t address_length = sizeof(address);
+
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	*rx_fd = socket(AF_INET, SOCK_DGRAM, 0);
+	*tx_fd = socket(AF_INET, SOCK_DGRAM, 0);
+	if (*rx_fd < 0 || *tx_fd < 0 ||
+		bind(*rx_fd, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+		getsockname(*rx_fd, (struct sockaddr *)&address, &address_length) != 0 ||
+		connect(*tx_fd, (struct sockaddr *)&address, sizeof(address)) != 0) {
+		return -1;
+	}
+	return 0;
+}
+
+/* Frames of varying length, one corrupted and one longer than a slot, go out
+ * in one batched send and come back through a ring smaller than the burst:
+ * every frame must decode in place, in order, across the ring wrap. */
+static int test_udp_loopback_batch(void) {
+	static uint8_t encoded[GT_UDP_FRAMES][GT_FRAME_LENGTH + 16];
+	static sdlp_tm_frame_t frame;
+	sdlp_frame_desc_t out[GT_UDP_FRAMES];
+	sdlp_tm_frame_view_t views[GT_UDP_SLOTS];
+	int results[GT_UDP_SLOTS];
+	uint8_t payload[GT_FRAME_LENGTH + 2]; /* frame 30 is two bytes longer than a slot */
+	sdlp_udp_rx_t rx;
+	const sdlp_frame_desc_t *frames;
+	size_t count = 0;
+	size_t sent = 0;
+	int rx_fd, tx_fd;
+
+	ASSERT_EQ_INT(0, gt_udp_pair(&rx_fd, &tx_fd));
+
+	for (int i = 0; i < GT_UDP_FRAMES; i++) {
+		uint16_t length = (uint16_t)(i == 30 ? GT_FRAME_LENGTH + 2 : 100 + i * 3);
+
+		for (size_t j = 0; j < length; j++) {
+			payload[j] = (uint8_t)(i * 5 + (int)j);
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_create_frame(&frame, 0x0C3, (uint8_t)(i % 8), payload, length));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_encode_frame(&frame, encoded[i], sizeof(encoded[i]), &out[i].length));
+		out[i].buffer = encoded[i];
+	}
+	encoded[17][50] ^= 0x04;
+
+	sdlp_udp_config_t config = {GT_UDP_SLOTS, GT_FRAME_LENGTH + TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE, 6};
+
+	config.slots = 12;
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_udp_rx_init(&rx, rx_fd, &config));
+	config.slots = GT_UDP_SLOTS;
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_udp_rx_init(&rx, rx_fd, &config));
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_udp_rx_recv(&rx, 0, &frames, &count));
+	ASSERT_EQ_INT(0, (int)count);
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_udp_send(tx_fd, out, GT_UDP_FRAMES, &sent));
+	ASSERT_EQ_INT(GT_UDP_FRAMES, (int)sent);
+
+	/* Fill the ring without releasing: it refuses more until frames go back. */
+	size_t held = 0;
+
+	while (held < GT_UDP_SLOTS) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_udp_rx_recv(&rx, 1, &frames, &count));
+		ASSERT_TRUE(count > 0 && count <= 6);
+		ASSERT_TRUE(frames[0].buffer == &rx.buffers[held * config.slot_size]);
+		held += count;
+	}
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_udp_rx_recv(&rx, 1, &frames, &count));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_udp_rx_release(&rx, GT_UDP_SLOTS + 1));
+
+	/* Check the held frames, then keep receiving, releasing each batch. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_batch(rx.frames, GT_UDP_SLOTS, views, results));
+	for (int i = 0; i < GT_UDP_SLOTS; i++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, results[i]);
+		ASSERT_TRUE(views[i].frame == rx.frames[i].buffer);
+		ASSERT_EQ_INT((int)out[i].length, (int)views[i].frame_length);
+		ASSERT_EQ_MEM(encoded[i], views[i].frame, out[i].length);
+	}
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_udp_rx_release(&rx, GT_UDP_SLOTS));
+
+	for (int next = GT_UDP_SLOTS; next < GT_UDP_FRAMES; next += (int)count) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_udp_rx_recv(&rx, 1, &frames, &count));
+		ASSERT_TRUE(count > 0 && next + (int)count <= GT_UDP_FRAMES);
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_batch(frames, count, views, results));
+
+		for (size_t i = 0; i < count; i++) {
+			int n = next + (int)i;
+
+			if (n == 30) {
+				ASSERT_EQ_INT(0, (int)frames[i].length);
+				ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, results[i]);
+			} else if (n == 17) {
+				ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, results[i]);
+			} else {
+				ASSERT_EQ_INT(SDLP_SUCCESS, results[i]);
+				ASSERT_EQ_INT(n % 8, views[i].header.virtual_channel_id);
+				ASSERT_EQ_MEM(encoded[n], views[i].frame, out[n].length);
+			}
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_udp_rx_release(&rx, count));
+	}
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_udp_rx_recv(&rx, 0, &frames, &count));
+	ASSERT_EQ_INT(0, (int)count);
+	ASSERT_EQ_INT(GT_UDP_FRAMES, (int)rx.stats.datagrams);
+	ASSERT_EQ_INT(1, (int)rx.stats.truncated);
+
+	sdlp_udp_rx_free(&rx);
+	close(rx_fd);
+	close(tx_fd);
+
+	return 0;
+}
+#endif
+
+int main(void) {
+	RUN_TEST(test_spsc_ring_wraparound);
+	RUN_TEST(test_pipeline_end_to_end);
+	RUN_TEST(test_pipeline_filter_drops_other_spacecraft);
+	RUN_TEST(test_pipeline_slow_vc_does_not_block_others);
+	RUN_TEST(test_crc16_parallel_matches_sequential);
+	RUN_TEST(test_frame_pool_concurrent);
+#if defined(__linux__)
+	RUN_TEST(test_udp_loopback_batch);
+#endif
+
+	if (cunit_overall_failures) {
+		printf("\nTotal failures: %d\n", cunit_overall_failures);
+		return 1;
+	}
+
+	printf("\nAll tests passed.\n");
+	return 0;
+}
@@ -4,6 +4,17 @@
 #include <stdint.h>
 
 #include "sdlp_common.h"
+#include "sdlp_cop1.h"
+#include "sdlp_mux.h"
+#include "sdlp_packet.h"
+#include "sdlp_filter.h"
+#include "sdlp_fixed.h"
+#include "sdlp_frame_pool.h"
+#include "sdlp_randomizer.h"
+#include "sdlp_rs.h"
+#include "sdlp_segment.h"
+#include "sdlp_stats.h"
+#include "sdlp_sync.h"
 #include "sdlp_tc.h"
 #include "sdlp_tm.h"
 
@@ -13,6 +24,146 @@ static int test_crc16_known_vector(void) {
 	return 0;
 }
 
+static uint16_t reference_crc16(const uint8_t *data, size_t length) {
+	uint16_t crc = 0xFFFF;
+
+	for (size_t i = 0; i < length; i++) {
+		crc ^= (uint16_t)(data[i] << 8);
+		for (int j = 0; j < 8; j++) {
+			crc = (uint16_t)((crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1));
+		}
+	}
+
+	return crc;
+}
+
+static int test_crc16_matches_reference(void) {
+	uint8_t data[300];
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 37u + 11u);
+	}
+
+	for (size_t length = 0; length <= sizeof(data); length++) {
+		ASSERT_EQ_INT(reference_crc16(data, length), sdlp_crc16(data, length));
+	}
+
+	return 0;
+}
+
+static int test_crc16_streaming_matches_one_shot(void) {
+	const uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+	for (size_t split = 0; split <= sizeof(data); split++) {
+		uint16_t crc = sdlp_crc16_init();
+		crc = sdlp_crc16_update(crc, data, split);
+		crc = sdlp_crc16_update(crc, &data[split], sizeof(data) - split);
+		ASSERT_EQ_INT(0x29B1, sdlp_crc16_final(crc));
+	}
+
+	return 0;
+}
+
+static int test_crc16_random_lengths_and_alignments(void) {
+	static uint8_t data[4096 + 16];
+	uint32_t seed = 0x12345678u;
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		seed = seed * 1103515245u + 12345u;
+		data[i] = (uint8_t)(seed >> 16);
+	}
+
+	for (int iter = 0; iter < 500; iter++) {
+		seed = seed * 1103515245u + 12345u;
+		size_t offset = (seed >> 8) % 16u;
+		seed = seed * 1103515245u + 12345u;
+		size_t length = (seed >> 8) % 4097u;
+		seed = seed * 1103515245u + 12345u;
+		size_t split = length ? (seed >> 8) % length : 0;
+
+		uint16_t expected = reference_crc16(&data[offset], length);
+		ASSERT_EQ_INT(expected, sdlp_crc16(&data[offset], length));
+
+		uint16_t crc = sdlp_crc16_update(sdlp_crc16_init(), &data[offset], split);
+		crc = sdlp_crc16_update(crc, &data[offset + split], length - split);
+		ASSERT_EQ_INT(expected, sdlp_crc16_final(crc));
+	}
+
+	return 0;
+}
+
+static int test_crc16_combine_matches_sequential(void) {
+	const uint8_t digits[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+	static uint8_t data[100000];
+	uint32_t seed = 0xC0FFEEu;
+
+	for (size_t split = 0; split <= sizeof(digits); split++) {
+		uint16_t a = sdlp_crc16(digits, split);
+		uint16_t b = sdlp_crc16(&digits[split], sizeof(digits) - split);
+
+		ASSERT_EQ_INT(0x29B1, sdlp_crc16_combine(a, b, sizeof(digits) - split));
+	}
+
+	for (size_t i = 0; i < sizeof(data); i++) {
+		seed = seed * 1103515245u + 12345u;
+		data[i] = (uint8_t)(seed >> 16);
+	}
+	uint16_t expected = sdlp_crc16(data, sizeof(data));
+
+	/* Splits on both sides of the 32767-byte period of the shift. */
+	for (int iter = 0; iter < 50; iter++) {
+		seed = seed * 1103515245u + 12345u;
+		size_t split = (seed >> 4) % sizeof(data);
+		uint16_t a = sdlp_crc16(data, split);
+		uint16_t b = sdlp_crc16(&data[split], sizeof(data) - split);
+
+		ASSERT_EQ_INT(expected, sdlp_crc16_combine(a, b, sizeof(data) - split));
+	}
+
+	/* Three pieces, merged left to right. */
+	uint16_t crc = sdlp_crc16(data, 40000);
+	crc = sdlp_crc16_combine(crc, sdlp_crc16(&data[40000], 32767), 32767);
+	crc = sdlp_crc16_combine(crc, sdlp_crc16(&data[72767], sizeof(data) - 72767), sizeof(data) - 72767);
+	ASSERT_EQ_INT(expected, crc);
+
+	return 0;
+}
+
+static int test_crc16_copy_matches_update(void) {
+	static uint8_t src[4096 + 16];
+	static uint8_t dst[4096 + 32];
+	uint32_t seed = 0x5EEDu;
+
+	for (size_t i = 0; i < sizeof(src); i++) {
+		seed = seed * 1103515245u + 12345u;
+		src[i] = (uint8_t)(seed >> 16);
+	}
+
+	for (int iter = 0; iter < 300; iter++) {
+		seed = seed * 1103515245u + 12345u;
+		size_t src_offset = (seed >> 8) % 16u;
+		size_t dst_offset = (seed >> 12) % 16u;
+		seed = seed * 1103515245u + 12345u;
+		size_t length = (seed >> 8) % 4097u;
+		seed = seed * 1103515245u + 12345u;
+		size_t split = length ? (seed >> 8) % length : 0;
+
+		memset(dst, 0xA5, sizeof(dst));
+
+		uint16_t crc = sdlp_crc16_copy(sdlp_crc16_init(), &dst[dst_offset], &src[src_offset], split);
+		crc = sdlp_crc16_copy(crc, &dst[dst_offset + split], &src[src_offset + split], length - split);
+
+		ASSERT_EQ_INT(reference_crc16(&src[src_offset], length), sdlp_crc16_final(crc));
+		ASSERT_EQ_MEM(&src[src_offset], &dst[dst_offset], length);
+		ASSERT_EQ_INT(0xA5, dst[dst_offset + length]);
+		if (dst_offset) {
+			ASSERT_EQ_INT(0xA5, dst[dst_offset - 1]);
+		}
+	}
+
+	return 0;
+}
+
 static int test_tm_create_frame_invalid_params(void) {
 	sdlp_tm_frame_t frame;
 	uint8_t payload[1] = {0xAA};
@@ -88,6 +239,1111 @@ static int test_tm_decode_crc_mismatch(void) {
 	return 0;
 }
 
+static int test_tm_decode_view_zero_copy(void) {
+	sdlp_tm_frame_t frame;
+	sdlp_tm_frame_view_t view;
+	const uint8_t payload[] = {0xCA, 0xFE, 0xBA, 0xBE, 0x01};
+	uint8_t encoded[TM_PRIMARY_HEADER_SIZE + TM_MAX_DATA_SIZE + TM_FRAME_ERROR_CONTROL_SIZE];
+	size_t encoded_size = 0;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tm_create_frame(&frame, 0x155, 5, payload, (uint16_t)sizeof(payload)));
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tm_encode_frame(&frame, encoded, sizeof(encoded), &encoded_size));
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_view(encoded, encoded_size, &view, 1));
+	ASSERT_TRUE(view.data == &encoded[TM_PRIMARY_HEADER_SIZE]);
+	ASSERT_EQ_INT((int)sizeof(payload), view.data_length);
+	ASSERT_EQ_INT(0x155, view.header.spacecraft_id);
+	ASSERT_EQ_INT(5, view.header.virtual_channel_id);
+
+	encoded[TM_PRIMARY_HEADER_SIZE + 1] ^= 0x10;
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_view(encoded, encoded_size, &view, 0));
+	ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, sdlp_tm_view_verify_crc(&view));
+	ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, sdlp_tm_decode_view(encoded, encoded_size, &view, 1));
+
+	return 0;
+}
+
+static int test_tm_builder_matches_encode(void) {
+	sdlp_tm_frame_t frame;
+	sdlp_tm_builder_t builder;
+	const uint8_t payload[] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77};
+	uint8_t expected[TM_PRIMARY_HEADER_SIZE + sizeof(payload) + TM_FRAME_ERROR_CONTROL_SIZE];
+	uint8_t built[TM_PRIMARY_HEADER_SIZE + 64 + TM_FRAME_ERROR_CONTROL_SIZE];
+	size_t expected_size = 0;
+	size_t built_size = 0;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tm_create_frame(&frame, 0x1C3, 6, payload, (uint16_t)sizeof(payload)));
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tm_encode_frame(&frame, expected, sizeof(expected), &expected_size));
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_builder_begin(&builder, built, sizeof(built), 0x1C3, 6));
+	ASSERT_TRUE(builder.data == &built[TM_PRIMARY_HEADER_SIZE]);
+	ASSERT_EQ_INT(64, builder.data_capacity);
+	builder.header.master_channel_frame_count = frame.header.master_channel_frame_count;
+	builder.header.virtual_channel_frame_count = frame.header.virtual_channel_frame_count;
+	memcpy(builder.data, payload, sizeof(payload));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_builder_commit(&builder, 65, &built_size));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_builder_commit(&builder, (uint16_t)sizeof(payload), &built_size));
+
+	ASSERT_EQ_INT((int)expected_size, (int)built_size);
+	ASSERT_EQ_MEM(expected, built, expected_size);
+
+	return 0;
+}
+
+static int test_tm_encode_iov_matches_encode(void) {
+	sdlp_tm_master_channel_t master_a, master_b;
+	sdlp_tm_virtual_channel_t vc_a, vc_b;
+	sdlp_tm_frame_t frame;
+	uint8_t payload[300];
+	uint8_t expected[TM_PRIMARY_HEADER_SIZE + sizeof(payload) + TM_FRAME_ERROR_CONTROL_SIZE];
+	uint8_t gathered[sizeof(expected)];
+	size_t expected_size = 0;
+	size_t gathered_size = 0;
+
+	for (size_t i = 0; i < sizeof(payload); i++) {
+		payload[i] = (uint8_t)(i * 7 + 3);
+	}
+	/* Packet header, empty piece, body, trailer. */
+	const sdlp_iovec_t iov[] = {{payload, 6}, {NULL, 0}, {&payload[6], 290}, {&payload[296], 4}};
+	const sdlp_iovec_t bad[] = {{payload, 6}, {NULL, 1}};
+	const sdlp_iovec_t too_long[] = {{payload, TM_MAX_DATA_SIZE}, {payload, 1}};
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_master_channel_init(&master_a, 0x0D2));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_master_channel_init(&master_b, 0x0D2));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_virtual_channel_init(&vc_a, &master_a, 5));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_virtual_channel_init(&vc_b, &master_b, 5));
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_vc_encode_iov(&vc_b, bad, 2, gathered, sizeof(gathered), &gathered_size));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_vc_encode_iov(&vc_b, too_long, 2, gathered, sizeof(gathered), &gathered_size));
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_tm_vc_encode_iov(&vc_b, iov, 4, gathered, sizeof(gathered) - 1, &gathered_size));
+
+	/* The rejected calls took no frame counts. */
+	for (int i = 0; i < 3; i++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_vc_create_frame(&vc_a, &frame, payload, (uint16_t)sizeof(payload)));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_encode_frame(&frame, expected, sizeof(expected), &expected_size));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_vc_encode_iov(&vc_b, iov, 4, gathered, sizeof(gathered), &gathered_size));
+		ASSERT_EQ_INT((int)expected_size, (int)gathered_size);
+		ASSERT_EQ_MEM(expected, gathered, expected_size);
+	}
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_encode_iov(0x0D2, 5, NULL, 0, gathered, sizeof(gathered), &gathered_size));
+	ASSERT_EQ_INT(TM_PRIMARY_HEADER_SIZE + TM_FRAME_ERROR_CONTROL_SIZE, (int)gathered_size);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_frame(gathered, gathered_size, &frame));
+
+	return 0;
+}
+
+SDLP_TM_FIXED_DEFINE(fixed_min, 1)
+SDLP_TM_FIXED_DEFINE(fixed_hk, 300)
+SDLP_TM_FIXED_DEFINE(fixed_max, TM_MAX_DATA_SIZE)
+
+typedef size_t (*fixed_encode_fn)(const sdlp_tm_header_t *, const uint8_t *, uint8_t *);
+typedef int (*fixed_decode_fn)(const uint8_t *, sdlp_tm_frame_view_t *);
+
+static int check_tm_fixed(uint16_t length, fixed_encode_fn encode, fixed_decode_fn decode) {
+	static sdlp_tm_frame_t frame;
+	static uint8_t payload[TM_MAX_DATA_SIZE];
+	static uint8_t expected[SDLP_TM_FIXED_FRAME_LENGTH(TM_MAX_DATA_SIZE)];
+	static uint8_t fixed[sizeof(expected)];
+	sdlp_tm_frame_view_t generic_view, fixed_view;
+	size_t expected_size = 0;
+
+	for (size_t i = 0; i < length; i++) {
+		payload[i] = (uint8_t)(i * 13 + length);
+	}
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_create_frame(&frame, 0x2C5, 6, payload, length));
+	frame.header.ocf_flag = 1;
+	frame.header.transfer_frame_data_field_status = 0x1800;
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_encode_frame(&frame, expected, sizeof(expected), &expected_size));
+	ASSERT_EQ_INT((int)expected_size, (int)encode(&frame.header, payload, fixed));
+	ASSERT_EQ_MEM(expected, fixed, expected_size);
+
+	memset(&generic_view, 0, sizeof(generic_view));
+	memset(&fixed_view, 0, sizeof(fixed_view));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_view(expected, expected_size, &generic_view, 1));
+	ASSERT_EQ_INT(SDLP_SUCCESS, decode(fixed, &fixed_view));
+	ASSERT_EQ_MEM(&generic_view.header, &fixed_view.header, sizeof(sdlp_tm_header_t));
+	ASSERT_TRUE(fixed_view.frame == fixed && fixed_view.data == &fixed[TM_PRIMARY_HEADER_SIZE]);
+	ASSERT_EQ_INT((int)generic_view.frame_length, (int)fixed_view.frame_length);
+	ASSERT_EQ_INT(generic_view.data_length, fixed_view.data_length);
+	ASSERT_EQ_INT(generic_view.fecf, fixed_view.fecf);
+
+	fixed[TM_PRIMARY_HEADER_SIZE + length - 1] ^= 0x40;
+	ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, decode(fixed, &fixed_view));
+
+	return 0;
+}
+
+static int test_tm_fixed_matches_encode(void) {
+	ASSERT_EQ_INT(0, check_tm_fixed(1, fixed_min_encode, fixed_min_decode));
+	ASSERT_EQ_INT(0, check_tm_fixed(300, fixed_hk_encode, fixed_hk_decode));
+	ASSERT_EQ_INT(0, check_tm_fixed(TM_MAX_DATA_SIZE, fixed_max_encode, fixed_max_decode));
+
+	return 0;
+}
+
+static int test_tm_decode_batch(void) {
+	static uint8_t buffers[11][TM_PRIMARY_HEADER_SIZE + 300 + TM_FRAME_ERROR_CONTROL_SIZE];
+	sdlp_frame_desc_t frames[11];
+	sdlp_tm_frame_view_t views[11];
+	int results[11];
+
+	for (int i = 0; i < 11; i++) {
+		sdlp_tm_builder_t builder;
+		uint16_t length = (uint16_t)(1 + i * 29);
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_builder_begin(&builder, buffers[i], sizeof(buffers[i]), 0x2B, (uint8_t)(i & 7)));
+		for (uint16_t j = 0; j < length; j++) {
+			builder.data[j] = (uint8_t)(i * 31 + j);
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_builder_commit(&builder, length, &frames[i].length));
+		frames[i].buffer = buffers[i];
+	}
+	buffers[5][TM_PRIMARY_HEADER_SIZE + 3] ^= 0x40;
+	frames[8].length = TM_PRIMARY_HEADER_SIZE + 1;
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_decode_batch(frames, 11, views, NULL));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_batch(frames, 11, views, results));
+
+	for (int i = 0; i < 11; i++) {
+		sdlp_tm_frame_view_t view;
+		int expected = sdlp_tm_decode_view(frames[i].buffer, frames[i].length, &view, 1);
+
+		ASSERT_EQ_INT(expected, results[i]);
+		if (i == 5) {
+			ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, results[i]);
+		} else if (i == 8) {
+			ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, results[i]);
+		} else {
+			ASSERT_EQ_INT(SDLP_SUCCESS, results[i]);
+			ASSERT_TRUE(views[i].data == view.data);
+			ASSERT_EQ_INT(1 + i * 29, views[i].data_length);
+			ASSERT_EQ_INT(i & 7, views[i].header.virtual_channel_id);
+		}
+	}
+
+	return 0;
+}
+
+static int test_tm_channel_context_counters(void) {
+	sdlp_tm_master_channel_t master;
+	sdlp_tm_virtual_channel_t vc1;
+	sdlp_tm_virtual_channel_t vc4;
+	sdlp_tm_frame_t frame;
+	sdlp_tm_builder_t builder;
+	uint8_t buffer[TM_PRIMARY_HEADER_SIZE + 8 + TM_FRAME_ERROR_CONTROL_SIZE];
+	const uint8_t payload[] = {0x42};
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_master_channel_init(&master, 0x2B7));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_virtual_channel_init(&vc1, &master, 1));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_virtual_channel_init(&vc4, &master, 4));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM,
+								sdlp_tm_virtual_channel_init(&vc4, &master, TM_MAX_VIRTUAL_CHANNELS));
+
+	for (int i = 0; i < 300; i++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_vc_create_frame(&vc1, &frame, payload, 1));
+		ASSERT_EQ_INT((2 * i) & 0xFF, frame.header.master_channel_frame_count);
+		ASSERT_EQ_INT(i & 0xFF, frame.header.virtual_channel_frame_count);
+		ASSERT_EQ_INT(0x2B7, frame.header.spacecraft_id);
+		ASSERT_EQ_INT(1, frame.header.virtual_channel_id);
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_vc_builder_begin(&vc4, &builder, buffer, sizeof(buffer)));
+		ASSERT_EQ_INT((2 * i + 1) & 0xFF, builder.header.master_channel_frame_count);
+		ASSERT_EQ_INT(i & 0xFF, builder.header.virtual_channel_frame_count);
+		ASSERT_EQ_INT(4, builder.header.virtual_channel_id);
+	}
+
+	return 0;
+}
+
+static int test_tm_template_patch_matches_encode(void) {
+	static const uint16_t lengths[] = {0, 1, 64, TM_MAX_DATA_SIZE};
+	static uint8_t buffer[TM_PRIMARY_HEADER_SIZE + TM_MAX_DATA_SIZE + TM_FRAME_ERROR_CONTROL_SIZE];
+	static uint8_t expected[sizeof(buffer)];
+	static sdlp_tm_frame_t frame;
+	sdlp_tm_master_channel_t master;
+	sdlp_tm_virtual_channel_t vc;
+	sdlp_tm_template_t tmpl;
+	size_t encoded_size = 0;
+	uint8_t patch[40];
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_master_channel_init(&master, 0x155));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_virtual_channel_init(&vc, &master, 2));
+
+	for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+		for (size_t i = 0; i < TM_MAX_DATA_SIZE; i++) {
+			frame.data[i] = (uint8_t)(i * 7u + l);
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_vc_create_frame(&vc, &frame, frame.data, lengths[l]));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_template_init(&tmpl, &frame, buffer, sizeof(buffer)));
+		ASSERT_EQ_INT(TM_PRIMARY_HEADER_SIZE + lengths[l] + TM_FRAME_ERROR_CONTROL_SIZE, tmpl.frame_length);
+
+		for (int n = 0; n < 300; n++) {
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_vc_template_next(&vc, &tmpl));
+			frame.header.master_channel_frame_count = tmpl.buffer[2];
+			frame.header.virtual_channel_frame_count = tmpl.buffer[3];
+
+			/* Rewrite a changing slice of the data field every few frames. */
+			if (lengths[l] > 0 && n % 3 == 0) {
+				size_t offset = (size_t)n * 13u % lengths[l];
+				size_t length = lengths[l] - offset < sizeof(patch) ? lengths[l] - offset : sizeof(patch);
+
+				for (size_t i = 0; i < length; i++) {
+					patch[i] = (uint8_t)(n + (int)i);
+				}
+				ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_template_patch(&tmpl, TM_PRIMARY_HEADER_SIZE + offset, patch, length));
+				memcpy(&frame.data[offset], patch, length);
+			}
+
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_encode_frame(&frame, expected, sizeof(expected), &encoded_size));
+			ASSERT_EQ_INT(encoded_size, tmpl.frame_length);
+			ASSERT_EQ_MEM(expected, tmpl.buffer, encoded_size);
+		}
+	}
+
+	/* Header bytes outside the counts, and an empty patch at the FECF boundary. */
+	patch[0] = 0x12;
+	patch[1] = 0x34;
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_template_patch(&tmpl, 4, patch, 2));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_template_patch(&tmpl, tmpl.frame_length - TM_FRAME_ERROR_CONTROL_SIZE, patch, 0));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_frame(tmpl.buffer, tmpl.frame_length, &frame));
+	ASSERT_EQ_INT(0x1234, frame.header.transfer_frame_data_field_status);
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_template_patch(&tmpl, tmpl.frame_length - TM_FRAME_ERROR_CONTROL_SIZE, patch, 1));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_template_patch(&tmpl, 0, NULL, 1));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_vc_template_next(&vc, NULL));
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_tm_template_init(&tmpl, &frame, buffer, 7));
+
+	return 0;
+}
+
+static int test_peek_header_and_filter(void) {
+	static sdlp_tm_frame_t tm;
+	static sdlp_tc_frame_t tc;
+	static sdlp_tm_filter_t tm_filter;
+	static sdlp_tc_filter_t tc_filter;
+	uint8_t buffer[TC_PRIMARY_HEADER_SIZE + TC_SEGMENT_HEADER_SIZE + 16 + TC_FRAME_ERROR_CONTROL_SIZE];
+	const uint8_t payload[4] = {1, 2, 3, 4};
+	sdlp_tm_header_t tm_header;
+	sdlp_tc_header_t tc_header;
+	size_t size = 0;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_filter_init(&tm_filter));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_filter_add(&tm_filter, 0x3FF, 6));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_filter_add(&tm_filter, 0x001, SDLP_FILTER_ALL_VCS));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_filter_remove(&tm_filter, 0x001, 3));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_filter_add(&tm_filter, 0x400, 0));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_filter_add(&tm_filter, 0x001, 8));
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_filter_init(&tc_filter));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_filter_add(&tc_filter, 0x2AA, 63));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_filter_add(&tc_filter, 0x155, SDLP_FILTER_ALL_VCS));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_filter_remove(&tc_filter, 0x155, 40));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tc_filter_add(&tc_filter, 0x001, 64));
+
+	static const uint16_t scids[] = {0x000, 0x001, 0x155, 0x2AA, 0x3FF};
+
+	for (size_t s = 0; s < sizeof(scids) / sizeof(scids[0]); s++) {
+		for (uint8_t vc = 0; vc < 64; vc++) {
+			if (vc < TM_MAX_VIRTUAL_CHANNELS) {
+				ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_create_frame(&tm, scids[s], vc, payload, sizeof(payload)));
+				tm.header.ocf_flag = vc & 1u;
+				ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_encode_frame(&tm, buffer, sizeof(buffer), &size));
+				ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_peek_header(buffer, TM_PRIMARY_HEADER_SIZE, &tm_header));
+				ASSERT_EQ_INT(tm.header.spacecraft_id, tm_header.spacecraft_id);
+				ASSERT_EQ_INT(tm.header.virtual_channel_id, tm_header.virtual_channel_id);
+				ASSERT_EQ_INT(tm.header.ocf_flag, tm_header.ocf_flag);
+				ASSERT_EQ_INT(tm.header.master_channel_frame_count, tm_header.master_channel_frame_count);
+				ASSERT_EQ_INT(tm.header.virtual_channel_frame_count, tm_header.virtual_channel_frame_count);
+				ASSERT_EQ_INT((scids[s] == 0x3FF && vc == 6) || (scids[s] == 0x001 && vc != 3),
+											sdlp_tm_filter_accept(&tm_filter, buffer));
+			}
+
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_create_frame(&tc, scids[s], vc, 0, payload, sizeof(payload)));
+			tc.header.bypass_flag = vc & 1u;
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_encode_frame(&tc, buffer, sizeof(buffer), &size));
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_peek_header(buffer, TC_PRIMARY_HEADER_SIZE, &tc_header));
+			ASSERT_EQ_INT(tc.header.spacecraft_id, tc_header.spacecraft_id);
+			ASSERT_EQ_INT(tc.header.virtual_channel_id, tc_header.virtual_channel_id);
+			ASSERT_EQ_INT(tc.header.bypass_flag, tc_header.bypass_flag);
+			ASSERT_EQ_INT(tc.header.frame_length, tc_header.frame_length);
+			ASSERT_EQ_INT(tc.header.frame_sequence_number, tc_header.frame_sequence_number);
+			ASSERT_EQ_INT((scids[s] == 0x2AA && vc == 63) || (scids[s] == 0x155 && vc != 40),
+										sdlp_tc_filter_accept(&tc_filter, buffer));
+		}
+	}
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_peek_header(buffer, TM_PRIMARY_HEADER_SIZE - 1, &tm_header));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tc_peek_header(NULL, TC_PRIMARY_HEADER_SIZE, &tc_header));
+
+	return 0;
+}
+
+static int test_stats_counts_link_events(void) {
+	sdlp_tm_master_channel_t master;
+	sdlp_tm_virtual_channel_t vc;
+	sdlp_tm_frame_t frame;
+	sdlp_tc_frame_t tc_frame;
+	sdlp_stats_t before;
+	sdlp_stats_t after;
+	uint8_t frames[3][TM_PRIMARY_HEADER_SIZE + 16 + TM_FRAME_ERROR_CONTROL_SIZE];
+	uint8_t tc_buffer[TC_PRIMARY_HEADER_SIZE + TC_SEGMENT_HEADER_SIZE + 16 + TC_FRAME_ERROR_CONTROL_SIZE];
+	static uint8_t oversized[TM_PRIMARY_HEADER_SIZE + UINT16_MAX + 1 + TM_FRAME_ERROR_CONTROL_SIZE];
+	uint8_t small[4];
+	const uint8_t payload[16] = {0x5A};
+	sdlp_tm_frame_t decoded;
+	sdlp_tc_frame_t tc_decoded;
+	size_t encoded_size;
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_stats_snapshot(NULL));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_stats_snapshot(&before));
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_master_channel_init(&master, 0x3E5));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_virtual_channel_init(&vc, &master, 6));
+	for (int i = 0; i < 3; i++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_vc_create_frame(&vc, &frame, payload, sizeof(payload)));
+		ASSERT_EQ_INT(SDLP_SUCCESS,
+									sdlp_tm_encode_frame(&frame, frames[i], sizeof(frames[i]), &encoded_size));
+	}
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL,
+								sdlp_tm_encode_frame(&frame, small, sizeof(small), &encoded_size));
+
+	/* Frame 1 is lost: one MC and one VC discontinuity. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_frame(frames[0], sizeof(frames[0]), &decoded));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_frame(frames[2], sizeof(frames[2]), &decoded));
+	frames[0][10] ^= 0x01;
+	ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, sdlp_tm_decode_frame(frames[0], sizeof(frames[0]), &decoded));
+	/* A short buffer is an argument error, not counted; a data field too long
+	 * for the header to describe is an invalid frame. */
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_decode_frame(frames[0], 3, &decoded));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_FRAME, sdlp_tm_decode_frame(oversized, sizeof(oversized), &decoded));
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_create_frame(&tc_frame, 0x3E5, 2, 9, payload, sizeof(payload)));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_encode_frame(&tc_frame, tc_buffer, sizeof(tc_buffer), &encoded_size));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_decode_frame(tc_buffer, encoded_size, &tc_decoded));
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_stats_snapshot(&after));
+
+#if defined(SDLP_STATS_ENABLED)
+	ASSERT_EQ_INT(3, after.tm_frames_encoded - before.tm_frames_encoded);
+	ASSERT_EQ_INT(2, after.tm_frames_decoded - before.tm_frames_decoded);
+	ASSERT_EQ_INT(1, after.tc_frames_encoded - before.tc_frames_encoded);
+	ASSERT_EQ_INT(1, after.tc_frames_decoded - before.tc_frames_decoded);
+	ASSERT_EQ_INT(1, after.crc_mismatches - before.crc_mismatches);
+	ASSERT_EQ_INT(1, after.invalid_frames - before.invalid_frames);
+	ASSERT_EQ_INT(1, after.buffer_too_small - before.buffer_too_small);
+	ASSERT_EQ_INT(1, after.tm_mc_discontinuities - before.tm_mc_discontinuities);
+	for (int v = 0; v < TM_MAX_VIRTUAL_CHANNELS; v++) {
+		ASSERT_EQ_INT(v == 6, after.tm_vc_discontinuities[v] - before.tm_vc_discontinuities[v]);
+	}
+#if defined(SDLP_STATS_CYCLES)
+	uint64_t samples[SDLP_STATS_TIMERS] = {0};
+
+	for (int t = 0; t < SDLP_STATS_TIMERS; t++) {
+		for (int b = 0; b < SDLP_STATS_HISTOGRAM_BINS; b++) {
+			samples[t] += after.cycles[t][b] - before.cycles[t][b];
+		}
+	}
+	ASSERT_EQ_INT(4, samples[SDLP_STATS_TIMER_ENCODE]);
+	ASSERT_EQ_INT(4, samples[SDLP_STATS_TIMER_DECODE]);
+	ASSERT_TRUE(samples[SDLP_STATS_TIMER_CRC] >= 8);
+#endif
+#else
+	sdlp_stats_t zero;
+
+	memset(&zero, 0, sizeof(zero));
+	ASSERT_EQ_MEM(&zero, &after, sizeof(zero));
+#endif
+
+	return 0;
+}
+
+/* Two spacecraft interleaved on one thread: frame 1 of the first is lost, and
+ * exactly that is counted, although every frame changes the SCID. */
+static int test_stats_tracks_spacecraft_separately(void) {
+	static const uint16_t scids[2] = {0x1A0, 0x1A1};
+	static const int order[5][2] = {{0, 0}, {1, 0}, {0, 2}, {1, 1}, {1, 2}};
+	sdlp_tm_master_channel_t master[2];
+	sdlp_tm_virtual_channel_t vc[2];
+	sdlp_tm_frame_t frame;
+	sdlp_tm_frame_t decoded;
+	sdlp_stats_t before;
+	sdlp_stats_t after;
+	uint8_t frames[2][3][TM_PRIMARY_HEADER_SIZE + 16 + TM_FRAME_ERROR_CONTROL_SIZE];
+	const uint8_t payload[16] = {0xA5};
+	size_t encoded_size;
+
+	for (int m = 0; m < 2; m++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_master_channel_init(&master[m], scids[m]));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_virtual_channel_init(&vc[m], &master[m], 3));
+		for (int i = 0; i < 3; i++) {
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_vc_create_frame(&vc[m], &frame, payload, sizeof(payload)));
+			ASSERT_EQ_INT(SDLP_SUCCESS,
+										sdlp_tm_encode_frame(&frame, frames[m][i], sizeof(frames[m][i]), &encoded_size));
+		}
+	}
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_stats_snapshot(&before));
+	for (int i = 0; i < 5; i++) {
+		const uint8_t *encoded = frames[order[i][0]][order[i][1]];
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_frame(encoded, sizeof(frames[0][0]), &decoded));
+	}
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_stats_snapshot(&after));
+
+#if defined(SDLP_STATS_ENABLED)
+	ASSERT_EQ_INT(5, after.tm_frames_decoded - before.tm_frames_decoded);
+	ASSERT_EQ_INT(1, after.tm_mc_discontinuities - before.tm_mc_discontinuities);
+	for (int v = 0; v < TM_MAX_VIRTUAL_CHANNELS; v++) {
+		ASSERT_EQ_INT(v == 3, after.tm_vc_discontinuities[v] - before.tm_vc_discontinuities[v]);
+	}
+#else
+	ASSERT_EQ_INT(0, after.tm_mc_discontinuities);
+#endif
+
+	return 0;
+}
+
+static int test_randomizer_sequence(void) {
+	static const uint8_t expected[12] = {0xFF, 0x48, 0x0E, 0xC0, 0x9A, 0x0D, 0x70, 0xBC, 0x8E, 0x2C, 0x93, 0xAD};
+	static uint8_t zeros[3000];
+	static uint8_t copy[3000];
+
+	memset(zeros, 0, sizeof(zeros));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_randomize(NULL, 1));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_randomize(zeros, sizeof(zeros)));
+	ASSERT_EQ_MEM(expected, zeros, sizeof(expected));
+	for (size_t i = SDLP_RANDOMIZER_PERIOD; i < sizeof(zeros); i++) {
+		ASSERT_EQ_INT(zeros[i - SDLP_RANDOMIZER_PERIOD], zeros[i]);
+	}
+
+	/* zeros now holds the sequence: XORing it again cancels, at any alignment. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_randomize_copy(&copy[3], zeros, 1037));
+	for (size_t i = 0; i < 1037; i++) {
+		ASSERT_EQ_INT(0, copy[3 + i]);
+	}
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_randomize(&copy[3], 1037));
+	ASSERT_EQ_MEM(zeros, &copy[3], 1037);
+
+	return 0;
+}
+
+static int test_tm_randomized_encode_decode(void) {
+	static const uint16_t lengths[] = {0, 1, 7, 64, 249, 255, 256, 700, TM_MAX_DATA_SIZE};
+	static uint8_t plain[TM_PRIMARY_HEADER_SIZE + TM_MAX_DATA_SIZE + TM_FRAME_ERROR_CONTROL_SIZE];
+	static uint8_t fused[sizeof(plain)];
+	static sdlp_tm_frame_t frame;
+	static sdlp_tm_frame_t decoded;
+	size_t encoded_size = 0;
+
+	for (size_t n = 0; n < sizeof(lengths) / sizeof(lengths[0]); n++) {
+		uint8_t data[TM_MAX_DATA_SIZE];
+		size_t plain_size = 0;
+		size_t fused_size = 0;
+		sdlp_tm_builder_t builder;
+		sdlp_tm_frame_view_t view;
+
+		if (lengths[n] > TM_MAX_DATA_SIZE) {
+			continue; /* built with a smaller TM_MAX_DATA_SIZE */
+		}
+		for (uint16_t i = 0; i < lengths[n]; i++) {
+			data[i] = (uint8_t)(i * 7 + n);
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_create_frame(&frame, 0x155, 6, data, lengths[n]));
+		frame.header.transfer_frame_data_field_status = 0x1234;
+
+		/* Fused encode == encode + randomize. */
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_encode_frame(&frame, plain, sizeof(plain), &plain_size));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_randomize(plain, plain_size));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_encode_frame_randomized(&frame, fused, sizeof(fused), &fused_size));
+		ASSERT_EQ_INT((int)plain_size, (int)fused_size);
+		ASSERT_EQ_MEM(plain, fused, plain_size);
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_builder_begin(&builder, fused, sizeof(fused), 0x155, 6));
+		builder.header = frame.header;
+		memcpy(builder.data, data, lengths[n]);
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_builder_commit_randomized(&builder, lengths[n], &fused_size));
+		ASSERT_EQ_INT((int)plain_size, (int)fused_size);
+		ASSERT_EQ_MEM(plain, fused, plain_size);
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_frame_randomized(plain, plain_size, &decoded));
+		ASSERT_EQ_INT(lengths[n], decoded.data_length);
+		ASSERT_EQ_INT(0x1234, decoded.header.transfer_frame_data_field_status);
+		ASSERT_EQ_INT(0x155, decoded.header.spacecraft_id);
+		ASSERT_EQ_MEM(data, decoded.data, lengths[n]);
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_view_randomized(fused, fused_size, &view));
+		ASSERT_EQ_INT(lengths[n], view.data_length);
+		ASSERT_EQ_INT(6, view.header.virtual_channel_id);
+		ASSERT_EQ_MEM(data, view.data, lengths[n]);
+
+		plain[plain_size / 2] ^= 0x10;
+		ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, sdlp_tm_decode_frame_randomized(plain, plain_size, &decoded));
+		ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, sdlp_tm_decode_view_randomized(plain, plain_size, &view));
+	}
+
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_tm_encode_frame_randomized(&frame, fused, 100, &encoded_size));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tm_decode_view_randomized(fused, TM_PRIMARY_HEADER_SIZE + 1, NULL));
+
+	return 0;
+}
+
+static int test_rs_encode_decode_roundtrip(void) {
+	static const sdlp_rs_config_t configs[] = {{1, 0, 0}, {1, 1, 0}, {2, 0, 0}, {4, 1, 0}, {5, 1, 0}, {8, 0, 0}, {8, 1, 0}, {3, 1, 100}, {1, 0, 222}};
+	static uint8_t block[SDLP_RS_MAX_INTERLEAVE * SDLP_RS_N];
+	static uint8_t original[sizeof(block)];
+	uint32_t seed = 12345u;
+
+	for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); c++) {
+		const sdlp_rs_config_t *config = &configs[c];
+		size_t depth = config->interleave;
+		size_t symbols = SDLP_RS_N - config->virtual_fill;
+		size_t length = sdlp_rs_codeblock_length(config);
+		int corrected = -1;
+
+		ASSERT_EQ_INT(depth * (SDLP_RS_K - config->virtual_fill), sdlp_rs_data_length(config));
+		ASSERT_EQ_INT(depth * symbols, length);
+		for (size_t i = 0; i < length; i++) {
+			seed = seed * 1103515245u + 12345u;
+			block[i] = (uint8_t)(seed >> 16);
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_rs_encode(config, block, length));
+		memcpy(original, block, length);
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_rs_decode(config, block, length, &corrected));
+		ASSERT_EQ_INT(0, corrected);
+		ASSERT_EQ_MEM(original, block, length);
+
+		/* 16 errors in every codeword, spread over data and parity. */
+		for (size_t i = 0; i < depth; i++) {
+			for (size_t e = 0; e < SDLP_RS_MAX_ERRORS; e++) {
+				size_t j = (e * 13u + i * 7u) % symbols;
+
+				block[j * depth + i] ^= (uint8_t)(e + 1u);
+			}
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_rs_decode(config, block, length, &corrected));
+		ASSERT_EQ_INT(SDLP_RS_MAX_ERRORS * depth, corrected);
+		ASSERT_EQ_MEM(original, block, length);
+
+		/* 17 errors in the last codeword: reported, left as received, and the
+		 * other codewords still corrected. */
+		block[0] ^= 0x5Au;
+		for (size_t e = 0; e <= SDLP_RS_MAX_ERRORS; e++) {
+			block[((e * 13u + 1u) % symbols) * depth + depth - 1u] ^= 0xA5u;
+		}
+		memcpy(original, block, length);
+		if (depth > 1) {
+			original[0] ^= 0x5Au;
+		}
+		ASSERT_EQ_INT(SDLP_ERROR_UNCORRECTABLE, sdlp_rs_decode(config, block, length, &corrected));
+		ASSERT_EQ_INT(depth > 1 ? 1 : 0, corrected);
+		ASSERT_EQ_MEM(original, block, length);
+	}
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_rs_encode(&(sdlp_rs_config_t){0, 0, 0}, block, sizeof(block)));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_rs_encode(&(sdlp_rs_config_t){9, 0, 0}, block, sizeof(block)));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_rs_decode(&(sdlp_rs_config_t){1, 0, SDLP_RS_K}, block, sizeof(block), NULL));
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_rs_decode(&configs[0], block, SDLP_RS_N - 1u, NULL));
+
+	return 0;
+}
+
+static int test_rs_dual_basis_matches_conventional(void) {
+	static const uint8_t tal[8] = {0x8D, 0xEF, 0xEC, 0x86, 0xFA, 0x99, 0xAF, 0x7B};
+	const sdlp_rs_config_t dual = {2, 1, 0};
+	const sdlp_rs_config_t conventional = {2, 0, 0};
+	static uint8_t block[2 * SDLP_RS_N];
+	uint8_t to_conventional[256];
+	int corrected = -1;
+
+	/* Invert the CCSDS 131.0-B transformation: dual-basis bit 7 - k of a
+	 * conventional symbol contributes row k of the matrix. */
+	for (unsigned v = 0; v < 256; v++) {
+		uint8_t d = 0;
+
+		for (unsigned k = 0; k < 8; k++) {
+			if (v & (1u << k)) {
+				d ^= tal[7 - k];
+			}
+		}
+		to_conventional[d] = (uint8_t)v;
+	}
+
+	for (size_t i = 0; i < sizeof(block); i++) {
+		block[i] = (uint8_t)(i * 31u + 7u);
+	}
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_rs_encode(&dual, block, sizeof(block)));
+	for (size_t i = 0; i < sizeof(block); i++) {
+		block[i] = to_conventional[block[i]];
+	}
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_rs_decode(&conventional, block, sizeof(block), &corrected));
+	ASSERT_EQ_INT(0, corrected);
+
+	return 0;
+}
+
+#define SYNC_TEST_FRAMES 6
+#define SYNC_TEST_PAYLOAD 40
+#define SYNC_TEST_FRAME_LENGTH (TM_PRIMARY_HEADER_SIZE + SYNC_TEST_PAYLOAD + TM_FRAME_ERROR_CONTROL_SIZE)
+
+typedef struct {
+	uint8_t frames[SYNC_TEST_FRAMES][SYNC_TEST_FRAME_LENGTH];
+	int count;
+	int crc_failures;
+	int locked;
+} sync_capture_t;
+
+static void sync_capture_frame(void *user, const uint8_t *frame, size_t frame_length,
+															 sdlp_sync_state_t state) {
+	sync_capture_t *capture = (sync_capture_t *)user;
+	sdlp_tm_frame_view_t view;
+
+	if (sdlp_tm_decode_view(frame, frame_length, &view, 1) != SDLP_SUCCESS) {
+		capture->crc_failures++;
+	}
+	if (state == SDLP_SYNC_LOCK) {
+		capture->locked++;
+	}
+	if (capture->count < SYNC_TEST_FRAMES) {
+		memcpy(capture->frames[capture->count], frame, frame_length);
+	}
+	capture->count++;
+}
+
+/* Builds junk + (ASM + frame) * SYNC_TEST_FRAMES + ASM, shifted right by 'slip'
+ * bits and optionally inverted. Returns the stream length. */
+static size_t build_sync_stream(uint8_t frames[SYNC_TEST_FRAMES][SYNC_TEST_FRAME_LENGTH],
+																uint8_t *stream, unsigned slip, int invert) {
+	static const uint8_t asm_bytes[SDLP_ASM_SIZE] = {0x1A, 0xCF, 0xFC, 0x1D};
+	uint8_t aligned[7 + SYNC_TEST_FRAMES * (SDLP_ASM_SIZE + SYNC_TEST_FRAME_LENGTH) + SDLP_ASM_SIZE];
+	size_t length = 0;
+	uint8_t payload[SYNC_TEST_PAYLOAD];
+	size_t encoded_size = 0;
+	sdlp_tm_frame_t frame;
+
+	for (int i = 0; i < 7; i++) {
+		aligned[length++] = (uint8_t)(0x55 + i);
+	}
+
+	for (int f = 0; f < SYNC_TEST_FRAMES; f++) {
+		for (size_t i = 0; i < sizeof(payload); i++) {
+			payload[i] = (uint8_t)(f * 31 + (int)i);
+		}
+		sdlp_tm_create_frame(&frame, 0x0AB, 3, payload, (uint16_t)sizeof(payload));
+		sdlp_tm_encode_frame(&frame, frames[f], SYNC_TEST_FRAME_LENGTH, &encoded_size);
+
+		memcpy(&aligned[length], asm_bytes, SDLP_ASM_SIZE);
+		length += SDLP_ASM_SIZE;
+		memcpy(&aligned[length], frames[f], SYNC_TEST_FRAME_LENGTH);
+		length += SYNC_TEST_FRAME_LENGTH;
+	}
+	memcpy(&aligned[length], asm_bytes, SDLP_ASM_SIZE);
+	length += SDLP_ASM_SIZE;
+
+	unsigned prev = 0;
+	for (size_t i = 0; i < length; i++) {
+		unsigned byte = invert ? (uint8_t)~aligned[i] : aligned[i];
+		stream[i] = (uint8_t)(((prev << 8) | byte) >> slip);
+		prev = byte;
+	}
+	stream[length] = (uint8_t)(prev << (8 - slip));
+
+	return length + 1;
+}
+
+static int test_sync_bit_slipped_inverted_stream(void) {
+	static uint8_t frames[SYNC_TEST_FRAMES][SYNC_TEST_FRAME_LENGTH];
+	static uint8_t stream[8 + SYNC_TEST_FRAMES * (SDLP_ASM_SIZE + SYNC_TEST_FRAME_LENGTH) + SDLP_ASM_SIZE];
+	uint8_t frame_buffer[SYNC_TEST_FRAME_LENGTH];
+
+	for (unsigned slip = 0; slip < 8; slip++) {
+		for (int invert = 0; invert < 2; invert++) {
+			sync_capture_t capture;
+			sdlp_sync_t sync;
+			sdlp_sync_config_t config = {SYNC_TEST_FRAME_LENGTH, frame_buffer, 1, 2, 2,
+																	 sync_capture_frame, &capture};
+			size_t length = build_sync_stream(frames, stream, slip, invert);
+
+			memset(&capture, 0, sizeof(capture));
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_sync_init(&sync, &config));
+
+			/* Feed in uneven chunks to exercise chunk boundaries. */
+			for (size_t offset = 0, chunk = 1; offset < length; offset += chunk, chunk = chunk * 3 % 37 + 1) {
+				size_t n = length - offset < chunk ? length - offset : chunk;
+				ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_sync_process(&sync, &stream[offset], n));
+			}
+
+			ASSERT_EQ_INT(SYNC_TEST_FRAMES, capture.count);
+			ASSERT_EQ_INT(0, capture.crc_failures);
+			ASSERT_EQ_INT(SYNC_TEST_FRAMES - 1, capture.locked);
+			ASSERT_EQ_INT(SDLP_SYNC_LOCK, sync.state);
+			for (int f = 0; f < SYNC_TEST_FRAMES; f++) {
+				ASSERT_EQ_MEM(frames[f], capture.frames[f], SYNC_TEST_FRAME_LENGTH);
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int test_sync_flywheel_and_lock_loss(void) {
+	static uint8_t frames[SYNC_TEST_FRAMES][SYNC_TEST_FRAME_LENGTH];
+	static uint8_t stream[8 + SYNC_TEST_FRAMES * (SDLP_ASM_SIZE + SYNC_TEST_FRAME_LENGTH) + SDLP_ASM_SIZE];
+	uint8_t frame_buffer[SYNC_TEST_FRAME_LENGTH];
+	sync_capture_t capture;
+	sdlp_sync_t sync;
+	sdlp_sync_config_t config = {SYNC_TEST_FRAME_LENGTH, frame_buffer, 1, 1, 1,
+															 sync_capture_frame, &capture};
+	size_t marker_stride = SDLP_ASM_SIZE + SYNC_TEST_FRAME_LENGTH;
+	size_t length = build_sync_stream(frames, stream, 0, 0);
+
+	/* Marker 3 has a correctable bit error and marker 4 is bridged by the
+	 * flywheel; losing marker 5 as well drops the lock, so frames 5 and 6 are
+	 * lost and the trailing marker only re-acquires. */
+	stream[7 + 2 * marker_stride] ^= 0x01;
+	stream[7 + 3 * marker_stride] ^= 0xFF;
+	stream[7 + 4 * marker_stride] ^= 0xFF;
+	stream[7 + 5 * marker_stride] ^= 0xFF;
+
+	memset(&capture, 0, sizeof(capture));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_sync_init(&sync, &config));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_sync_process(&sync, stream, length));
+
+	ASSERT_EQ_INT(4, capture.count);
+	ASSERT_EQ_INT(0, capture.crc_failures);
+	ASSERT_EQ_INT(1, (int)sync.stats.marker_bit_errors);
+	ASSERT_EQ_INT(1, (int)sync.stats.flywheel_frames);
+	ASSERT_EQ_INT(1, (int)sync.stats.lock_losses);
+	ASSERT_EQ_INT(2, (int)sync.stats.acquisitions);
+	ASSERT_EQ_INT(SDLP_SYNC_CHECK, sync.state);
+
+	return 0;
+}
+
+#define PKT_TEST_COUNT 7
+#define PKT_TEST_FRAME_DATA 64
+#define PKT_TEST_MAX_FRAMES 16
+
+static const size_t pkt_test_lengths[PKT_TEST_COUNT] = {10, 100, 7, 200, 7, 30, 41};
+
+typedef struct {
+	uint8_t stream[1024];
+	size_t stream_length;
+	size_t starts[PKT_TEST_COUNT + 1];
+	uint8_t frames[PKT_TEST_MAX_FRAMES][PKT_TEST_FRAME_DATA];
+	sdlp_tm_header_t headers[PKT_TEST_MAX_FRAMES];
+	int frame_count;
+} pkt_test_link_t;
+
+typedef struct {
+	const pkt_test_link_t *link;
+	int delivered[PKT_TEST_COUNT];
+	int mismatches;
+	int in_frame;
+} pkt_capture_t;
+
+static void pkt_test_write_packet(uint8_t *p, uint16_t apid, uint16_t seq, size_t length) {
+	p[0] = (uint8_t)(0x08 | ((apid >> 8) & 0x07));
+	p[1] = (uint8_t)(apid & 0xFF);
+	p[2] = (uint8_t)(0xC0 | ((seq >> 8) & 0x3F));
+	p[3] = (uint8_t)(seq & 0xFF);
+	p[4] = (uint8_t)((length - 7) >> 8);
+	p[5] = (uint8_t)((length - 7) & 0xFF);
+	for (size_t i = SDLP_SPACE_PACKET_HEADER_SIZE; i < length; i++) {
+		p[i] = (uint8_t)(seq * 13 + i);
+	}
+}
+
+/* Packs the test packets back to back into fixed-length frame data fields with
+ * the First Header Pointer set, padding with an idle packet. */
+static void pkt_test_build_link(pkt_test_link_t *link) {
+	size_t pos = 0;
+
+	memset(link, 0, sizeof(*link));
+	for (int i = 0; i < PKT_TEST_COUNT; i++) {
+		link->starts[i] = pos;
+		pkt_test_write_packet(&link->stream[pos], 0x100, (uint16_t)i, pkt_test_lengths[i]);
+		pos += pkt_test_lengths[i];
+	}
+	link->starts[PKT_TEST_COUNT] = pos;
+	pkt_test_write_packet(&link->stream[pos], SDLP_SPACE_PACKET_IDLE_APID, 0, 80);
+	pos += 80;
+	link->stream_length = pos;
+
+	link->frame_count = (int)(link->starts[PKT_TEST_COUNT] / PKT_TEST_FRAME_DATA) + 1;
+	for (int f = 0; f < link->frame_count; f++) {
+		size_t begin = (size_t)f * PKT_TEST_FRAME_DATA;
+		uint16_t fhp = TM_FHP_NO_PACKET_START;
+
+		for (int i = 0; i <= PKT_TEST_COUNT; i++) {
+			if (link->starts[i] >= begin && link->starts[i] < begin + PKT_TEST_FRAME_DATA) {
+				fhp = (uint16_t)(link->starts[i] - begin);
+				break;
+			}
+		}
+		memcpy(link->frames[f], &link->stream[begin], PKT_TEST_FRAME_DATA);
+		link->headers[f].virtual_channel_id = 2;
+		link->headers[f].virtual_channel_frame_count = (uint8_t)(250 + f);
+		link->headers[f].transfer_frame_data_field_status = fhp;
+	}
+}
+
+static void pkt_capture_packet(void *user, const uint8_t *packet, size_t length) {
+	pkt_capture_t *capture = (pkt_capture_t *)user;
+	int seq = ((packet[2] & 0x3F) << 8) | packet[3];
+
+	if (seq >= PKT_TEST_COUNT || length != pkt_test_lengths[seq] ||
+			memcmp(packet, &capture->link->stream[capture->link->starts[seq]], length) != 0) {
+		capture->mismatches++;
+		return;
+	}
+	for (int f = 0; f < capture->link->frame_count; f++) {
+		if (packet >= capture->link->frames[f] && packet < capture->link->frames[f] + PKT_TEST_FRAME_DATA) {
+			capture->in_frame++;
+		}
+	}
+	capture->delivered[seq]++;
+}
+
+static int test_packet_extractor_spanning_packets(void) {
+	static pkt_test_link_t link;
+	uint8_t reassembly[256];
+	pkt_capture_t capture;
+	sdlp_packet_extractor_t extractor;
+	sdlp_packet_extractor_config_t config = {reassembly, sizeof(reassembly), pkt_capture_packet, &capture};
+
+	pkt_test_build_link(&link);
+	memset(&capture, 0, sizeof(capture));
+	capture.link = &link;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_packet_extractor_init(&extractor, &config));
+	for (int f = 0; f < link.frame_count; f++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_packet_extractor_push(&extractor, &link.headers[f], link.frames[f],
+																													 PKT_TEST_FRAME_DATA));
+	}
+
+	ASSERT_EQ_INT(0, capture.mismatches);
+	for (int i = 0; i < PKT_TEST_COUNT; i++) {
+		ASSERT_EQ_INT(1, capture.delivered[i]);
+	}
+	/* Packets 0, 2 and 4 lie wholly inside one frame and are not copied. */
+	ASSERT_EQ_INT(3, capture.in_frame);
+	ASSERT_EQ_INT(0, (int)extractor.stats.frame_gaps);
+	ASSERT_EQ_INT(0, (int)extractor.stats.resyncs);
+
+	return 0;
+}
+
+static int test_packet_extractor_frame_gap_resync(void) {
+	static pkt_test_link_t link;
+	uint8_t reassembly[256];
+	pkt_capture_t capture;
+	sdlp_packet_extractor_t extractor;
+	sdlp_packet_extractor_config_t config = {reassembly, sizeof(reassembly), pkt_capture_packet, &capture};
+
+	pkt_test_build_link(&link);
+	memset(&capture, 0, sizeof(capture));
+	capture.link = &link;
+
+	/* Frame 4 (bytes 256-319) is lost: packets 3 (bytes 117-316) and 4 (bytes
+	 * 317-323) are dropped and the extractor resynchronises on packet 5 at the
+	 * FHP of frame 5. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_packet_extractor_init(&extractor, &config));
+	for (int f = 0; f < link.frame_count; f++) {
+		if (f == 4) {
+			continue;
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_packet_extractor_push(&extractor, &link.headers[f], link.frames[f],
+																													 PKT_TEST_FRAME_DATA));
+	}
+
+	ASSERT_EQ_INT(0, capture.mismatches);
+	ASSERT_EQ_INT(1, (int)extractor.stats.frame_gaps);
+	ASSERT_EQ_INT(1, capture.delivered[2]);
+	ASSERT_EQ_INT(0, capture.delivered[3]);
+	ASSERT_EQ_INT(0, capture.delivered[4]);
+	ASSERT_EQ_INT(1, capture.delivered[5]);
+	ASSERT_EQ_INT(1, capture.delivered[6]);
+
+	return 0;
+}
+
+typedef struct {
+	uint16_t next_seq;
+	int packets;
+	int errors;
+} mux_capture_t;
+
+static void mux_capture_packet(void *user, const uint8_t *packet, size_t length) {
+	mux_capture_t *capture = (mux_capture_t *)user;
+	uint16_t seq = (uint16_t)(((packet[2] & 0x3F) << 8) | packet[3]);
+	uint8_t expected[300];
+
+	pkt_test_write_packet(expected, (uint16_t)(((packet[0] & 0x07) << 8) | packet[1]), seq, length);
+	if (seq != capture->next_seq || memcmp(expected, packet, length) != 0) {
+		capture->errors++;
+	}
+	capture->next_seq++;
+	capture->packets++;
+}
+
+static int test_mux_packs_packets_and_idle_frames(void) {
+	sdlp_mux_t mux;
+	sdlp_mux_vc_t vc_hk;
+	sdlp_mux_vc_t vc_sci;
+	static uint8_t ring_hk[1024];
+	static uint8_t ring_sci[1024];
+	uint8_t packet[300];
+	uint8_t frame[80];
+	size_t frame_size = 0;
+	uint8_t reassembly[2][300];
+	mux_capture_t captures[2];
+	sdlp_packet_extractor_t extractors[2];
+	int idle_frames = 0;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_init(&mux, 0x1F0, sizeof(frame), SDLP_MUX_PRIORITY));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_add_vc(&mux, &vc_hk, 1, ring_hk, sizeof(ring_hk), 2, 1));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_add_vc(&mux, &vc_sci, 3, ring_sci, sizeof(ring_sci), 1, 1));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM,
+								sdlp_mux_add_vc(&mux, &vc_sci, TM_OID_VIRTUAL_CHANNEL, ring_sci, sizeof(ring_sci), 1, 1));
+
+	memset(captures, 0, sizeof(captures));
+	for (int i = 0; i < 2; i++) {
+		sdlp_packet_extractor_config_t config = {reassembly[i], sizeof(reassembly[i]), mux_capture_packet,
+																						 &captures[i]};
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_packet_extractor_init(&extractors[i], &config));
+	}
+
+	for (uint16_t seq = 0; seq < 6; seq++) {
+		size_t length = 7 + (size_t)seq * 41;
+		pkt_test_write_packet(packet, 0x010, seq, length);
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_enqueue(&vc_hk, packet, length));
+		pkt_test_write_packet(packet, 0x020, seq, 250 - length);
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_enqueue(&vc_sci, packet, 250 - length));
+	}
+	pkt_test_write_packet(packet, 0x020, 99, 300);
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_mux_enqueue(&vc_sci, packet, 300));
+
+	for (int f = 0; f < 40; f++) {
+		sdlp_tm_frame_view_t view;
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_next_frame(&mux, frame, sizeof(frame), &frame_size));
+		ASSERT_EQ_INT((int)sizeof(frame), (int)frame_size);
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_view(frame, frame_size, &view, 1));
+		ASSERT_EQ_INT(0x1F0, view.header.spacecraft_id);
+		ASSERT_EQ_INT(f & 0xFF, view.header.master_channel_frame_count);
+
+		if (view.header.virtual_channel_id == TM_OID_VIRTUAL_CHANNEL) {
+			ASSERT_EQ_INT(TM_FHP_IDLE_DATA, view.header.transfer_frame_data_field_status);
+			idle_frames++;
+			continue;
+		}
+		/* Priority: science only gets a frame once housekeeping cannot fill one. */
+		if (view.header.virtual_channel_id == 3) {
+			ASSERT_TRUE(sdlp_mux_queued(&vc_hk) < sizeof(frame) - TM_PRIMARY_HEADER_SIZE - TM_FRAME_ERROR_CONTROL_SIZE);
+		}
+		ASSERT_EQ_INT(SDLP_SUCCESS,
+									sdlp_packet_extractor_push_view(&extractors[view.header.virtual_channel_id == 1 ? 0 : 1],
+																									&view));
+	}
+
+	ASSERT_EQ_INT(6, captures[0].packets);
+	ASSERT_EQ_INT(6, captures[1].packets);
+	ASSERT_EQ_INT(0, captures[0].errors + captures[1].errors);
+	ASSERT_EQ_INT(0, (int)(extractors[0].stats.resyncs + extractors[1].stats.resyncs));
+	ASSERT_TRUE(idle_frames > 0);
+	ASSERT_EQ_INT(idle_frames, (int)mux.idle_frames);
+
+	return 0;
+}
+
+static int test_mux_weighted_round_robin(void) {
+	sdlp_mux_t mux;
+	sdlp_mux_vc_t vcs[2];
+	static uint8_t rings[2][1024];
+	uint8_t packet[200];
+	uint8_t frame[64];
+	size_t frame_size = 0;
+	static const uint8_t expected_vcs[9] = {0, 0, 5, 0, 0, 5, 0, 0, 5};
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_init(&mux, 0x001, sizeof(frame), SDLP_MUX_WEIGHTED_RR));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_add_vc(&mux, &vcs[0], 0, rings[0], sizeof(rings[0]), 0, 2));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_add_vc(&mux, &vcs[1], 5, rings[1], sizeof(rings[1]), 0, 1));
+
+	for (uint16_t seq = 0; seq < 5; seq++) {
+		pkt_test_write_packet(packet, 0x001, seq, sizeof(packet));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_enqueue(&vcs[0], packet, sizeof(packet)));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_enqueue(&vcs[1], packet, sizeof(packet)));
+	}
+
+	for (int f = 0; f < 9; f++) {
+		sdlp_tm_frame_view_t view;
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_mux_next_frame(&mux, frame, sizeof(frame), &frame_size));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_view(frame, frame_size, &view, 1));
+		ASSERT_EQ_INT(expected_vcs[f], view.header.virtual_channel_id);
+	}
+
+	return 0;
+}
+
+#define POOL_FRAME_LENGTH (TM_PRIMARY_HEADER_SIZE + 100 + TM_FRAME_ERROR_CONTROL_SIZE)
+
+SDLP_FRAME_POOL_STORAGE(test_pool, 5, POOL_FRAME_LENGTH);
+
+static int test_frame_pool_acquire_release(void) {
+	sdlp_frame_pool_t pool;
+	uint8_t *buffers[5];
+	uint8_t *buffer;
+	uint8_t payload[100] = {0};
+	size_t encoded_size;
+
+	ASSERT_EQ_INT(128, (int)SDLP_FRAME_POOL_STRIDE(POOL_FRAME_LENGTH));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM,
+				  sdlp_frame_pool_init(&pool, test_pool_buffers, test_pool_links, 0, POOL_FRAME_LENGTH));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM,
+				  sdlp_frame_pool_init(&pool, &test_pool_buffers[1], test_pool_links, 5, POOL_FRAME_LENGTH));
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+				  sdlp_frame_pool_init(&pool, test_pool_buffers, test_pool_links, 5, POOL_FRAME_LENGTH));
+
+	/* A fresh pool hands out every buffer once, in address order, each on its own cache lines. */
+	for (size_t i = 0; i < 5; i++) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_frame_pool_acquire(&pool, &buffers[i]));
+		ASSERT_TRUE(buffers[i] == &test_pool_buffers[i * 128]);
+		ASSERT_EQ_INT(0, (int)((uintptr_t)buffers[i] % SDLP_FRAME_POOL_ALIGN));
+	}
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_frame_pool_acquire(&pool, &buffer));
+
+	/* Buffers from a pool sized for one channel hold that channel's frames. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_encode_iov(0x12, 1, &(sdlp_iovec_t){payload, sizeof(payload)}, 1,
+												   buffers[4], pool.buffer_size, &encoded_size));
+	ASSERT_EQ_INT(POOL_FRAME_LENGTH, (int)encoded_size);
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_frame_pool_release(&pool, buffers[2] + 1));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_frame_pool_release(&pool, buffers[4] + 128));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_frame_pool_release(&pool, payload));
+
+	/* Last released, first acquired. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_frame_pool_release(&pool, buffers[3]));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_frame_pool_release(&pool, buffers[1]));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_frame_pool_acquire(&pool, &buffer));
+	ASSERT_TRUE(buffer == buffers[1]);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_frame_pool_acquire(&pool, &buffer));
+	ASSERT_TRUE(buffer == buffers[3]);
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_frame_pool_acquire(&pool, &buffer));
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_frame_pool_acquire(NULL, &buffer));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_frame_pool_release(&pool, NULL));
+
+	return 0;
+}
+
 static int test_tc_create_frame_invalid_params(void) {
 	sdlp_tc_frame_t frame;
 	uint8_t payload[1] = {0x55};
@@ -163,16 +1419,537 @@ static int test_tc_decode_crc_mismatch(void) {
 	return 0;
 }
 
+static int test_tc_decode_view_zero_copy(void) {
+	sdlp_tc_frame_t frame;
+	sdlp_tc_frame_view_t view;
+	const uint8_t payload[] = {0x0A, 0x0B, 0x0C};
+	uint8_t encoded[TC_PRIMARY_HEADER_SIZE + TC_MAX_DATA_SIZE + TC_FRAME_ERROR_CONTROL_SIZE + 1];
+	size_t encoded_size = 0;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tc_create_frame(&frame, 0x2AA, 0x21, 0x07, payload, (uint16_t)sizeof(payload)));
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tc_encode_frame(&frame, encoded, sizeof(encoded), &encoded_size));
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_decode_view(encoded, encoded_size, &view, 1));
+	ASSERT_TRUE(view.data == &encoded[encoded_size - TC_FRAME_ERROR_CONTROL_SIZE - sizeof(payload)]);
+	ASSERT_EQ_INT((int)sizeof(payload), view.data_length);
+	ASSERT_EQ_MEM(payload, view.data, sizeof(payload));
+	ASSERT_EQ_INT(0x2AA, view.header.spacecraft_id);
+	ASSERT_EQ_INT(0x21, view.header.virtual_channel_id);
+	ASSERT_EQ_INT(0x07, view.header.frame_sequence_number);
+
+	encoded[encoded_size - 1] ^= 0x01;
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_decode_view(encoded, encoded_size, &view, 0));
+	ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, sdlp_tc_view_verify_crc(&view));
+
+	return 0;
+}
+
+static int test_tc_builder_matches_encode(void) {
+	sdlp_tc_frame_t frame;
+	sdlp_tc_builder_t builder;
+	const uint8_t payload[] = {0x9F, 0x8E, 0x7D, 0x6C};
+	uint8_t expected[TC_PRIMARY_HEADER_SIZE + 1 + sizeof(payload) + TC_FRAME_ERROR_CONTROL_SIZE];
+	uint8_t built[sizeof(expected)];
+	size_t expected_size = 0;
+	size_t built_size = 0;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tc_create_frame(&frame, 0x301, 0x12, 0x34, payload, (uint16_t)sizeof(payload)));
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tc_encode_frame(&frame, expected, sizeof(expected), &expected_size));
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_builder_begin(&builder, built, sizeof(built), 0x301, 0x12, 0x34));
+	memcpy(builder.data, payload, sizeof(payload));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_builder_commit(&builder, (uint16_t)sizeof(payload), &built_size));
+
+	ASSERT_EQ_INT((int)expected_size, (int)built_size);
+	ASSERT_EQ_MEM(expected, built, expected_size);
+
+	return 0;
+}
+
+static int test_tc_encode_iov_matches_encode(void) {
+	sdlp_tc_frame_t frame;
+	const uint8_t payload[] = {0x10, 0x32, 0x54, 0x76, 0x98, 0xBA, 0xDC};
+	const sdlp_iovec_t iov[] = {{payload, 2}, {&payload[2], 5}};
+	uint8_t expected[TC_PRIMARY_HEADER_SIZE + TC_SEGMENT_HEADER_SIZE + sizeof(payload) + TC_FRAME_ERROR_CONTROL_SIZE];
+	uint8_t gathered[sizeof(expected)];
+	size_t expected_size = 0;
+	size_t gathered_size = 0;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tc_create_frame(&frame, 0x2A7, 0x21, 0x5C, payload, (uint16_t)sizeof(payload)));
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tc_encode_frame(&frame, expected, sizeof(expected), &expected_size));
+
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL,
+								sdlp_tc_encode_iov(0x2A7, 0x21, 0x5C, iov, 2, gathered, expected_size - 1, &gathered_size));
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tc_encode_iov(0x2A7, 0x21, 0x5C, iov, 2, gathered, sizeof(gathered), &gathered_size));
+	ASSERT_EQ_INT((int)expected_size, (int)gathered_size);
+	ASSERT_EQ_MEM(expected, gathered, expected_size);
+
+	return 0;
+}
+
+static int test_tc_decode_batch(void) {
+	static uint8_t buffers[9][TC_PRIMARY_HEADER_SIZE + TC_SEGMENT_HEADER_SIZE + 600 + TC_FRAME_ERROR_CONTROL_SIZE];
+	sdlp_frame_desc_t frames[9];
+	sdlp_tc_frame_view_t views[9];
+	int results[9];
+
+	for (int i = 0; i < 9; i++) {
+		sdlp_tc_builder_t builder;
+		uint16_t length = (uint16_t)(600 - i * 67);
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_builder_begin(&builder, buffers[i], sizeof(buffers[i]), 0x2B, 3, (uint8_t)i));
+		memset(builder.data, i, length);
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_builder_commit(&builder, length, &frames[i].length));
+		frames[i].buffer = buffers[i];
+	}
+	buffers[2][frames[2].length - 1] ^= 0x01;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_decode_batch(frames, 9, views, results));
+
+	for (int i = 0; i < 9; i++) {
+		ASSERT_EQ_INT(i == 2 ? SDLP_ERROR_CRC_MISMATCH : SDLP_SUCCESS, results[i]);
+		ASSERT_EQ_INT(i, views[i].header.frame_sequence_number);
+		ASSERT_EQ_INT(i, views[i].data[views[i].data_length - 1]);
+	}
+
+	return 0;
+}
+
+typedef struct {
+	int sdus;
+	uint8_t map_id;
+	size_t length;
+	uint8_t data[6000];
+} sdu_capture_t;
+
+static void sdu_capture(void *user, uint8_t map_id, const uint8_t *sdu, size_t length) {
+	sdu_capture_t *capture = (sdu_capture_t *)user;
+
+	capture->sdus++;
+	capture->map_id = map_id;
+	capture->length = length;
+	if (length <= sizeof(capture->data)) {
+		memcpy(capture->data, sdu, length);
+	}
+}
+
+static int test_tc_segment_reassemble_roundtrip(void) {
+	static uint8_t sdu[5000];
+	static uint8_t frames[5100];
+	static uint8_t pool[2 * 5000];
+	static sdu_capture_t capture;
+	sdlp_tc_map_context_t contexts[2];
+	sdlp_tc_segmenter_t segmenter;
+	sdlp_tc_reassembler_t reassembler;
+	size_t encoded_size = 0;
+	size_t frame_count = 0;
+	const uint8_t expected_flags[] = {TC_SEQ_FLAG_FIRST, TC_SEQ_FLAG_CONTINUE, TC_SEQ_FLAG_CONTINUE,
+																		TC_SEQ_FLAG_CONTINUE, TC_SEQ_FLAG_LAST};
+
+	for (size_t i = 0; i < sizeof(sdu); i++) {
+		sdu[i] = (uint8_t)(i * 7u + (i >> 8));
+	}
+
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tc_segmenter_init(&segmenter, 0x123, 2, 64, 1000));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM,
+								sdlp_tc_segmenter_init(&segmenter, 0x123, 2, 5, TC_MAX_SEGMENT_SIZE + 1));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_init(&segmenter, 0x123, 2, 5, 1000));
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL,
+								sdlp_tc_segment_sdu(&segmenter, sdu, sizeof(sdu), frames, 5039, &encoded_size, &frame_count));
+	ASSERT_EQ_INT(SDLP_SUCCESS,
+								sdlp_tc_segment_sdu(&segmenter, sdu, sizeof(sdu), frames, sizeof(frames), &encoded_size, &frame_count));
+	ASSERT_EQ_INT(5, (int)frame_count);
+	ASSERT_EQ_INT(5000 + 5 * 8, (int)encoded_size);
+	ASSERT_EQ_INT(5, (int)segmenter.frames);
+	ASSERT_EQ_INT(1, (int)segmenter.sdus);
+
+	sdlp_tc_reassembler_config_t config = {pool, 5000, contexts, 2, sdu_capture, &capture};
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_reassembler_init(&reassembler, &config));
+
+	for (size_t f = 0, offset = 0; f < frame_count; f++) {
+		size_t length = 1000 + 8;
+		sdlp_tc_frame_view_t view;
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_decode_view(&frames[offset], length, &view, 1));
+		ASSERT_EQ_INT(0x123, view.header.spacecraft_id);
+		ASSERT_EQ_INT(2, view.header.virtual_channel_id);
+		ASSERT_EQ_INT((int)f, view.header.frame_sequence_number);
+		ASSERT_EQ_INT((expected_flags[f] << 6) | 5, frames[offset + TC_PRIMARY_HEADER_SIZE]);
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_reassembler_push(&reassembler, &frames[offset], length));
+		ASSERT_EQ_INT(f < 4 ? 0 : 1, capture.sdus);
+		offset += length;
+	}
+
+	ASSERT_EQ_INT(1, capture.sdus);
+	ASSERT_EQ_INT(5, capture.map_id);
+	ASSERT_EQ_INT(5000, (int)capture.length);
+	ASSERT_EQ_MEM(sdu, capture.data, sizeof(sdu));
+	ASSERT_EQ_INT(5, (int)reassembler.stats.segments);
+
+	/* An SDU that fits in one segment is sent and delivered unsegmented. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segment_sdu(&segmenter, sdu, 10, frames, sizeof(frames), &encoded_size, NULL));
+	ASSERT_EQ_INT(18, (int)encoded_size);
+	ASSERT_EQ_INT((TC_SEQ_FLAG_NO_SEG << 6) | 5, frames[TC_PRIMARY_HEADER_SIZE]);
+	ASSERT_EQ_INT(5, frames[4]);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_reassembler_push(&reassembler, frames, encoded_size));
+	ASSERT_EQ_INT(2, capture.sdus);
+	ASSERT_EQ_INT(10, (int)capture.length);
+	ASSERT_EQ_MEM(sdu, capture.data, 10);
+	ASSERT_EQ_INT(5, (int)reassembler.stats.segments);
+
+	frames[7] ^= 0x01;
+	ASSERT_EQ_INT(SDLP_ERROR_CRC_MISMATCH, sdlp_tc_reassembler_push(&reassembler, frames, encoded_size));
+
+	return 0;
+}
+
+static int test_tc_reassembler_map_contexts(void) {
+	static uint8_t sdus[4][400];
+	static uint8_t pool[2 * 300];
+	static sdu_capture_t capture;
+	sdlp_tc_map_context_t contexts[2];
+	sdlp_tc_segmenter_t segmenters[4];
+	sdlp_tc_reassembler_t reassembler;
+	uint8_t frame[128];
+	size_t frame_size = 0;
+
+	sdlp_tc_reassembler_config_t config = {pool, 300, contexts, 2, sdu_capture, &capture};
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_reassembler_init(&reassembler, &config));
+
+	for (uint8_t m = 0; m < 3; m++) {
+		memset(sdus[m], 0x10 + m, 300);
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_init(&segmenters[m], 0x42, 1, (uint8_t)(m + 1), 100));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_start(&segmenters[m], sdus[m], 300));
+	}
+
+	/* Three MAPs interleaved, two contexts: the third MAP's SDU is dropped. */
+	for (int round = 0; round < 3; round++) {
+		for (int m = 0; m < 3; m++) {
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_next(&segmenters[m], frame, sizeof(frame), &frame_size));
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_reassembler_push(&reassembler, frame, frame_size));
+			if (round == 2 && m < 2) {
+				ASSERT_EQ_INT(m + 1, capture.map_id);
+				ASSERT_EQ_INT(300, (int)capture.length);
+				ASSERT_EQ_INT(0x10 + m, capture.data[299]);
+			}
+		}
+	}
+	ASSERT_TRUE(!sdlp_tc_segmenter_pending(&segmenters[0]));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_tc_segmenter_next(&segmenters[0], frame, sizeof(frame), &frame_size));
+	ASSERT_EQ_INT(2, capture.sdus);
+	ASSERT_EQ_INT(1, (int)reassembler.stats.no_context);
+	ASSERT_EQ_INT(2, (int)reassembler.stats.orphan_segments);
+
+	/* A new FIRST aborts the SDU in progress on the same MAP. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_start(&segmenters[0], sdus[0], 300));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_next(&segmenters[0], frame, sizeof(frame), &frame_size));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_reassembler_push(&reassembler, frame, frame_size));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_init(&segmenters[0], 0x42, 1, 1, 100));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_start(&segmenters[0], sdus[0], 300));
+	while (sdlp_tc_segmenter_pending(&segmenters[0])) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_next(&segmenters[0], frame, sizeof(frame), &frame_size));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_reassembler_push(&reassembler, frame, frame_size));
+	}
+	ASSERT_EQ_INT(1, (int)reassembler.stats.aborted_sdus);
+	ASSERT_EQ_INT(3, capture.sdus);
+
+	/* An oversize SDU is dropped whole without orphaning its tail. */
+	memset(sdus[3], 0x33, sizeof(sdus[3]));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_init(&segmenters[3], 0x42, 1, 9, 100));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_start(&segmenters[3], sdus[3], sizeof(sdus[3])));
+	while (sdlp_tc_segmenter_pending(&segmenters[3])) {
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_segmenter_next(&segmenters[3], frame, sizeof(frame), &frame_size));
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tc_reassembler_push(&reassembler, frame, frame_size));
+	}
+	ASSERT_EQ_INT(1, (int)reassembler.stats.oversize_sdus);
+	ASSERT_EQ_INT(2, (int)reassembler.stats.orphan_segments);
+	ASSERT_EQ_INT(3, capture.sdus);
+	ASSERT_EQ_INT(TC_MAP_NO_CONTEXT, reassembler.map_context[9]);
+
+	return 0;
+}
+
+static int test_clcw_encode_decode(void) {
+	sdlp_clcw_t clcw = {0};
+	sdlp_clcw_t decoded;
+	uint8_t buffer[SDLP_CLCW_SIZE];
+	const uint8_t expected[] = {0x01, 0x0C, 0x2A, 0x7F};
+
+	clcw.cop_in_effect = SDLP_COP_IN_EFFECT_COP1;
+	clcw.virtual_channel_id = 3;
+	clcw.lockout = 1;
+	clcw.retransmit = 1;
+	clcw.farm_b_counter = 1;
+	clcw.report_value = 0x7F;
+
+	ASSERT_EQ_INT(SDLP_ERROR_BUFFER_TOO_SMALL, sdlp_clcw_encode(&clcw, buffer, 3));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_clcw_encode(&clcw, buffer, sizeof(buffer)));
+	ASSERT_EQ_MEM(expected, buffer, sizeof(expected));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_clcw_decode(buffer, sizeof(buffer), &decoded));
+	ASSERT_EQ_MEM(&clcw, &decoded, sizeof(clcw));
+
+	buffer[0] |= 0x80; /* control word type 1 is not a CLCW */
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_FRAME, sdlp_clcw_decode(buffer, sizeof(buffer), &decoded));
+
+	/* Carried in the OCF of a TM frame. */
+	uint8_t tm[64];
+	size_t tm_size = 0;
+	sdlp_tm_builder_t builder;
+	sdlp_tm_frame_view_t view;
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_builder_begin(&builder, tm, sizeof(tm), 0x10, 0));
+	builder.header.ocf_flag = 1;
+	memset(builder.data, 0xAA, 20);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_clcw_encode(&clcw, &builder.data[20], SDLP_CLCW_SIZE));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_builder_commit(&builder, 24, &tm_size));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_tm_decode_view(tm, tm_size, &view, 1));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_clcw_decode_tm_view(&view, &decoded));
+	ASSERT_EQ_MEM(&clcw, &decoded, sizeof(clcw));
+
+	return 0;
+}
+
+typedef struct {
+	int frames;
+	int errors;
+	int busy;
+} cop_capture_t;
+
+static int cop_capture_frame(void *user, const sdlp_tc_frame_view_t *view) {
+	cop_capture_t *capture = (cop_capture_t *)user;
+
+	if (capture->busy) {
+		return 1;
+	}
+	if (view->data_length != 20 || view->data[0] != (uint8_t)capture->frames ||
+			view->data[19] != (uint8_t)~capture->frames) {
+		capture->errors++;
+	}
+	capture->frames++;
+	return 0;
+}
+
+static int cop_feed_back(sdlp_fop_t *fop, const sdlp_farm_t *farm, uint32_t now) {
+	sdlp_clcw_t clcw;
+
+	if (sdlp_farm_get_clcw(farm, &clcw) != SDLP_SUCCESS) {
+		return 1;
+	}
+	return sdlp_fop_process_clcw(fop, &clcw, now);
+}
+
+static int test_cop1_retransmits_lost_frames(void) {
+	static sdlp_fop_slot_t slots[8];
+	sdlp_fop_t fop;
+	sdlp_farm_t farm;
+	cop_capture_t capture = {0};
+	uint8_t fdu[20] = {0};
+	int queued = 0;
+	uint32_t now = 0;
+
+	sdlp_fop_config_t fop_config = {0x2A, 1, slots, 8, 6, 4, 100};
+	sdlp_farm_config_t farm_config = {1, 10, cop_capture_frame, &capture};
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_init(&fop, &fop_config));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_init(&farm, &farm_config));
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_fop_transfer(&fop, fdu, sizeof(fdu)));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_start(&fop));
+
+	/* Lossy link: every 7th frame on the air is dropped and a CLCW comes back
+	 * every third slot. */
+	for (int slot = 0; slot < 400 && capture.frames < 50; slot++) {
+		const uint8_t *frame;
+		size_t length;
+
+		while (queued < 50) {
+			fdu[0] = (uint8_t)queued;
+			memset(&fdu[1], 0x5A, 18);
+			fdu[19] = (uint8_t)~queued;
+			int result = sdlp_fop_transfer(&fop, fdu, sizeof(fdu));
+			if (result == SDLP_ERROR_BUFFER_TOO_SMALL) {
+				break;
+			}
+			ASSERT_EQ_INT(SDLP_SUCCESS, result);
+			queued++;
+		}
+		ASSERT_TRUE(sdlp_fop_outstanding(&fop) <= 6);
+
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, now, &frame, &length));
+		if (length && slot % 7 != 3) {
+			ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_push(&farm, frame, length));
+		}
+		if (slot % 3 == 2) {
+			ASSERT_EQ_INT(SDLP_SUCCESS, cop_feed_back(&fop, &farm, now));
+		}
+		now += 10;
+		ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_poll(&fop, now));
+	}
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, cop_feed_back(&fop, &farm, now));
+	ASSERT_EQ_INT(50, capture.frames);
+	ASSERT_EQ_INT(0, capture.errors);
+	ASSERT_EQ_INT(50, farm.vr);
+	ASSERT_EQ_INT(SDLP_FOP_ACTIVE, fop.state);
+	ASSERT_EQ_INT(0, sdlp_fop_outstanding(&fop));
+	ASSERT_EQ_INT(50, (int)fop.stats.acknowledged);
+	ASSERT_TRUE(fop.stats.retransmissions > 0);
+	ASSERT_EQ_INT(0, (int)fop.stats.alerts);
+	ASSERT_TRUE(farm.stats.discarded > 0);
+	ASSERT_EQ_INT(0, (int)farm.stats.lockouts);
+
+	return 0;
+}
+
+static int test_cop1_wait_lockout_and_recovery(void) {
+	static sdlp_fop_slot_t slots[4];
+	sdlp_fop_t fop;
+	sdlp_farm_t farm;
+	cop_capture_t capture = {0};
+	uint8_t fdu[20] = {0};
+	const uint8_t *frame;
+	size_t length;
+	sdlp_clcw_t clcw;
+
+	sdlp_fop_config_t fop_config = {0x2A, 1, slots, 4, 4, 2, 100};
+	sdlp_farm_config_t farm_config = {1, 10, cop_capture_frame, &capture};
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_init(&fop, &fop_config));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_init(&farm, &farm_config));
+
+	/* FARM out of buffers: WAIT, then retransmission after release. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_start(&fop));
+	fdu[19] = 0xFF;
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_transfer(&fop, fdu, sizeof(fdu)));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 0, &frame, &length));
+	capture.busy = 1;
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_push(&farm, frame, length));
+	ASSERT_EQ_INT(SDLP_FARM_WAIT, farm.state);
+	ASSERT_EQ_INT(SDLP_SUCCESS, cop_feed_back(&fop, &farm, 1));
+	ASSERT_EQ_INT(SDLP_FOP_RETRANSMIT_WITH_WAIT, fop.state);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 2, &frame, &length));
+	ASSERT_EQ_INT(0, (int)length);
+
+	capture.busy = 0;
+	sdlp_farm_buffer_release(&farm);
+	ASSERT_EQ_INT(SDLP_SUCCESS, cop_feed_back(&fop, &farm, 3));
+	ASSERT_EQ_INT(SDLP_FOP_RETRANSMIT_WITHOUT_WAIT, fop.state);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 4, &frame, &length));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_push(&farm, frame, length));
+	ASSERT_EQ_INT(1, capture.frames);
+	ASSERT_EQ_INT(SDLP_SUCCESS, cop_feed_back(&fop, &farm, 5));
+	ASSERT_EQ_INT(SDLP_FOP_ACTIVE, fop.state);
+	ASSERT_EQ_INT(1, (int)fop.stats.retransmissions);
+
+	/* A frame far outside the window locks the FARM out; FOP alerts. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_start_set_vr(&fop, 100));
+	ASSERT_EQ_INT(SDLP_FOP_INITIALIZING, fop.state);
+	ASSERT_EQ_INT(SDLP_ERROR_INVALID_PARAM, sdlp_fop_transfer(&fop, fdu, sizeof(fdu)));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_start(&fop));
+	fdu[0] = 1;
+	fdu[19] = 0xFE;
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_transfer(&fop, fdu, sizeof(fdu)));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 10, &frame, &length));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_push(&farm, frame, length));
+	ASSERT_EQ_INT(SDLP_FARM_LOCKOUT, farm.state);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_get_clcw(&farm, &clcw));
+	ASSERT_EQ_INT(1, clcw.lockout);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_process_clcw(&fop, &clcw, 11));
+	ASSERT_EQ_INT(SDLP_FOP_INITIAL, fop.state);
+	ASSERT_EQ_INT(SDLP_FOP_ALERT_LOCKOUT, fop.alert);
+
+	/* Unlock, then Set V(R) to resynchronise both ends. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_start_unlock(&fop));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 20, &frame, &length));
+	ASSERT_EQ_INT(TC_PRIMARY_HEADER_SIZE + 1 + TC_FRAME_ERROR_CONTROL_SIZE, (int)length);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_push(&farm, frame, length));
+	ASSERT_EQ_INT(SDLP_FARM_OPEN, farm.state);
+	ASSERT_EQ_INT(SDLP_SUCCESS, cop_feed_back(&fop, &farm, 21));
+	ASSERT_EQ_INT(SDLP_FOP_ACTIVE, fop.state);
+	ASSERT_EQ_INT(1, fop.vs);
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_start_set_vr(&fop, 100));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 30, &frame, &length));
+	/* The Set V(R) frame is lost; T1 sends it again. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_poll(&fop, 130));
+	ASSERT_EQ_INT(1, (int)fop.stats.timeouts);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 130, &frame, &length));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_push(&farm, frame, length));
+	ASSERT_EQ_INT(100, farm.vr);
+	ASSERT_EQ_INT(2, farm.farm_b_counter);
+	ASSERT_EQ_INT(SDLP_SUCCESS, cop_feed_back(&fop, &farm, 131));
+	ASSERT_EQ_INT(SDLP_FOP_ACTIVE, fop.state);
+
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_transfer(&fop, fdu, sizeof(fdu)));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 140, &frame, &length));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_farm_push(&farm, frame, length));
+	ASSERT_EQ_INT(2, capture.frames);
+	ASSERT_EQ_INT(101, farm.vr);
+
+	/* No CLCW at all: the transmission limit raises an alert. */
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_transfer(&fop, fdu, sizeof(fdu)));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 150, &frame, &length));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_poll(&fop, 250));
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_next_frame(&fop, 250, &frame, &length));
+	ASSERT_TRUE(length > 0);
+	ASSERT_EQ_INT(SDLP_SUCCESS, sdlp_fop_poll(&fop, 350));
+	ASSERT_EQ_INT(SDLP_FOP_INITIAL, fop.state);
+	ASSERT_EQ_INT(SDLP_FOP_ALERT_LIMIT, fop.alert);
+
+	return 0;
+}
+
 int main(void) {
 	RUN_TEST(test_crc16_known_vector);
+	RUN_TEST(test_crc16_matches_reference);
+	RUN_TEST(test_crc16_streaming_matches_one_shot);
+	RUN_TEST(test_crc16_random_lengths_and_alignments);
+	RUN_TEST(test_crc16_combine_matches_sequential);
+	RUN_TEST(test_crc16_copy_matches_update);
 	RUN_TEST(test_tm_create_frame_invalid_params);
 	RUN_TEST(test_tm_encode_decode_roundtrip);
 	RUN_TEST(test_tm_encode_buffer_too_small);
 	RUN_TEST(test_tm_decode_crc_mismatch);
+	RUN_TEST(test_tm_decode_view_zero_copy);
+	RUN_TEST(test_tm_builder_matches_encode);
+	RUN_TEST(test_tm_encode_iov_matches_encode);
+	RUN_TEST(test_tm_fixed_matches_encode);
+	RUN_TEST(test_tm_decode_batch);
+	RUN_TEST(test_tm_channel_context_counters);
+	RUN_TEST(test_tm_template_patch_matches_encode);
+	RUN_TEST(test_peek_header_and_filter);
+	RUN_TEST(test_stats_counts_link_events);
+	RUN_TEST(test_stats_tracks_spacecraft_separately);
+	RUN_TEST(test_randomizer_sequence);
+	RUN_TEST(test_tm_randomized_encode_decode);
+	RUN_TEST(test_rs_encode_decode_roundtrip);
+	RUN_TEST(test_rs_dual_basis_matches_conventional);
+	RUN_TEST(test_sync_bit_slipped_inverted_stream);
+	RUN_TEST(test_sync_flywheel_and_lock_loss);
+	RUN_TEST(test_packet_extractor_spanning_packets);
+	RUN_TEST(test_packet_extractor_frame_gap_resync);
+	RUN_TEST(test_mux_packs_packets_and_idle_frames);
+	RUN_TEST(test_mux_weighted_round_robin);
+	RUN_TEST(test_frame_pool_acquire_release);
 	RUN_TEST(test_tc_create_frame_invalid_params);
 	RUN_TEST(test_tc_encode_decode_roundtrip);
 	RUN_TEST(test_tc_encode_buffer_too_small);
 	RUN_TEST(test_tc_decode_crc_mismatch);
+	RUN_TEST(test_tc_decode_view_zero_copy);
+	RUN_TEST(test_tc_builder_matches_encode);
+	RUN_TEST(test_tc_encode_iov_matches_encode);
+	RUN_TEST(test_tc_decode_batch);
+	RUN_TEST(test_tc_segment_reassemble_roundtrip);
+	RUN_TEST(test_tc_reassembler_map_contexts);
+	RUN_TEST(test_clcw_encode_decode);
+	RUN_TEST(test_cop1_retransmits_lost_frames);
+	RUN_TEST(test_cop1_wait_lockout_and_recovery);
 
 	if (cunit_overall_failures) {
 		printf("\nTotal failures: %d\n", cunit_overall_failures);
@@ -0,0 +1,361 @@
+/* Replay a TM capture file through the decoder.
+ * The capture is mapped, not read: every frame is decoded in place with the
+ * batch decoder (or derandomized in a private copy-on-write mapping with -r).
+ * Reports per SCID/VC frame counts, CRC failures and frame count gaps, and the
+ * decode throughput, timed apart from the -o writes of each VC's data field to
+ * its own file.
+ *
+ * Record layout: [length prefix, -p][skipped bytes, -s][transfer frame].
+ * The prefix is big-endian and holds the transfer frame length only. */
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "sdlp_randomizer.h"
+#include "sdlp_tm.h"
+
+#define REPLAY_SCIDS 1024u
+#define REPLAY_CHANNELS (REPLAY_SCIDS * TM_MAX_VIRTUAL_CHANNELS)
+#define REPLAY_BURST 64u
+#define REPLAY_PATH_MAX 4096
+
+typedef struct {
+    uint64_t frames;
+    uint64_t crc_errors;
+    uint64_t gaps;
+    uint64_t lost; /* frames missing according to the counts */
+    uint8_t last_count;
+    uint8_t seen;
+} replay_counter_t;
+
+typedef struct {
+    size_t frame_length; /* -l; 0 with a length prefix */
+    size_t prefix;       /* -p: 0, 2 or 4 bytes */
+    size_t skip;         /* -s */
+    int randomized;      /* -r */
+    const char *split_dir; /* -o */
+} replay_options_t;
+
+typedef struct {
+    replay_options_t options;
+    uint64_t frames;
+    uint64_t good;
+    uint64_t crc_errors;
+    uint64_t invalid;
+    size_t trailing; /* bytes after the last complete record */
+    double decode_seconds; /* locating and decoding frames, split writes excluded */
+    replay_counter_t vc[REPLAY_CHANNELS];
+    replay_counter_t mc[REPLAY_SCIDS];
+    FILE *split[REPLAY_CHANNELS];
+} replay_t;
+
+static void usage(const char *program) {
+    fprintf(stderr,
+            "usage: %s (-l LENGTH | -p WIDTH) [-s BYTES] [-r] [-o DIR] CAPTURE\n"
+            "  -l LENGTH  fixed transfer frame length in bytes\n"
+            "  -p WIDTH   each record starts with a big-endian frame length of 2 or 4 bytes\n"
+            "  -s BYTES   skip BYTES before each frame (e.g. 4 for an attached ASM)\n"
+            "  -r         frames are pseudo-randomized\n"
+            "  -o DIR     write the data field of good frames to DIR/scid<SCID>_vc<VC>.bin\n",
+            program);
+}
+
+static int parse_size(const char *text, size_t *value) {
+    char *end;
+    unsigned long long parsed = strtoull(text, &end, 0);
+
+    if (*text == '\0' || *end != '\0' || parsed > SIZE_MAX) {
+        return 0;
+    }
+
+    *value = (size_t)parsed;
+    return 1;
+}
+
+/* Step a MC or VC frame count: 8-bit, wraps, so a gap is any other step than +1. */
+static void count_frame(replay_counter_t *counter, uint8_t count) {
+    if (counter->seen) {
+        uint8_t expected = (uint8_t)(counter->last_count + 1u);
+
+        if (count != expected) {
+            counter->gaps++;
+            counter->lost += (uint8_t)(count - expected);
+        }
+    }
+
+    counter->seen = 1;
+    counter->last_count = count;
+    counter->frames++;
+}
+
+static int split_write(replay_t *replay, size_t channel, const sdlp_tm_frame_view_t *view) {
+    if (!replay->split[channel]) {
+        char path[REPLAY_PATH_MAX];
+
+        snprintf(path, sizeof(path), "%s/scid%03X_vc%u.bin", replay->options.split_dir,
+                 (unsigned)view->header.spacecraft_id, (unsigned)view->header.virtual_channel_id);
+        replay->split[channel] = fopen(path, "wb");
+
+        if (!replay->split[channel]) {
+            perror(path);
+            return 0;
+        }
+    }
+
+    return fwrite(view->data, 1, view->data_length, replay->split[channel]) == view->data_length;
+}
+
+static int account(replay_t *replay, const sdlp_tm_frame_view_t *view, int result) {
+    replay->frames++;
+
+    if (result == SDLP_ERROR_CRC_MISMATCH) {
+        /* The header may be the damaged part; charge the channel it names
+         * but leave the counts alone. */
+        replay->crc_errors++;
+        replay->vc[(size_t)view->header.spacecraft_id * TM_MAX_VIRTUAL_CHANNELS +
+                   view->header.virtual_channel_id].crc_errors++;
+        return 1;
+    }
+
+    if (result != SDLP_SUCCESS) {
+        replay->invalid++;
+        return 1;
+    }
+
+    size_t channel = (size_t)view->header.spacecraft_id * TM_MAX_VIRTUAL_CHANNELS +
+                     view->header.virtual_channel_id;
+
+    replay->good++;
+    count_frame(&replay->mc[view->header.spacecraft_id], view->header.master_channel_frame_count);
+    count_frame(&replay->vc[channel], view->header.virtual_channel_frame_count);
+
+    return !replay->options.split_dir || split_write(replay, channel, view);
+}
+
+/* Locate the next frame at *offset; 0 at the end of the capture. */
+static int next_frame(replay_t *replay, uint8_t *capture, size_t size, size_t *offset,
+                      uint8_t **frame, size_t *length) {
+    size_t remaining = size - *offset;
+    size_t header = replay->options.prefix + replay->options.skip;
+    size_t frame_length = replay->options.frame_length;
+
+    if (remaining < header) {
+        return 0;
+    }
+
+    if (replay->options.prefix) {
+        const uint8_t *prefix = &capture[*offset];
+
+        frame_length = 0;
+        for (size_t i = 0; i < replay->options.prefix; i++) {
+            frame_length = (frame_length << 8) | prefix[i];
+        }
+    }
+
+    if (remaining - header < frame_length) {
+        return 0;
+    }
+
+    *frame = &capture[*offset + header];
+    *length = frame_length;
+    *offset += header + frame_length;
+    return 1;
+}
+
+static double elapsed(const struct timespec *start, const struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) + (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static int replay_capture(replay_t *replay, uint8_t *capture, size_t size) {
+    sdlp_frame_desc_t frames[REPLAY_BURST];
+    sdlp_tm_frame_view_t views[REPLAY_BURST];
+    int results[REPLAY_BURST];
+    size_t offset = 0;
+    int more = 1;
+
+    while (more) {
+        struct timespec start, end;
+        size_t count = 0;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        while (count < REPLAY_BURST) {
+            uint8_t *frame;
+            size_t length;
+
+            if (!(more = next_frame(replay, capture, size, &offset, &frame, &length))) {
+                break;
+            }
+
+            if (replay->options.randomized) {
+                results[count] = sdlp_tm_decode_view_randomized(frame, length, &views[count]);
+            }
+            frames[count].buffer = frame;
+            frames[count].length = length;
+            count++;
+        }
+
+        if (!replay->options.randomized) {
+            sdlp_tm_decode_batch(frames, count, views, results);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        replay->decode_seconds += elapsed(&start, &end);
+
+        for (size_t i = 0; i < count; i++) {
+            if (!account(replay, &views[i], results[i])) {
+                return 0;
+            }
+        }
+    }
+
+    replay->trailing = size - offset;
+    return 1;
+}
+
+static void report(const replay_t *replay, const char *path, size_t size, double total_seconds) {
+    double seconds = replay->decode_seconds;
+
+    printf("capture     %s, %zu bytes\n", path, size);
+    printf("frames      %llu (good %llu, crc errors %llu, invalid %llu)\n",
+           (unsigned long long)replay->frames, (unsigned long long)replay->good,
+           (unsigned long long)replay->crc_errors, (unsigned long long)replay->invalid);
+    if (replay->trailing) {
+        printf("trailing    %zu bytes (incomplete record)\n", replay->trailing);
+    }
+    if (seconds > 0) {
+        printf("throughput  %.1f MB/s, %.0f frames/s decoding (%.3f s; %.3f s end to end)\n",
+               (double)size / seconds / 1e6, (double)replay->frames / seconds, seconds,
+               total_seconds);
+    }
+
+    printf("\n%-6s %-3s %12s %10s %8s %10s\n", "SCID", "VC", "frames", "crc_err", "gaps", "lost");
+    for (size_t scid = 0; scid < REPLAY_SCIDS; scid++) {
+        const replay_counter_t *mc = &replay->mc[scid];
+        int listed = 0;
+
+        for (size_t vc = 0; vc < TM_MAX_VIRTUAL_CHANNELS; vc++) {
+            const replay_counter_t *counter = &replay->vc[scid * TM_MAX_VIRTUAL_CHANNELS + vc];
+
+            if (!counter->frames && !counter->crc_errors) {
+                continue;
+            }
+            printf("0x%03zX  %-3zu %12llu %10llu %8llu %10llu\n", scid, vc,
+                   (unsigned long long)counter->frames, (unsigned long long)counter->crc_errors,
+                   (unsigned long long)counter->gaps, (unsigned long long)counter->lost);
+            listed = 1;
+        }
+
+        if (mc->frames) {
+            printf("0x%03zX  %-3s %12llu %10s %8llu %10llu\n", scid, "MC",
+                   (unsigned long long)mc->frames, "", (unsigned long long)mc->gaps,
+                   (unsigned long long)mc->lost);
+        } else if (listed) {
+            printf("0x%03zX  %-3s %12s\n", scid, "MC", "0");
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    static replay_t replay;
+    replay_options_t *options = &replay.options;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "l:p:s:ro:")) != -1) {
+        switch (opt) {
+        case 'l':
+            if (!parse_size(optarg, &options->frame_length)) {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+        case 'p':
+            if (!parse_size(optarg, &options->prefix) ||
+                (options->prefix != 2 && options->prefix != 4)) {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+        case 's':
+            if (!parse_size(optarg, &options->skip)) {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+        case 'r':
+            options->randomized = 1;
+            break;
+        case 'o':
+            options->split_dir = optarg;
+            break;
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (optind != argc - 1 || (options->frame_length == 0) == (options->prefix == 0)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    const char *path = argv[optind];
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        perror(path);
+        return 1;
+    }
+
+    size_t size = (size_t)st.st_size;
+    uint8_t *capture = NULL;
+
+    if (size > 0) {
+        /* Derandomizing writes into the frames: map them private so the pages
+         * touched become copies and the file is left as it was. */
+        int prot = options->randomized ? PROT_READ | PROT_WRITE : PROT_READ;
+        void *map = mmap(NULL, size, prot, MAP_PRIVATE, fd, 0);
+
+        if (map == MAP_FAILED) {
+            perror("mmap");
+            close(fd);
+            return 1;
+        }
+        capture = map;
+        posix_madvise(map, size, POSIX_MADV_SEQUENTIAL);
+    }
+    close(fd);
+
+    struct timespec start, end;
+    int ok;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    ok = capture ? replay_capture(&replay, capture, size) : 1;
+
+    for (size_t i = 0; i < REPLAY_CHANNELS; i++) {
+        if (replay.split[i] && fclose(replay.split[i]) != 0) {
+            ok = 0;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (capture) {
+        munmap(capture, size);
+    }
+
+    if (!ok) {
+        fprintf(stderr, "%s: writing the split streams failed\n", argv[0]);
+        return 1;
+    }
+
+    report(&replay, path, size, elapsed(&start, &end));
+
+    return replay.crc_errors || replay.invalid ? 3 : 0;
+}